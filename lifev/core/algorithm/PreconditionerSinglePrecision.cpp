@@ -0,0 +1,211 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Single precision preconditioner
+
+    @date 10-2026
+ */
+
+#include <Epetra_Vector.h>
+
+#include <lifev/core/LifeV.hpp>
+#include "PreconditionerSinglePrecision.hpp"
+
+namespace LifeV
+{
+
+// ===================================================
+// Constructors & Destructor
+// ===================================================
+PreconditionerSinglePrecision::PreconditionerSinglePrecision ( std::shared_ptr<Epetra_Comm> comm ) :
+    super (),
+    M_preconditioner(),
+    M_comm ( comm )
+{
+
+}
+
+PreconditionerSinglePrecision::~PreconditionerSinglePrecision()
+{
+
+}
+
+
+// ===================================================
+// Methods
+// ===================================================
+Int
+PreconditionerSinglePrecision::buildPreconditioner ( operator_type& matrix )
+{
+    const Real absoluteThreshold ( this->M_list.get ( "fact: absolute threshold", 0. ) );
+    const Real relativeThreshold ( this->M_list.get ( "fact: relative threshold", 1. ) );
+
+    M_preconditioner.reset ( new prec_raw_type() );
+    M_preconditioner->setUp ( *matrix->matrixPtr(), absoluteThreshold, relativeThreshold );
+
+    M_precType = "ILU0_SinglePrecision";
+
+    this->M_preconditionerCreated = true;
+
+    return ( EXIT_SUCCESS );
+}
+
+void
+PreconditionerSinglePrecision::resetPreconditioner()
+{
+    M_preconditioner.reset();
+
+    this->M_preconditionerCreated = false;
+}
+
+void
+PreconditionerSinglePrecision::createParametersList ( list_Type&         list,
+                                                      const GetPot&      dataFile,
+                                                      const std::string& section,
+                                                      const std::string& subSection )
+{
+    createSinglePrecisionList ( list, dataFile, section, subSection, M_comm->MyPID() == 0 );
+}
+
+void
+PreconditionerSinglePrecision::createSinglePrecisionList ( list_Type&         list,
+                                                           const GetPot&      dataFile,
+                                                           const std::string& section,
+                                                           const std::string& subSection,
+                                                           const bool&        verbose )
+{
+    bool displayList = dataFile ( (section + "/displayList").data(), false );
+
+    Real athr = dataFile ( (section + "/" + subSection + "/fact/absolute_threshold").data(), 0. );
+    Real rthr = dataFile ( (section + "/" + subSection + "/fact/relative_threshold").data(), 1. );
+
+    list.set ( "fact: absolute threshold", athr );
+    list.set ( "fact: relative threshold", rthr );
+
+    if ( displayList && verbose )
+    {
+        std::cout << "SinglePrecision parameters list:" << std::endl;
+        std::cout << "-----------------------------" << std::endl;
+        list.print ( std::cout );
+        std::cout << "-----------------------------" << std::endl;
+    }
+}
+
+Int
+PreconditionerSinglePrecision::ApplyInverse ( const Epetra_MultiVector& vector1, Epetra_MultiVector& vector2 ) const
+{
+    return M_preconditioner->ApplyInverse ( vector1, vector2 );
+}
+
+Int
+PreconditionerSinglePrecision::Apply ( const Epetra_MultiVector& vector1, Epetra_MultiVector& vector2 ) const
+{
+    return M_preconditioner->Apply ( vector1, vector2 );
+}
+
+void
+PreconditionerSinglePrecision::showMe ( std::ostream& output ) const
+{
+    output << "PreconditionerSinglePrecision: ILU(0) of the local blocks in single precision";
+    if ( M_preconditioner )
+    {
+        output << ", " << M_preconditioner->factorsBytes() << " bytes on this process";
+    }
+    output << std::endl;
+}
+
+// ===================================================
+// Set Methods
+// ===================================================
+void
+PreconditionerSinglePrecision::setDataFromGetPot ( const GetPot&      dataFile,
+                                                   const std::string& section )
+{
+    createSinglePrecisionList ( this->M_list, dataFile, section, "singleprecision", M_comm->MyPID() == 0 );
+}
+
+Int
+PreconditionerSinglePrecision::SetUseTranspose ( bool useTranspose )
+{
+    return M_preconditioner->SetUseTranspose ( useTranspose );
+}
+
+// ===================================================
+// Get Methods
+// ===================================================
+Real
+PreconditionerSinglePrecision::condest()
+{
+    // Same estimate as Ifpack: the largest entry of the preconditioner applied to a vector of ones
+    Epetra_Vector ones ( M_preconditioner->OperatorDomainMap() );
+    Epetra_Vector result ( M_preconditioner->OperatorRangeMap() );
+    ones.PutScalar ( 1. );
+    M_preconditioner->ApplyInverse ( ones, result );
+
+    Real condest ( 0. );
+    result.NormInf ( &condest );
+    return condest;
+}
+
+Preconditioner::prec_raw_type*
+PreconditionerSinglePrecision::preconditioner()
+{
+    return M_preconditioner.get();
+}
+
+PreconditionerSinglePrecision::super::prec_type
+PreconditionerSinglePrecision::preconditionerPtr()
+{
+    return M_preconditioner;
+}
+
+std::string
+PreconditionerSinglePrecision::preconditionerType()
+{
+    return M_precType;
+}
+
+bool
+PreconditionerSinglePrecision::UseTranspose()
+{
+    return M_preconditioner->UseTranspose();
+}
+
+const Epetra_Map&
+PreconditionerSinglePrecision::OperatorRangeMap() const
+{
+    return M_preconditioner->OperatorRangeMap();
+}
+
+const Epetra_Map&
+PreconditionerSinglePrecision::OperatorDomainMap() const
+{
+    return M_preconditioner->OperatorDomainMap();
+}
+
+} // namespace LifeV
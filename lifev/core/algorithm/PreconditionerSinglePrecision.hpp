@@ -0,0 +1,214 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Single precision preconditioner
+
+    @date 10-2026
+ */
+
+#ifndef _PRECONDITIONERSINGLEPRECISION_HPP_
+#define _PRECONDITIONERSINGLEPRECISION_HPP_
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/filter/GetPot.hpp>
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/algorithm/Preconditioner.hpp>
+#include <lifev/core/operator/SinglePrecisionILU.hpp>
+
+namespace LifeV
+{
+
+//! PreconditionerSinglePrecision - Block Jacobi ILU(0) preconditioner applied in single precision
+/*!
+  The factors of the local blocks are stored as floats (see Operators::SinglePrecisionILU),
+  the Krylov solver keeps working with double precision vectors. It can be used directly,
+  or as the preconditioner of an inner solver through PreconditionerLinearSolver.
+
+  Data file parameters, in the subsection "singleprecision":
+  <ul>
+  <li> fact/absolute_threshold, fact/relative_threshold: perturbation of the diagonal, as for Ifpack
+  </ul>
+*/
+class PreconditionerSinglePrecision:
+    public Preconditioner
+{
+public:
+
+    //! @name Public Types
+    //@{
+
+    typedef Preconditioner                         super;
+
+    typedef Operators::SinglePrecisionILU          prec_raw_type;
+    typedef std::shared_ptr<prec_raw_type>       prec_type;
+
+    typedef super::operator_raw_type               operator_raw_type;
+    typedef super::operator_type                   operator_type;
+
+    //@}
+
+
+    //! @name Constructors & Destructor
+    //@{
+
+    //! Empty constructor
+#ifdef HAVE_MPI
+    PreconditionerSinglePrecision ( std::shared_ptr<Epetra_Comm> comm = std::shared_ptr<Epetra_Comm> ( new Epetra_MpiComm ( MPI_COMM_WORLD ) ) );
+#else
+    PreconditionerSinglePrecision ( std::shared_ptr<Epetra_Comm> comm = std::shared_ptr<Epetra_Comm> ( new Epetra_SerialComm ) );
+#endif
+
+    //! Destructor
+    virtual ~PreconditionerSinglePrecision();
+
+    //@}
+
+
+    //! @name Methods
+    //@{
+
+    //! Build a preconditioner based on the given matrix
+    /*!
+      @param matrix Matrix upon which construct the preconditioner
+     */
+    Int buildPreconditioner ( operator_type& matrix );
+
+    //! Reset the preconditioner
+    void resetPreconditioner();
+
+    //! Create the list of parameters of the preconditioner
+    /*!
+      @param list A Parameter list to be filled
+      @param dataFile A GetPot object containing the data about the preconditioner
+      @param section The section in "dataFile" where to find data about the preconditioner
+      @param subSection The subsection in "dataFile" where to find data about the preconditioner
+     */
+    virtual void createParametersList ( list_Type&         list,
+                                        const GetPot&      dataFile,
+                                        const std::string& section,
+                                        const std::string& subSection );
+
+    //! Create the list of parameters of the preconditioner
+    /*!
+      @param list A Parameter list to be filled
+      @param dataFile A GetPot object containing the data about the preconditioner
+      @param section The section in "dataFile" where to find data about the preconditioner
+      @param subSection The subsection in "dataFile" where to find data about the preconditioner
+     */
+    static void createSinglePrecisionList ( list_Type&         list,
+                                            const GetPot&      dataFile,
+                                            const std::string& section,
+                                            const std::string& subSection = "singleprecision",
+                                            const bool&        verbose = true );
+
+    //! Apply the inverse of the preconditioner on vector1 and store the result in vector2
+    /*!
+      @param vector1 Vector to which we apply the preconditioner
+      @param vector2 Vector to the store the result
+     */
+    virtual Int ApplyInverse ( const Epetra_MultiVector& vector1, Epetra_MultiVector& vector2 ) const;
+
+    //! Apply the inverse of the preconditioner on vector1 and store the result in vector2
+    /*!
+      @param vector1 Vector to which we apply the preconditioner
+      @param vector2 Vector to the store the result
+     */
+    virtual Int Apply ( const Epetra_MultiVector& vector1, Epetra_MultiVector& vector2 ) const;
+
+    //! Show informations about the preconditioner
+    virtual void showMe ( std::ostream& output = std::cout ) const;
+
+    //@}
+
+
+    //! @name Set Methods
+    //@{
+
+    //! Set the data of the preconditioner using a GetPot object
+    /*!
+      @param dataFile A GetPot object containing the data about the preconditioner
+      @param section The section in "dataFile" where to find data about the preconditioner
+     */
+    void setDataFromGetPot ( const GetPot&      dataFile,
+                             const std::string& section );
+
+    //! Set the matrix to be used transposed (or not)
+    /*!
+      @param useTranspose If true the preconditioner is transposed
+     */
+    Int SetUseTranspose ( bool useTranspose = false );
+
+    //@}
+
+
+    //! @name Get Methods
+    //@{
+
+    //! Return an estimation of the condition number of the preconditioner
+    Real condest ();
+
+    //! Return a raw pointer on the preconditioner
+    super::prec_raw_type* preconditioner();
+
+    //! Return a shared pointer on the preconditioner
+    super::prec_type preconditionerPtr();
+
+    //! Return the type of preconditioner
+    std::string preconditionerType();
+
+    //! Return true if the preconditioner is transposed
+    bool UseTranspose();
+
+    //! Return the Range map of the operator
+    const Epetra_Map& OperatorRangeMap() const;
+
+    //! Return the Domain map of the operator
+    const Epetra_Map& OperatorDomainMap() const;
+
+    //@}
+
+private:
+
+    prec_type M_preconditioner;
+    std::shared_ptr<Epetra_Comm> M_comm;
+};
+
+
+inline Preconditioner* createSinglePrecision()
+{
+    return new PreconditionerSinglePrecision();
+}
+namespace
+{
+static bool registerSP = PRECFactory::instance().registerProduct ( "SinglePrecision", &createSinglePrecision );
+}
+
+} // namespace LifeV
+
+#endif
@@ -50,6 +50,9 @@ SolverAmesos::SolverAmesos ( const commPtr_Type& comm ) :
     M_matrix               (),
     M_problem              (),
     M_solver               (),
+    M_symbolicFactorizationDone ( false ),
+    M_numericFactorizationDone ( false ),
+    M_reuseFactorization   ( false ),
     M_trilinosParameterList(),
     M_displayer            ( comm )
 {
@@ -149,6 +152,40 @@ void SolverAmesos::resetPreconditioner()
 
 }
 
+void SolverAmesos::resetFactorization()
+{
+    M_symbolicFactorizationDone = false;
+    M_numericFactorizationDone  = false;
+    M_patternRowMap.reset();
+    M_patternRowPointers.clear();
+    M_patternColumnIds.clear();
+}
+
+Int SolverAmesos::symbolicFactorization()
+{
+    ASSERT ( M_matrix.get() != 0, "SolverAmesos::symbolicFactorization: the matrix has not been set" );
+
+    M_numericFactorizationDone = false;
+    AMESOS_CHK_ERR ( M_solver->SymbolicFactorization() );
+    storePattern ( *M_matrix );
+    M_symbolicFactorizationDone = true;
+
+    return 0;
+}
+
+Int SolverAmesos::numericFactorization()
+{
+    if ( !M_symbolicFactorizationDone )
+    {
+        AMESOS_CHK_ERR ( symbolicFactorization() );
+    }
+
+    AMESOS_CHK_ERR ( M_solver->NumericFactorization() );
+    M_numericFactorizationDone = true;
+
+    return 0;
+}
+
 void SolverAmesos::setupPreconditioner ( const GetPot& /*dataFile*/, const std::string& /*section*/ )
 {
 
@@ -159,6 +196,11 @@ void SolverAmesos::setReusePreconditioner ( const bool& /*reusePreconditioner*/
 
 }
 
+void SolverAmesos::setReuseFactorization ( const bool& reuseFactorization )
+{
+    M_reuseFactorization = reuseFactorization;
+}
+
 void SolverAmesos::showMe ( std::ostream& output ) const
 {
     M_trilinosParameterList.print ( output );
@@ -169,14 +211,24 @@ void SolverAmesos::showMe ( std::ostream& output ) const
 // ===================================================
 Int SolverAmesos::setMatrix ( const matrix_type& matrix )
 {
+    // The user guarantees that the factorized matrix has not changed (see setReuseFactorization())
+    if ( M_reuseFactorization && M_numericFactorizationDone )
+    {
+        return 0;
+    }
+
     M_matrix = matrix.matrixPtr();
     M_problem.SetOperator ( M_matrix.get() );
 
-    // After setting the matrix we can perform symbolic & numeric factorization
-    AMESOS_CHK_ERR ( M_solver->SymbolicFactorization() );
-    AMESOS_CHK_ERR ( M_solver->NumericFactorization() );
+    // After setting the matrix we can perform symbolic & numeric factorization;
+    // the symbolic one is kept as long as the pattern does not change
+    if ( !M_symbolicFactorizationDone || !samePattern ( *M_matrix ) )
+    {
+        M_symbolicFactorizationDone = false;
+        AMESOS_CHK_ERR ( symbolicFactorization() );
+    }
 
-    return 0;
+    return numericFactorization();
 }
 
 void SolverAmesos::setOperator ( const Epetra_Operator& /*oper*/ )
@@ -259,5 +311,63 @@ void SolverAmesos::createSolver ( const std::string& solverType )
     }
 }
 
+bool SolverAmesos::samePattern ( const Epetra_CrsMatrix& matrix ) const
+{
+    if ( !M_patternRowMap || !matrix.Filled() || !matrix.RowMap().SameAs ( *M_patternRowMap ) )
+    {
+        return false;
+    }
+
+    Int localSame ( static_cast<Int> ( M_patternRowPointers.back() ) == matrix.NumMyNonzeros() );
+
+    Int numEntries;
+    Int* indices;
+    for ( Int row ( 0 ); localSame && row < matrix.NumMyRows(); ++row )
+    {
+        matrix.Graph().ExtractMyRowView ( row, numEntries, indices );
+        if ( numEntries != M_patternRowPointers[row + 1] - M_patternRowPointers[row] )
+        {
+            localSame = 0;
+            break;
+        }
+        for ( Int entry ( 0 ); entry < numEntries; ++entry )
+            if ( matrix.GCID ( indices[entry] ) != M_patternColumnIds[M_patternRowPointers[row] + entry] )
+            {
+                localSame = 0;
+                break;
+            }
+    }
+
+    Int globalSame;
+    matrix.Comm().MinAll ( &localSame, &globalSame, 1 );
+
+    return globalSame == 1;
+}
+
+void SolverAmesos::storePattern ( const Epetra_CrsMatrix& matrix )
+{
+    if ( !matrix.Filled() )
+    {
+        M_patternRowMap.reset();
+        return;
+    }
+
+    M_patternRowMap.reset ( new Epetra_BlockMap ( matrix.RowMap() ) );
+    M_patternRowPointers.assign ( matrix.NumMyRows() + 1, 0 );
+    M_patternColumnIds.resize ( matrix.NumMyNonzeros() );
+
+    Int numEntries;
+    Int* indices;
+    for ( Int row ( 0 ); row < matrix.NumMyRows(); ++row )
+    {
+        matrix.Graph().ExtractMyRowView ( row, numEntries, indices );
+        M_patternRowPointers[row + 1] = M_patternRowPointers[row] + numEntries;
+        for ( Int entry ( 0 ); entry < numEntries; ++entry )
+        {
+            M_patternColumnIds[M_patternRowPointers[row] + entry] = matrix.GCID ( indices[entry] );
+        }
+    }
+}
+
 } // namespace LifeV
 
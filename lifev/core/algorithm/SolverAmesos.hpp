@@ -133,10 +133,31 @@ public:
 
     //! Delete the stored preconditioner
     /*!
-      Note: This method is empty
+      Note: This method is empty, the factorization is deleted by resetFactorization()
      */
     void resetPreconditioner();
 
+    //! Delete the stored factorization
+    /*!
+      The next call to setMatrix() performs again both the symbolic and the numeric factorization.
+      It must be called when the values of a matrix whose factorization is reused have changed.
+     */
+    void resetFactorization();
+
+    //! Perform the symbolic factorization of the matrix set with setMatrix()
+    /*!
+      The symbolic analysis depends only on the sparsity pattern of the matrix.
+      @return Amesos error code
+     */
+    Int symbolicFactorization();
+
+    //! Perform the numeric factorization of the matrix set with setMatrix()
+    /*!
+      The symbolic factorization is computed first if needed.
+      @return Amesos error code
+     */
+    Int numericFactorization();
+
     //! Setup the preconditioner
     /*!
       Note: This method is empty
@@ -147,11 +168,20 @@ public:
 
     //! Specify if the preconditioner should be reuse or not
     /*!
-      Note: This method is empty
+      Note: This method is empty, the reuse of the factorization is set by setReuseFactorization()
       @param reusePreconditioner If set to true, do not recompute the preconditioner
      */
     void setReusePreconditioner ( const bool& /*reusePreconditioner*/ );
 
+    //! Specify if the factorization should be reused or not
+    /*!
+      If set to true, setMatrix() keeps the current factors, whatever matrix it receives,
+      until resetFactorization() is called: use it only for matrices whose values do not
+      change, since neither the values nor the address of the matrix are checked.
+      @param reuseFactorization If set to true, do not recompute the factorization
+     */
+    void setReuseFactorization ( const bool& reuseFactorization );
+
     //! Print informations about the solver
     void showMe ( std::ostream& output = std::cout ) const;
 
@@ -163,7 +193,12 @@ public:
 
     //! Set matrix from MatrixEpetra
     /*!
+      The matrix is factorized immediately. The symbolic factorization is skipped when
+      the sparsity pattern of the matrix is the same as the one of the previous matrix;
+      the numeric factorization is skipped as well when the factorization is reused
+      (see setReuseFactorization()) and has not been reset.
       @param matrix Matrix of the system
+      @return Amesos error code
      */
     Int setMatrix ( const matrix_type& matrix );
 
@@ -252,6 +287,20 @@ private:
      */
     void createSolver ( const std::string& solverType );
 
+    //! Return true if the pattern of the matrix is the one used for the last symbolic factorization
+    /*!
+      The comparison is done on the global column ids of each local row; the result is
+      reduced over all the processes, since the factorization is a collective operation.
+      @param matrix The matrix to be compared
+     */
+    bool samePattern ( const Epetra_CrsMatrix& matrix ) const;
+
+    //! Store the pattern of the matrix used for the symbolic factorization
+    /*!
+      @param matrix The matrix whose pattern is stored
+     */
+    void storePattern ( const Epetra_CrsMatrix& matrix );
+
     //@}
 
     matrix_type::matrix_ptrtype M_matrix;
@@ -260,6 +309,14 @@ private:
 
     Amesos_BaseSolver*          M_solver;
 
+    bool                        M_symbolicFactorizationDone;
+    bool                        M_numericFactorizationDone;
+    bool                        M_reuseFactorization;
+
+    std::shared_ptr<Epetra_BlockMap> M_patternRowMap;
+    std::vector<Int>            M_patternRowPointers;
+    std::vector<Int>            M_patternColumnIds;
+
     Teuchos::ParameterList      M_trilinosParameterList;
 
     Displayer                   M_displayer;
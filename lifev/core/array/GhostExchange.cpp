@@ -0,0 +1,275 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Persistent communication plan to update the ghost entries of repeated vectors
+
+    @date 10-2026
+ */
+
+#include <Epetra_MpiComm.h>
+
+#include <lifev/core/array/GhostExchange.hpp>
+
+namespace LifeV
+{
+
+// ===================================================
+// Constructors & Destructor
+// ===================================================
+
+GhostExchange::GhostExchange ( const Epetra_BlockMap& uniqueMap, const Epetra_BlockMap& repeatedMap ) :
+    M_uniqueMap ( uniqueMap ),
+    M_repeatedMap ( repeatedMap ),
+    M_numReceives ( 0 ),
+    M_numSends ( 0 ),
+    M_comm ( MPI_COMM_NULL ),
+    M_repeatedVector ( 0 )
+{
+    if ( uniqueMap.MaxElementSize() != 1 || repeatedMap.MaxElementSize() != 1 )
+    {
+        ERROR_MSG ( "GhostExchange works only with point maps" );
+    }
+
+    // Split the repeated entries in owned and ghost ones
+    const Int numRepeated ( repeatedMap.NumMyElements() );
+    const Int* repeatedGIDs ( repeatedMap.MyGlobalElements() );
+
+    std::vector<Int> ghostGIDs;
+    std::vector<Int> ghostLIDs;
+    for ( Int i ( 0 ); i < numRepeated; ++i )
+    {
+        const Int uniqueLID ( uniqueMap.LID ( repeatedGIDs[ i ] ) );
+        if ( uniqueLID >= 0 )
+        {
+            M_ownedUniqueLIDs.push_back ( uniqueLID );
+            M_ownedRepeatedLIDs.push_back ( i );
+        }
+        else
+        {
+            ghostGIDs.push_back ( repeatedGIDs[ i ] );
+            ghostLIDs.push_back ( i );
+        }
+    }
+
+    // Owners of the ghost entries and local ids on the owners (collective call)
+    const Int numGhosts ( ghostGIDs.size() );
+    std::vector<Int> ownerPIDs ( numGhosts );
+    std::vector<Int> ownerLIDs ( numGhosts );
+    uniqueMap.RemoteIDList ( numGhosts, ghostGIDs.data(), ownerPIDs.data(), ownerLIDs.data() );
+
+    const Epetra_MpiComm* mpiComm ( dynamic_cast<const Epetra_MpiComm*> ( &uniqueMap.Comm() ) );
+    if ( mpiComm == 0 )
+    {
+        // Serial communicator: all the entries are owned
+        if ( numGhosts != 0 )
+        {
+            ERROR_MSG ( "GhostExchange: some repeated global ids are not in the unique map" );
+        }
+        return;
+    }
+
+    MPI_Comm_dup ( mpiComm->Comm(), &M_comm );
+    const Int numProcs ( mpiComm->NumProc() );
+
+    // Sort the ghost entries by owner, keeping the order of the repeated map for each owner
+    std::vector<Int> receiveOffsets ( numProcs + 1, 0 );
+    for ( Int i ( 0 ); i < numGhosts; ++i )
+    {
+        // A global id not owned by any process would corrupt the plan
+        if ( ownerPIDs[ i ] < 0 )
+        {
+            ERROR_MSG ( "GhostExchange: some repeated global ids are not in the unique map" );
+        }
+        ++receiveOffsets[ ownerPIDs[ i ] + 1 ];
+    }
+    std::vector<Int> receiveCounts ( receiveOffsets.begin() + 1, receiveOffsets.end() );
+    for ( Int p ( 0 ); p < numProcs; ++p )
+    {
+        receiveOffsets[ p + 1 ] += receiveOffsets[ p ];
+    }
+
+    M_receiveLIDs.resize ( numGhosts );
+    std::vector<Int> requestedLIDs ( numGhosts );
+    std::vector<Int> position ( receiveOffsets.begin(), receiveOffsets.end() - 1 );
+    for ( Int i ( 0 ); i < numGhosts; ++i )
+    {
+        const Int k ( position[ ownerPIDs[ i ] ]++ );
+        M_receiveLIDs[ k ] = ghostLIDs[ i ];
+        requestedLIDs[ k ] = ownerLIDs[ i ];
+    }
+
+    // Each owner learns how many values it has to send to every process
+    std::vector<Int> sendCounts ( numProcs );
+    MPI_Alltoall ( &receiveCounts[ 0 ], 1, MPI_INT, &sendCounts[ 0 ], 1, MPI_INT, M_comm );
+
+    std::vector<Int> sendOffsets ( numProcs + 1, 0 );
+    for ( Int p ( 0 ); p < numProcs; ++p )
+    {
+        sendOffsets[ p + 1 ] = sendOffsets[ p ] + sendCounts[ p ];
+    }
+    M_sendLIDs.resize ( sendOffsets[ numProcs ] );
+
+    // Send to the owners the local ids of the requested entries
+    const Int tag ( 0 );
+    std::vector<MPI_Request> setupRequests;
+    for ( Int p ( 0 ); p < numProcs; ++p )
+    {
+        if ( sendCounts[ p ] > 0 )
+        {
+            setupRequests.push_back ( MPI_REQUEST_NULL );
+            MPI_Irecv ( &M_sendLIDs[ sendOffsets[ p ] ], sendCounts[ p ], MPI_INT, p, tag, M_comm, &setupRequests.back() );
+        }
+    }
+    for ( Int p ( 0 ); p < numProcs; ++p )
+    {
+        if ( receiveCounts[ p ] > 0 )
+        {
+            setupRequests.push_back ( MPI_REQUEST_NULL );
+            MPI_Isend ( &requestedLIDs[ receiveOffsets[ p ] ], receiveCounts[ p ], MPI_INT, p, tag, M_comm, &setupRequests.back() );
+        }
+    }
+    if ( !setupRequests.empty() )
+    {
+        MPI_Waitall ( setupRequests.size(), &setupRequests[ 0 ], MPI_STATUSES_IGNORE );
+    }
+
+    // Persistent requests on the contiguous blocks of the buffers
+    M_sendBuffer.resize ( M_sendLIDs.size() );
+    M_receiveBuffer.resize ( M_receiveLIDs.size() );
+    for ( Int p ( 0 ); p < numProcs; ++p )
+    {
+        if ( receiveCounts[ p ] > 0 )
+        {
+            M_requests.push_back ( MPI_REQUEST_NULL );
+            MPI_Recv_init ( &M_receiveBuffer[ receiveOffsets[ p ] ], receiveCounts[ p ], MPI_DOUBLE, p, tag, M_comm, &M_requests.back() );
+            ++M_numReceives;
+        }
+    }
+    for ( Int p ( 0 ); p < numProcs; ++p )
+    {
+        if ( sendCounts[ p ] > 0 )
+        {
+            M_requests.push_back ( MPI_REQUEST_NULL );
+            MPI_Send_init ( &M_sendBuffer[ sendOffsets[ p ] ], sendCounts[ p ], MPI_DOUBLE, p, tag, M_comm, &M_requests.back() );
+            ++M_numSends;
+        }
+    }
+}
+
+GhostExchange::~GhostExchange()
+{
+    // Nothing can be released once MPI has been finalized
+    Int finalized ( 0 );
+    MPI_Finalized ( &finalized );
+    if ( finalized )
+    {
+        return;
+    }
+
+    if ( isUpdating() )
+    {
+        MPI_Waitall ( M_requests.size(), &M_requests[ 0 ], MPI_STATUSES_IGNORE );
+    }
+
+    for ( std::vector<MPI_Request>::iterator it = M_requests.begin(); it != M_requests.end(); ++it )
+    {
+        MPI_Request_free ( & ( *it ) );
+    }
+
+    if ( M_comm != MPI_COMM_NULL )
+    {
+        MPI_Comm_free ( &M_comm );
+    }
+}
+
+// ===================================================
+// Methods
+// ===================================================
+
+void GhostExchange::startUpdate ( const vector_Type& uniqueVector, vector_Type& repeatedVector )
+{
+    // The buffers are shared by all the vectors on the map: overlapping updates would corrupt them
+    if ( isUpdating() )
+    {
+        ERROR_MSG ( "GhostExchange: an update is already in progress on this map, call finishUpdate() first" );
+    }
+    ASSERT ( uniqueVector.NumVectors() == 1 && repeatedVector.NumVectors() == 1,
+             "GhostExchange works only with single vectors" );
+    ASSERT ( uniqueVector.MyLength() == M_uniqueMap.NumMyElements()
+             && repeatedVector.MyLength() == M_repeatedMap.NumMyElements(),
+             "GhostExchange: the vectors do not match the maps of the plan" );
+
+    // Post the receives first, then pack and send the owned values
+    if ( M_numReceives > 0 )
+    {
+        MPI_Startall ( M_numReceives, &M_requests[ 0 ] );
+    }
+
+    const Real* source ( uniqueVector[ 0 ] );
+    for ( UInt i ( 0 ); i < M_sendLIDs.size(); ++i )
+    {
+        M_sendBuffer[ i ] = source[ M_sendLIDs[ i ] ];
+    }
+
+    if ( M_numSends > 0 )
+    {
+        MPI_Startall ( M_numSends, &M_requests[ M_numReceives ] );
+    }
+
+    // The owned entries are copied while the messages travel
+    Real* target ( repeatedVector[ 0 ] );
+    for ( UInt i ( 0 ); i < M_ownedUniqueLIDs.size(); ++i )
+    {
+        target[ M_ownedRepeatedLIDs[ i ] ] = source[ M_ownedUniqueLIDs[ i ] ];
+    }
+
+    M_repeatedVector = &repeatedVector;
+}
+
+void GhostExchange::finishUpdate()
+{
+    if ( !isUpdating() )
+    {
+        ERROR_MSG ( "GhostExchange: no update in progress, call startUpdate() first" );
+    }
+
+    if ( !M_requests.empty() )
+    {
+        MPI_Waitall ( M_requests.size(), &M_requests[ 0 ], MPI_STATUSES_IGNORE );
+    }
+
+    Real* target ( ( *M_repeatedVector ) [ 0 ] );
+    for ( UInt i ( 0 ); i < M_receiveLIDs.size(); ++i )
+    {
+        target[ M_receiveLIDs[ i ] ] = M_receiveBuffer[ i ];
+    }
+
+    M_repeatedVector = 0;
+}
+
+} // namespace LifeV
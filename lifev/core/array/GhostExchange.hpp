@@ -0,0 +1,203 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Persistent communication plan to update the ghost entries of repeated vectors
+
+    @date 10-2026
+ */
+
+#ifndef _GHOSTEXCHANGE_HPP_
+#define _GHOSTEXCHANGE_HPP_
+
+#include <vector>
+
+#include <mpi.h>
+
+#include <Epetra_BlockMap.h>
+#include <Epetra_MultiVector.h>
+
+#include <lifev/core/LifeV.hpp>
+
+namespace LifeV
+{
+
+//! GhostExchange - Update of the ghost entries of a repeated vector from a unique vector
+/*!
+  The class computes once the communication pattern between a unique map and a
+  repeated map with the same global ids, i.e. which owned entries have to be sent
+  to which neighbor process and where the received values have to be stored.
+
+  The values exchanged with each neighbor are packed in a contiguous block of a
+  single send buffer (resp. receive buffer) and moved with persistent MPI requests
+  (MPI_Send_init/MPI_Recv_init) started at each update. The update can be split
+  in startUpdate() and finishUpdate(), so that the communication overlaps with
+  computations that do not need the ghost values.
+
+  The plan is equivalent to an Epetra_Import from the unique map to the repeated
+  one with the Insert combine mode. It is built by MapEpetra::ghostExchange() and
+  shared by all the copies of a MapEpetra.
+
+  Only one update at a time can be in progress on a given plan, i.e. on all the
+  vectors based on the same MapEpetra: starting a second update before the first
+  one is finished is an error, also in optimized builds.
+ */
+class GhostExchange
+{
+public:
+
+    //! @name Public Types
+    //@{
+
+    typedef Epetra_MultiVector vector_Type;
+
+    //@}
+
+    //! @name Constructors & Destructor
+    //@{
+
+    //! Constructor
+    /*!
+      The construction is collective on the communicator of the maps.
+      @param uniqueMap Map of the vectors owning the values
+      @param repeatedMap Map of the vectors with the ghost entries
+     */
+    GhostExchange ( const Epetra_BlockMap& uniqueMap, const Epetra_BlockMap& repeatedMap );
+
+    //! Destructor
+    ~GhostExchange();
+
+    //@}
+
+    //! @name Methods
+    //@{
+
+    //! Start the update of a repeated vector
+    /*!
+      The owned entries are copied at once, the values for the neighbors are packed
+      and the communications are started. The ghost entries of repeatedVector must
+      not be accessed until finishUpdate() returns.
+      @param uniqueVector Source vector, based on the unique map
+      @param repeatedVector Target vector, based on the repeated map
+     */
+    void startUpdate ( const vector_Type& uniqueVector, vector_Type& repeatedVector );
+
+    //! Wait for the communications started by startUpdate() and store the ghost values
+    void finishUpdate();
+
+    //! Update the entries of a repeated vector from a unique vector
+    /*!
+      @param uniqueVector Source vector, based on the unique map
+      @param repeatedVector Target vector, based on the repeated map
+     */
+    void update ( const vector_Type& uniqueVector, vector_Type& repeatedVector )
+    {
+        startUpdate ( uniqueVector, repeatedVector );
+        finishUpdate();
+    }
+
+    //@}
+
+    //! @name Get Methods
+    //@{
+
+    //! Return the unique map of the plan
+    const Epetra_BlockMap& uniqueMap() const
+    {
+        return M_uniqueMap;
+    }
+
+    //! Return the repeated map of the plan
+    const Epetra_BlockMap& repeatedMap() const
+    {
+        return M_repeatedMap;
+    }
+
+    //! Return true if an update has been started and not finished yet
+    bool isUpdating() const
+    {
+        return M_repeatedVector != 0;
+    }
+
+    //! Number of processes this process sends values to
+    UInt numSendNeighbors() const
+    {
+        return M_numSends;
+    }
+
+    //! Number of processes this process receives values from
+    UInt numReceiveNeighbors() const
+    {
+        return M_numReceives;
+    }
+
+    //@}
+
+private:
+
+    //! @name Private Methods
+    //@{
+
+    //! No copy: the persistent requests refer to the buffers of this object
+    GhostExchange ( const GhostExchange& );
+
+    GhostExchange& operator= ( const GhostExchange& );
+
+    //@}
+
+    // Copies of the maps, sharing the Epetra data
+    Epetra_BlockMap M_uniqueMap;
+    Epetra_BlockMap M_repeatedMap;
+
+    // Entries owned by this process: unique local id and repeated local id
+    std::vector<Int> M_ownedUniqueLIDs;
+    std::vector<Int> M_ownedRepeatedLIDs;
+
+    // Unique local ids packed for the neighbors, contiguous by neighbor
+    std::vector<Int> M_sendLIDs;
+
+    // Repeated local ids of the received values, contiguous by neighbor
+    std::vector<Int> M_receiveLIDs;
+
+    std::vector<Real> M_sendBuffer;
+    std::vector<Real> M_receiveBuffer;
+
+    // Persistent requests: receives first, then sends
+    std::vector<MPI_Request> M_requests;
+    UInt M_numReceives;
+    UInt M_numSends;
+
+    // Communicator reserved to the plan, to avoid tag clashes with other messages
+    MPI_Comm M_comm;
+
+    // Target of the update in progress
+    vector_Type* M_repeatedVector;
+};
+
+} // namespace LifeV
+
+#endif /* _GHOSTEXCHANGE_HPP_ */
@@ -46,6 +46,7 @@
 #include <lifev/core/util/LifeChronoManager.hpp>
 #include <lifev/core/array/MapEpetra.hpp>
 #include <lifev/core/mesh/NeighborMarker.hpp>
+#include <lifev/core/mesh/NeighborGraph.hpp>
 
 #ifdef HAVE_LIFEV_DEBUG
 //#define LIFEV_GHOSTHANDLER_DEBUG 1
@@ -93,6 +94,7 @@ public:
     typedef std::shared_ptr<vertexPartition_Type> vertexPartitionPtr_Type;
     typedef std::vector<markerID_Type> markerIDList_Type;
     typedef std::vector<int> markerIDListSigned_Type;
+    typedef NeighborGraph neighborGraph_Type;
 
     //@}
 
@@ -150,21 +152,21 @@ public:
     }
 
     //! List of point neighbors to a point (identified by the global ID)
-    neighborList_Type const& pointPointNeighborsList()
+    neighborGraph_Type const& pointPointNeighborsList()
     {
         ASSERT ( !M_pointPointNeighborsList.empty(), "M_pointPointNeighborsList is empty" );
         return M_pointPointNeighborsList;
     }
 
     //! List of edge neighbors to a point (identified by the global ID)
-    neighborList_Type const& pointEdgeNeighborsList()
+    neighborGraph_Type const& pointEdgeNeighborsList()
     {
         ASSERT ( !M_pointEdgeNeighborsList.empty(), "M_pointEdgeNeighborsList is empty" );
         return M_pointEdgeNeighborsList;
     }
 
     //! List of element neighbors to a point (identified by the global ID)
-    neighborList_Type const& pointElementNeighborsList()
+    neighborGraph_Type const& pointElementNeighborsList()
     {
         ASSERT ( !M_pointElementNeighborsList.empty(), "M_pointElementNeighborsList is empty" );
         return M_pointElementNeighborsList;
@@ -327,6 +329,14 @@ protected:
 
     //@}
 
+    //! @name Protected Methods
+    //@{
+
+    //! New stamp to mark the points visited by a neighbor search
+    UInt newPointVisitStamp();
+
+    //@}
+
     //! @name Protected Members
     //@{
 
@@ -336,9 +346,13 @@ protected:
     commPtr_Type const M_comm;
     UInt const M_me;
 
-    neighborList_Type M_pointPointNeighborsList;
-    neighborList_Type M_pointEdgeNeighborsList;
-    neighborList_Type M_pointElementNeighborsList;
+    neighborGraph_Type M_pointPointNeighborsList;
+    neighborGraph_Type M_pointEdgeNeighborsList;
+    neighborGraph_Type M_pointElementNeighborsList;
+
+    //! Visit stamps of the points, used by the breadth-first neighbor searches
+    std::vector<UInt> M_pointVisitStamp;
+    UInt M_pointVisitCounter;
 
     bool M_verbose;
 #ifdef LIFEV_GHOSTHANDLER_DEBUG
@@ -357,6 +371,8 @@ GhostHandler<MeshType>::GhostHandler ( commPtr_Type const& comm ) :
     M_pointPointNeighborsList(),
     M_pointEdgeNeighborsList(),
     M_pointElementNeighborsList(),
+    M_pointVisitStamp(),
+    M_pointVisitCounter ( 0 ),
     M_verbose ( 0 )
 #ifdef LIFEV_GHOSTHANDLER_DEBUG
     , M_debugOut ( ( "gh." + ( comm->NumProc() > 1 ? std::to_string ( M_me ) : "s" ) + ".out" ).c_str() )
@@ -377,6 +393,8 @@ GhostHandler<MeshType>::GhostHandler ( meshPtr_Type fullMesh,
     M_pointPointNeighborsList(),
     M_pointEdgeNeighborsList(),
     M_pointElementNeighborsList(),
+    M_pointVisitStamp(),
+    M_pointVisitCounter ( 0 ),
     M_verbose ( 0 )
 #ifdef LIFEV_GHOSTHANDLER_DEBUG
     , M_debugOut ( ( "gh." + ( comm->NumProc() > 1 ? std::to_string ( M_me ) : "s" ) + ".out" ).c_str() )
@@ -393,6 +411,8 @@ GhostHandler<MeshType>::GhostHandler ( meshPtr_Type fullMesh,
     M_pointPointNeighborsList(),
     M_pointEdgeNeighborsList(),
     M_pointElementNeighborsList(),
+    M_pointVisitStamp(),
+    M_pointVisitCounter ( 0 ),
     M_verbose ( 0 )
 #ifdef LIFEV_GHOSTHANDLER_DEBUG
     , M_debugOut ( ( "gh." + ( comm->NumProc() > 1 ? std::to_string ( M_me ) : "s" ) + ".out" ).c_str() )
@@ -429,15 +449,15 @@ void GhostHandler<MeshType>::clean ( NeighborType const neighborType )
 {
     if ( (neighborType & POINT_NEIGHBORS) != 0 )
     {
-        clearVector ( M_pointPointNeighborsList );
+        M_pointPointNeighborsList.clear();
     }
     if ( (neighborType & RIDGE_NEIGHBORS) != 0 )
     {
-        clearVector ( M_pointEdgeNeighborsList );
+        M_pointEdgeNeighborsList.clear();
     }
     if ( (neighborType & ELEMENT_NEIGHBORS) != 0 )
     {
-        clearVector ( M_pointElementNeighborsList );
+        M_pointElementNeighborsList.clear();
     }
 }
 
@@ -446,77 +466,38 @@ void GhostHandler<MeshType>::clean ( NeighborType const neighborType )
 namespace
 {
 
-void writeNeighborMap ( EpetraExt::HDF5& file, neighborList_Type& list, std::string const& name )
+void writeNeighborMap ( EpetraExt::HDF5& file, NeighborGraph const& graph, std::string const& name )
 {
-    // copy the map into vectors
-    ASSERT ( list.size() > 0, "the map " + name + " is empty!" )
-    std::vector<Int> offsets ( list.size() + 1 );
-    std::vector<Int> values;
-    Int sum ( 0 );
-    for ( UInt i ( 0 ); i < list.size(); i++ )
-    {
-        sum += list[ i ].size();
-        offsets[ i + 1 ] = sum;
-        for ( neighbors_Type::const_iterator j ( list[ i ].begin() ); j != list[ i ].end(); ++j )
-        {
-            values.push_back ( *j );
-        }
-    }
+    // the compressed row arrays are written as they are
+    ASSERT ( graph.size() > 0, "the map " + name + " is empty!" )
+    NeighborGraph::offsets_Type const& offsets ( graph.offsets() );
+    NeighborGraph::values_Type const& values ( graph.values() );
 
     // Save the vectors into the file
     file.Write ( name, "offsetSize", static_cast<Int> ( offsets.size() ) );
-    file.Write ( name, "offsets", H5T_NATIVE_INT, offsets.size(), &offsets[ 0 ] );
+    file.Write ( name, "offsets", H5T_NATIVE_UINT, offsets.size(), const_cast<UInt*> ( offsets.data() ) );
     file.Write ( name, "valueSize", static_cast<Int> ( values.size() ) );
-    file.Write ( name, "values", H5T_NATIVE_INT, values.size(), &values[ 0 ] );
-
-    //#ifdef LIFEV_GHOSTHANDLER_DEBUG
-    //    std::cerr << name << std::endl;
-    //    for ( UInt i ( 0 ); i < map.size(); i++ )
-    //    {
-    //        std::cerr << i << "> ";
-    //        for ( neighborList_Type::const_iterator j ( map[ i ].begin() ); j != map[ i ].end(); ++j )
-    //        {
-    //            std::cerr << *j << " ";
-    //        }
-    //        std::cerr <<std::endl;
-    //    }
-    //#endif
+    file.Write ( name, "values", H5T_NATIVE_UINT, values.size(), const_cast<ID*> ( values.data() ) );
 }
 
-void readNeighborMap ( EpetraExt::HDF5& file, neighborList_Type& list, std::string const& name )
+void readNeighborMap ( EpetraExt::HDF5& file, NeighborGraph& graph, std::string const& name )
 {
-    // Read the vectors from the file
+    // Read the vectors from the file, HDF5 converts the integer type if needed
     Int offsetSize;
     file.Read ( name, "offsetSize", offsetSize );
-    std::vector<Int> offsets ( offsetSize );
-    file.Read ( name, "offsets", H5T_NATIVE_INT, offsetSize, &offsets[ 0 ] );
+    NeighborGraph::offsets_Type offsets ( offsetSize );
+    file.Read ( name, "offsets", H5T_NATIVE_UINT, offsetSize, offsets.data() );
     Int valueSize;
     file.Read ( name, "valueSize", valueSize );
-    std::vector<Int> values ( valueSize );
-    file.Read ( name, "values", H5T_NATIVE_INT, valueSize, &values[ 0 ] );
+    NeighborGraph::values_Type values ( valueSize );
+    file.Read ( name, "values", H5T_NATIVE_UINT, valueSize, values.data() );
 
-    // setup the map
-    list.resize ( offsetSize - 1 );
+    // setup the graph, files written with the previous set based lists may have unsorted rows
     for ( Int i ( 0 ); i < offsetSize - 1; i++ )
     {
-        for ( Int j ( offsets[ i ] ); j < offsets[ i + 1 ]; j++ )
-        {
-            list[ i ].insert ( values[ j ] );
-        }
+        std::sort ( values.begin() + offsets[ i ], values.begin() + offsets[ i + 1 ] );
     }
-
-    //#ifdef LIFEV_GHOSTHANDLER_DEBUG
-    //    std::cerr << name << std::endl;
-    //    for ( UInt i ( 0 ); i < map.size(); i++ )
-    //    {
-    //        std::cerr << i << "> ";
-    //        for ( neighborList_Type::const_iterator j ( map[ i ].begin() ); j != map[ i ].end(); ++j )
-    //        {
-    //            std::cerr << *j << " ";
-    //        }
-    //        std::cerr <<std::endl;
-    //    }
-    //#endif
+    graph.setStructure ( offsets, values );
 }
 
 }
@@ -615,27 +596,37 @@ void GhostHandler<MeshType>::createPointNeighbors()
 template <typename MeshType>
 void GhostHandler<MeshType>::createPointPointNeighborsList()
 {
-    M_pointPointNeighborsList.resize ( M_fullMesh->numGlobalPoints() );
     // generate point neighbors by watching edges
     // note: this can be based also on faces or volumes
-    for ( UInt ie = 0; ie < M_fullMesh->numEdges(); ie++ )
+    // the first pass counts the neighbors of each point, the second one stores them
+    M_pointPointNeighborsList.beginAssembly ( M_fullMesh->numGlobalPoints() );
+    for ( UInt pass = 0; pass < 2; pass++ )
     {
-        ID id0 = M_fullMesh->edge ( ie ).point ( 0 ).id();
-        ID id1 = M_fullMesh->edge ( ie ).point ( 1 ).id();
+        if ( pass == 1 )
+        {
+            M_pointPointNeighborsList.allocateEntries();
+        }
 
-        ASSERT ( M_fullMesh->point ( id0 ).id() == id0 && M_fullMesh->point ( id1 ).id() == id1,
-                 "the mesh has been reordered, the point must be found" );
+        for ( UInt ie = 0; ie < M_fullMesh->numEdges(); ie++ )
+        {
+            ID id0 = M_fullMesh->edge ( ie ).point ( 0 ).id();
+            ID id1 = M_fullMesh->edge ( ie ).point ( 1 ).id();
 
-        M_pointPointNeighborsList[ id0 ].insert ( id1 );
-        M_pointPointNeighborsList[ id1 ].insert ( id0 );
+            ASSERT ( M_fullMesh->point ( id0 ).id() == id0 && M_fullMesh->point ( id1 ).id() == id1,
+                     "the mesh has been reordered, the point must be found" );
+
+            M_pointPointNeighborsList.addEntry ( id0, id1 );
+            M_pointPointNeighborsList.addEntry ( id1, id0 );
+        }
     }
+    M_pointPointNeighborsList.endAssembly();
 
 #ifdef LIFEV_GHOSTHANDLER_DEBUG
     M_debugOut << "M_pointPointNeighborsList on proc " << M_me << std::endl;
     for ( UInt i = 0; i < M_pointPointNeighborsList.size(); i++ )
     {
         M_debugOut << i << ": ";
-        for ( neighbors_Type::const_iterator it = M_pointPointNeighborsList[ i ].begin();
+        for ( neighborGraph_Type::const_iterator it = M_pointPointNeighborsList[ i ].begin();
                 it != M_pointPointNeighborsList[ i ].end(); ++it )
         {
             M_debugOut << *it << " ";
@@ -663,136 +654,171 @@ inline bool isInside ( markerID_Type const& pointMarker, std::vector<int> const&
 template <typename MeshType>
 void GhostHandler<MeshType>::createPointPointNeighborsList (markerIDListSigned_Type const& flags)
 {
-    M_pointPointNeighborsList.resize ( M_fullMesh->numGlobalPoints() );
     // generate point neighbors by watching edges
     // note: this can be based also on faces or volumes
-    for ( UInt ie = 0; ie < M_fullMesh->numEdges(); ie++ )
+    // the first pass counts the neighbors of each point, the second one stores them
+    M_pointPointNeighborsList.beginAssembly ( M_fullMesh->numGlobalPoints() );
+    for ( UInt pass = 0; pass < 2; pass++ )
     {
-        ID id0 = M_fullMesh->edge ( ie ).point ( 0 ).id();
-        ID id1 = M_fullMesh->edge ( ie ).point ( 1 ).id();
-
-        ASSERT ( M_fullMesh->point ( id0 ).id() == id0 && M_fullMesh->point ( id1 ).id() == id1,
-                 "the mesh has been reordered, the point must be found" );
-
-        if ( isInside (M_fullMesh->edge ( ie ).point ( 1 ).markerID(), flags) )
+        if ( pass == 1 )
         {
-            M_pointPointNeighborsList[ id0 ].insert ( id1 );
+            M_pointPointNeighborsList.allocateEntries();
         }
 
-        if ( isInside (M_fullMesh->edge ( ie ).point ( 0 ).markerID(), flags) )
+        for ( UInt ie = 0; ie < M_fullMesh->numEdges(); ie++ )
         {
-            M_pointPointNeighborsList[ id1 ].insert ( id0 );
+            ID id0 = M_fullMesh->edge ( ie ).point ( 0 ).id();
+            ID id1 = M_fullMesh->edge ( ie ).point ( 1 ).id();
+
+            ASSERT ( M_fullMesh->point ( id0 ).id() == id0 && M_fullMesh->point ( id1 ).id() == id1,
+                     "the mesh has been reordered, the point must be found" );
+
+            if ( isInside (M_fullMesh->edge ( ie ).point ( 1 ).markerID(), flags) )
+            {
+                M_pointPointNeighborsList.addEntry ( id0, id1 );
+            }
+
+            if ( isInside (M_fullMesh->edge ( ie ).point ( 0 ).markerID(), flags) )
+            {
+                M_pointPointNeighborsList.addEntry ( id1, id0 );
+            }
         }
+    }
+    M_pointPointNeighborsList.endAssembly();
+}
 
-        //if(M_fullMesh->edge( ie ).point( 1 ).markerID()==20 || M_fullMesh->edge( ie ).point( 1 ).markerID()==1)
-        //    M_pointPointNeighborsList[ id0 ].insert( id1 );
+template <typename MeshType>
+UInt GhostHandler<MeshType>::newPointVisitStamp()
+{
+    if ( M_pointVisitStamp.size() != M_pointPointNeighborsList.size() )
+    {
+        M_pointVisitStamp.assign ( M_pointPointNeighborsList.size(), 0 );
+        M_pointVisitCounter = 0;
+    }
 
-        //if(M_fullMesh->edge( ie ).point( 0 ).markerID()==20 || M_fullMesh->edge( ie ).point( 0 ).markerID()==1)
-        //    M_pointPointNeighborsList[ id1 ].insert( id0 );
+    // on overflow all the stamps are reset
+    if ( ++M_pointVisitCounter == 0 )
+    {
+        std::fill ( M_pointVisitStamp.begin(), M_pointVisitStamp.end(), 0 );
+        M_pointVisitCounter = 1;
     }
+
+    return M_pointVisitCounter;
 }
 
 template <typename MeshType>
 neighbors_Type GhostHandler<MeshType>::circleNeighbors ( UInt globalID, UInt nCircles )
 {
-    neighbors_Type neighbors;
-    neighbors_Type newEntries;
-    neighbors_Type newNeighbors;
+    neighborGraph_Type const& graph ( this->pointPointNeighborsList() );
+    UInt const stamp ( newPointVisitStamp() );
 
-    neighbors = this->pointPointNeighborsList() [ globalID ];
+    // breadth-first search: each circle is the set of points reached for the first time
+    std::vector<ID> neighbors;
+    std::vector<ID> front ( 1, globalID );
+    std::vector<ID> newFront;
 
-    for (UInt i = 0; i < nCircles - 1; ++i)
+    for ( UInt i = 0; i < nCircles && !front.empty(); ++i )
     {
-        for (neighbors_Type::iterator it = neighbors.begin(); it != neighbors.end(); ++it)
+        newFront.clear();
+        for ( std::vector<ID>::const_iterator it = front.begin(); it != front.end(); ++it )
         {
-            newEntries = this->pointPointNeighborsList() [*it];
-            for (neighbors_Type::iterator ii = newEntries.begin(); ii != newEntries.end(); ++ii)
+            neighborGraph_Type::row_Type const row ( graph[ *it ] );
+            for ( neighborGraph_Type::const_iterator ii = row.begin(); ii != row.end(); ++ii )
             {
-                newNeighbors.insert (*ii);
+                if ( M_pointVisitStamp[ *ii ] != stamp )
+                {
+                    M_pointVisitStamp[ *ii ] = stamp;
+                    newFront.push_back ( *ii );
+                }
             }
         }
-
-        for (neighbors_Type::iterator it = newNeighbors.begin(); it != newNeighbors.end(); ++it)
-        {
-        	neighbors.insert(*it);
-        }
+        neighbors.insert ( neighbors.end(), newFront.begin(), newFront.end() );
+        front.swap ( newFront );
     }
 
-    return neighbors;
+    return neighbors_Type ( neighbors.begin(), neighbors.end() );
 }
 
 
 template <typename MeshType>
 neighbors_Type GhostHandler<MeshType>::neighborsWithinRadius ( UInt globalID, Real radius )
 {
-    neighbors_Type neighbors;
-    neighbors_Type newEntries;
-    neighbors_Type newNeighbors;
-    bool isInside = true;
-    Real d = 0;
-    UInt mysize = 0;
-
-    neighbors = this->pointPointNeighborsList() [globalID];
+    neighborGraph_Type const& graph ( this->pointPointNeighborsList() );
+    UInt const stamp ( newPointVisitStamp() );
 
     typename mesh_Type::point_Type const& p = M_fullMesh->point (globalID);
 
-    while (isInside)
+    // breadth-first search starting from the first circle of neighbors:
+    // only the points within the radius are collected and further expanded
+    std::vector<ID> neighbors;
+    std::vector<ID> front ( graph[ globalID ].begin(), graph[ globalID ].end() );
+    std::vector<ID> newFront;
+
+    while ( !front.empty() )
     {
-        for (neighbors_Type::iterator it = neighbors.begin(); it != neighbors.end(); ++it)
+        newFront.clear();
+        for ( std::vector<ID>::const_iterator it = front.begin(); it != front.end(); ++it )
         {
-            newEntries = this->pointPointNeighborsList() [*it];
-            for (neighbors_Type::iterator ii = newEntries.begin(); ii != newEntries.end(); ++ii)
+            neighborGraph_Type::row_Type const row ( graph[ *it ] );
+            for ( neighborGraph_Type::const_iterator ii = row.begin(); ii != row.end(); ++ii )
             {
+                if ( M_pointVisitStamp[ *ii ] == stamp )
+                {
+                    continue;
+                }
+
                 typename mesh_Type::point_Type const& n = M_fullMesh->point (*ii);
-                d = std::sqrt ( ( n.x() - p.x() ) * ( n.x() - p.x() ) +
-                                ( n.y() - p.y() ) * ( n.y() - p.y() ) +
-                                ( n.z() - p.z() ) * ( n.z() - p.z() ) );
+                Real const d = std::sqrt ( ( n.x() - p.x() ) * ( n.x() - p.x() ) +
+                                           ( n.y() - p.y() ) * ( n.y() - p.y() ) +
+                                           ( n.z() - p.z() ) * ( n.z() - p.z() ) );
                 if (d < radius)
                 {
-                    newNeighbors.insert (*ii);
+                    M_pointVisitStamp[ *ii ] = stamp;
+                    newFront.push_back ( *ii );
                 }
             }
         }
-
-        neighbors = newNeighbors;
-
-        if (neighbors.size() == mysize)
-        {
-            isInside = false;
-        }
-
-        mysize = neighbors.size();
-
+        neighbors.insert ( neighbors.end(), newFront.begin(), newFront.end() );
+        front.swap ( newFront );
     }
 
-    return neighbors;
-
+    return neighbors_Type ( neighbors.begin(), neighbors.end() );
 }
 
 template <typename MeshType>
 void GhostHandler<MeshType>::createPointEdgeNeighborsList()
 {
-    M_pointEdgeNeighborsList.resize ( M_fullMesh->numGlobalPoints() );
     // generate point neighbors by watching edges
     // note: this can be based also on faces or volumes
-    for ( UInt ie = 0; ie < M_fullMesh->numEdges(); ie++ )
+    // the first pass counts the edges of each point, the second one stores them
+    M_pointEdgeNeighborsList.beginAssembly ( M_fullMesh->numGlobalPoints() );
+    for ( UInt pass = 0; pass < 2; pass++ )
     {
-        ID id0 = M_fullMesh->edge ( ie ).point ( 0 ).id();
-        ID id1 = M_fullMesh->edge ( ie ).point ( 1 ).id();
+        if ( pass == 1 )
+        {
+            M_pointEdgeNeighborsList.allocateEntries();
+        }
 
-        ASSERT ( M_fullMesh->point ( id0 ).id() == id0 && M_fullMesh->point ( id1 ).id() == id1,
-                 "the mesh has been reordered, the point must be found" );
+        for ( UInt ie = 0; ie < M_fullMesh->numEdges(); ie++ )
+        {
+            ID id0 = M_fullMesh->edge ( ie ).point ( 0 ).id();
+            ID id1 = M_fullMesh->edge ( ie ).point ( 1 ).id();
 
-        M_pointEdgeNeighborsList[ id0 ].insert ( ie );
-        M_pointEdgeNeighborsList[ id1 ].insert ( ie );
+            ASSERT ( M_fullMesh->point ( id0 ).id() == id0 && M_fullMesh->point ( id1 ).id() == id1,
+                     "the mesh has been reordered, the point must be found" );
+
+            M_pointEdgeNeighborsList.addEntry ( id0, ie );
+            M_pointEdgeNeighborsList.addEntry ( id1, ie );
+        }
     }
+    M_pointEdgeNeighborsList.endAssembly();
 
 #ifdef LIFEV_GHOSTHANDLER_DEBUG
     M_debugOut << "M_pointEdgeNeighborsList on proc " << M_me << std::endl;
     for ( UInt i = 0; i < M_pointEdgeNeighborsList.size(); i++ )
     {
         M_debugOut << i << ": ";
-        for ( neighbors_Type::const_iterator it = M_pointEdgeNeighborsList[ i ].begin();
+        for ( neighborGraph_Type::const_iterator it = M_pointEdgeNeighborsList[ i ].begin();
                 it != M_pointEdgeNeighborsList[ i ].end(); ++it )
         {
             M_debugOut << *it << " ";
@@ -805,19 +831,29 @@ void GhostHandler<MeshType>::createPointEdgeNeighborsList()
 template <typename MeshType>
 void GhostHandler<MeshType>::createPointElementNeighborsList()
 {
-    M_pointElementNeighborsList.resize ( M_fullMesh->numGlobalPoints() );
     // generate element neighbors by cycling on elements
-    for ( UInt ie = 0; ie < M_fullMesh->numElements(); ie++ )
+    // the first pass counts the elements of each point, the second one stores them
+    M_pointElementNeighborsList.beginAssembly ( M_fullMesh->numGlobalPoints() );
+    for ( UInt pass = 0; pass < 2; pass++ )
     {
-        ASSERT ( M_fullMesh->element ( ie ).id() == ie,
-                 "the mesh has been reordered, the point must be found" );
+        if ( pass == 1 )
+        {
+            M_pointElementNeighborsList.allocateEntries();
+        }
 
-        for ( UInt k = 0; k < mesh_Type::element_Type::S_numPoints; k++ )
+        for ( UInt ie = 0; ie < M_fullMesh->numElements(); ie++ )
         {
-            ID id ( M_fullMesh->element ( ie ).point ( k ).id() );
-            M_pointElementNeighborsList[ id ].insert ( ie );
+            ASSERT ( M_fullMesh->element ( ie ).id() == ie,
+                     "the mesh has been reordered, the point must be found" );
+
+            for ( UInt k = 0; k < mesh_Type::element_Type::S_numPoints; k++ )
+            {
+                ID id ( M_fullMesh->element ( ie ).point ( k ).id() );
+                M_pointElementNeighborsList.addEntry ( id, ie );
+            }
         }
     }
+    M_pointElementNeighborsList.endAssembly();
 }
 
 template <typename MeshType>
@@ -929,7 +965,7 @@ typename GhostHandler<MeshType>::map_Type& GhostHandler<MeshType>::ghostMapOnPoi
                 pointIt != myOriginalElementsSet.end(); ++pointIt )
         {
             // iterate on each point neighborhood
-            for ( neighbors_Type::const_iterator neighborIt = M_pointPointNeighborsList[ *pointIt ].begin();
+            for ( neighborGraph_Type::const_iterator neighborIt = M_pointPointNeighborsList[ *pointIt ].begin();
                     neighborIt != M_pointPointNeighborsList[ *pointIt ].end(); ++neighborIt )
             {
                 myGlobalElementsSet.insert ( *neighborIt );
@@ -1016,7 +1052,7 @@ typename GhostHandler<MeshType>::map_Type& GhostHandler<MeshType>::ghostMapOnEdg
                     pointIt != addedElementsSet.end(); ++pointIt )
             {
                 // iterate on each point neighborhood
-                for ( neighbors_Type::const_iterator neighborIt = M_pointEdgeNeighborsList[ *pointIt ].begin();
+                for ( neighborGraph_Type::const_iterator neighborIt = M_pointEdgeNeighborsList[ *pointIt ].begin();
                         neighborIt != M_pointEdgeNeighborsList[ *pointIt ].end(); ++neighborIt )
                 {
                     std::pair<std::set<Int>::iterator, bool> isInserted = myGlobalElementsSet.insert ( *neighborIt );
@@ -1162,7 +1198,7 @@ typename GhostHandler<MeshType>::map_Type& GhostHandler<MeshType>::ghostMapOnEle
                 globalId != pointIDOnSubdInt.end(); ++globalId )
         {
             // iterate on each point neighborhood
-            for ( neighbors_Type::const_iterator neighborIt = M_pointElementNeighborsList[ *globalId ].begin();
+            for ( neighborGraph_Type::const_iterator neighborIt = M_pointElementNeighborsList[ *globalId ].begin();
                     neighborIt != M_pointElementNeighborsList[ *globalId ].end(); ++neighborIt )
             {
                 std::pair<std::set<Int>::iterator, bool> isInserted = myGlobalElementsSet.insert ( *neighborIt );
@@ -1307,7 +1343,7 @@ void GhostHandler<MeshType>::extendGraphFE ( graphPtr_Type elemGraph,
         if ( pointPID[ currentPoint ] == static_cast<Int>(M_me) )
         {
             // check if all element neighbors are on this proc
-            for ( neighbors_Type::const_iterator neighborIt = M_pointElementNeighborsList[ currentPoint ].begin();
+            for ( neighborGraph_Type::const_iterator neighborIt = M_pointElementNeighborsList[ currentPoint ].begin();
                     neighborIt != M_pointElementNeighborsList[ currentPoint ].end(); ++neighborIt )
             {
                 // add the point if a neighbor is missing
@@ -1355,7 +1391,7 @@ void GhostHandler<MeshType>::extendGraphFE ( graphPtr_Type elemGraph,
         {
             const int& currentPoint = workingPoints[ k ];
             // iterate on point neighborhood
-            for ( neighbors_Type::const_iterator neighborIt = M_pointElementNeighborsList[ currentPoint ].begin();
+            for ( neighborGraph_Type::const_iterator neighborIt = M_pointElementNeighborsList[ currentPoint ].begin();
                     neighborIt != M_pointElementNeighborsList[ currentPoint ].end(); ++neighborIt )
             {
                 std::pair<std::set<Int>::iterator, bool> isInserted = augmentedElemsSet.insert ( *neighborIt );
@@ -1528,7 +1564,7 @@ void GhostHandler<MeshType>::extendGraphFE ( const vertexPartitionPtr_Type& elem
         if ( pointPID[ currentPoint ] == static_cast<Int>(partIndex) )
         {
             // check if all element neighbors are on this proc
-            for ( neighbors_Type::const_iterator neighborIt = M_pointElementNeighborsList[ currentPoint ].begin();
+            for ( neighborGraph_Type::const_iterator neighborIt = M_pointElementNeighborsList[ currentPoint ].begin();
                     neighborIt != M_pointElementNeighborsList[ currentPoint ].end(); ++neighborIt )
             {
                 // add the point if a neighbor is missing
@@ -1576,7 +1612,7 @@ void GhostHandler<MeshType>::extendGraphFE ( const vertexPartitionPtr_Type& elem
         {
             const int& currentPoint = workingPoints[ k ];
             // iterate on point neighborhood
-            for ( neighbors_Type::const_iterator neighborIt = M_pointElementNeighborsList[ currentPoint ].begin();
+            for ( neighborGraph_Type::const_iterator neighborIt = M_pointElementNeighborsList[ currentPoint ].begin();
                     neighborIt != M_pointElementNeighborsList[ currentPoint ].end(); ++neighborIt )
             {
                 std::pair<std::set<Int>::iterator, bool> isInserted = augmentedElemsSet.insert ( *neighborIt );
@@ -1638,7 +1674,7 @@ void GhostHandler<MeshType>::showMe ( bool const /*verbose*/, std::ostream& out
     for ( UInt i = 0; i < M_pointPointNeighborsList.size(); i++ )
     {
         out << i << " > ";
-        for ( neighbors_Type::const_iterator nIt = M_pointPointNeighborsList[ i ].begin();
+        for ( neighborGraph_Type::const_iterator nIt = M_pointPointNeighborsList[ i ].begin();
                 nIt != M_pointPointNeighborsList[ i ].end(); ++nIt )
         {
             out << *nIt << " ";
@@ -1649,7 +1685,7 @@ void GhostHandler<MeshType>::showMe ( bool const /*verbose*/, std::ostream& out
     for ( UInt i = 0; i < M_pointPointNeighborsList.size(); i++ )
     {
         out << i << " > ";
-        for ( neighbors_Type::const_iterator nIt = M_pointPointNeighborsList[ i ].begin();
+        for ( neighborGraph_Type::const_iterator nIt = M_pointPointNeighborsList[ i ].begin();
                 nIt != M_pointPointNeighborsList[ i ].end(); ++nIt )
         {
             out << *nIt << " ";
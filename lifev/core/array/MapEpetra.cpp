@@ -52,7 +52,9 @@ namespace LifeV
 
 MapEpetra::MapEpetra () :
     M_exporter (new std::shared_ptr<Epetra_Export>()),
-    M_importer (new std::shared_ptr<Epetra_Import>())
+    M_importer (new std::shared_ptr<Epetra_Import>()),
+    M_ghostExchange (new std::shared_ptr<GhostExchange>()),
+    M_subsetPlans (new subsetPlanList_Type() )
 {
     // Nothing to be done here
 }
@@ -74,6 +76,7 @@ MapEpetra::MapEpetra ( Int  numGlobalElements,
 MapEpetra::MapEpetra ( mapData_Type const& mapData, commPtr_Type const& commPtr ) :
     M_exporter (new std::shared_ptr<Epetra_Export>()),
     M_importer (new std::shared_ptr<Epetra_Import>()),
+    M_ghostExchange (new std::shared_ptr<GhostExchange>()),
     M_commPtr  ( commPtr )
 {
     ASSERT (M_commPtr.get()!=0, "Error! The communicator pointer is not valid.\n");
@@ -95,6 +98,7 @@ MapEpetra::MapEpetra ( const Int numGlobalElements,
                        const commPtr_Type& commPtr ) :
     M_exporter (new std::shared_ptr<Epetra_Export>()),
     M_importer (new std::shared_ptr<Epetra_Import>()),
+    M_ghostExchange (new std::shared_ptr<GhostExchange>()),
     M_commPtr  ( commPtr )
 {
     ASSERT (M_commPtr.get()!=0, "Error! The communicator pointer is not valid.\n");
@@ -114,6 +118,7 @@ MapEpetra::MapEpetra ( const Int           size,
                        const commPtr_Type& commPtr ) :
     M_exporter (new std::shared_ptr<Epetra_Export>()),
     M_importer (new std::shared_ptr<Epetra_Import>()),
+    M_ghostExchange (new std::shared_ptr<GhostExchange>()),
     M_commPtr  ( commPtr )
 {
     ASSERT (M_commPtr.get()!=0, "Error! The communicator pointer is not valid.\n");
@@ -189,7 +194,9 @@ MapEpetra& MapEpetra::operator= (const MapEpetra& epetraMap)
         M_uniqueMapEpetra   = epetraMap.M_uniqueMapEpetra;
         M_exporter          = epetraMap.M_exporter;
         M_importer          = epetraMap.M_importer;
+        M_ghostExchange     = epetraMap.M_ghostExchange;
         M_commPtr           = epetraMap.M_commPtr;
+        M_subsetPlans       = epetraMap.M_subsetPlans;
     }
 
     return *this;
@@ -251,6 +258,7 @@ MapEpetra& MapEpetra::operator+= ( const MapEpetra& epetraMap )
 
     M_exporter.reset (new std::shared_ptr<Epetra_Export>());
     M_importer.reset (new std::shared_ptr<Epetra_Import>());
+    M_ghostExchange.reset (new std::shared_ptr<GhostExchange>());
 
     return *this;
 }
@@ -400,6 +408,70 @@ const Epetra_Import& MapEpetra::importer()
     return **M_importer;
 }
 
+GhostExchange& MapEpetra::ghostExchange()
+{
+    ASSERT (M_uniqueMapEpetra.get()!=0 && M_repeatedMapEpetra.get()!=0, "Error! One (or both) the map pointers are not valid.\n");
+
+    if ( !M_ghostExchange )
+    {
+        M_ghostExchange.reset ( new std::shared_ptr<GhostExchange>() );
+    }
+
+    // The plan is rebuilt if the internal maps have been replaced
+    std::shared_ptr<GhostExchange>& plan ( *M_ghostExchange );
+    if ( !plan
+            || plan->uniqueMap().DataPtr() != getUniqueMap()->DataPtr()
+            || plan->repeatedMap().DataPtr() != getRepeatedMap()->DataPtr() )
+    {
+        plan.reset ( new GhostExchange ( *getUniqueMap(), *getRepeatedMap() ) );
+    }
+
+    return *plan;
+}
+
+MapEpetra::subsetPlan_Type const&
+MapEpetra::subsetPlan ( MapEpetraType mapType,
+                        const Epetra_BlockMap& sourceMap,
+                        const Epetra_BlockMap& targetMap,
+                        const UInt sourceOffset,
+                        const UInt targetOffset ) const
+{
+    // Number of plans kept for each map: a monolithic solver typically splits
+    // and joins a handful of blocks, each with its own pair of offsets
+    const UInt maxNumPlans ( 16 );
+
+    const Epetra_BlockMap& selectionMap ( *map ( mapType ) );
+
+    if ( !M_subsetPlans )
+    {
+        M_subsetPlans.reset ( new subsetPlanList_Type() );
+    }
+
+    for ( subsetPlanList_Type::iterator it = M_subsetPlans->begin(); it != M_subsetPlans->end(); ++it )
+    {
+        const subsetPlan_Type& plan ( **it );
+        if ( plan.selectionMap.DataPtr() == selectionMap.DataPtr()
+                && plan.sourceMap.DataPtr() == sourceMap.DataPtr()
+                && plan.targetMap.DataPtr() == targetMap.DataPtr()
+                && plan.sourceOffset == sourceOffset
+                && plan.targetOffset == targetOffset )
+        {
+            // Move the plan in front of the list, so that the least used ones are dropped first
+            M_subsetPlans->splice ( M_subsetPlans->begin(), *M_subsetPlans, it );
+            return plan;
+        }
+    }
+
+    M_subsetPlans->push_front ( subsetPlanPtr_Type ( new subsetPlan_Type ( selectionMap, sourceMap, targetMap,
+                                                                           sourceOffset, targetOffset ) ) );
+    if ( M_subsetPlans->size() > maxNumPlans )
+    {
+        M_subsetPlans->pop_back();
+    }
+
+    return *M_subsetPlans->front();
+}
+
 // ===================================================
 // Set Methods
 // ===================================================
@@ -426,6 +498,29 @@ void MapEpetra::setMap ( mapPtr_Type map, MapEpetraType mapType )
 // Private Methods
 // ===================================================
 
+MapEpetra::SubsetPlan::SubsetPlan ( const Epetra_BlockMap& selection,
+                                    const Epetra_BlockMap& source,
+                                    const Epetra_BlockMap& target,
+                                    const UInt sourceShift,
+                                    const UInt targetShift ) :
+    selectionMap ( selection ),
+    sourceMap ( source ),
+    targetMap ( target ),
+    sourceOffset ( sourceShift ),
+    targetOffset ( targetShift ),
+    sourceLIDs ( selection.NumMyElements() ),
+    targetLIDs ( selection.NumMyElements() )
+{
+    const Int* gids ( selection.MyGlobalElements() );
+
+    for ( Int i = 0; i < selection.NumMyElements(); ++i )
+    {
+        sourceLIDs[i] = source.LID ( static_cast<EpetraInt_Type> ( gids[i] + sourceOffset ) );
+        targetLIDs[i] = target.LID ( static_cast<EpetraInt_Type> ( gids[i] + targetOffset ) );
+        ASSERT ( ( targetLIDs[i] >= 0 ) && ( sourceLIDs[i] >= 0 ), "VectorEpetra::subset ERROR : !! lid < 0\n" );
+    }
+}
+
 MapEpetra::MapEpetra (const MapEpetra& epetraMap)
 {
     this->operator= ( epetraMap );
@@ -457,6 +552,8 @@ void MapEpetra::uniqueMap()
 
     M_exporter.reset (new std::shared_ptr<Epetra_Export>());
     M_importer.reset (new std::shared_ptr<Epetra_Import>());
+    M_ghostExchange.reset (new std::shared_ptr<GhostExchange>());
+    M_subsetPlans.reset (new subsetPlanList_Type() );
 }
 
 void MapEpetra::createImportExport()
@@ -47,6 +47,8 @@
 #include <Epetra_Import.h>
 #include <Epetra_Comm.h>
 
+#include <list>
+
 #ifdef HAVE_HDF5
 #include <EpetraExt_HDF5.h>
 #endif
@@ -55,6 +57,7 @@
 #include <lifev/core/array/EnumMapEpetra.hpp>
 #include <lifev/core/array/MapEpetraData.hpp>
 #include <lifev/core/array/MapVector.hpp>
+#include <lifev/core/array/GhostExchange.hpp>
 
 namespace LifeV
 {
@@ -88,11 +91,40 @@ public:
        map.*/
     typedef std::shared_ptr< std::shared_ptr<Epetra_Export> > exporterPtr_Type;
     typedef std::shared_ptr< std::shared_ptr<Epetra_Import> > importerPtr_Type;
+    typedef std::shared_ptr< std::shared_ptr<GhostExchange> > ghostExchangePtr_Type;
 
 
     typedef Epetra_Comm                                           comm_Type;
     typedef std::shared_ptr<comm_Type>                          commPtr_Type;
 
+    //! Local ids used to copy the entries selected by this map between two Epetra maps
+    /*!
+      The plan stores copies of the three Epetra maps it was built for: the copies share
+      the underlying Epetra data, so that the identity test on DataPtr() performed by
+      subsetPlan() stays valid for the whole lifetime of the plan.
+     */
+    struct SubsetPlan
+    {
+        SubsetPlan ( const Epetra_BlockMap& selectionMap,
+                     const Epetra_BlockMap& sourceMap,
+                     const Epetra_BlockMap& targetMap,
+                     const UInt sourceOffset,
+                     const UInt targetOffset );
+
+        Epetra_BlockMap  selectionMap;
+        Epetra_BlockMap  sourceMap;
+        Epetra_BlockMap  targetMap;
+        UInt             sourceOffset;
+        UInt             targetOffset;
+        std::vector<Int> sourceLIDs;
+        std::vector<Int> targetLIDs;
+    };
+
+    typedef SubsetPlan                                            subsetPlan_Type;
+    typedef std::shared_ptr<subsetPlan_Type>                    subsetPlanPtr_Type;
+    typedef std::list<subsetPlanPtr_Type>                         subsetPlanList_Type;
+    typedef std::shared_ptr<subsetPlanList_Type>                subsetPlanListPtr_Type;
+
     //@}
 
     //! @name Constructors & Destructor
@@ -284,6 +316,34 @@ public:
 
     //! Getter for the Epetra_Import
     Epetra_Import const& importer();
+
+    //! Getter for the persistent plan updating Repeated vectors from Unique vectors
+    /*!
+      The plan is built the first time it is requested (collective call) and it is
+      then shared by all the copies of this MapEpetra, as the importer and the exporter.
+      @return The ghost exchange plan from the Unique map to the Repeated map
+     */
+    GhostExchange& ghostExchange();
+
+    //! Getter for the local ids needed to copy the entries of this map from sourceMap to targetMap
+    /*!
+      The global id gid of the selected map (Unique or Repeated) is read at gid + sourceOffset
+      in sourceMap and written at gid + targetOffset in targetMap. The local ids are computed
+      the first time a given combination is requested and are then shared by all the copies
+      of this MapEpetra; maps are identified through Epetra_BlockMap::DataPtr(), so that the
+      lookup does not require any communication.
+      @param mapType Type of this map used to select the entries
+      @param sourceMap Map of the vector the values are read from
+      @param targetMap Map of the vector the values are written to
+      @param sourceOffset Offset added to the gids when reading
+      @param targetOffset Offset added to the gids when writing
+      @return The cached plan
+     */
+    subsetPlan_Type const& subsetPlan ( MapEpetraType mapType,
+                                        const Epetra_BlockMap& sourceMap,
+                                        const Epetra_BlockMap& targetMap,
+                                        const UInt sourceOffset,
+                                        const UInt targetOffset ) const;
     //@}
 
     //! @name Set Methods
@@ -345,7 +405,11 @@ private:
     mapPtr_Type        M_uniqueMapEpetra;
     exporterPtr_Type   M_exporter;
     importerPtr_Type   M_importer;
+    ghostExchangePtr_Type M_ghostExchange;
     commPtr_Type       M_commPtr;
+
+    //! Most recently used subset plans, shared by the copies of this map
+    mutable subsetPlanListPtr_Type M_subsetPlans;
 };
 
 // ===================================================
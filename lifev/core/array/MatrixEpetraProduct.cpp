@@ -0,0 +1,327 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Reusable plan for the sparse product A * diag(d) * B + c * C
+
+    @date 10-2026
+ */
+
+#include <algorithm>
+
+#include <Epetra_CrsGraph.h>
+#include <Epetra_FECrsMatrix.h>
+
+#include <lifev/core/array/MatrixEpetraProduct.hpp>
+
+namespace LifeV
+{
+
+// ===================================================
+// Constructors & Destructor
+// ===================================================
+MatrixEpetraProduct::MatrixEpetraProduct() :
+    M_result(),
+    M_importer(),
+    M_importedB(),
+    M_numSymbolicPhases ( 0 ),
+    M_ompParams()
+{
+
+}
+
+// ===================================================
+// Methods
+// ===================================================
+const MatrixEpetraProduct::matrixPtr_Type&
+MatrixEpetraProduct::multiply ( const matrix_Type& A,
+                                const vector_Type* diagonal,
+                                const matrix_Type& B,
+                                const matrix_Type* C,
+                                const Real& coefficient )
+{
+    ASSERT ( A.matrixPtr()->Filled() && B.matrixPtr()->Filled(), "MatrixEpetraProduct::multiply: Error: the factors must be globally assembled" );
+    ASSERT ( A.matrixPtr()->DomainMap().SameAs ( B.matrixPtr()->RowMap() ), "MatrixEpetraProduct::multiply: Error: the row map of B must be the domain map of A" );
+    ASSERT ( !diagonal || diagonal->Map().SameAs ( B.matrixPtr()->RowMap() ), "MatrixEpetraProduct::multiply: Error: the diagonal must have the row map of B" );
+    ASSERT ( !C || ( C->matrixPtr()->Filled() && C->matrixPtr()->RowMap().SameAs ( A.matrixPtr()->RowMap() ) ),
+             "MatrixEpetraProduct::multiply: Error: C must be globally assembled, with the row map of A" );
+
+    if ( patternIsValid ( A, B, C ) )
+    {
+        importRows ( A, B );
+    }
+    else
+    {
+        symbolic ( A, B, C );
+    }
+
+    if ( !numeric ( A, diagonal, C, coefficient ) )
+    {
+        // The patterns changed without changing the sizes
+        symbolic ( A, B, C );
+        numeric ( A, diagonal, C, coefficient );
+    }
+
+    return M_result;
+}
+
+void
+MatrixEpetraProduct::reset()
+{
+    M_result.reset();
+    M_importer.reset();
+    M_importedB.reset();
+    M_patternSizes.clear();
+}
+
+// ===================================================
+// Private Methods
+// ===================================================
+bool
+MatrixEpetraProduct::patternIsValid ( const matrix_Type& A, const matrix_Type& B, const matrix_Type* C ) const
+{
+    if ( !M_result || !M_importer )
+    {
+        return false;
+    }
+
+    // Only global quantities are compared before SameAs, which is a collective call
+    std::vector<long long> sizes ( 5, -1 );
+    sizes[ 0 ] = A.matrixPtr()->NumGlobalRows();
+    sizes[ 1 ] = A.matrixPtr()->NumGlobalNonzeros();
+    sizes[ 2 ] = B.matrixPtr()->NumGlobalRows();
+    sizes[ 3 ] = B.matrixPtr()->NumGlobalNonzeros();
+    if ( C )
+    {
+        sizes[ 4 ] = C->matrixPtr()->NumGlobalNonzeros();
+    }
+
+    return sizes == M_patternSizes
+           && A.matrixPtr()->ColMap().SameAs ( M_importer->TargetMap() )
+           && B.matrixPtr()->RowMap().SameAs ( M_importer->SourceMap() );
+}
+
+void
+MatrixEpetraProduct::importRows ( const matrix_Type& A, const matrix_Type& B )
+{
+    M_importedB.reset ( new Epetra_CrsMatrix ( Copy, A.matrixPtr()->ColMap(), 0 ) );
+    M_importedB->Import ( *B.matrixPtr(), *M_importer, Insert );
+}
+
+void
+MatrixEpetraProduct::symbolic ( const matrix_Type& A, const matrix_Type& B, const matrix_Type* C )
+{
+    const Epetra_CrsMatrix& a ( *A.matrixPtr() );
+    const Epetra_CrsMatrix& b ( *B.matrixPtr() );
+
+    M_importer.reset ( new Epetra_Import ( a.ColMap(), b.RowMap() ) );
+    importRows ( A, B );
+
+    // Union of the columns of the rows of B selected by each row of A (global ids)
+    Epetra_CrsGraph graph ( Copy, a.RowMap(), 0 );
+    std::vector<Int> columns;
+    for ( Int i ( 0 ); i < a.NumMyRows(); ++i )
+    {
+        columns.clear();
+
+        Int numEntries ( 0 );
+        Real* values ( 0 );
+        Int* indices ( 0 );
+        a.ExtractMyRowView ( i, numEntries, values, indices );
+        for ( Int k ( 0 ); k < numEntries; ++k )
+        {
+            Int numEntriesB ( 0 );
+            Real* valuesB ( 0 );
+            Int* indicesB ( 0 );
+            M_importedB->ExtractGlobalRowView ( a.ColMap().GID ( indices[ k ] ), numEntriesB, valuesB, indicesB );
+            columns.insert ( columns.end(), indicesB, indicesB + numEntriesB );
+        }
+
+        if ( C )
+        {
+            const Epetra_CrsMatrix& c ( *C->matrixPtr() );
+            c.ExtractMyRowView ( i, numEntries, values, indices );
+            for ( Int k ( 0 ); k < numEntries; ++k )
+            {
+                columns.push_back ( c.ColMap().GID ( indices[ k ] ) );
+            }
+        }
+
+        std::sort ( columns.begin(), columns.end() );
+        columns.erase ( std::unique ( columns.begin(), columns.end() ), columns.end() );
+        if ( !columns.empty() )
+        {
+            graph.InsertGlobalIndices ( a.RowMap().GID ( i ), static_cast<Int> ( columns.size() ), &columns[ 0 ] );
+        }
+    }
+    graph.FillComplete ( b.DomainMap(), a.RangeMap() );
+
+    // The result is filled once, the following products only change its values
+    matrix_Type::matrix_ptrtype resultCrs ( new matrix_Type::matrix_type ( Copy, graph ) );
+    M_result.reset ( new matrix_Type ( A.map(), resultCrs ) );
+    M_result->globalAssemble ( std::shared_ptr<const MapEpetra> ( new MapEpetra ( B.domainMap() ) ),
+                               std::shared_ptr<const MapEpetra> ( new MapEpetra ( A.rangeMap() ) ) );
+
+    M_patternSizes.assign ( 5, -1 );
+    M_patternSizes[ 0 ] = a.NumGlobalRows();
+    M_patternSizes[ 1 ] = a.NumGlobalNonzeros();
+    M_patternSizes[ 2 ] = b.NumGlobalRows();
+    M_patternSizes[ 3 ] = b.NumGlobalNonzeros();
+    if ( C )
+    {
+        M_patternSizes[ 4 ] = C->matrixPtr()->NumGlobalNonzeros();
+    }
+
+    ++M_numSymbolicPhases;
+}
+
+bool
+MatrixEpetraProduct::numeric ( const matrix_Type& A, const vector_Type* diagonal, const matrix_Type* C, const Real& coefficient )
+{
+    const Epetra_CrsMatrix& a ( *A.matrixPtr() );
+    const Epetra_CrsMatrix& result ( *M_result->matrixPtr() );
+    const Epetra_Map& resultColumnMap ( result.ColMap() );
+
+    // Diagonal scaling on the column map of A
+    Epetra_Vector scaling ( a.ColMap() );
+    if ( diagonal )
+    {
+        scaling.Import ( *diagonal, *M_importer, Insert );
+    }
+    else
+    {
+        scaling.PutScalar ( 1. );
+    }
+
+    // Scaled rows of B with the local column ids of the result (-1 if not in the pattern)
+    const Int numImportedRows ( M_importedB->NumMyRows() );
+    M_rowPointersB.resize ( numImportedRows + 1 );
+    M_rowPointersB[ 0 ] = 0;
+    for ( Int j ( 0 ); j < numImportedRows; ++j )
+    {
+        M_rowPointersB[ j + 1 ] = M_rowPointersB[ j ] + M_importedB->NumMyEntries ( j );
+    }
+    M_columnsB.resize ( M_rowPointersB[ numImportedRows ] );
+    M_valuesB.resize ( M_rowPointersB[ numImportedRows ] );
+
+    const Int numRows ( a.NumMyRows() );
+    bool missingEntry ( false );
+
+    M_ompParams.apply();
+
+    #pragma omp parallel reduction(||:missingEntry)
+    {
+        #pragma omp for schedule(runtime)
+        for ( Int j = 0; j < numImportedRows; ++j )
+        {
+            Int numEntries ( 0 );
+            Real* values ( 0 );
+            Int* indices ( 0 );
+            M_importedB->ExtractGlobalRowView ( a.ColMap().GID ( j ), numEntries, values, indices );
+            for ( Int k ( 0 ); k < numEntries; ++k )
+            {
+                M_columnsB[ M_rowPointersB[ j ] + k ] = resultColumnMap.LID ( indices[ k ] );
+                M_valuesB[ M_rowPointersB[ j ] + k ] = scaling[ j ] * values[ k ];
+            }
+        }
+
+        // Position of the columns of the current row of the result, -1 elsewhere
+        std::vector<Int> position ( result.NumMyCols(), -1 );
+
+        #pragma omp for schedule(runtime)
+        for ( Int i = 0; i < numRows; ++i )
+        {
+            Int numEntries ( 0 );
+            Real* values ( 0 );
+            Int* indices ( 0 );
+            result.ExtractMyRowView ( i, numEntries, values, indices );
+            for ( Int k ( 0 ); k < numEntries; ++k )
+            {
+                position[ indices[ k ] ] = k;
+                values[ k ] = 0.;
+            }
+
+            Int numEntriesA ( 0 );
+            Real* valuesA ( 0 );
+            Int* indicesA ( 0 );
+            a.ExtractMyRowView ( i, numEntriesA, valuesA, indicesA );
+            for ( Int k ( 0 ); k < numEntriesA; ++k )
+            {
+                const Int j ( indicesA[ k ] );
+                for ( Int l ( M_rowPointersB[ j ] ); l < M_rowPointersB[ j + 1 ]; ++l )
+                {
+                    const Int p ( M_columnsB[ l ] < 0 ? -1 : position[ M_columnsB[ l ] ] );
+                    if ( p < 0 )
+                    {
+                        missingEntry = true;
+                    }
+                    else
+                    {
+                        values[ p ] += valuesA[ k ] * M_valuesB[ l ];
+                    }
+                }
+            }
+
+            if ( C )
+            {
+                const Epetra_CrsMatrix& c ( *C->matrixPtr() );
+                Int numEntriesC ( 0 );
+                Real* valuesC ( 0 );
+                Int* indicesC ( 0 );
+                c.ExtractMyRowView ( i, numEntriesC, valuesC, indicesC );
+                for ( Int k ( 0 ); k < numEntriesC; ++k )
+                {
+                    const Int column ( resultColumnMap.LID ( c.ColMap().GID ( indicesC[ k ] ) ) );
+                    const Int p ( column < 0 ? -1 : position[ column ] );
+                    if ( p < 0 )
+                    {
+                        missingEntry = true;
+                    }
+                    else
+                    {
+                        values[ p ] += coefficient * valuesC[ k ];
+                    }
+                }
+            }
+
+            for ( Int k ( 0 ); k < numEntries; ++k )
+            {
+                position[ indices[ k ] ] = -1;
+            }
+        }
+    }
+
+    M_ompParams.restorePreviousNumThreads();
+
+    // All the processes must agree on a new symbolic phase
+    Int localMissing ( missingEntry ), globalMissing ( 0 );
+    a.Comm().MaxAll ( &localMissing, &globalMissing, 1 );
+
+    return globalMissing == 0;
+}
+
+} // namespace LifeV
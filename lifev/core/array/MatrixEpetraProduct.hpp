@@ -0,0 +1,192 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Reusable plan for the sparse product A * diag(d) * B + c * C
+
+    @date 10-2026
+ */
+
+#ifndef _MATRIXEPETRAPRODUCT_HPP_
+#define _MATRIXEPETRAPRODUCT_HPP_
+
+#include <vector>
+
+#include <Epetra_CrsMatrix.h>
+#include <Epetra_Import.h>
+#include <Epetra_Map.h>
+#include <Epetra_Vector.h>
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/util/OpenMPParameters.hpp>
+
+namespace LifeV
+{
+
+//! MatrixEpetraProduct - Sparse product A * diag(d) * B + c * C with a cached pattern
+/*!
+  The class computes products such as the approximated Schur complements
+  B * diag(F)^{-1} * Bt of the block preconditioners, which are rebuilt each time
+  the values of F change while the patterns of A, B and C stay the same.
+
+  The first call to multiply() computes the pattern of the result (symbolic phase):
+  the importer of the rows of B needed by the process, the graph of the result and
+  the result matrix itself, which is filled once. The following calls only compute the
+  values (numeric phase), in place in the result matrix, with a loop over the rows
+  that can be threaded with setOpenMPParameters().
+
+  The symbolic phase is done again when the number of rows or entries of one of the
+  factors changes, when the column map of A changes, or when the numeric phase finds
+  an entry which is not in the cached pattern. Entries of the cached pattern that are
+  not in the new product are set to zero.
+
+  The result is returned by reference and is overwritten by the next call to multiply():
+  the matrix must be copied if it has to outlive the next product.
+ */
+class MatrixEpetraProduct
+{
+public:
+
+    //! @name Public Types
+    //@{
+
+    typedef MatrixEpetra<Real>                     matrix_Type;
+    typedef std::shared_ptr<matrix_Type>           matrixPtr_Type;
+    typedef Epetra_Vector                          vector_Type;
+
+    //@}
+
+
+    //! @name Constructors & Destructor
+    //@{
+
+    //! Empty constructor
+    MatrixEpetraProduct();
+
+    //! Destructor
+    ~MatrixEpetraProduct() {}
+
+    //@}
+
+
+    //! @name Methods
+    //@{
+
+    //! Compute A * diag(diagonal) * B + coefficient * C (collective call)
+    /*!
+      @param A Left factor, globally assembled
+      @param diagonal Diagonal scaling with the row map of B, the identity if null
+      @param B Right factor, globally assembled, its row map must be the domain map of A
+      @param C Matrix added to the product, globally assembled, with the row map of A (optional)
+      @param coefficient Coefficient of C
+      @return The result, with the row map of A, the range map of A and the domain map of B.
+              While the pattern is kept, the same matrix (same pointer) is returned and overwritten
+              by each call; a new matrix is allocated only by a symbolic phase.
+     */
+    const matrixPtr_Type& multiply ( const matrix_Type& A,
+                                     const vector_Type* diagonal,
+                                     const matrix_Type& B,
+                                     const matrix_Type* C = 0,
+                                     const Real& coefficient = 1. );
+
+    //! Forget the cached pattern, the next product does the symbolic phase
+    void reset();
+
+    //@}
+
+
+    //! @name Set Methods
+    //@{
+
+    //! Set the OpenMP parameters of the numeric phase
+    void setOpenMPParameters ( const OpenMPParameters& ompParams )
+    {
+        M_ompParams = ompParams;
+    }
+
+    //@}
+
+
+    //! @name Get Methods
+    //@{
+
+    //! Return the result of the last product
+    const matrixPtr_Type& result() const
+    {
+        return M_result;
+    }
+
+    //! Return the number of symbolic phases done since the construction
+    UInt numSymbolicPhases() const
+    {
+        return M_numSymbolicPhases;
+    }
+
+    //@}
+
+private:
+
+    //! @name Private Methods
+    //@{
+
+    //! Return true if the cached pattern may be used with the given factors
+    bool patternIsValid ( const matrix_Type& A, const matrix_Type& B, const matrix_Type* C ) const;
+
+    //! Import the rows of B corresponding to the columns of A in M_importedB
+    void importRows ( const matrix_Type& A, const matrix_Type& B );
+
+    //! Compute the graph of the result and allocate it
+    void symbolic ( const matrix_Type& A, const matrix_Type& B, const matrix_Type* C );
+
+    //! Compute the values of the result, return false if an entry is not in the pattern
+    bool numeric ( const matrix_Type& A, const vector_Type* diagonal, const matrix_Type* C, const Real& coefficient );
+
+    //@}
+
+    matrixPtr_Type                       M_result;
+
+    //! Importer of the rows of B from the row map of B to the column map of A
+    std::shared_ptr<Epetra_Import>       M_importer;
+    std::shared_ptr<Epetra_CrsMatrix>    M_importedB;
+
+    //! Rows of B in the column map of A, the columns are local ids of the result
+    std::vector<Int>                     M_rowPointersB;
+    std::vector<Int>                     M_columnsB;
+    std::vector<Real>                    M_valuesB;
+
+    //! Number of rows and entries of the factors used to build the pattern
+    std::vector<long long>               M_patternSizes;
+
+    UInt                                 M_numSymbolicPhases;
+
+    OpenMPParameters                     M_ompParams;
+};
+
+} // namespace LifeV
+
+#endif // _MATRIXEPETRAPRODUCT_HPP_
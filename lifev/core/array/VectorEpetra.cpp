@@ -127,6 +127,11 @@ VectorEpetra::VectorEpetra ( const VectorEpetra& vector, const MapEpetraType& ma
             M_epetraVector->Export ( vector.epetraVector(), M_epetraMap->importer(), combineMode );
             return ;
         case Repeated:
+            if ( combineMode == Add || combineMode == Insert )
+            {
+                M_epetraMap->ghostExchange().update ( vector.epetraVector(), *M_epetraVector );
+                return ;
+            }
             M_epetraVector->Import ( vector.epetraVector(), M_epetraMap->exporter(), combineMode );
             return ;
     }
@@ -226,6 +231,13 @@ VectorEpetra::operator= ( const VectorEpetra& vector )
         return *this;
     }
 
+    // update of the ghost entries: every entry is written by the persistent plan of the MapEpetra
+    if ( ( M_combineMode == Add || M_combineMode == Insert ) && isGhostUpdateOf ( vector ) )
+    {
+        M_epetraMap->ghostExchange().update ( vector.epetraVector(), *M_epetraVector );
+        return *this;
+    }
+
     *this *= 0.; // because of a buggy behaviour in case of multidefined indeces.
 
     // vector have the same underlying MapEpetra, we then use the existing importer/exporter
@@ -731,6 +743,34 @@ VectorEpetra::add ( const VectorEpetra& vector, const Int offset )
     return *this;
 }
 
+VectorEpetra&
+VectorEpetra::add ( const data_type& scalar, const VectorEpetra& vector )
+{
+    return this->update ( scalar, vector, 1. );
+}
+
+VectorEpetra&
+VectorEpetra::update ( const data_type& scalar, const VectorEpetra& vector, const data_type& scalarThis )
+{
+    if ( this->blockMap().SameAs ( vector.blockMap() ) )
+    {
+        M_epetraVector->Update ( scalar, vector.epetraVector(), scalarThis );
+        return *this;
+    }
+
+    // Different maps: the scaled vector is imported or exported as in operator= and operator+=
+    VectorEpetra scaledVector ( vector );
+    scaledVector *= scalar;
+
+    if ( scalarThis == 0. )
+    {
+        return *this = scaledVector;
+    }
+
+    *this *= scalarThis;
+    return *this += scaledVector;
+}
+
 VectorEpetra&
 VectorEpetra::replace ( const VectorEpetra& vector, const Int& offset )
 {
@@ -774,19 +814,19 @@ VectorEpetra::subset ( const Epetra_MultiVector& vector,
                        const UInt          offset2,
                        const UInt          column )
 {
-    const Int*    gids         = map.map (M_mapType)->MyGlobalElements();
-    const UInt    numMyEntries = map.map (M_mapType)->NumMyElements();
+    // The local ids are computed once for each (map, source, target, offsets) combination
+    const MapEpetra::subsetPlan_Type& plan = map.subsetPlan ( M_mapType, vector.Map(), blockMap(), offset1, offset2 );
 
-    Int lid1 ;
-    Int lid2 ;
+    const UInt    numMyEntries = plan.sourceLIDs.size();
+    const Int*    lid1         = numMyEntries ? &plan.sourceLIDs[0] : 0;
+    const Int*    lid2         = numMyEntries ? &plan.targetLIDs[0] : 0;
+    const Real*   source       = vector[column];
+    Real*         target       = (*M_epetraVector) [0];
 
     // eg:  p = (u,p) or u = (u,p)
     for ( UInt i = 0; i < numMyEntries; ++i )
     {
-        lid1 = vector.Map().LID ( static_cast<EpetraInt_Type> (gids[i] + offset1) );
-        lid2 = blockMap().LID ( static_cast<EpetraInt_Type> (gids[i] + offset2) );
-        ASSERT ( ( lid2 >= 0 ) && ( lid1 >= 0 ), "VectorEpetra::subset ERROR : !! lid < 0\n" );
-        (*M_epetraVector) [0][lid2] = vector[column][lid1];
+        target[lid2[i]] = source[lid1[i]];
     }
 
     return *this;
@@ -1060,9 +1100,39 @@ VectorEpetra::size() const
     return 0;
 }
 
+void
+VectorEpetra::startGhostUpdate ( const VectorEpetra& vector )
+{
+    if ( !isGhostUpdateOf ( vector ) )
+    {
+        ERROR_MSG ( "VectorEpetra::startGhostUpdate ERROR : a Repeated vector and a Unique vector on the same MapEpetra are required\n" );
+    }
+
+    M_epetraMap->ghostExchange().startUpdate ( vector.epetraVector(), *M_epetraVector );
+}
+
+void
+VectorEpetra::finishGhostUpdate()
+{
+    ASSERT ( M_epetraMap.get() != 0, "Error! The vector does not have a valid MapEpetra.\n" );
+
+    M_epetraMap->ghostExchange().finishUpdate();
+}
+
 // ===================================================
 // Private Methods
 // ===================================================
+bool
+VectorEpetra::isGhostUpdateOf ( const VectorEpetra& vector ) const
+{
+    // the maps are identified through DataPtr(), so that no communication is needed
+    return M_mapType == Repeated && vector.M_mapType == Unique
+           && M_epetraMap.get() && vector.M_epetraMap.get()
+           && M_epetraMap->map ( Repeated )->DataPtr() == blockMap().DataPtr()
+           && M_epetraMap->map ( Unique ).get()
+           && M_epetraMap->map ( Unique )->DataPtr() == vector.blockMap().DataPtr();
+}
+
 VectorEpetra&
 VectorEpetra::Import (const Epetra_FEVector& vector, combineMode_Type combineMode )
 {
@@ -1079,8 +1149,14 @@ VectorEpetra::Import (const Epetra_FEVector& vector, combineMode_Type combineMod
 
     *this *= 0.; // because of a buggy behaviour in case of multidefined indeces.
 
-    Epetra_Export reducedExport ( blockMap(), vector.Map() );
-    M_epetraVector->Import ( vector, reducedExport, combineMode );
+    // The communication plan is kept as long as the two maps do not change
+    if ( !M_reducedExporter
+            || M_reducedExporter->SourceMap().DataPtr() != blockMap().DataPtr()
+            || M_reducedExporter->TargetMap().DataPtr() != vector.Map().DataPtr() )
+    {
+        M_reducedExporter.reset ( new Epetra_Export ( blockMap(), vector.Map() ) );
+    }
+    M_epetraVector->Import ( vector, *M_reducedExporter, combineMode );
 
     return *this;
 }
@@ -1101,8 +1177,13 @@ VectorEpetra::Export ( const Epetra_FEVector& vector, combineMode_Type combineMo
 
     *this *= 0.; // because of a buggy behaviour in case of multidefined indeces.
 
-    Epetra_Import reducedImport ( vector.Map(), blockMap() );
-    M_epetraVector->Export (vector, reducedImport, combineMode);
+    if ( !M_reducedImporter
+            || M_reducedImporter->SourceMap().DataPtr() != vector.Map().DataPtr()
+            || M_reducedImporter->TargetMap().DataPtr() != blockMap().DataPtr() )
+    {
+        M_reducedImporter.reset ( new Epetra_Import ( vector.Map(), blockMap() ) );
+    }
+    M_epetraVector->Export (vector, *M_reducedImporter, combineMode);
 
     return *this;
 }
@@ -425,6 +425,18 @@ public:
         return M_epetraVector->GlobalAssemble ( M_combineMode );
     }
 
+    //! Start the update of this Repeated vector from a Unique vector based on the same MapEpetra
+    /*!
+      The values are moved with the persistent plan returned by MapEpetra::ghostExchange().
+      Computations that do not need the ghost entries of this vector can be done before
+      calling finishGhostUpdate(). Only one update per MapEpetra can be in progress.
+      @param vector Unique vector to read the values from
+     */
+    void startGhostUpdate ( const VectorEpetra& vector );
+
+    //! Complete the update started by startGhostUpdate()
+    void finishGhostUpdate();
+
     //! Return the local Id of a global row
     /*!
       @param row Global row Id
@@ -483,6 +495,25 @@ public:
      */
     VectorEpetra& add ( const VectorEpetra& vector, const Int offset = 0 );
 
+    //! Add a scaled vector to the current vector: this += scalar * vector
+    /*!
+      When the two vectors have the same map this is a single Epetra Update,
+      without the temporary vector allocated by this += scalar * vector.
+      @param scalar Scalar factor
+      @param vector Vector to be scaled and added, it may be the current vector
+     */
+    VectorEpetra& add ( const data_type& scalar, const VectorEpetra& vector );
+
+    //! Combine the current vector with a scaled vector: this = scalar * vector + scalarThis * this
+    /*!
+      When the two vectors have the same map this is a single Epetra Update,
+      without temporary vectors: this = scalar * vector is update ( scalar, vector, 0. ).
+      @param scalar Factor of the given vector
+      @param vector Given vector, it may be the current vector
+      @param scalarThis Factor of the current vector
+     */
+    VectorEpetra& update ( const data_type& scalar, const VectorEpetra& vector, const data_type& scalarThis );
+
     //! Replace part of the vector with a given vector
     /*!
      * Typical examples are: (u,p) = p or (u,p) = u.
@@ -770,6 +801,14 @@ private:
     //! @name Private Methods
     //@{
 
+    //! Return true if this vector is the Repeated counterpart of the given Unique vector
+    /*!
+      In that case copying the vector into this one is a plain update of the ghost entries,
+      done with the persistent plan of the MapEpetra.
+      @param vector Vector to be copied into this one
+     */
+    bool isGhostUpdateOf ( const VectorEpetra& vector ) const;
+
     //! Import the value of a vector
     /*!
       Copies the value of a vector u. If the map is not the same,
@@ -816,6 +855,10 @@ private:
     MapEpetraType                  M_mapType;
     vectorPtr_Type                 M_epetraVector;
     combineMode_Type               M_combineMode;
+
+    //! Communication plans reused by Import() and Export() while the maps involved do not change
+    std::shared_ptr<Epetra_Export> M_reducedExporter;
+    std::shared_ptr<Epetra_Import> M_reducedImporter;
 };
 
 VectorEpetra operator- ( const VectorEpetra& vector );
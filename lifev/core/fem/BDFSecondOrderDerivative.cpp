@@ -96,10 +96,11 @@ BDFSecondOrderDerivative::first_der_old_dts(vector_Type& vec_old_timesteps) // N
 
     switch (M_BDForder) {
         case 1:
-        	vec_old_timesteps = -1.0 * M_states[M_sizeStencil-1]; // vec = -1.0 * d_n
+        	vec_old_timesteps.update ( -1.0, M_states[M_sizeStencil-1], 0. ); // vec = -1.0 * d_n
             break;
         case 2:
-        	vec_old_timesteps = -2.0 * M_states[M_sizeStencil-1] + 0.5 * M_states[M_sizeStencil-2]; // vec = -2.0 * d_n + 0.5 * d_{n-1}
+        	vec_old_timesteps.update ( -2.0, M_states[M_sizeStencil-1], 0. ); // vec = -2.0 * d_n + 0.5 * d_{n-1}
+        	vec_old_timesteps.add ( 0.5, M_states[M_sizeStencil-2] );
             break;
         default:
             break;
@@ -113,10 +114,13 @@ BDFSecondOrderDerivative::second_der_old_dts(vector_Type& vec_old_timesteps) //
 
     switch (M_BDForder) {
         case 1:
-        	vec_old_timesteps = -2.0 * M_states[M_sizeStencil-1] + 1.0 * M_states[M_sizeStencil-2]; // vec = -2 * d_n + 1.0 * d_{n-1}
+        	vec_old_timesteps.update ( -2.0, M_states[M_sizeStencil-1], 0. ); // vec = -2 * d_n + 1.0 * d_{n-1}
+        	vec_old_timesteps.add ( 1.0, M_states[M_sizeStencil-2] );
             break;
         case 2:
-        	vec_old_timesteps = -5.0 * M_states[M_sizeStencil-1] + 4.0 * M_states[M_sizeStencil-2] - 1.0 * M_states[M_sizeStencil-3]; // vec = -5 * d_n + 4.0 * d_{n-1} - 1.0 * d_{n-2}
+        	vec_old_timesteps.update ( -5.0, M_states[M_sizeStencil-1], 0. ); // vec = -5 * d_n + 4.0 * d_{n-1} - 1.0 * d_{n-2}
+        	vec_old_timesteps.add ( 4.0, M_states[M_sizeStencil-2] );
+        	vec_old_timesteps.add ( -1.0, M_states[M_sizeStencil-3] );
             break;
         default:
             break;
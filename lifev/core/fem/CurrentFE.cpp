@@ -90,68 +90,13 @@ CurrentFE::CurrentFE ( const ReferenceFE& refFE, const GeometricMap& geoMap, con
 
     M_dphiRefUpdated (false),
     M_d2phiRefUpdated (false),
-    M_divPhiRefUpdated (false)
+    M_divPhiRefUpdated (false),
+    M_constantJacobian (false)
 
 {
-    for ( UInt iterQuad (0); iterQuad < M_nbQuadPt; ++iterQuad )
-    {
-        for ( UInt iterNode (0); iterNode < M_nbNode; ++iterNode )
-        {
-            // --- PHI ---
-            if (M_refFE->hasPhi() )
-            {
-                for (UInt iterFEDim (0); iterFEDim < M_refFE->feDim(); ++iterFEDim)
-                {
-                    M_phi[iterNode][iterFEDim][iterQuad] = M_refFE->phi ( iterNode, iterFEDim,
-                                                                          M_quadRule->quadPointCoor (iterQuad) );
-                }
-            }
+    tabulateReferenceValues();
 
-            // --- DIV ---
-            if (M_refFE->hasDivPhi() )
-            {
-                M_divPhiRef[iterNode][iterQuad] = M_refFE->divPhi (iterNode,
-                                                                   M_quadRule->quadPointCoor (iterQuad) );
-            };
-
-
-            for ( UInt icoor (0); icoor < M_nbLocalCoor; ++icoor )
-            {
-                // --- DPHI ---
-                if (M_refFE->hasDPhi() )
-                {
-                    M_dphiRef[iterNode][icoor][iterQuad] = M_refFE->dPhi ( iterNode,
-                                                                           icoor,
-                                                                           M_quadRule->quadPointCoor (iterQuad) );
-                };
-
-                // --- D2PHI
-                if (M_refFE->hasD2Phi() )
-                {
-                    for ( UInt jcoor (0); jcoor < M_nbLocalCoor; ++jcoor )
-                    {
-                        M_d2phiRef[iterNode][icoor][jcoor][iterQuad] = M_refFE->d2Phi ( iterNode,
-                                                                                        icoor, jcoor,
-                                                                                        M_quadRule->quadPointCoor (iterQuad) );
-                    }
-                }
-            }
-        }
-        for ( UInt k (0); k < M_nbGeoNode; ++k )
-        {
-            for ( UInt icoor (0); icoor < M_nbLocalCoor; ++icoor )
-            {
-                M_dphiGeometricMap[k][icoor][iterQuad] = M_geoMap->dPhi ( k, icoor,
-                                                                          M_quadRule->quadPointCoor (iterQuad) );
-            }
-        }
-    }
-
-    M_phiUpdated = true;
-    M_dphiRefUpdated = true;
-    M_divPhiRefUpdated = true;
-    M_d2phiRefUpdated = true;
-    M_dphiGeometricMapUpdated = true;
+    checkConstantJacobian();
 }
 
 CurrentFE::CurrentFE ( const ReferenceFE& refFE, const GeometricMap& geoMap ) :
@@ -184,7 +129,8 @@ CurrentFE::CurrentFE ( const ReferenceFE& refFE, const GeometricMap& geoMap ) :
     M_phiVectUpdated          (false),
     M_dphiRefUpdated          (false),
     M_d2phiRefUpdated         (false),
-    M_divPhiRefUpdated        (false)
+    M_divPhiRefUpdated        (false),
+    M_constantJacobian        (false)
 
 {
     // Nothing to be done here
@@ -233,7 +179,8 @@ CurrentFE::CurrentFE (const CurrentFE& fe) :
     M_phiVectUpdated          (fe.M_phiVectUpdated),
     M_dphiRefUpdated          (fe.M_dphiRefUpdated),
     M_d2phiRefUpdated         (fe.M_d2phiRefUpdated),
-    M_divPhiRefUpdated        (fe.M_divPhiRefUpdated)
+    M_divPhiRefUpdated        (fe.M_divPhiRefUpdated),
+    M_constantJacobian        (fe.M_constantJacobian)
 {
     // Nothing to be done here
 }
@@ -766,6 +713,17 @@ void CurrentFE::setQuadRule (const QuadratureRule& newQuadRule)
     M_divPhiRefUpdated = false;
 
     // Update what can be updated
+    tabulateReferenceValues();
+
+    checkConstantJacobian();
+}
+
+void CurrentFE::tabulateReferenceValues()
+{
+    // The values in the reference element are shared by all the CurrentFE using the same quadrature
+    const ReferenceElement::tabulationPtr_Type tabulation ( M_refFE->tabulation ( *M_quadRule ) );
+    const ReferenceElement::tabulationPtr_Type geoTabulation ( M_geoMap->tabulation ( *M_quadRule ) );
+
     for ( UInt iterQuad (0); iterQuad < M_nbQuadPt; ++iterQuad )
     {
         for ( UInt iterNode (0); iterNode < M_nbNode; ++iterNode )
@@ -775,16 +733,14 @@ void CurrentFE::setQuadRule (const QuadratureRule& newQuadRule)
             {
                 for (UInt iterFEDim (0); iterFEDim < M_refFE->feDim(); ++iterFEDim)
                 {
-                    M_phi[iterNode][iterFEDim][iterQuad] = M_refFE->phi ( iterNode, iterFEDim,
-                                                                          M_quadRule->quadPointCoor (iterQuad) );
+                    M_phi[iterNode][iterFEDim][iterQuad] = tabulation->phi ( iterQuad, iterNode, iterFEDim );
                 }
             }
 
             // --- DIV ---
             if (M_refFE->hasDivPhi() )
             {
-                M_divPhiRef[iterNode][iterQuad] = M_refFE->divPhi (iterNode,
-                                                                   M_quadRule->quadPointCoor (iterQuad) );
+                M_divPhiRef[iterNode][iterQuad] = tabulation->divPhi ( iterQuad, iterNode );
             }
 
             for ( UInt icoor (0); icoor < M_nbLocalCoor; ++icoor )
@@ -792,9 +748,7 @@ void CurrentFE::setQuadRule (const QuadratureRule& newQuadRule)
                 // --- DPHI ---
                 if (M_refFE->hasDPhi() )
                 {
-                    M_dphiRef[iterNode][icoor][iterQuad] = M_refFE->dPhi ( iterNode,
-                                                                           icoor,
-                                                                           M_quadRule->quadPointCoor (iterQuad) );
+                    M_dphiRef[iterNode][icoor][iterQuad] = tabulation->dPhi ( iterQuad, iterNode, icoor );
                 }
 
                 // --- D2PHI ---
@@ -802,9 +756,7 @@ void CurrentFE::setQuadRule (const QuadratureRule& newQuadRule)
                 {
                     for ( UInt jcoor (0); jcoor < M_nbLocalCoor; ++jcoor )
                     {
-                        M_d2phiRef[iterNode][icoor][jcoor][iterQuad] = M_refFE->d2Phi ( iterNode,
-                                                                                        icoor, jcoor,
-                                                                                        M_quadRule->quadPointCoor (iterQuad) );
+                        M_d2phiRef[iterNode][icoor][jcoor][iterQuad] = tabulation->d2Phi ( iterQuad, iterNode, icoor, jcoor );
                     }
                 }
             }
@@ -813,8 +765,7 @@ void CurrentFE::setQuadRule (const QuadratureRule& newQuadRule)
         {
             for ( UInt icoor (0); icoor < M_nbLocalCoor; ++icoor )
             {
-                M_dphiGeometricMap[k][icoor][iterQuad] = M_geoMap->dPhi ( k, icoor,
-                                                                          M_quadRule->quadPointCoor (iterQuad) );
+                M_dphiGeometricMap[k][icoor][iterQuad] = geoTabulation->dPhi ( iterQuad, k, icoor );
             }
         }
     }
@@ -866,6 +817,26 @@ void CurrentFE::computeDphiGeometricMap()
         }
     }
     M_dphiGeometricMapUpdated = true;
+
+    checkConstantJacobian();
+}
+
+void CurrentFE::checkConstantJacobian()
+{
+    M_constantJacobian = ( M_nbQuadPt > 0 );
+    for (UInt iterQuad (1); iterQuad < M_nbQuadPt && M_constantJacobian; ++iterQuad)
+    {
+        for (UInt iterNode (0); iterNode < M_nbGeoNode; ++iterNode)
+        {
+            for (UInt iterCoor (0); iterCoor < M_nbLocalCoor; ++iterCoor)
+            {
+                if ( M_dphiGeometricMap[iterNode][iterCoor][iterQuad] != M_dphiGeometricMap[iterNode][iterCoor][0] )
+                {
+                    M_constantJacobian = false;
+                }
+            }
+        }
+    }
 }
 
 void CurrentFE::computeJacobian()
@@ -875,7 +846,10 @@ void CurrentFE::computeJacobian()
 
     Real partialSum;
 
-    for (UInt iterQuad (0); iterQuad < M_nbQuadPt ; ++iterQuad)
+    // For an affine map the jacobian is computed in the first node only
+    const UInt nbQuadPt ( M_constantJacobian ? 1 : M_nbQuadPt );
+
+    for (UInt iterQuad (0); iterQuad < nbQuadPt ; ++iterQuad)
     {
         for (UInt icoord (0); icoord < M_nbLocalCoor; ++icoord)
         {
@@ -890,6 +864,14 @@ void CurrentFE::computeJacobian()
             }
         }
     }
+
+    for (UInt iterQuad (nbQuadPt); iterQuad < M_nbQuadPt ; ++iterQuad)
+        for (UInt icoord (0); icoord < M_nbLocalCoor; ++icoord)
+            for (UInt jcoord (0); jcoord < M_nbLocalCoor; ++jcoord)
+            {
+                M_jacobian[icoord][jcoord][iterQuad] = M_jacobian[icoord][jcoord][0];
+            }
+
     M_jacobianUpdated = true;
 }
 
@@ -897,7 +879,9 @@ void CurrentFE::computeTInverseJacobian()
 {
     ASSERT (M_jacobianUpdated, "Missing update: jacobian");
 
-    for (UInt iterQuad (0); iterQuad < M_nbQuadPt ; ++iterQuad)
+    const UInt nbQuadPt ( M_constantJacobian ? 1 : M_nbQuadPt );
+
+    for (UInt iterQuad (0); iterQuad < nbQuadPt ; ++iterQuad)
     {
         switch (M_nbLocalCoor)
         {
@@ -967,6 +951,13 @@ void CurrentFE::computeTInverseJacobian()
 
     }
 
+    for (UInt iterQuad (nbQuadPt); iterQuad < M_nbQuadPt ; ++iterQuad)
+        for (UInt icoord (0); icoord < M_nbLocalCoor; ++icoord)
+            for (UInt jcoord (0); jcoord < M_nbLocalCoor; ++jcoord)
+            {
+                M_tInverseJacobian[icoord][jcoord][iterQuad] = M_tInverseJacobian[icoord][jcoord][0];
+            }
+
     M_tInverseJacobianUpdated = true;
 }
 
@@ -974,7 +965,9 @@ void CurrentFE::computeDetJacobian()
 {
     ASSERT (M_jacobianUpdated, "Missing update: jacobian");
 
-    for (UInt iterQuad (0); iterQuad < M_nbQuadPt ; ++iterQuad)
+    const UInt nbQuadPt ( M_constantJacobian ? 1 : M_nbQuadPt );
+
+    for (UInt iterQuad (0); iterQuad < nbQuadPt ; ++iterQuad)
     {
         switch (M_nbLocalCoor)
         {
@@ -1025,6 +1018,11 @@ void CurrentFE::computeDetJacobian()
                 break;
         }
     }
+
+    for (UInt iterQuad (nbQuadPt); iterQuad < M_nbQuadPt ; ++iterQuad)
+    {
+        M_detJacobian[iterQuad] = M_detJacobian[0];
+    }
     M_detJacobianUpdated = true;
 }
 
@@ -580,6 +580,12 @@ protected:
     //! Compute the values of the derivatives of the mapping in the quadrature nodes
     void computeDphiGeometricMap();
 
+    //! Check whether the derivatives of the mapping are constant over the quadrature nodes
+    void checkConstantJacobian();
+
+    //! Copy the values of the basis functions in the quadrature nodes from the tabulation of the reference elements
+    void tabulateReferenceValues();
+
     //! Compute the jacobian in the quadrature nodes
     void computeJacobian();
 
@@ -669,6 +675,10 @@ protected:
     bool M_d2phiRefUpdated;
     bool M_divPhiRefUpdated;
 
+    // True if the derivatives of the geometric map are the same in all the
+    // quadrature nodes (affine map), so that the jacobian is computed once
+    bool M_constantJacobian;
+
     // OLD FUNCTIONS
 
 public:
@@ -847,7 +857,6 @@ void CurrentFE::updateJac ( const MeshElementMarkedType& geoele )
     M_currentLocalId = geoele.localId();
     //! compute the jacobian and its determinant...
     computeCellNodes (geoele);
-    computeDphiGeometricMap();
     computeJacobian();
     computeDetJacobian();
     computeWDetJacobian();
@@ -865,7 +874,6 @@ void CurrentFE::updateJacQuadPt ( const MeshElementMarkedType& geoele )
     M_currentLocalId = geoele.localId();
     // compute the jacobian and its determinant...
     computeCellNodes (geoele);
-    computeDphiGeometricMap();
     computeJacobian();
     computeDetJacobian();
     computeWDetJacobian();
@@ -885,13 +893,11 @@ void CurrentFE::updateFirstDeriv ( const MeshElementMarkedType& geoele )
     M_currentLocalId = geoele.localId();
     //! compute the inverse jacobian...
     computeCellNodes (geoele);
-    computeDphiGeometricMap();
     computeJacobian();
     computeDetJacobian();
     computeWDetJacobian();
     computeTInverseJacobian();
-    //! product InvJac by dPhiRef to compute phiDer
-    computeDphiRef();
+    //! product InvJac by dPhiRef (tabulated with the quadrature rule) to compute phiDer
     computeDphi();
 }
 
@@ -907,13 +913,11 @@ void CurrentFE::updateFirstDerivQuadPt ( const MeshElementMarkedType& geoele )
     M_currentLocalId = geoele.localId();
     //! compute the inverse jacobian...
     computeCellNodes (geoele);
-    computeDphiGeometricMap();
     computeJacobian();
     computeDetJacobian();
     computeWDetJacobian();
     computeTInverseJacobian();
-    //! product InvJac by dPhiRef to compute phiDer
-    computeDphiRef();
+    //! product InvJac by dPhiRef (tabulated with the quadrature rule) to compute phiDer
     computeDphi();
     //! and the coordinates of the quadrature points
     computeQuadNodes();
@@ -932,13 +936,11 @@ void CurrentFE::updateSecondDeriv ( const MeshElementMarkedType& geoele )
     M_currentLocalId = geoele.localId();
     //! compute the inverse jacobian...
     computeCellNodes (geoele);
-    computeDphiGeometricMap();
     computeJacobian();
     computeDetJacobian();
     computeWDetJacobian();
     computeTInverseJacobian();
     //! compute the second derivative
-    computeD2phiRef();
     computeD2phi();
 }
 
@@ -954,13 +956,11 @@ void CurrentFE::updateSecondDerivQuadPt ( const MeshElementMarkedType& geoele )
     M_currentLocalId = geoele.localId();
     //! compute the inverse jacobian...
     computeCellNodes (geoele);
-    computeDphiGeometricMap();
     computeJacobian();
     computeDetJacobian();
     computeWDetJacobian();
     computeTInverseJacobian();
     //! compute the second derivative
-    computeD2phiRef();
     computeD2phi();
     //! and the coordinates of the quadrature points
     computeQuadNodes();
@@ -977,15 +977,12 @@ void CurrentFE::updateFirstSecondDeriv ( const MeshElementMarkedType& geoele )
     M_currentLocalId = geoele.localId();
     //! compute the inverse jacobian...
     computeCellNodes (geoele);
-    computeDphiGeometricMap();
     computeJacobian();
     computeDetJacobian();
     computeWDetJacobian();
     computeTInverseJacobian();
     //! compute phiDer and phiDer2
-    computeDphiRef();
     computeDphi();
-    computeD2phiRef();
     computeD2phi();
 }
 /*!
@@ -1000,14 +997,11 @@ void CurrentFE::updateFirstSecondDerivQuadPt ( const MeshElementMarkedType& geoe
     M_currentLocalId = geoele.localId();
     //! compute the inverse jacobian...
     computeCellNodes (geoele);
-    computeDphiGeometricMap();
     computeJacobian();
     computeDetJacobian();
     computeWDetJacobian();
     computeTInverseJacobian();
     //! compute phiDer and phiDer2
-    computeDphiRef();
-    computeD2phiRef();
     computeDphi();
     computeD2phi();
     //! and the coordinates of the quadrature points
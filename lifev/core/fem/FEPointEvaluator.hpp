@@ -0,0 +1,566 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Evaluation of finite element functions in a fixed set of points
+
+    @date 10-2026
+ */
+
+#ifndef _FEPOINTEVALUATOR_HPP_
+#define _FEPOINTEVALUATOR_HPP_ 1
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+#include <lifev/core/array/VectorSmall.hpp>
+#include <lifev/core/fem/FESpace.hpp>
+
+namespace LifeV
+{
+
+//! FEPointEvaluator - Evaluate finite element functions in a fixed set of points
+/*!
+  The class is built once for a set of points, given identically on all the processes
+  (probes, virtual electrodes, nodes of a non-matching interface, ...):
+  <ol>
+  <li> each process locates the points in its local elements, using a uniform grid of
+       bins over the bounding boxes of the elements, so that only a few elements are
+       tested for each point;
+  <li> each point is then assigned to the process with the lowest rank containing it;
+  <li> the owner stores, for each of its points, the global ids of the dofs of the
+       containing element and the values and the gradients of the basis functions.
+  </ol>
+  The evaluation of a field is then a weighted sum over the stored dofs for all the points,
+  followed by a single reduction which gives the values of all the points on all the processes.
+
+  The location of the points relies on CurrentFE::coorBackMap, which is exact for affine
+  simplicial elements only (segments, triangles, tetrahedra).
+ */
+template < typename MeshType, typename MapType >
+class FEPointEvaluator
+{
+public:
+
+    //! @name Public Types
+    //@{
+
+    typedef MeshType                                 mesh_Type;
+    typedef MapType                                  map_Type;
+    typedef FESpace < mesh_Type, map_Type >          FESpace_Type;
+    typedef std::shared_ptr < FESpace_Type >       FESpacePtr_Type;
+    typedef VectorEpetra                             vector_Type;
+    typedef Vector3D                                 point_Type;
+
+    //@}
+
+    //! @name Constructors & Destructor
+    //@{
+
+    //! Constructor: locate the points in the mesh (collective call)
+    /*!
+      @param feSpace Finite element space of the fields to be evaluated
+      @param points Points where the fields are evaluated, the same on all the processes
+      @param tolerance Tolerance on the reference coordinates to consider a point inside an element.
+             The bins are searched with the corresponding geometric tolerance, i.e. the
+             tolerance times the largest size of the local elements.
+     */
+    FEPointEvaluator ( const FESpacePtr_Type& feSpace,
+                       const std::vector<point_Type>& points,
+                       const Real& tolerance = 1e-10 );
+
+    //! Destructor
+    ~FEPointEvaluator() {}
+
+    //@}
+
+    //! @name Methods
+    //@{
+
+    //! Evaluate a field in all the points (collective call)
+    /*!
+      @param solution Vector of the field, with a unique or repeated map
+      @param values Values in the points, the same on all the processes (0 for the points not found)
+      @param component Component of the field, for vectorial finite element spaces
+     */
+    void evaluate ( const vector_Type& solution, std::vector<Real>& values, const UInt& component = 0 ) const;
+
+    //! Evaluate the gradient of a field in all the points (collective call)
+    /*!
+      @param solution Vector of the field, with a unique or repeated map
+      @param gradients Gradients in the points, the same on all the processes (0 for the points not found)
+      @param component Component of the field, for vectorial finite element spaces
+     */
+    void evaluateGradient ( const vector_Type& solution, std::vector<point_Type>& gradients, const UInt& component = 0 ) const;
+
+    //@}
+
+    //! @name Get Methods
+    //@{
+
+    //! Number of points
+    UInt numPoints() const
+    {
+        return M_owner.size();
+    }
+
+    //! Return true if the i-th point is inside the mesh
+    bool isFound ( const UInt& i ) const
+    {
+        return M_owner[ i ] >= 0;
+    }
+
+    //! Rank of the process owning the i-th point, -1 if it has not been found
+    Int owner ( const UInt& i ) const
+    {
+        return M_owner[ i ];
+    }
+
+    //! Local id of the element containing the i-th point, only on the owner of the point
+    ID elementID ( const UInt& i ) const
+    {
+        ASSERT ( M_owner[ i ] == M_feSpace->map().comm().MyPID(), "The point is not owned by this process" );
+        return M_elementIDs[ M_localIndex[ i ] ];
+    }
+
+    //@}
+
+private:
+
+    //! @name Private Methods
+    //@{
+
+    //! Build the grid of bins over the bounding boxes of the local elements
+    void buildBins();
+
+    //! Find the local element containing the point, return false if there is none
+    bool locate ( const point_Type& point, ID& elementID, point_Type& referencePoint, CurrentFE& fe ) const;
+
+    //! Gather the values of the dofs of a field for the local points
+    void gatherDofValues ( const vector_Type& solution, const UInt& component, std::vector<Real>& dofValues ) const;
+
+    //@}
+
+    FESpacePtr_Type M_feSpace;
+
+    // Tolerance on the reference coordinates, and on the physical coordinates for the bins
+    Real            M_tolerance;
+    Real            M_geometricTolerance;
+
+    // Bins: bounding box of the local mesh, number of bins and size in each direction,
+    // elements intersecting each bin stored contiguously (CSR format)
+    point_Type        M_binOrigin;
+    point_Type        M_binSize;
+    UInt              M_numBins[ 3 ];
+    std::vector<UInt> M_binOffsets;
+    std::vector<ID>   M_binElements;
+
+    // Owner of each point
+    std::vector<Int>  M_owner;
+
+    // Position of each point in the local arrays, only for the points owned by this process
+    std::vector<UInt> M_localIndex;
+
+    // Local points: index of the point, element, values and gradients of the basis functions
+    std::vector<UInt> M_localPoints;
+    std::vector<ID>   M_elementIDs;
+    std::vector<Real> M_phi;
+    std::vector<Real> M_dphi;
+};
+
+// ===================================================
+// Constructors & Destructor
+// ===================================================
+
+template < typename MeshType, typename MapType >
+FEPointEvaluator < MeshType, MapType >::
+FEPointEvaluator ( const FESpacePtr_Type& feSpace,
+                   const std::vector<point_Type>& points,
+                   const Real& tolerance ) :
+    M_feSpace ( feSpace ),
+    M_tolerance ( tolerance ),
+    M_geometricTolerance ( 0. ),
+    M_owner ( points.size(), -1 ),
+    M_localIndex ( points.size(), 0 )
+{
+    ASSERT ( feSpace->refFE().shape() == TETRA || feSpace->refFE().shape() == TRIANGLE || feSpace->refFE().shape() == LINE,
+             "FEPointEvaluator works only with simplicial elements" );
+
+    buildBins();
+
+    const Epetra_Comm& comm ( M_feSpace->map().comm() );
+    const Int myPID ( comm.MyPID() );
+    const UInt nbPoints ( points.size() );
+
+    // Locate the points in the local mesh
+    CurrentFE fe ( M_feSpace->fe() );
+    std::vector<Int> localOwner ( nbPoints, comm.NumProc() );
+    std::vector<ID> elementIDs ( nbPoints, 0 );
+    std::vector<point_Type> referencePoints ( nbPoints );
+    for ( UInt i ( 0 ); i < nbPoints; ++i )
+    {
+        if ( locate ( points[ i ], elementIDs[ i ], referencePoints[ i ], fe ) )
+        {
+            localOwner[ i ] = myPID;
+        }
+    }
+
+    // Points shared by several processes (on the interfaces) belong to the lowest rank
+    std::vector<Int> globalOwner ( nbPoints, comm.NumProc() );
+    if ( nbPoints > 0 )
+    {
+        comm.MinAll ( &localOwner[ 0 ], &globalOwner[ 0 ], nbPoints );
+    }
+
+    // Values and gradients of the basis functions in the owned points
+    const UInt nbDof ( M_feSpace->refFE().nbDof() );
+    const UInt nbLocalCoor ( M_feSpace->refFE().nbLocalCoor() );
+    for ( UInt i ( 0 ); i < nbPoints; ++i )
+    {
+        if ( globalOwner[ i ] < comm.NumProc() )
+        {
+            M_owner[ i ] = globalOwner[ i ];
+        }
+        if ( M_owner[ i ] != myPID )
+        {
+            continue;
+        }
+
+        M_localIndex[ i ] = M_localPoints.size();
+        M_localPoints.push_back ( i );
+        M_elementIDs.push_back ( elementIDs[ i ] );
+
+        const point_Type& hat ( referencePoints[ i ] );
+        fe.update ( M_feSpace->mesh()->element ( elementIDs[ i ] ), UPDATE_ONLY_CELL_NODES );
+
+        Real inverseJacobian[ 3 ][ 3 ] = { { 0., 0., 0. }, { 0., 0., 0. }, { 0., 0., 0. } };
+        for ( UInt iCoor ( 0 ); iCoor < nbLocalCoor; ++iCoor )
+        {
+            for ( UInt jCoor ( 0 ); jCoor < nbLocalCoor; ++jCoor )
+            {
+                inverseJacobian[ iCoor ][ jCoor ] = fe.pointInverseJacobian ( hat[ 0 ], hat[ 1 ], hat[ 2 ], iCoor, jCoor );
+            }
+        }
+
+        for ( UInt iDof ( 0 ); iDof < nbDof; ++iDof )
+        {
+            M_phi.push_back ( M_feSpace->refFE().phi ( iDof, hat[ 0 ], hat[ 1 ], hat[ 2 ] ) );
+
+            Real dphiRef[ 3 ] = { 0., 0., 0. };
+            for ( UInt jCoor ( 0 ); jCoor < nbLocalCoor; ++jCoor )
+            {
+                dphiRef[ jCoor ] = M_feSpace->refFE().dPhi ( iDof, jCoor, hat[ 0 ], hat[ 1 ], hat[ 2 ] );
+            }
+            for ( UInt iCoor ( 0 ); iCoor < 3; ++iCoor )
+            {
+                Real dphi ( 0. );
+                for ( UInt jCoor ( 0 ); jCoor < nbLocalCoor; ++jCoor )
+                {
+                    dphi += dphiRef[ jCoor ] * inverseJacobian[ iCoor ][ jCoor ];
+                }
+                M_dphi.push_back ( dphi );
+            }
+        }
+    }
+}
+
+// ===================================================
+// Methods
+// ===================================================
+
+template < typename MeshType, typename MapType >
+void
+FEPointEvaluator < MeshType, MapType >::
+evaluate ( const vector_Type& solution, std::vector<Real>& values, const UInt& component ) const
+{
+    const UInt nbDof ( M_feSpace->refFE().nbDof() );
+
+    std::vector<Real> dofValues;
+    gatherDofValues ( solution, component, dofValues );
+
+    std::vector<Real> localValues ( numPoints(), 0. );
+    for ( UInt k ( 0 ); k < M_localPoints.size(); ++k )
+    {
+        const Real* phi ( &M_phi[ k * nbDof ] );
+        const Real* dofValue ( &dofValues[ k * nbDof ] );
+
+        Real value ( 0. );
+        for ( UInt iDof ( 0 ); iDof < nbDof; ++iDof )
+        {
+            value += dofValue[ iDof ] * phi[ iDof ];
+        }
+        localValues[ M_localPoints[ k ] ] = value;
+    }
+
+    values.assign ( numPoints(), 0. );
+    if ( numPoints() > 0 )
+    {
+        M_feSpace->map().comm().SumAll ( &localValues[ 0 ], &values[ 0 ], numPoints() );
+    }
+}
+
+template < typename MeshType, typename MapType >
+void
+FEPointEvaluator < MeshType, MapType >::
+evaluateGradient ( const vector_Type& solution, std::vector<point_Type>& gradients, const UInt& component ) const
+{
+    const UInt nbDof ( M_feSpace->refFE().nbDof() );
+
+    std::vector<Real> dofValues;
+    gatherDofValues ( solution, component, dofValues );
+
+    std::vector<Real> localGradients ( 3 * numPoints(), 0. );
+    for ( UInt k ( 0 ); k < M_localPoints.size(); ++k )
+    {
+        const Real* dphi ( &M_dphi[ 3 * k * nbDof ] );
+        const Real* dofValue ( &dofValues[ k * nbDof ] );
+        Real* gradient ( &localGradients[ 3 * M_localPoints[ k ] ] );
+
+        for ( UInt iDof ( 0 ); iDof < nbDof; ++iDof )
+        {
+            for ( UInt iCoor ( 0 ); iCoor < 3; ++iCoor )
+            {
+                gradient[ iCoor ] += dofValue[ iDof ] * dphi[ 3 * iDof + iCoor ];
+            }
+        }
+    }
+
+    std::vector<Real> globalGradients ( 3 * numPoints(), 0. );
+    if ( numPoints() > 0 )
+    {
+        M_feSpace->map().comm().SumAll ( &localGradients[ 0 ], &globalGradients[ 0 ], 3 * numPoints() );
+    }
+
+    gradients.resize ( numPoints() );
+    for ( UInt i ( 0 ); i < numPoints(); ++i )
+    {
+        gradients[ i ] = point_Type ( globalGradients[ 3 * i ], globalGradients[ 3 * i + 1 ], globalGradients[ 3 * i + 2 ] );
+    }
+}
+
+// ===================================================
+// Private Methods
+// ===================================================
+
+template < typename MeshType, typename MapType >
+void
+FEPointEvaluator < MeshType, MapType >::
+buildBins()
+{
+    const mesh_Type& mesh ( *M_feSpace->mesh() );
+    const UInt numElements ( mesh.numElements() );
+    const UInt nbVertices ( MeshType::geoShape_Type::S_numPoints );
+
+    // Bounding boxes of the elements
+    std::vector<point_Type> boxMin ( numElements );
+    std::vector<point_Type> boxMax ( numElements );
+    point_Type meshMin ( 0., 0., 0. );
+    point_Type meshMax ( 0., 0., 0. );
+    Real elementSize ( 0. );
+    for ( UInt iElement ( 0 ); iElement < numElements; ++iElement )
+    {
+        for ( UInt iCoor ( 0 ); iCoor < 3; ++iCoor )
+        {
+            Real minCoor ( mesh.element ( iElement ).point ( 0 ).coordinate ( iCoor ) );
+            Real maxCoor ( minCoor );
+            for ( UInt iPoint ( 1 ); iPoint < nbVertices; ++iPoint )
+            {
+                const Real coor ( mesh.element ( iElement ).point ( iPoint ).coordinate ( iCoor ) );
+                minCoor = std::min ( minCoor, coor );
+                maxCoor = std::max ( maxCoor, coor );
+            }
+            boxMin[ iElement ][ iCoor ] = minCoor;
+            boxMax[ iElement ][ iCoor ] = maxCoor;
+            elementSize = std::max ( elementSize, maxCoor - minCoor );
+
+            if ( iElement == 0 || minCoor < meshMin[ iCoor ] )
+            {
+                meshMin[ iCoor ] = minCoor;
+            }
+            if ( iElement == 0 || maxCoor > meshMax[ iCoor ] )
+            {
+                meshMax[ iCoor ] = maxCoor;
+            }
+        }
+    }
+
+    // A point within M_tolerance of an element in reference coordinates is at most
+    // M_tolerance times the size of the element away from it
+    M_geometricTolerance = M_tolerance * elementSize;
+
+    // About one bin per element: the bins are cubes of side h in the directions where the mesh extends
+    Real volume ( 1. );
+    UInt dimension ( 0 );
+    for ( UInt iCoor ( 0 ); iCoor < 3; ++iCoor )
+    {
+        if ( meshMax[ iCoor ] > meshMin[ iCoor ] )
+        {
+            volume *= meshMax[ iCoor ] - meshMin[ iCoor ];
+            ++dimension;
+        }
+    }
+    const Real h ( dimension > 0 ? std::pow ( volume / std::max<UInt> ( numElements, 1 ), 1. / dimension ) : 1. );
+
+    UInt totalBins ( 1 );
+    M_binOrigin = meshMin;
+    for ( UInt iCoor ( 0 ); iCoor < 3; ++iCoor )
+    {
+        const Real extent ( meshMax[ iCoor ] - meshMin[ iCoor ] );
+        M_numBins[ iCoor ] = std::max<UInt> ( 1, static_cast<UInt> ( extent / h ) );
+        M_binSize[ iCoor ] = extent > 0. ? extent / M_numBins[ iCoor ] : 1.;
+        totalBins *= M_numBins[ iCoor ];
+    }
+
+    // Each element is stored in all the bins intersecting its bounding box, enlarged by the
+    // geometric tolerance: count, then fill
+    M_binOffsets.assign ( totalBins + 1, 0 );
+    for ( UInt pass ( 0 ); pass < 2; ++pass )
+    {
+        std::vector<UInt> position ( M_binOffsets.begin(), M_binOffsets.end() - 1 );
+        for ( UInt iElement ( 0 ); iElement < numElements; ++iElement )
+        {
+            UInt first[ 3 ];
+            UInt last[ 3 ];
+            for ( UInt iCoor ( 0 ); iCoor < 3; ++iCoor )
+            {
+                const Real firstPosition ( ( boxMin[ iElement ][ iCoor ] - M_geometricTolerance - M_binOrigin[ iCoor ] ) / M_binSize[ iCoor ] );
+                const Real lastPosition ( ( boxMax[ iElement ][ iCoor ] + M_geometricTolerance - M_binOrigin[ iCoor ] ) / M_binSize[ iCoor ] );
+                first[ iCoor ] = std::min<UInt> ( M_numBins[ iCoor ] - 1, static_cast<UInt> ( std::max ( firstPosition, 0. ) ) );
+                last[ iCoor ] = std::min<UInt> ( M_numBins[ iCoor ] - 1, static_cast<UInt> ( std::max ( lastPosition, 0. ) ) );
+            }
+
+            for ( UInt i ( first[ 0 ] ); i <= last[ 0 ]; ++i )
+                for ( UInt j ( first[ 1 ] ); j <= last[ 1 ]; ++j )
+                    for ( UInt k ( first[ 2 ] ); k <= last[ 2 ]; ++k )
+                    {
+                        const UInt bin ( ( i * M_numBins[ 1 ] + j ) * M_numBins[ 2 ] + k );
+                        if ( pass == 0 )
+                        {
+                            ++M_binOffsets[ bin + 1 ];
+                        }
+                        else
+                        {
+                            M_binElements[ position[ bin ]++ ] = iElement;
+                        }
+                    }
+        }
+
+        if ( pass == 0 )
+        {
+            for ( UInt bin ( 0 ); bin < totalBins; ++bin )
+            {
+                M_binOffsets[ bin + 1 ] += M_binOffsets[ bin ];
+            }
+            M_binElements.resize ( M_binOffsets[ totalBins ] );
+        }
+    }
+}
+
+template < typename MeshType, typename MapType >
+bool
+FEPointEvaluator < MeshType, MapType >::
+locate ( const point_Type& point, ID& elementID, point_Type& referencePoint, CurrentFE& fe ) const
+{
+    if ( M_binElements.empty() )
+    {
+        return false;
+    }
+
+    // Bin containing the point, points slightly outside of the bounding box go to the closest bin.
+    // The comparisons are done in physical coordinates, with the geometric tolerance.
+    UInt index[ 3 ];
+    for ( UInt iCoor ( 0 ); iCoor < 3; ++iCoor )
+    {
+        const Real distance ( point[ iCoor ] - M_binOrigin[ iCoor ] );
+        if ( distance < - M_geometricTolerance || distance > M_numBins[ iCoor ] * M_binSize[ iCoor ] + M_geometricTolerance )
+        {
+            return false;
+        }
+        index[ iCoor ] = std::min<UInt> ( M_numBins[ iCoor ] - 1, static_cast<UInt> ( std::max ( distance / M_binSize[ iCoor ], 0. ) ) );
+    }
+    const UInt bin ( ( index[ 0 ] * M_numBins[ 1 ] + index[ 1 ] ) * M_numBins[ 2 ] + index[ 2 ] );
+
+    const UInt nbLocalCoor ( M_feSpace->refFE().nbLocalCoor() );
+    for ( UInt iCandidate ( M_binOffsets[ bin ] ); iCandidate < M_binOffsets[ bin + 1 ]; ++iCandidate )
+    {
+        const ID candidate ( M_binElements[ iCandidate ] );
+        fe.update ( M_feSpace->mesh()->element ( candidate ), UPDATE_ONLY_CELL_NODES );
+
+        Real hat[ 3 ] = { 0., 0., 0. };
+        fe.coorBackMap ( point[ 0 ], point[ 1 ], point[ 2 ], hat[ 0 ], hat[ 1 ], hat[ 2 ] );
+
+        // Barycentric coordinates of the simplex
+        bool inside ( true );
+        Real sum ( 0. );
+        for ( UInt iCoor ( 0 ); iCoor < nbLocalCoor; ++iCoor )
+        {
+            inside = inside && hat[ iCoor ] >= - M_tolerance;
+            sum += hat[ iCoor ];
+        }
+        if ( inside && sum <= 1. + M_tolerance )
+        {
+            elementID = candidate;
+            referencePoint = point_Type ( hat[ 0 ], hat[ 1 ], hat[ 2 ] );
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template < typename MeshType, typename MapType >
+void
+FEPointEvaluator < MeshType, MapType >::
+gatherDofValues ( const vector_Type& solution, const UInt& component, std::vector<Real>& dofValues ) const
+{
+    // The dofs of the elements may be owned by other processes
+    if ( solution.mapType() != Repeated )
+    {
+        const vector_Type repeatedSolution ( solution, Repeated );
+        gatherDofValues ( repeatedSolution, component, dofValues );
+        return;
+    }
+
+    const UInt nbDof ( M_feSpace->refFE().nbDof() );
+    const UInt offset ( component * M_feSpace->dof().numTotalDof() );
+
+    dofValues.resize ( M_localPoints.size() * nbDof );
+    for ( UInt k ( 0 ); k < M_localPoints.size(); ++k )
+    {
+        for ( UInt iDof ( 0 ); iDof < nbDof; ++iDof )
+        {
+            dofValues[ k * nbDof + iDof ] = solution[ offset + M_feSpace->dof().localToGlobalMap ( M_elementIDs[ k ], iDof ) ];
+        }
+    }
+}
+
+} // namespace LifeV
+
+#endif /* _FEPOINTEVALUATOR_HPP_ */
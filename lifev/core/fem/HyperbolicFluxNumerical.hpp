@@ -36,6 +36,9 @@
 #ifndef _HYPERBOLICNUMERICALFLUXES_H_
 #define _HYPERBOLICNUMERICALFLUXES_H_ 1
 
+#include <algorithm>
+#include <cmath>
+
 #include <boost/bind.hpp>
 #include <lifev/core/fem/FESpace.hpp>
 #include <lifev/core/algorithm/SolverAztecOO.hpp>
@@ -73,9 +76,10 @@ Real functionDotNormal ( const Real&              unknown,
                               fieldsValues.begin(), fieldsValues.end() );
 
     // Compute  \sum_{i} physicalFlux(i) * n(i)
+    const Vector functionValue ( function ( t, x, y, z, unknownAndFields ) );
     for ( UInt nDim (0); nDim < problemDimension; ++nDim )
     {
-        valueFunctionDotNormal += plusMinus * function ( t, x, y, z, unknownAndFields ) [nDim] * normal[nDim];
+        valueFunctionDotNormal += plusMinus * functionValue[nDim] * normal[nDim];
     }
 
     return valueFunctionDotNormal;
@@ -94,7 +98,7 @@ Real absFunctionDotNormal ( const Real&              unknown,
 {
     Real valueFunctionDotNormal (0);
     const UInt problemDimension ( normal.size() );
-    std::vector<Real> unknownAndFields ( fieldsValues.size() + 1, 0. );
+    std::vector<Real> unknownAndFields ( 1, 0. );
 
     // Add to the vector unknownAndFields the values of the unknown then the value of the external fields.
     unknownAndFields[0] = unknown;
@@ -102,9 +106,10 @@ Real absFunctionDotNormal ( const Real&              unknown,
                               fieldsValues.begin(), fieldsValues.end() );
 
     // Compute \sum_{i} physicalFlux(i) * n(i)
+    const Vector functionValue ( function ( t, x, y, z, unknownAndFields ) );
     for ( LifeV::UInt nDim (0); nDim < problemDimension; ++nDim )
     {
-        valueFunctionDotNormal += function ( t, x, y, z, unknownAndFields ) [nDim] * normal[nDim];
+        valueFunctionDotNormal += functionValue[nDim] * normal[nDim];
     }
 
     return plusMinus * std::fabs ( valueFunctionDotNormal );
@@ -211,6 +216,14 @@ public:
                               const Real&        z = 0 ) const = 0;
     //@}
 
+    //! @name Methods
+    //@{
+
+    //! Return a copy of the numerical flux, allocated with new.
+    virtual AbstractNumericalFlux* clone () const = 0;
+
+    //@}
+
 
     //! @name Set Methods
     //@{
@@ -259,13 +272,13 @@ public:
       @param unknown The value of the unknown.
       @return The value of \f$ \mathbf{ \hat{ F } } \cdot \mathbf{ n }\f$ in the point \f$ (x, y, z, t, u) \f$.
     */
-    inline Real physicalFluxDotNormal ( const normal_Type& normal,
-                                        const UInt&        iElem,
-                                        const Real&        t,
-                                        const Real&        x,
-                                        const Real&        y,
-                                        const Real&        z,
-                                        const Real&        unknown ) const
+    virtual Real physicalFluxDotNormal ( const normal_Type& normal,
+                                         const UInt&        iElem,
+                                         const Real&        t,
+                                         const Real&        x,
+                                         const Real&        y,
+                                         const Real&        z,
+                                         const Real&        unknown ) const
     {
         return computeFunctionDotNormal ( M_physicalFlux, normal, iElem, t, x, y, z, +1 ) ( unknown );
     }
@@ -281,13 +294,13 @@ public:
       @param unknown The value of the unknown.
       @return The value of \f$ \mathbf{ \hat{ F^\prime } } \cdot \mathbf{ n }\f$ in the point \f$ (x, y, z, t, u) \f$.
     */
-    inline Real firstDerivativePhysicalFluxDotNormal ( const normal_Type& normal,
-                                                       const UInt&        iElem,
-                                                       const Real&        t,
-                                                       const Real&        x,
-                                                       const Real&        y,
-                                                       const Real&        z,
-                                                       const Real&        unknown ) const
+    virtual Real firstDerivativePhysicalFluxDotNormal ( const normal_Type& normal,
+                                                        const UInt&        iElem,
+                                                        const Real&        t,
+                                                        const Real&        x,
+                                                        const Real&        y,
+                                                        const Real&        z,
+                                                        const Real&        unknown ) const
     {
         return computeFunctionDotNormal ( M_firstDerivativePhysicalFlux, normal, iElem, t, x, y, z, +1 ) ( unknown );
     }
@@ -310,14 +323,14 @@ public:
       @note We assume left and right side of \f$ e \f$ is given by: the normal direction goes
       from the left side to the right side.
     */
-    Real normInfinity ( const Real&        leftState,
-                        const Real&        rightState,
-                        const normal_Type& normal,
-                        const UInt&        iElem,
-                        const Real&        t = 0,
-                        const Real&        x = 0,
-                        const Real&        y = 0,
-                        const Real&        z = 0 ) const;
+    virtual Real normInfinity ( const Real&        leftState,
+                                const Real&        rightState,
+                                const normal_Type& normal,
+                                const UInt&        iElem,
+                                const Real&        t = 0,
+                                const Real&        x = 0,
+                                const Real&        y = 0,
+                                const Real&        z = 0 ) const;
 
     //@}
 
@@ -326,6 +339,13 @@ protected:
     //! @name Protected Methods
     //@{
 
+    //! Values of the external fields in an element.
+    /*!
+      @param iElem The ID of the current element in the mesh.
+      @param values The values of the external fields, the components of the i-th field start at i * fieldDim.
+    */
+    void externalFieldsValues ( const UInt& iElem, std::vector<Real>& values ) const;
+
     //! Return a scalar function from a general vector function dot normal in a given point of a face.
     /*!
       @param function Function to be reduced.
@@ -432,21 +452,11 @@ normInfinity ( const Real& leftState, const Real& rightState, const normal_Type&
                const Real& t, const Real& x, const Real& y, const Real& z ) const
 {
 
-    std::vector<Real> values ( M_fields.size() * M_fESpace.fieldDim(), 0 );
-    const UInt totalDofsPresent ( M_fESpace.dof().numTotalDof() );
-    const UInt fieldDim ( M_fESpace.fieldDim() );
+    std::vector<Real> values;
     scalarFunction_Type absFunctionDotNormalBound;
 
     // Takes the value of all the external fields in the current element.
-    for ( UInt i (0); i < M_fields.size(); ++i )
-    {
-        // Select if the external field is a scalar or vector field
-        for ( UInt iComponent (0); iComponent < fieldDim; ++iComponent )
-        {
-            values[ i * fieldDim + iComponent ] = (* ( * (M_fields) [i] ) ) [ iComponent * totalDofsPresent + M_fESpace.dof().localToGlobalMap ( iElem, 0)  ];
-        }
-
-    }
+    externalFieldsValues ( iElem, values );
 
     // Bind the function which depends on all the parameter to obatin a scalar function, which depend just on the unknown
     absFunctionDotNormalBound = std::bind ( &absFunctionDotNormal, std::placeholders::_1,
@@ -462,20 +472,18 @@ normInfinity ( const Real& leftState, const Real& rightState, const normal_Type&
 
 } // getNormInfty
 
-// Create the fluxDotNormal function
+// Values of the external fields in an element
 template < typename Mesh, typename SolverType >
-std::function< Real ( const Real& ) >
+void
 AbstractNumericalFlux< Mesh, SolverType >::
-computeFunctionDotNormal ( const vectorFunction_Type& function, const normal_Type& normal, const UInt& iElem,
-                           const Real& t, const Real& x, const Real& y, const Real& z, const Real& plusMinus ) const
+externalFieldsValues ( const UInt& iElem, std::vector<Real>& values ) const
 {
 
-    std::vector<Real> values ( M_fields.size() * M_fESpace.fieldDim(), 0 );
     const UInt totalDofsPresent ( M_fESpace.dof().numTotalDof() );
     const UInt fieldDim ( M_fESpace.fieldDim() );
-    scalarFunction_Type functionDotNormalBound;
 
-    // Takes the value of all the external fields in the current element.
+    values.assign ( M_fields.size() * fieldDim, 0 );
+
     for ( UInt i (0); i < M_fields.size(); ++i )
     {
         // Select if the external field is a scalar or vector field
@@ -486,6 +494,22 @@ computeFunctionDotNormal ( const vectorFunction_Type& function, const normal_Typ
 
     }
 
+} // externalFieldsValues
+
+// Create the fluxDotNormal function
+template < typename Mesh, typename SolverType >
+std::function< Real ( const Real& ) >
+AbstractNumericalFlux< Mesh, SolverType >::
+computeFunctionDotNormal ( const vectorFunction_Type& function, const normal_Type& normal, const UInt& iElem,
+                           const Real& t, const Real& x, const Real& y, const Real& z, const Real& plusMinus ) const
+{
+
+    std::vector<Real> values;
+    scalarFunction_Type functionDotNormalBound;
+
+    // Takes the value of all the external fields in the current element.
+    externalFieldsValues ( iElem, values );
+
     // Bind the fluxDotNormal function with known quantities.
     functionDotNormalBound = std::bind ( &functionDotNormal, std::placeholders::_1, function,
                                            normal, t, x, y, z, plusMinus, values );
@@ -594,6 +618,17 @@ public:
 
     //@}
 
+    //! @name Methods
+    //@{
+
+    //! Return a copy of the numerical flux, allocated with new.
+    virtual GodunovNumericalFlux* clone () const
+    {
+        return new GodunovNumericalFlux ( *this );
+    }
+
+    //@}
+
 protected:
 
     //! Tollerance for the Brent algorithm used for Godunov flux.
@@ -683,6 +718,345 @@ operator() ( const Real& leftState, const Real& rightState, const normal_Type& n
 
 } // operator()
 
+// ######################################################################### //
+
+//! NormalFluxShape Shape of the normal flux with respect to the unknown.
+/*!
+  @author Alessio Fumagalli <alessio.fumagalli@mail.polimi.it>
+
+  Shape of \f$ g( u ) = \mathbf{F}( u ) \cdot \mathbf{n} \f$ in a point of a face, returned by the flux
+  functors of GodunovFunctorNumericalFlux. The Godunov flux, that is the solution of the Riemann problem, follows
+  directly from the shape:
+  <ol>
+  <li> MonotoneFlux: the minimum and the maximum of \f$ g \f$ are reached at the states;</li>
+  <li> ConvexFlux: \f$ g \f$ is convex with minimum in extremum;</li>
+  <li> ConcaveFlux: \f$ g \f$ is concave with maximum in extremum;</li>
+  <li> GeneralFlux: nothing is known, the extrema are computed with the Brent algorithm.</li>
+  </ol>
+  The maximum of \f$ \vert g^\prime \vert \f$ of the CFL condition is reached at the states only for convex and
+  concave fluxes, for the other shapes it is computed with the Brent algorithm.
+*/
+struct NormalFluxShape
+{
+    enum Type
+    {
+        GeneralFlux,
+        MonotoneFlux,
+        ConvexFlux,
+        ConcaveFlux
+    };
+
+    NormalFluxShape ( const Type& shapeType = GeneralFlux, const Real& shapeExtremum = 0. ) :
+        type     ( shapeType ),
+        extremum ( shapeExtremum )
+    {}
+
+    //! Shape of the normal flux.
+    Type type;
+
+    //! Minimum point of a convex flux or maximum point of a concave flux.
+    Real extremum;
+};
+
+//! GodunovFunctorNumericalFlux Godunov solver for physical fluxes given as functors.
+/*!
+  @author Alessio Fumagalli <alessio.fumagalli@mail.polimi.it>
+
+  This class computes the same Godunov flux of GodunovNumericalFlux, but the physical flux is a functor, called
+  without the std::function and std::bind layers, which also gives the shape of \f$ \mathbf{F} \cdot \mathbf{n} \f$
+  (see NormalFluxShape). For monotone, convex and concave normal fluxes the Godunov flux is computed from the
+  values in the states and in the extremum, without the Brent algorithm. The local
+  \f$ \Vert \mathbf{F}^\prime \cdot \mathbf{n} \Vert_{L^\infty} \f$ of the CFL condition is computed from the values
+  in the states only for convex and concave fluxes, whose first derivative is monotone: for monotone and general
+  fluxes it still needs the Brent algorithm.
+  <br>
+  The functor must provide the methods
+  \code
+  // Physical flux dot normal
+  Real flux ( const Real& u, const KN<Real>& normal, const std::vector<Real>& fields,
+              const Real& t, const Real& x, const Real& y, const Real& z ) const;
+  // First derivative, respect to the unknown, of the physical flux dot normal
+  Real derivative ( const Real& u, const KN<Real>& normal, const std::vector<Real>& fields,
+                    const Real& t, const Real& x, const Real& y, const Real& z ) const;
+  // Shape of the physical flux dot normal
+  NormalFluxShape shape ( const KN<Real>& normal, const std::vector<Real>& fields,
+                          const Real& t, const Real& x, const Real& y, const Real& z ) const;
+  \endcode
+  where fields are the values of the external fields in the current element. The methods are called concurrently
+  by the threads of HyperbolicSolver, so they must not modify shared data.
+  @note The physicalFlux() and firstDerivativePhysicalFlux() methods of the base class return empty functions.
+*/
+template < typename Mesh,
+         typename FluxFunctor,
+         typename SolverType = LifeV::SolverAztecOO >
+class GodunovFunctorNumericalFlux : public AbstractNumericalFlux<Mesh, SolverType>
+{
+
+public:
+
+    //! @name Public Types
+    //@{
+
+    typedef FluxFunctor                                                            fluxFunctor_Type;
+    typedef typename AbstractNumericalFlux<Mesh, SolverType>::vectorFunction_Type vectorFunction_Type;
+    typedef typename AbstractNumericalFlux<Mesh, SolverType>::dataFile_Type       dataFile_Type;
+    typedef typename AbstractNumericalFlux<Mesh, SolverType>::normal_Type         normal_Type;
+
+    //@}
+
+    // Constructors & destructor.
+    //! @name Constructors and destructor
+    //@{
+
+    //! Constructor for the class
+    /*!
+      @param fluxFunctor Physical flux for the problem, with its first derivative and its shape.
+      @param fESpace Finite element space of the hyperbolic problem.
+      @param data Data for the problem.
+      @param section Section for read the data from GetPot file.
+    */
+    GodunovFunctorNumericalFlux ( const fluxFunctor_Type&         fluxFunctor,
+                                  const FESpace<Mesh, MapEpetra>& fESpace,
+                                  const dataFile_Type&            data,
+                                  const std::string&              section = "numerical_flux/" );
+
+    //! Virtual destructor
+    virtual ~GodunovFunctorNumericalFlux () {}
+
+    //@}
+
+    //! @name Operators
+    //@{
+
+    //! Computes the face contribution of the flux using Godunov flux.
+    /*!
+      @param leftState Left value of the unknown respect to the face.
+      @param rightValue Right value of the unknown respect to the face.
+      @param normal Normal of the face.
+      @param iElem The ID of the current element in the mesh.
+      @param t Current time.
+      @param x Abscissa.
+      @param y Ordinate.
+      @param z Quota.
+    */
+    virtual Real operator() ( const Real&        leftState,
+                              const Real&        rightState,
+                              const normal_Type& normal,
+                              const UInt&        iElem,
+                              const Real&        t = 0,
+                              const Real&        x = 0,
+                              const Real&        y = 0,
+                              const Real&        z = 0 ) const;
+
+    //@}
+
+    //! @name Methods
+    //@{
+
+    //! Return a copy of the numerical flux, allocated with new.
+    virtual GodunovFunctorNumericalFlux* clone () const
+    {
+        return new GodunovFunctorNumericalFlux ( *this );
+    }
+
+    //! Evaluate the flux dot normal in a given point of a face.
+    virtual Real physicalFluxDotNormal ( const normal_Type& normal,
+                                         const UInt&        iElem,
+                                         const Real&        t,
+                                         const Real&        x,
+                                         const Real&        y,
+                                         const Real&        z,
+                                         const Real&        unknown ) const;
+
+    //! Evaluate the first derivative of the flux dot normal in a given point of a face.
+    virtual Real firstDerivativePhysicalFluxDotNormal ( const normal_Type& normal,
+                                                        const UInt&        iElem,
+                                                        const Real&        t,
+                                                        const Real&        x,
+                                                        const Real&        y,
+                                                        const Real&        z,
+                                                        const Real&        unknown ) const;
+
+    //! Computes the local infinity norm of the first derivative of the flux dot normal.
+    virtual Real normInfinity ( const Real&        leftState,
+                                const Real&        rightState,
+                                const normal_Type& normal,
+                                const UInt&        iElem,
+                                const Real&        t = 0,
+                                const Real&        x = 0,
+                                const Real&        y = 0,
+                                const Real&        z = 0 ) const;
+
+    //@}
+
+    //! @name Get Methods
+    //@{
+
+    //! Return the physical flux functor.
+    inline const fluxFunctor_Type& fluxFunctor () const
+    {
+        return M_fluxFunctor;
+    }
+
+    //@}
+
+protected:
+
+    //! Physical flux functor.
+    fluxFunctor_Type M_fluxFunctor;
+
+    //! Tollerance for the Brent algorithm used for general fluxes.
+    Real M_brentToll;
+
+    //! Maximum of iteration for the Brent algorithm used for general fluxes.
+    UInt M_brentMaxIter;
+
+}; // GodunovFunctorNumericalFlux
+
+// ===================================================
+// Constructors & Destructor
+// ===================================================
+
+// Constructor of the class
+template < typename Mesh, typename FluxFunctor, typename SolverType >
+GodunovFunctorNumericalFlux<Mesh, FluxFunctor, SolverType>::
+GodunovFunctorNumericalFlux ( const fluxFunctor_Type&          fluxFunctor,
+                              const FESpace<Mesh, MapEpetra>&  fESpace,
+                              const dataFile_Type&             data,
+                              const std::string&               section ) :
+    AbstractNumericalFlux<Mesh, SolverType>::AbstractNumericalFlux  ( vectorFunction_Type(),
+                                                                      vectorFunction_Type(),
+                                                                      fESpace,
+                                                                      data,
+                                                                      section ),
+    M_fluxFunctor                                 ( fluxFunctor ),
+    M_brentToll                                   ( data ( ( section + "godunov/brent_toll" ).data(), 1e-4 ) ),
+    M_brentMaxIter                                ( data ( ( section + "godunov/brent_maxIter" ).data(), 20) )
+{
+
+} // Constructor
+
+// ===================================================
+// Operators
+// ===================================================
+
+template < typename Mesh, typename FluxFunctor, typename SolverType >
+Real
+GodunovFunctorNumericalFlux<Mesh, FluxFunctor, SolverType>::
+operator() ( const Real& leftState, const Real& rightState, const normal_Type& normal,
+             const UInt& iElem, const Real& t, const Real& x, const Real& y, const Real& z ) const
+{
+
+    // Values of the external fields in the current element
+    std::vector<Real> values;
+    this->externalFieldsValues ( iElem, values );
+
+    // The normal flux function
+    const auto normalFlux = [&] ( const Real & unknown )
+    {
+        return M_fluxFunctor.flux ( unknown, normal, values, t, x, y, z );
+    };
+
+    const NormalFluxShape shape ( M_fluxFunctor.shape ( normal, values, t, x, y, z ) );
+
+    // Select where it is the upwind direction
+    if ( rightState > leftState )
+    {
+        // Compute min f \cdot n in [leftState, rightState]
+        switch ( shape.type )
+        {
+            case NormalFluxShape::MonotoneFlux:
+            case NormalFluxShape::ConcaveFlux:
+                return std::min ( normalFlux ( leftState ), normalFlux ( rightState ) );
+            case NormalFluxShape::ConvexFlux:
+                return normalFlux ( std::min ( std::max ( shape.extremum, leftState ), rightState ) );
+            default:
+                return normalFlux ( NonLinearBrent ( normalFlux, leftState, rightState, M_brentToll, M_brentMaxIter ) );
+        }
+    }
+    else
+    {
+        // Compute max f \cdot n in [rightState, leftState]
+        switch ( shape.type )
+        {
+            case NormalFluxShape::MonotoneFlux:
+            case NormalFluxShape::ConvexFlux:
+                return std::max ( normalFlux ( leftState ), normalFlux ( rightState ) );
+            case NormalFluxShape::ConcaveFlux:
+                return normalFlux ( std::min ( std::max ( shape.extremum, rightState ), leftState ) );
+            default:
+            {
+                const auto minusNormalFlux = [&] ( const Real & unknown )
+                {
+                    return - normalFlux ( unknown );
+                };
+                return normalFlux ( NonLinearBrent ( minusNormalFlux, leftState, rightState, M_brentToll, M_brentMaxIter ) );
+            }
+        }
+    }
+
+} // operator()
+
+// ===================================================
+// Methods
+// ===================================================
+
+template < typename Mesh, typename FluxFunctor, typename SolverType >
+Real
+GodunovFunctorNumericalFlux<Mesh, FluxFunctor, SolverType>::
+physicalFluxDotNormal ( const normal_Type& normal, const UInt& iElem,
+                        const Real& t, const Real& x, const Real& y, const Real& z, const Real& unknown ) const
+{
+    std::vector<Real> values;
+    this->externalFieldsValues ( iElem, values );
+
+    return M_fluxFunctor.flux ( unknown, normal, values, t, x, y, z );
+}
+
+template < typename Mesh, typename FluxFunctor, typename SolverType >
+Real
+GodunovFunctorNumericalFlux<Mesh, FluxFunctor, SolverType>::
+firstDerivativePhysicalFluxDotNormal ( const normal_Type& normal, const UInt& iElem,
+                                       const Real& t, const Real& x, const Real& y, const Real& z, const Real& unknown ) const
+{
+    std::vector<Real> values;
+    this->externalFieldsValues ( iElem, values );
+
+    return M_fluxFunctor.derivative ( unknown, normal, values, t, x, y, z );
+}
+
+template < typename Mesh, typename FluxFunctor, typename SolverType >
+Real
+GodunovFunctorNumericalFlux<Mesh, FluxFunctor, SolverType>::
+normInfinity ( const Real& leftState, const Real& rightState, const normal_Type& normal, const UInt& iElem,
+               const Real& t, const Real& x, const Real& y, const Real& z ) const
+{
+
+    // Values of the external fields in the current element
+    std::vector<Real> values;
+    this->externalFieldsValues ( iElem, values );
+
+    // Minus the absolute value of the first derivative of the normal flux
+    const auto minusAbsDerivative = [&] ( const Real & unknown )
+    {
+        return - std::fabs ( M_fluxFunctor.derivative ( unknown, normal, values, t, x, y, z ) );
+    };
+
+    Real maxValue ( - std::min ( minusAbsDerivative ( leftState ), minusAbsDerivative ( rightState ) ) );
+
+    // The first derivative of a convex or concave flux is monotone, its maximum is reached at the states
+    const NormalFluxShape shape ( M_fluxFunctor.shape ( normal, values, t, x, y, z ) );
+    if ( shape.type != NormalFluxShape::ConvexFlux && shape.type != NormalFluxShape::ConcaveFlux )
+    {
+        const Real argMax = NonLinearBrent ( minusAbsDerivative, leftState, rightState,
+                                             this->M_CFLBrentToll, this->M_CFLBrentMaxIter );
+        maxValue = std::max ( maxValue, - minusAbsDerivative ( argMax ) );
+    }
+
+    return maxValue;
+
+} // normInfinity
+
 } // Namespace LifeV
 
 #endif //_HYPERBOLICNUMERICALFLUXES_H_
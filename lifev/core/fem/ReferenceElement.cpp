@@ -35,11 +35,16 @@
     @mantainer Samuel Quinodoz <samuel.quinodoz@epfl.ch>
  */
 
+#include <algorithm>
+
 #include <lifev/core/fem/ReferenceElement.hpp>
+#include <lifev/core/fem/QuadratureRule.hpp>
 
 namespace LifeV
 {
 
+const UInt ReferenceElement::S_maxNbTabulations;
+
 // ===================================================
 // Constructors & Destructor
 // ===================================================
@@ -57,7 +62,8 @@ ReferenceElement::ReferenceElement ( std::string name, ReferenceShapes shape, UI
     M_shape ( shape ),
     M_nbDof ( nbDof ),
     M_nbLocalCoor ( nbLocalCoor ),
-    M_feDim ( feDim )
+    M_feDim ( feDim ),
+    M_tabulations ()
 {
 }
 
@@ -82,5 +88,164 @@ ReferenceElement::refCoor() const
     return coordinates;
 }
 
+ReferenceElement::tabulationPtr_Type
+ReferenceElement::tabulation ( const QuadratureRule& qr ) const
+{
+    tabulationPtr_Type result;
+
+    #pragma omp critical (ReferenceElementTabulation)
+    {
+        for (std::list<TabulationEntry>::iterator it (M_tabulations.begin() ); it != M_tabulations.end(); ++it)
+        {
+            if (it->matches (qr) )
+            {
+                result = it->tabulation;
+                M_tabulations.splice (M_tabulations.begin(), M_tabulations, it);
+                break;
+            }
+        }
+    }
+
+    if (result)
+    {
+        return result;
+    }
+
+    // The values are computed outside of the critical section, the other threads can go on
+    tabulationPtr_Type tabulation (new Tabulation (*this, qr) );
+
+    #pragma omp critical (ReferenceElementTabulation)
+    {
+        // Another thread may have computed the same tabulation in the meantime
+        for (std::list<TabulationEntry>::iterator it (M_tabulations.begin() ); it != M_tabulations.end(); ++it)
+        {
+            if (it->matches (qr) )
+            {
+                result = it->tabulation;
+                break;
+            }
+        }
+
+        if (!result)
+        {
+            result = tabulation;
+            M_tabulations.push_front (TabulationEntry (qr, tabulation) );
+            if (M_tabulations.size() > S_maxNbTabulations)
+            {
+                M_tabulations.pop_back();
+            }
+        }
+    }
+
+    return result;
+}
+
+UInt
+ReferenceElement::nbTabulations() const
+{
+    UInt nbTabulations (0);
+
+    #pragma omp critical (ReferenceElementTabulation)
+    {
+        nbTabulations = M_tabulations.size();
+    }
+
+    return nbTabulations;
+}
+
+ReferenceElement::TabulationEntry::TabulationEntry ( const QuadratureRule& qr, const tabulationPtr_Type& tabulation ) :
+    name ( qr.name() ),
+    nodes (),
+    tabulation ( tabulation )
+{
+    for (UInt q (0); q < qr.nbQuadPt(); ++q)
+    {
+        const GeoVector& coor ( qr.quadPointCoor (q) );
+        nodes.insert (nodes.end(), coor.begin(), coor.end() );
+    }
+}
+
+bool
+ReferenceElement::TabulationEntry::matches ( const QuadratureRule& qr ) const
+{
+    if (qr.name() != name || qr.nbQuadPt() != tabulation->nbQuadPt() )
+    {
+        return false;
+    }
+
+    std::vector<Real>::const_iterator node (nodes.begin() );
+    for (UInt q (0); q < qr.nbQuadPt(); ++q)
+    {
+        const GeoVector& coor ( qr.quadPointCoor (q) );
+        if (static_cast<UInt> (nodes.end() - node) < coor.size() || !std::equal (coor.begin(), coor.end(), node) )
+        {
+            return false;
+        }
+        node += coor.size();
+    }
+
+    return node == nodes.end();
+}
+
+// ===================================================
+// Tabulation
+// ===================================================
+
+ReferenceElement::Tabulation::Tabulation ( const ReferenceElement& refElement, const QuadratureRule& qr ) :
+    M_nbQuadPt ( qr.nbQuadPt() ),
+    M_nbDof ( refElement.nbDof() ),
+    M_nbLocalCoor ( refElement.nbLocalCoor() ),
+    M_feDim ( refElement.feDim() )
+{
+    if (refElement.hasPhi() )
+    {
+        M_phi.resize (M_nbQuadPt * M_nbDof * M_feDim);
+    }
+    if (refElement.hasDPhi() )
+    {
+        M_dPhi.resize (M_nbQuadPt * M_nbDof * M_nbLocalCoor);
+    }
+    if (refElement.hasD2Phi() )
+    {
+        M_d2Phi.resize (M_nbQuadPt * M_nbDof * M_nbLocalCoor * M_nbLocalCoor);
+    }
+    if (refElement.hasDivPhi() )
+    {
+        M_divPhi.resize (M_nbQuadPt * M_nbDof);
+    }
+
+    for (UInt q (0); q < M_nbQuadPt; ++q)
+    {
+        const GeoVector& node ( qr.quadPointCoor (q) );
+
+        for (UInt i (0); i < M_nbDof; ++i)
+        {
+            for (UInt icoor (0); icoor < M_feDim && !M_phi.empty(); ++icoor)
+            {
+                M_phi[ ( q * M_nbDof + i ) * M_feDim + icoor ] = refElement.phi (i, icoor, node);
+            }
+
+            for (UInt icoor (0); icoor < M_nbLocalCoor && !M_dPhi.empty(); ++icoor)
+            {
+                M_dPhi[ ( q * M_nbDof + i ) * M_nbLocalCoor + icoor ] = refElement.dPhi (i, icoor, node);
+            }
+
+            for (UInt icoor (0); icoor < M_nbLocalCoor && !M_d2Phi.empty(); ++icoor)
+            {
+                for (UInt jcoor (0); jcoor < M_nbLocalCoor; ++jcoor)
+                {
+                    M_d2Phi[ ( ( q * M_nbDof + i ) * M_nbLocalCoor + icoor ) * M_nbLocalCoor + jcoor ] =
+                        refElement.d2Phi (i, icoor, jcoor, node);
+                }
+            }
+
+            if (!M_divPhi.empty() )
+            {
+                M_divPhi[ q * M_nbDof + i ] = refElement.divPhi (i, node);
+            }
+        }
+    }
+}
+
 
 } // Namespace LifeV
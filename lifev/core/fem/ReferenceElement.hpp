@@ -39,6 +39,9 @@
 #ifndef REFELE_H
 #define REFELE_H 1
 
+#include <list>
+#include <memory>
+
 #include <lifev/core/LifeV.hpp>
 
 #include <lifev/core/mesh/ElementShapes.hpp>
@@ -47,6 +50,8 @@ namespace LifeV
 {
 typedef boost::numeric::ublas::vector<Real> GeoVector;
 
+class QuadratureRule;
+
 //! ReferenceElement - The basis class for the geometric mapping and the reference finite elements.
 /*!
   @author J.-F. Gerbeau
@@ -74,8 +79,68 @@ public:
     // Some typedefs for functions
     typedef Real ( * function_Type ) ( const GeoVector& );
 
+    //! Values of the basis functions and of their derivatives in the nodes of a quadrature rule
+    /*!
+      The values are stored contiguously, quadrature node by quadrature node. The arrays
+      of the functions that the reference element does not define are left empty.
+     */
+    class Tabulation
+    {
+    public:
+
+        //! Evaluate the functions of refElement in the nodes of qr
+        Tabulation ( const ReferenceElement& refElement, const QuadratureRule& qr );
+
+        //! Return the number of quadrature nodes
+        UInt nbQuadPt() const
+        {
+            return M_nbQuadPt;
+        }
+
+        //! Return the value of the component icoor of the i-th basis function in the node q
+        Real phi ( UInt q, UInt i, UInt icoor = 0 ) const
+        {
+            return M_phi[ ( q * M_nbDof + i ) * M_feDim + icoor ];
+        }
+
+        //! Return the icoor-th derivative of the i-th basis function in the node q
+        Real dPhi ( UInt q, UInt i, UInt icoor ) const
+        {
+            return M_dPhi[ ( q * M_nbDof + i ) * M_nbLocalCoor + icoor ];
+        }
+
+        //! Return the (icoor,jcoor)-th second derivative of the i-th basis function in the node q
+        Real d2Phi ( UInt q, UInt i, UInt icoor, UInt jcoor ) const
+        {
+            return M_d2Phi[ ( ( q * M_nbDof + i ) * M_nbLocalCoor + icoor ) * M_nbLocalCoor + jcoor ];
+        }
+
+        //! Return the divergence of the i-th basis function in the node q
+        Real divPhi ( UInt q, UInt i ) const
+        {
+            return M_divPhi[ q * M_nbDof + i ];
+        }
+
+    private:
+
+        UInt M_nbQuadPt;
+        UInt M_nbDof;
+        UInt M_nbLocalCoor;
+        UInt M_feDim;
+
+        std::vector<Real> M_phi;
+        std::vector<Real> M_dPhi;
+        std::vector<Real> M_d2Phi;
+        std::vector<Real> M_divPhi;
+    };
+
+    typedef std::shared_ptr<const Tabulation> tabulationPtr_Type;
+
     //@}
 
+    //! Maximum number of tabulations kept by a reference element
+    static const UInt S_maxNbTabulations = 8;
+
     //! @name Constructor & Destructor
     //@{
 
@@ -187,6 +252,22 @@ public:
         return ( M_divPhi != static_cast<function_Type*> (NULL) );
     }
 
+    //! Return the values of the functions in the nodes of a quadrature rule
+    /*!
+      The values are computed the first time a quadrature rule (identified by its
+      name and the coordinates of its nodes) is requested, then they are shared by
+      all the current finite elements using this reference element with the same rule.
+      Only the S_maxNbTabulations rules used most recently are kept: the rules built
+      element by element, e.g. by the level set adapted integrators, do not make the
+      cache grow. The method can be called concurrently by several threads.
+      @param qr The quadrature rule
+      @return The tabulation, which stays valid as long as the pointer is held
+     */
+    tabulationPtr_Type tabulation ( const QuadratureRule& qr ) const;
+
+    //! Return the number of tabulations currently kept
+    UInt nbTabulations() const;
+
     //! Method for transforming nodal values into FE values
     /*!
       This method can be used to retrieve the FE coefficients corresponding
@@ -365,6 +446,22 @@ private:
     //! Number of dimension of the FE (1 for scalar FE, more for vectorial FE)
     const UInt M_feDim;
 
+    //! Tabulation computed for a quadrature rule, with the name and the nodes of the rule
+    struct TabulationEntry
+    {
+        TabulationEntry ( const QuadratureRule& qr, const tabulationPtr_Type& tabulation );
+
+        //! Tell if the entry refers to the rule qr
+        bool matches ( const QuadratureRule& qr ) const;
+
+        std::string        name;
+        std::vector<Real>  nodes;
+        tabulationPtr_Type tabulation;
+    };
+
+    //! Tabulations already computed, the most recently used first
+    mutable std::list<TabulationEntry> M_tabulations;
+
 };
 
 
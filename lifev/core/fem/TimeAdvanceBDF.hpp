@@ -52,6 +52,68 @@ namespace LifeV
 {
 const UInt BDF_MAX_ORDER = 5;
 
+//! Copy a state in the storage of an older one, if the storage can be reused.
+/*!
+  The generic version never reuses the storage: the state is copied in a new vector.
+  @return true if the state has been copied in the storage.
+*/
+template<typename feVectorType>
+inline bool copyStateInPlace ( feVectorType& /*storage*/, const feVectorType& /*state*/ )
+{
+    return false;
+}
+
+//! Copy a VectorEpetra in the storage of an older one, if they have the same map.
+/*!
+  With different maps (e.g. Repeated and Unique) the assignment would import or export
+  the values with the combine mode of the storage, which is not a copy: the storage is
+  then reused only when the two vectors have the same map type and the same Epetra map.
+  The check does not need any communication.
+  @return true if the state has been copied in the storage.
+*/
+inline bool copyStateInPlace ( VectorEpetra& storage, const VectorEpetra& state )
+{
+    if ( storage.mapType() != state.mapType() || storage.blockMap().DataPtr() != state.blockMap().DataPtr() )
+    {
+        return false;
+    }
+
+    storage.epetraVector() = state.epetraVector();
+    return true;
+}
+
+//! Add a scaled state to a vector: vector += scalar * state.
+/*!
+  The generic version uses the operators of the vector type.
+*/
+template<typename feVectorType>
+inline void addScaledState ( feVectorType& vector, const Real& scalar, const feVectorType& state )
+{
+    vector += scalar * state;
+}
+
+//! Add a scaled VectorEpetra to a vector, without the temporary of scalar * state.
+inline void addScaledState ( VectorEpetra& vector, const Real& scalar, const VectorEpetra& state )
+{
+    vector.add ( scalar, state );
+}
+
+//! Set a vector to a scaled state: vector = scalar * state.
+/*!
+  The generic version uses the operators of the vector type.
+*/
+template<typename feVectorType>
+inline void setScaledState ( feVectorType& vector, const Real& scalar, const feVectorType& state )
+{
+    vector = scalar * state;
+}
+
+//! Set a VectorEpetra to a scaled state, without the temporary of scalar * state.
+inline void setScaledState ( VectorEpetra& vector, const Real& scalar, const VectorEpetra& state )
+{
+    vector.update ( scalar, state, 0. );
+}
+
 //!class TimeAdvanceBDF - Backward differencing formula time discretization for the first and the second order problem in time.
 /*!
  @author Simone Deparis  <simone.deparis@epfl.ch>
@@ -320,7 +382,9 @@ TimeAdvanceBDF<feVectorType>::shiftRight (feVector_Type const&  solution )
     feVectorContainerPtrIterate_Type itm1 = this->M_unknowns.end() - 1;
     feVectorContainerPtrIterate_Type itb  = this->M_unknowns.begin();
 
-    delete *itm1;
+    // The oldest state vector is recycled to store the new solution when it has
+    // the same map: only the pointers are shifted, no vector is allocated or freed
+    feVector_Type* oldest = *itm1;
 
     for ( ; it != itb; --it )
     {
@@ -328,7 +392,13 @@ TimeAdvanceBDF<feVectorType>::shiftRight (feVector_Type const&  solution )
         *it = *itm1;
     }
 
-    *itb = new feVector_Type (solution);
+    if ( !copyStateInPlace ( *oldest, solution ) )
+    {
+        delete oldest;
+        oldest = new feVector_Type ( solution );
+    }
+
+    *itb = oldest;
 
 }
 
@@ -341,7 +411,7 @@ TimeAdvanceBDF<feVectorType>::RHSFirstDerivative (const Real& timeStep, feVector
 
     for ( UInt i = 1; i < this->M_order; ++i )
     {
-        rhsContribution += (this->M_alpha[ i + 1 ] / timeStep) * *this->M_unknowns[ i ];
+        addScaledState ( rhsContribution, this->M_alpha[ i + 1 ] / timeStep, *this->M_unknowns[ i ] );
     }
 }
 
@@ -355,13 +425,17 @@ TimeAdvanceBDF<feVectorType>::updateRHSSecondDerivative (const Real& timeStep )
 
     feVectorContainerPtrIterate_Type it  = this->M_rhsContribution.end() - 1;
 
-    *it = new feVector_Type (*this->M_unknowns[ 0 ]);
+    if ( *it == NULL || !copyStateInPlace ( **it, *this->M_unknowns[ 0 ] ) )
+    {
+        delete *it;
+        *it = new feVector_Type (*this->M_unknowns[ 0 ]);
+    }
 
     ** it *= this->M_xi[ 1 ] / (timeStep * timeStep);
 
     for ( UInt i = 1; i < this->M_order + 1; ++i )
     {
-        **it += ( this->M_xi[ i + 1 ] / (timeStep * timeStep) ) * *this->M_unknowns[ i ];
+        addScaledState ( **it, this->M_xi[ i + 1 ] / (timeStep * timeStep), *this->M_unknowns[ i ] );
     }
 }
 
@@ -625,11 +699,11 @@ template<typename feVectorType>
 void
 TimeAdvanceBDF<feVectorType>::extrapolation (feVector_Type& extrapolation) const
 {
-    extrapolation = this->M_beta[ 0 ] * (*this->M_unknowns[ 0 ]);
+    setScaledState ( extrapolation, this->M_beta[ 0 ], *this->M_unknowns[ 0 ] );
 
     for ( UInt i = 1; i < this->M_order; ++i )
     {
-        extrapolation += this->M_beta[ i ] * (*this->M_unknowns[ i ]);
+        addScaledState ( extrapolation, this->M_beta[ i ], *this->M_unknowns[ i ] );
     }
 }
 
@@ -640,11 +714,11 @@ TimeAdvanceBDF<feVectorType>::extrapolationFirstDerivative (feVector_Type& extra
     ASSERT ( this->M_orderDerivative == 2,
              "extrapolationFirstDerivative: this method must be used with the second order problem." )
 
-    extrapolation = this->M_betaFirstDerivative[ 0 ] * (*this->M_unknowns[ 0 ]);
+    setScaledState ( extrapolation, this->M_betaFirstDerivative[ 0 ], *this->M_unknowns[ 0 ] );
 
     for ( UInt i = 1; i < this->M_order; ++i )
     {
-        extrapolation += this->M_betaFirstDerivative[ i ] * (*this->M_unknowns[ i ]);
+        addScaledState ( extrapolation, this->M_betaFirstDerivative[ i ], *this->M_unknowns[ i ] );
     }
 }
 
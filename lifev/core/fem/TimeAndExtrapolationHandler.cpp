@@ -1,5 +1,7 @@
 #include <lifev/core/fem/TimeAndExtrapolationHandler.hpp>
 
+#include <algorithm>
+
 namespace LifeV
 {
 
@@ -7,6 +9,8 @@ TimeAndExtrapolationHandler::TimeAndExtrapolationHandler():
     M_BDForder(0),
     M_maximumExtrapolationOrder(0),
     M_states(),
+    M_sizeStencil(0),
+    M_statesShareMap(false),
     M_timeStep(0.0)
 {}
 
@@ -14,12 +18,45 @@ TimeAndExtrapolationHandler::TimeAndExtrapolationHandler(const UInt orderBDF, co
     M_BDForder(orderBDF),
     M_maximumExtrapolationOrder(maximumOrderExtrapolation),
     M_states(),
+    M_sizeStencil(0),
+    M_statesShareMap(false),
     M_timeStep()
 {}
 
+TimeAndExtrapolationHandler::TimeAndExtrapolationHandler(const TimeAndExtrapolationHandler& handler):
+    M_BDForder(handler.M_BDForder),
+    M_maximumExtrapolationOrder(handler.M_maximumExtrapolationOrder),
+    M_states(),
+    M_sizeStencil(handler.M_sizeStencil),
+    M_statesShareMap(false),
+    M_timeStep(handler.M_timeStep)
+{
+    M_states.reserve(handler.M_states.size());
+    for ( UInt i = 0; i < handler.M_states.size(); ++i )
+        M_states.push_back( vectorPtr_Type( new vector_Type(*handler.M_states[i]) ) );
+    updateStatesShareMap();
+}
+
 TimeAndExtrapolationHandler::~TimeAndExtrapolationHandler()
 {}
 
+TimeAndExtrapolationHandler&
+TimeAndExtrapolationHandler::operator=(const TimeAndExtrapolationHandler& handler)
+{
+    if ( this != &handler )
+    {
+        // copy and swap, so that the states of the two handlers are never shared
+        TimeAndExtrapolationHandler copy(handler);
+        M_BDForder = copy.M_BDForder;
+        M_maximumExtrapolationOrder = copy.M_maximumExtrapolationOrder;
+        M_states.swap(copy.M_states);
+        M_sizeStencil = copy.M_sizeStencil;
+        M_statesShareMap = copy.M_statesShareMap;
+        M_timeStep = copy.M_timeStep;
+    }
+    return *this;
+}
+
 void
 TimeAndExtrapolationHandler::setBDForder(const UInt order)
 {
@@ -39,7 +76,7 @@ TimeAndExtrapolationHandler::setTimeStep(const Real dt)
 }
 
 void
-TimeAndExtrapolationHandler::initialize(const std::vector<vector_Type> InitialData)
+TimeAndExtrapolationHandler::initialize(const std::vector<vector_Type>& InitialData)
 {
 	ASSERT( M_BDForder != 0, "Order of the BDF scheme has not been set, please use TimeAndExtrapolationHandler::setBDForder(const UInt order)");
 
@@ -49,28 +86,28 @@ TimeAndExtrapolationHandler::initialize(const std::vector<vector_Type> InitialDa
 
     ASSERT( InitialData.size() == M_sizeStencil, "Wrong initial data dimension, it has to be of size equal max(M_BDForder, M_maximumExtrapolationOrder)");
 
-    for ( int i = 0; i < M_sizeStencil; ++i )
-        M_states.push_back(InitialData[i]);
+    M_states.resize(M_sizeStencil);
+    for ( UInt i = 0; i < M_sizeStencil; ++i )
+        M_states[i].reset( new vector_Type(InitialData[i]) );
+    updateStatesShareMap();
 }
 
 void
-TimeAndExtrapolationHandler::shift(const vector_Type newVector)
+TimeAndExtrapolationHandler::shift(const vector_Type& newVector)
 {
-    switch (M_sizeStencil) {
-        case 1: // size 1: we just replace the last entry by the new vector
-            M_states[M_sizeStencil-1] = newVector;
-            break;
-        case 2: // size 2
-            M_states[M_sizeStencil-2] = M_states[M_sizeStencil-1];
-            M_states[M_sizeStencil-1] = newVector;
-            break;
-        case 3: // size 3
-        	M_states[M_sizeStencil-3] = M_states[M_sizeStencil-2];
-        	M_states[M_sizeStencil-2] = M_states[M_sizeStencil-1];
-        	M_states[M_sizeStencil-1] = newVector;
-        	break;
-        default:
-            break;
+    ASSERT( M_states.size() == M_sizeStencil, "The time handler has not been initialized, please use TimeAndExtrapolationHandler::initialize");
+
+    // the oldest state moves to the back and is overwritten by the new vector. With a different map
+    // (e.g. Repeated and Unique) the assignment would import or export the values: a new copy is stored instead
+    std::rotate(M_states.begin(), M_states.begin()+1, M_states.end());
+    if ( hasStatesMap(newVector) )
+    {
+        M_states[M_sizeStencil-1]->epetraVector() = newVector.epetraVector();
+    }
+    else
+    {
+        M_states[M_sizeStencil-1].reset( new vector_Type(newVector) );
+        updateStatesShareMap();
     }
 }
 
@@ -80,14 +117,20 @@ TimeAndExtrapolationHandler::extrapolate(const UInt order, vector_Type& extrapol
     ASSERT( order <= M_maximumExtrapolationOrder, "Order of extrapolation is higher than the maximum order previously set");
     switch (order) {
         case 1:
-            extrapolation = M_states[M_sizeStencil-1]; // u_star = u_n
+            extrapolation = *M_states[M_sizeStencil-1]; // u_star = u_n
             break;
         case 2:
-            extrapolation = 2*M_states[M_sizeStencil-1] - M_states[M_sizeStencil-2]; // u_star = 2*u_n - u_{n-1}
+        {
+            const Real coefficients[2] = {2.0, -1.0}; // u_star = 2*u_n - u_{n-1}
+            linearCombination(coefficients, 2, extrapolation);
             break;
+        }
         case 3:
-        	extrapolation = 3*M_states[M_sizeStencil-1] - 3*M_states[M_sizeStencil-2] + M_states[M_sizeStencil-3]; // u_star = 3*u_n - 3*u_{n-1} + u_{n-2}
-        	break;
+        {
+            const Real coefficients[3] = {3.0, -3.0, 1.0}; // u_star = 3*u_n - 3*u_{n-1} + u_{n-2}
+            linearCombination(coefficients, 3, extrapolation);
+            break;
+        }
         default:
             break;
     }
@@ -100,19 +143,93 @@ TimeAndExtrapolationHandler::rhsContribution(vector_Type& rhs_bdf)
 
     switch (M_BDForder) {
         case 1:
-            rhs_bdf = 1/M_timeStep*M_states[M_sizeStencil-1]; // u_rhs = 1/dt*u_n
+        {
+            const Real coefficients[1] = {1.0/M_timeStep}; // u_rhs = 1/dt*u_n
+            linearCombination(coefficients, 1, rhs_bdf);
             break;
+        }
         case 2:
-            rhs_bdf = 1/M_timeStep*(2*M_states[M_sizeStencil-1] - (1.0/2.0)*M_states[M_sizeStencil-2]); // u_rhs = 1/dt*(2*u_n - 0.5*u_{n-1})
+        {
+            const Real coefficients[2] = {2.0/M_timeStep, -0.5/M_timeStep}; // u_rhs = 1/dt*(2*u_n - 0.5*u_{n-1})
+            linearCombination(coefficients, 2, rhs_bdf);
             break;
+        }
         case 3:
-        	rhs_bdf = 1/M_timeStep*(3*M_states[M_sizeStencil-1] - (3.0/2.0)*M_states[M_sizeStencil-2] + (1.0/3.0)*M_states[M_sizeStencil-3]); // u_rhs = 1/dt*(3*u_n - 3/2*u_{n-1} + 1/3*u_{n-2})
-        	break;
+        {
+            // u_rhs = 1/dt*(3*u_n - 3/2*u_{n-1} + 1/3*u_{n-2})
+            const Real coefficients[3] = {3.0/M_timeStep, -1.5/M_timeStep, 1.0/(3.0*M_timeStep)};
+            linearCombination(coefficients, 3, rhs_bdf);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void
+TimeAndExtrapolationHandler::linearCombination(const Real* coefficients, const UInt numberOfStates, vector_Type& result) const
+{
+    ASSERT( numberOfStates <= M_sizeStencil, "Not enough states stored for the requested combination");
+
+    const vector_Type& newest = *M_states[M_sizeStencil-1];
+
+    // the raw arrays are read over the local length of the newest state: all the vectors must have its map
+    if ( !M_statesShareMap || !hasStatesMap(result) || numberOfStates > 3 )
+    {
+        // different layouts (e.g. repeated result): combine on the layout of the newest state and let the assignment import
+        vector_Type combination( newest );
+        combination *= coefficients[0];
+        for ( UInt i = 1; i < numberOfStates; ++i )
+            combination.add( coefficients[i], *M_states[M_sizeStencil-1-i] );
+        result = combination;
+        return;
+    }
+
+    const Int length = newest.epetraVector().MyLength();
+    Real* target = result.epetraVector()[0];
+    const Real* u0 = newest.epetraVector()[0];
+
+    switch (numberOfStates) {
+        case 1:
+            for ( Int i = 0; i < length; ++i )
+                target[i] = coefficients[0] * u0[i];
+            break;
+        case 2:
+        {
+            const Real* u1 = M_states[M_sizeStencil-2]->epetraVector()[0];
+            for ( Int i = 0; i < length; ++i )
+                target[i] = coefficients[0] * u0[i] + coefficients[1] * u1[i];
+            break;
+        }
+        case 3:
+        {
+            const Real* u1 = M_states[M_sizeStencil-2]->epetraVector()[0];
+            const Real* u2 = M_states[M_sizeStencil-3]->epetraVector()[0];
+            for ( Int i = 0; i < length; ++i )
+                target[i] = coefficients[0] * u0[i] + coefficients[1] * u1[i] + coefficients[2] * u2[i];
+            break;
+        }
         default:
+            ERROR_MSG( "TimeAndExtrapolationHandler::linearCombination: unexpected number of states" );
             break;
     }
 }
 
+bool
+TimeAndExtrapolationHandler::hasStatesMap(const vector_Type& vector) const
+{
+    const vector_Type& newest = *M_states.back();
+    return vector.mapType() == newest.mapType() && vector.blockMap().DataPtr() == newest.blockMap().DataPtr();
+}
+
+void
+TimeAndExtrapolationHandler::updateStatesShareMap()
+{
+    M_statesShareMap = !M_states.empty();
+    for ( UInt i = 0; i + 1 < M_states.size() && M_statesShareMap; ++i )
+        M_statesShareMap = hasStatesMap(*M_states[i]);
+}
+
 Real
 TimeAndExtrapolationHandler::alpha()
 {
@@ -33,9 +33,15 @@ public:
     // constructor taking as first input the order of the Time Advancing BDF scheme, as second the maximum order of extrapolation desired (maximum 3)
     TimeAndExtrapolationHandler(const UInt orderBDF, const UInt maximumOrderExtrapolation);
 
+    // copy constructor, the states are copied and not shared with the given handler
+    TimeAndExtrapolationHandler(const TimeAndExtrapolationHandler& handler);
+
     // empty destructor
     ~TimeAndExtrapolationHandler();
 
+    // assignment operator, the states are copied and not shared with the given handler
+    TimeAndExtrapolationHandler& operator=(const TimeAndExtrapolationHandler& handler);
+
     // setup of the class taking the order of the method
     void setBDForder(const UInt order);
 
@@ -43,15 +49,20 @@ public:
     void setMaximumExtrapolationOrder(const UInt order);
 
     // initialize the time handler class with initial data, need a vector of M_order vectorEpetra
-    void initialize(const std::vector<vector_Type> InitialData);
+    void initialize(const std::vector<vector_Type>& InitialData);
 
-    // shift - to be used when a timestep is solved
-    void shift(const vector_Type newVector);
+    // shift - to be used when a timestep is solved. The storage of the oldest state is recycled
+    // for the new one when they have the same map, so that no vector is allocated during the time loop
+    void shift(const vector_Type& newVector);
 
-    // getter for the state
+    // getter for the state (copy of the stored vectors, from the oldest to the newest)
     std::vector<vector_Type> state()
     {
-        return M_states;
+        std::vector<vector_Type> states;
+        states.reserve ( M_states.size() );
+        for ( UInt i = 0; i < M_states.size(); ++i )
+            states.push_back ( *M_states[i] );
+        return states;
     }
 
     // set the timestep
@@ -68,18 +79,31 @@ public:
 
 private:
 
+    // result = sum_i coefficients[i] * u_{n-i}, i = 0, .., numberOfStates-1. The combination is computed in a single
+    // sweep over the entries when all the states and the result have the same map, with temporaries otherwise
+    void linearCombination(const Real* coefficients, const UInt numberOfStates, vector_Type& result) const;
+
+    // true if the vector has the same map (type and Epetra data) as the states, no communication is needed
+    bool hasStatesMap(const vector_Type& vector) const;
+
+    // update M_statesShareMap after a change of the states
+    void updateStatesShareMap();
+
     // order of the BDF scheme used
     UInt M_BDForder;
 
     // maximum order used for extrapolation
     UInt M_maximumExtrapolationOrder;
 
-    // vector with the state variable at time n, n-1, .., n-(p-1)
-    std::vector<vector_Type> M_states;
+    // ring of the state variables at time n-(p-1), .., n-1, n: shift rotates the pointers
+    std::vector<vectorPtr_Type> M_states;
 
     // variable that contains the bigger value between M_BDForder and M_maximumExtrapolationOrder
     UInt M_sizeStencil;
 
+    // true if all the states have the same map, the condition of the single sweep combination
+    bool M_statesShareMap;
+
     // timestep
     Real M_timeStep;
 
@@ -13,6 +13,8 @@
 
 #include <lifev/core/LifeV.hpp>
 
+#include <algorithm>
+
 namespace LifeV
 {
 
@@ -39,10 +41,10 @@ public:
     void setBDForder(const UInt order);
 
     // initialize the time handler class with initial data, need a vector of M_order vectorEpetra
-    void initialize(const std::vector<vector_Type> InitialData);
+    void initialize(const std::vector<vector_Type>& InitialData);
 
-    // shift - to be used when a timestep is solved
-    void shift(const vector_Type newVector);
+    // shift - to be used when a timestep is solved. The storage of the oldest state is recycled
+    void shift(const vector_Type& newVector);
 
     // getter for the state
     std::vector<vector_Type> state()
@@ -112,7 +114,7 @@ TimeAndExtrapolationHandlerQuadPts<DIM>::setTimeStep(const Real dt)
 
 template <UInt DIM>
 void
-TimeAndExtrapolationHandlerQuadPts<DIM>::initialize(const std::vector<vector_Type> InitialData)
+TimeAndExtrapolationHandlerQuadPts<DIM>::initialize(const std::vector<vector_Type>& InitialData)
 {
     ASSERT( M_BDForder != 0, "Order of the BDF scheme has not been set, please use TimeAndExtrapolationHandler::setBDForder(const UInt order)");
     
@@ -120,30 +122,17 @@ TimeAndExtrapolationHandlerQuadPts<DIM>::initialize(const std::vector<vector_Typ
     
     ASSERT( InitialData.size() == M_sizeStencil, "Wrong initial data dimension, it has to be of size equal max(M_BDForder, M_maximumExtrapolationOrder)");
     
-    for ( int i = 0; i < M_sizeStencil; ++i )
-        M_states.push_back(InitialData[i]);
+    M_states.assign(InitialData.begin(), InitialData.end());
 }
 
 template <UInt DIM>
 void
-TimeAndExtrapolationHandlerQuadPts<DIM>::shift(const vector_Type newVector)
+TimeAndExtrapolationHandlerQuadPts<DIM>::shift(const vector_Type& newVector)
 {
-    switch (M_sizeStencil) {
-            case 1: // size 1: we just replace the last entry by the new vector
-            M_states[M_sizeStencil-1] = newVector;
-            break;
-            case 2: // size 2
-            M_states[M_sizeStencil-2] = M_states[M_sizeStencil-1];
-            M_states[M_sizeStencil-1] = newVector;
-            break;
-            case 3: // size 3
-            M_states[M_sizeStencil-3] = M_states[M_sizeStencil-2];
-            M_states[M_sizeStencil-2] = M_states[M_sizeStencil-1];
-            M_states[M_sizeStencil-1] = newVector;
-            break;
-        default:
-            break;
-    }
+    // rotating swaps the containers instead of copying them; the oldest state,
+    // now at the back, is overwritten in place by the new values
+    std::rotate(M_states.begin(), M_states.begin()+1, M_states.end());
+    M_states[M_sizeStencil-1] = newVector;
 }
 
 template <UInt DIM>
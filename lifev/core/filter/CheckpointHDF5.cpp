@@ -0,0 +1,276 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Checkpoint and restart of the solver state in HDF5 files
+
+    @date 10-2026
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <lifev/core/util/StringUtility.hpp>
+#include <lifev/core/filter/CheckpointHDF5.hpp>
+
+#ifdef HAVE_HDF5
+
+namespace LifeV
+{
+
+// ===================================================
+// Constructors & Destructor
+// ===================================================
+
+CheckpointHDF5::CheckpointHDF5 ( const commPtr_Type& comm,
+                                 const std::string& prefix,
+                                 const std::string& directory ) :
+    M_comm ( comm ),
+    M_prefix ( prefix ),
+    M_directory ( directory ),
+    M_nextIndex ( 0 )
+{
+    // New checkpoints never overwrite the ones already on disk
+    M_nextIndex = lastCheckpoint() + 1;
+}
+
+// ===================================================
+// Methods
+// ===================================================
+
+void CheckpointHDF5::addVector ( const std::string& name, const vectorPtr_Type& vector )
+{
+    M_vectors.push_back ( std::make_pair ( name, vector ) );
+}
+
+void CheckpointHDF5::addVectors ( const std::string& name, const vectorPtrList_Type& vectors )
+{
+    M_vectorLists.push_back ( std::make_pair ( name, vectors ) );
+}
+
+UInt CheckpointHDF5::write ( const Real& time )
+{
+    const UInt index ( M_nextIndex++ );
+
+    hdf5_Type file ( *M_comm );
+    file.Create ( fileName ( index ) );
+    if ( !file.IsOpen() )
+    {
+        ERROR_MSG ( "Unable to create " + fileName ( index ) );
+    }
+
+    const namedVectorList_Type vectors ( registeredVectors() );
+    for ( namedVectorList_Type::const_iterator it = vectors.begin(); it != vectors.end(); ++it )
+    {
+        const std::string& name ( it->first );
+        const vector_Type& vector ( *it->second );
+        Record& record ( M_records[ name ] );
+
+        // The vector is written if its values changed on any process
+        const size_t hash ( localHash ( vector ) );
+        Int changed ( record.fileIndex < 0 || hash != record.hash );
+        Int globalChanged ( 0 );
+        M_comm->MaxAll ( &changed, &globalChanged, 1 );
+
+        if ( globalChanged )
+        {
+            const LinearLayout& layout ( linearLayout ( vector.blockMap() ) );
+            Epetra_MultiVector linearVector ( layout.linearMap, 1 );
+            linearVector.Export ( vector.epetraVector(), layout.exporter, Insert );
+            file.Write ( name, linearVector );
+            record.fileIndex = index;
+        }
+        record.hash = hash;
+
+        file.Write ( "Index", name, record.fileIndex );
+    }
+
+    file.Write ( "Checkpoint", "time", time );
+    file.Write ( "Checkpoint", "numProcesses", M_comm->NumProc() );
+    file.Close();
+
+    return index;
+}
+
+Real CheckpointHDF5::read ( Int index )
+{
+    if ( index < 0 )
+    {
+        index = lastCheckpoint();
+    }
+    if ( index < 0 )
+    {
+        ERROR_MSG ( "No checkpoint " + M_directory + M_prefix + " found" );
+    }
+
+    // Files are opened once, the index file is the first one
+    std::map<Int, std::shared_ptr<hdf5_Type> > files;
+    std::shared_ptr<hdf5_Type>& indexFile ( files[ index ] );
+    indexFile.reset ( new hdf5_Type ( *M_comm ) );
+    indexFile->Open ( fileName ( index ) );
+    if ( !indexFile->IsOpen() )
+    {
+        ERROR_MSG ( "Unable to open " + fileName ( index ) );
+    }
+
+    Real time ( 0. );
+    indexFile->Read ( "Checkpoint", "time", time );
+
+    const namedVectorList_Type vectors ( registeredVectors() );
+    for ( namedVectorList_Type::const_iterator it = vectors.begin(); it != vectors.end(); ++it )
+    {
+        const std::string& name ( it->first );
+        vector_Type& vector ( *it->second );
+        Record& record ( M_records[ name ] );
+
+        indexFile->Read ( "Index", name, record.fileIndex );
+
+        std::shared_ptr<hdf5_Type>& file ( files[ record.fileIndex ] );
+        if ( !file )
+        {
+            file.reset ( new hdf5_Type ( *M_comm ) );
+            file->Open ( fileName ( record.fileIndex ) );
+            if ( !file->IsOpen() )
+            {
+                ERROR_MSG ( "Unable to open " + fileName ( record.fileIndex ) );
+            }
+        }
+
+        // The values are stored by global id: EpetraExt redistributes them on the map of the vector
+        Epetra_MultiVector* values ( 0 );
+        file->Read ( name, *vector.map().map ( vector.mapType() ), values );
+        vector.epetraVector().Update ( 1., *values, 0. );
+        delete values;
+
+        record.hash = localHash ( vector );
+    }
+
+    for ( std::map<Int, std::shared_ptr<hdf5_Type> >::iterator it = files.begin(); it != files.end(); ++it )
+    {
+        it->second->Close();
+    }
+
+    // Restarting from an older checkpoint must not overwrite the following ones
+    M_nextIndex = std::max ( M_nextIndex, static_cast<UInt> ( lastCheckpoint() + 1 ) );
+
+    return time;
+}
+
+Int CheckpointHDF5::lastCheckpoint() const
+{
+    Int last ( -1 );
+    if ( M_comm->MyPID() == 0 )
+    {
+        while ( std::ifstream ( fileName ( last + 1 ).c_str() ).good() )
+        {
+            ++last;
+        }
+    }
+    M_comm->Broadcast ( &last, 1, 0 );
+
+    return last;
+}
+
+// ===================================================
+// Private Methods
+// ===================================================
+
+CheckpointHDF5::LinearLayout::LinearLayout ( const Epetra_BlockMap& map ) :
+    sourceMap ( map ),
+    linearMap ( map.MaxAllGID() + 1, 0, map.Comm() ),
+    exporter ( map, linearMap )
+{
+}
+
+std::string CheckpointHDF5::fileName ( const UInt index ) const
+{
+    std::ostringstream name;
+    name << M_directory << M_prefix << "." << std::setw ( 5 ) << std::setfill ( '0' ) << index << ".h5";
+    return name.str();
+}
+
+CheckpointHDF5::namedVectorList_Type CheckpointHDF5::registeredVectors() const
+{
+    namedVectorList_Type vectors;
+
+    for ( UInt i ( 0 ); i < M_vectors.size(); ++i )
+    {
+        vectors.push_back ( std::make_pair ( M_vectors[ i ].first, M_vectors[ i ].second.get() ) );
+    }
+
+    for ( UInt i ( 0 ); i < M_vectorLists.size(); ++i )
+    {
+        const vectorPtrList_Type& list ( M_vectorLists[ i ].second );
+        for ( UInt j ( 0 ); j < list.size(); ++j )
+        {
+            vectors.push_back ( std::make_pair ( M_vectorLists[ i ].first + "." + number2string ( j ), list[ j ].get() ) );
+        }
+    }
+
+    for ( UInt i ( 0 ); i < M_stencils.size(); ++i )
+    {
+        const stencil_Type& stencil ( *M_stencils[ i ].second );
+        for ( UInt j ( 0 ); j < stencil.size(); ++j )
+        {
+            vectors.push_back ( std::make_pair ( M_stencils[ i ].first + "." + number2string ( j ), stencil[ j ] ) );
+        }
+    }
+
+    return vectors;
+}
+
+const CheckpointHDF5::LinearLayout& CheckpointHDF5::linearLayout ( const Epetra_BlockMap& map )
+{
+    // The layout keeps a copy of the map, so that its DataPtr() identifies it
+    std::shared_ptr<LinearLayout>& layout ( M_layouts[ map.DataPtr() ] );
+    if ( !layout )
+    {
+        layout.reset ( new LinearLayout ( map ) );
+    }
+    return *layout;
+}
+
+size_t CheckpointHDF5::localHash ( const vector_Type& vector )
+{
+    // FNV-1a on the bytes of the local values
+    const unsigned char* bytes ( reinterpret_cast<const unsigned char*> ( vector.epetraVector() [ 0 ] ) );
+    const size_t numBytes ( vector.epetraVector().MyLength() * sizeof ( Real ) );
+
+    size_t hash ( 14695981039346656037ULL );
+    for ( size_t i ( 0 ); i < numBytes; ++i )
+    {
+        hash ^= bytes[ i ];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+} // namespace LifeV
+
+#endif // HAVE_HDF5
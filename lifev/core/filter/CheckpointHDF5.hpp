@@ -0,0 +1,236 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Checkpoint and restart of the solver state in HDF5 files
+
+    @date 10-2026
+ */
+
+#ifndef CHECKPOINT_HDF5_H
+#define CHECKPOINT_HDF5_H 1
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <Epetra_ConfigDefs.h>
+#include <Epetra_Comm.h>
+#include <Epetra_Export.h>
+#include <Epetra_Map.h>
+
+#ifndef HAVE_HDF5
+
+#warning warning you should reconfigure Trilinos with  -D TPL_ENABLE_HDF5:BOOL=ON
+
+#else
+
+#include <EpetraExt_HDF5.h>
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+namespace LifeV
+{
+
+//! CheckpointHDF5 - Checkpoint and restart of the solver state
+/*!
+  The class saves a set of registered vectors (solutions, the stencil of a TimeAdvance
+  scheme, the state variables of an ionic model, ...) in a sequence of HDF5 files
+  named <prefix>.<index>.h5, and reads them back on restart.
+
+  The values of each vector are stored by global id, i.e. the entry of global id gid
+  is at position gid in the file, independently of the partitioning. The vectors can
+  then be read with any number of processes: the values are redistributed on the maps
+  of the registered vectors.
+
+  The checkpoints are incremental: a vector is written only if its values changed since
+  the previous checkpoint. Each file stores, in the group "Index", the number of the file
+  holding the last version of every vector, so that the files of the previous checkpoints
+  must be kept as long as they are referenced.
+
+  Usage:
+  <ol>
+  <li> register the vectors with addVector, addVectors and addTimeAdvance
+  <li> call write( time ) to save a checkpoint
+  <li> on restart, register the same vectors and call read() to load the last checkpoint
+  </ol>
+ */
+class CheckpointHDF5
+{
+public:
+
+    //! @name Public Types
+    //@{
+
+    typedef VectorEpetra                               vector_Type;
+    typedef std::shared_ptr<vector_Type>             vectorPtr_Type;
+    typedef std::vector<vectorPtr_Type>                vectorPtrList_Type;
+    typedef std::vector<vector_Type*>                  stencil_Type;
+    typedef Epetra_Comm                                comm_Type;
+    typedef std::shared_ptr<comm_Type>               commPtr_Type;
+    typedef EpetraExt::HDF5                            hdf5_Type;
+
+    //@}
+
+    //! @name Constructors & Destructor
+    //@{
+
+    //! Constructor
+    /*!
+      @param comm Communicator
+      @param prefix Prefix of the checkpoint files
+      @param directory Directory of the checkpoint files
+     */
+    CheckpointHDF5 ( const commPtr_Type& comm,
+                     const std::string& prefix = "checkpoint",
+                     const std::string& directory = "./" );
+
+    //! Destructor
+    ~CheckpointHDF5() {}
+
+    //@}
+
+    //! @name Methods
+    //@{
+
+    //! Register a vector
+    /*!
+      @param name Name of the vector in the checkpoint files, must be unique
+      @param vector The vector to be saved and restored
+     */
+    void addVector ( const std::string& name, const vectorPtr_Type& vector );
+
+    //! Register a list of vectors, e.g. the state variables of an ionic model
+    /*!
+      The vectors are saved as name.0, name.1, ...
+      @param name Name of the list in the checkpoint files, must be unique
+      @param vectors The vectors to be saved and restored
+     */
+    void addVectors ( const std::string& name, const vectorPtrList_Type& vectors );
+
+    //! Register the stencil of a time advance scheme (BDF history, Newmark states)
+    /*!
+      The stencil is followed by reference, since the time advance schemes rotate
+      the pointers of their history. The vectors are saved as name.0, name.1, ...
+      @param name Name of the scheme in the checkpoint files, must be unique
+      @param timeAdvance The time advance scheme, its stencil must be initialized before read()
+     */
+    template <typename TimeAdvanceType>
+    void addTimeAdvance ( const std::string& name, TimeAdvanceType& timeAdvance )
+    {
+        M_stencils.push_back ( std::make_pair ( name, &timeAdvance.stencil() ) );
+    }
+
+    //! Write a checkpoint
+    /*!
+      Only the vectors whose values changed since the last checkpoint are written.
+      @param time Current time
+      @return The index of the checkpoint
+     */
+    UInt write ( const Real& time );
+
+    //! Read a checkpoint into the registered vectors
+    /*!
+      The following checkpoints are numbered after the last one on disk, also when
+      an older checkpoint is read, so that no existing file is overwritten.
+      @param index Index of the checkpoint, the last one available if negative
+      @return The time of the checkpoint
+     */
+    Real read ( Int index = -1 );
+
+    //! Index of the last checkpoint available on disk, -1 if there are none
+    Int lastCheckpoint() const;
+
+    //@}
+
+private:
+
+    //! Entry of the checkpoint for a given vector
+    struct Record
+    {
+        Record() :
+            hash ( 0 ),
+            fileIndex ( -1 )
+        {}
+
+        //! Hash of the local values at the last write or read
+        size_t hash;
+
+        //! Index of the file storing the last version of the vector
+        Int fileIndex;
+    };
+
+    //! Communication plan from a vector map to the linear map indexed by global id
+    struct LinearLayout
+    {
+        LinearLayout ( const Epetra_BlockMap& map );
+
+        Epetra_BlockMap sourceMap;
+        Epetra_Map      linearMap;
+        Epetra_Export   exporter;
+    };
+
+    typedef std::vector<std::pair<std::string, vector_Type*> > namedVectorList_Type;
+
+    //! @name Private Methods
+    //@{
+
+    //! Name of the file with the given index
+    std::string fileName ( const UInt index ) const;
+
+    //! List of all the registered vectors with their names
+    namedVectorList_Type registeredVectors() const;
+
+    //! Layout to write the vectors based on the given map
+    const LinearLayout& linearLayout ( const Epetra_BlockMap& map );
+
+    //! Hash of the local values of a vector
+    static size_t localHash ( const vector_Type& vector );
+
+    //@}
+
+    commPtr_Type M_comm;
+    std::string  M_prefix;
+    std::string  M_directory;
+
+    std::vector<std::pair<std::string, vectorPtr_Type> >       M_vectors;
+    std::vector<std::pair<std::string, vectorPtrList_Type> >   M_vectorLists;
+    std::vector<std::pair<std::string, const stencil_Type*> >  M_stencils;
+
+    std::map<std::string, Record> M_records;
+    std::map<const void*, std::shared_ptr<LinearLayout> > M_layouts;
+
+    //! Index of the next checkpoint
+    UInt M_nextIndex;
+};
+
+} // namespace LifeV
+
+#endif // HAVE_HDF5
+
+#endif // CHECKPOINT_HDF5_H
@@ -37,15 +37,22 @@ along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
 #ifndef EXPORTER_HDF5_H
 #define EXPORTER_HDF5_H 1
 
+#include <algorithm>
 #include <sstream>
+#include <vector>
 
 
 #include <Epetra_ConfigDefs.h>
 #include <EpetraExt_DistArray.h>
 #include <EpetraExt_HDF5.h>
 #include <Epetra_Comm.h>
+#include <Epetra_Import.h>
+#include <Epetra_Map.h>
 #include <Epetra_IntVector.h>
 #include <Epetra_MultiVector.h>
+#ifdef EPETRA_MPI
+#include <Epetra_MpiComm.h>
+#endif
 
 #include <boost/algorithm/string.hpp>
 #include <boost/shared_array.hpp>
@@ -119,6 +126,8 @@ public:
       "start"     (start index for sections in the hdf5 data structure 0 for 000, 1 for 001 etc.),
       "save"      (how many time steps per postprocessing)
       "multimesh" ( = true if the mesh has to be saved at each post-processing step)
+      "singlePrecision" ( = true to write the fields in single precision, shuffled and deflated when
+                          the HDF5 library allows it, default false; import reads either precision)
       @param mesh the mesh
       @param the prefix for the case file (ex. "test" for test.case)
       @param the procId determines de CPU id. if negative, it ussemes there is only one processor
@@ -228,6 +237,12 @@ protected:
     void writeVariable (const exporterData_Type& dvar);
     void writeScalar (const exporterData_Type& dvar);
     void writeVector (const exporterData_Type& dvar);
+    //! write the values of a field, converted to single precision if required
+    void writeValues (const std::string& varname, const Epetra_MultiVector& values);
+    //! read the values of a field, in the precision of the stored dataset
+    void readValues (const std::string& varname, const Epetra_Map& map, Epetra_MultiVector*& values);
+    //! open a second handle to a file of M_HDF5, to be released with H5Fclose
+    hid_t openFile (const std::string& fileName, const unsigned& accessFlags, const Epetra_Comm& comm) const;
 
     void writeGeometry();
 
@@ -246,6 +261,9 @@ protected:
 
     //! do we want to write on file the connectivity?
     bool                        M_printConnectivity;
+
+    //! do we want to write the fields in single precision?
+    bool                        M_singlePrecision;
     //@}
 
 };
@@ -263,7 +281,8 @@ ExporterHDF5<MeshType>::ExporterHDF5() :
     M_HDF5              (),
     M_closingLines      ( "\n    </Grid>\n\n  </Domain>\n</Xdmf>\n"),
     M_outputFileName    ( "noninitialisedFileName" ),
-    M_printConnectivity ( true )
+    M_printConnectivity ( true ),
+    M_singlePrecision   ( false )
 {
 }
 
@@ -276,6 +295,7 @@ ExporterHDF5<MeshType>::ExporterHDF5 (const GetPot& dfile, meshPtr_Type mesh, co
     M_outputFileName    ( "noninitialisedFileName" )
 {
     M_printConnectivity = dfile ( ( prefix + "/printConnectivity" ).data(), 1);
+    M_singlePrecision = dfile ( ( prefix + "/singlePrecision" ).data(), false );
     this->setMeshProcId ( mesh, procId );
 }
 
@@ -287,6 +307,7 @@ ExporterHDF5<MeshType>::ExporterHDF5 (const GetPot& dfile, const std::string& pr
     M_outputFileName    ( "noninitialisedFileName" )
 {
     M_printConnectivity = dfile ( ( prefix + "/printConnectivity" ).data(), 1);
+    M_singlePrecision = dfile ( ( prefix + "/singlePrecision" ).data(), false );
 }
 
 // ===================================================
@@ -577,6 +598,7 @@ void ExporterHDF5<MeshType>::setDataFromGetPot ( const GetPot& dataFile, const s
 {
     super::setDataFromGetPot ( dataFile, section );
     M_printConnectivity = dataFile ( ( section + "/printConnectivity" ).data(), 1);
+    M_singlePrecision = dataFile ( ( section + "/singlePrecision" ).data(), false );
 }
 
 // ===================================================
@@ -870,7 +892,7 @@ void ExporterHDF5<MeshType>::writeScalarDatastructure  ( std::ofstream& xdmf, co
          "           <DataStructure  Format=\"HDF\"\n" <<
          "                           Dimensions=\"" << dvar.numDOF() << " " << dim << "\"\n" <<
          "                           DataType=\"Float\"\n" <<
-         "                           Precision=\"8\">\n" <<
+         "                           Precision=\"" << ( M_singlePrecision ? 4 : 8 ) << "\">\n" <<
          "               " << M_outputFileName << ":/" << dvar.variableName()
          << this->M_postfix  << "/Values\n" << // see also in writeVector/scalar
          "           </DataStructure>\n" <<
@@ -900,7 +922,7 @@ void ExporterHDF5<MeshType>::writeVectorDatastructure  ( std::ofstream& xdmf, co
              << this->M_mesh->numGlobalVertices()
              << " 1\"\n"
              << "                           DataType=\"Float\"\n"
-             << "                           Precision=\"8\">\n"
+             << "                           Precision=\"" << ( M_singlePrecision ? 4 : 8 ) << "\">\n"
              << "               "
              << M_outputFileName
              << ":/"
@@ -959,8 +981,7 @@ void ExporterHDF5<MeshType>::writeScalar (const exporterData_Type& dvar)
     subVar.subset (*dvar.storedArrayPtr(), start);
 
     std::string varname (dvar.variableName() + this->M_postfix); // see also in writeAttributes
-    bool writeTranspose (true);
-    M_HDF5->Write (varname, subVar.epetraVector(), writeTranspose );
+    writeValues (varname, subVar.epetraVector() );
 }
 
 template <typename MeshType>
@@ -1019,13 +1040,204 @@ void ExporterHDF5<MeshType>::writeVector (const exporterData_Type& dvar)
     Epetra_MultiVector multiVector (View, *subMap.map (Unique), ArrayOfPointers, nDimensions);
 
 
-    bool writeTranspose (true);
     std::string varname (dvar.variableName() + this->M_postfix); // see also in writeAttributes
-    M_HDF5->Write (varname, multiVector, writeTranspose);
+    writeValues (varname, multiVector);
 
     delete[] ArrayOfPointers;
 }
 
+template <typename MeshType>
+void ExporterHDF5<MeshType>::writeValues (const std::string& varname, const Epetra_MultiVector& values)
+{
+    if ( !M_singlePrecision )
+    {
+        bool writeTranspose (true);
+        M_HDF5->Write (varname, values, writeTranspose);
+        return;
+    }
+
+    // Same layout of the transposed double precision output: a GlobalLength x NumVectors
+    // dataset, where the processes write their rows one after the other
+    const Int myLength ( values.MyLength() );
+    const Int numVectors ( values.NumVectors() );
+
+    std::vector<float> buffer ( std::max ( myLength, 1 ) * numVectors );
+    for ( Int i ( 0 ); i < myLength; ++i )
+    {
+        for ( Int d ( 0 ); d < numVectors; ++d )
+        {
+            buffer[ i * numVectors + d ] = static_cast<float> ( values[ d ][ i ] );
+        }
+    }
+
+    Int offset ( 0 );
+    values.Comm().ScanSum ( &myLength, &offset, 1 );
+    offset -= myLength;
+
+    // EpetraExt writes only double precision multivectors: the dataset is created with the C interface,
+    // on a second handle to the file that HDF5 shares with the one of M_HDF5
+    const hid_t file ( openFile ( this->M_postDir + M_outputFileName, H5F_ACC_RDWR, values.Comm() ) );
+#ifdef H5_USE_16_API
+    hid_t group ( H5Gcreate ( file, varname.c_str(), 0 ) );
+#else
+    hid_t group ( H5Gcreate ( file, varname.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) );
+#endif
+
+    hsize_t dimensions[ 2 ] = { static_cast<hsize_t> ( values.GlobalLength() ), static_cast<hsize_t> ( numVectors ) };
+    hid_t fileSpace ( H5Screate_simple ( 2, dimensions, NULL ) );
+
+    // Chunked dataset, with the bytes shuffled before the deflate filter: the exponents of
+    // neighbouring values are alike and compress well
+    hid_t properties ( H5Pcreate ( H5P_DATASET_CREATE ) );
+#if defined(H5_HAVE_PARALLEL) && ( H5_VERS_MAJOR * 10000 + H5_VERS_MINOR * 100 + H5_VERS_RELEASE < 11002 )
+    // The parallel writes of this HDF5 version do not support filters
+    const bool compress ( false );
+#else
+    const bool compress ( dimensions[ 0 ] > 0 && H5Zfilter_avail ( H5Z_FILTER_DEFLATE ) > 0 );
+#endif
+    if ( compress )
+    {
+        hsize_t chunk[ 2 ] = { std::min<hsize_t> ( dimensions[ 0 ], 65536 ), dimensions[ 1 ] };
+        H5Pset_chunk ( properties, 2, chunk );
+        H5Pset_shuffle ( properties );
+        H5Pset_deflate ( properties, 4 );
+    }
+
+#ifdef H5_USE_16_API
+    hid_t dataset ( H5Dcreate ( group, "Values", H5T_NATIVE_FLOAT, fileSpace, properties ) );
+#else
+    hid_t dataset ( H5Dcreate ( group, "Values", H5T_NATIVE_FLOAT, fileSpace, H5P_DEFAULT, properties, H5P_DEFAULT ) );
+#endif
+
+    hsize_t start[ 2 ] = { static_cast<hsize_t> ( offset ), 0 };
+    hsize_t count[ 2 ] = { static_cast<hsize_t> ( std::max ( myLength, 1 ) ), static_cast<hsize_t> ( numVectors ) };
+    hid_t memorySpace ( H5Screate_simple ( 2, count, NULL ) );
+    if ( myLength > 0 )
+    {
+        H5Sselect_hyperslab ( fileSpace, H5S_SELECT_SET, start, NULL, count, NULL );
+    }
+    else
+    {
+        // The processes without entries take part in the collective write
+        H5Sselect_none ( fileSpace );
+        H5Sselect_none ( memorySpace );
+    }
+
+    hid_t transfer ( H5Pcreate ( H5P_DATASET_XFER ) );
+#ifdef H5_HAVE_PARALLEL
+    H5Pset_dxpl_mpio ( transfer, H5FD_MPIO_COLLECTIVE );
+#endif
+    H5Dwrite ( dataset, H5T_NATIVE_FLOAT, memorySpace, fileSpace, transfer, &buffer[ 0 ] );
+
+    H5Pclose ( transfer );
+    H5Sclose ( memorySpace );
+    H5Dclose ( dataset );
+    H5Pclose ( properties );
+    H5Sclose ( fileSpace );
+    H5Gclose ( group );
+    H5Fclose ( file );
+}
+
+template <typename MeshType>
+void ExporterHDF5<MeshType>::readValues (const std::string& varname, const Epetra_Map& map, Epetra_MultiVector*& values)
+{
+    // The precision is the one of the dataset, whatever the setting of this exporter
+    const hid_t file ( openFile ( this->M_postDir + this->M_prefix + ".h5", H5F_ACC_RDONLY, map.Comm() ) );
+    const std::string datasetName ( varname + "/Values" );
+#ifdef H5_USE_16_API
+    hid_t dataset ( H5Dopen ( file, datasetName.c_str() ) );
+#else
+    hid_t dataset ( H5Dopen ( file, datasetName.c_str(), H5P_DEFAULT ) );
+#endif
+    if ( dataset < 0 )
+    {
+        H5Fclose ( file );
+        ERROR_MSG ( "ExporterHDF5: the dataset " + datasetName + " does not exist" );
+    }
+
+    hid_t dataType ( H5Dget_type ( dataset ) );
+    const bool singlePrecision ( H5Tequal ( dataType, H5T_NATIVE_FLOAT ) > 0 );
+    H5Tclose ( dataType );
+
+    if ( !singlePrecision )
+    {
+        H5Dclose ( dataset );
+        H5Fclose ( file );
+
+        bool readTranspose (true);
+        M_HDF5->Read (varname, map, values, readTranspose);
+        return;
+    }
+
+    // As EpetraExt does, the rows are read on a linear map and then imported on the requested one
+    hid_t fileSpace ( H5Dget_space ( dataset ) );
+    hsize_t dimensions[ 2 ];
+    H5Sget_simple_extent_dims ( fileSpace, dimensions, NULL );
+    const Int numVectors ( static_cast<Int> ( dimensions[ 1 ] ) );
+
+    Epetra_Map linearMap ( static_cast<Int> ( dimensions[ 0 ] ), map.IndexBase(), map.Comm() );
+    const Int myLength ( linearMap.NumMyElements() );
+
+    std::vector<float> buffer ( std::max ( myLength, 1 ) * numVectors );
+    hsize_t count[ 2 ] = { static_cast<hsize_t> ( std::max ( myLength, 1 ) ), static_cast<hsize_t> ( numVectors ) };
+    hid_t memorySpace ( H5Screate_simple ( 2, count, NULL ) );
+    if ( myLength > 0 )
+    {
+        hsize_t start[ 2 ] = { static_cast<hsize_t> ( linearMap.MinMyGID() - linearMap.IndexBase() ), 0 };
+        H5Sselect_hyperslab ( fileSpace, H5S_SELECT_SET, start, NULL, count, NULL );
+    }
+    else
+    {
+        H5Sselect_none ( fileSpace );
+        H5Sselect_none ( memorySpace );
+    }
+
+    hid_t transfer ( H5Pcreate ( H5P_DATASET_XFER ) );
+#ifdef H5_HAVE_PARALLEL
+    H5Pset_dxpl_mpio ( transfer, H5FD_MPIO_COLLECTIVE );
+#endif
+    H5Dread ( dataset, H5T_NATIVE_FLOAT, memorySpace, fileSpace, transfer, &buffer[ 0 ] );
+
+    H5Pclose ( transfer );
+    H5Sclose ( memorySpace );
+    H5Sclose ( fileSpace );
+    H5Dclose ( dataset );
+    H5Fclose ( file );
+
+    Epetra_MultiVector linearValues ( linearMap, numVectors );
+    for ( Int i ( 0 ); i < myLength; ++i )
+    {
+        for ( Int d ( 0 ); d < numVectors; ++d )
+        {
+            linearValues[ d ][ i ] = static_cast<Real> ( buffer[ i * numVectors + d ] );
+        }
+    }
+
+    values = new Epetra_MultiVector ( map, numVectors );
+    Epetra_Import importer ( map, linearMap );
+    values->Import ( linearValues, importer, Insert );
+}
+
+template <typename MeshType>
+hid_t ExporterHDF5<MeshType>::openFile (const std::string& fileName, const unsigned& accessFlags, const Epetra_Comm& comm) const
+{
+    // HDF5 recognises a file that is already open and shares it between the two handles
+    hid_t accessProperties ( H5Pcreate ( H5P_FILE_ACCESS ) );
+#if defined(H5_HAVE_PARALLEL) && defined(EPETRA_MPI)
+    H5Pset_fapl_mpio ( accessProperties, dynamic_cast<const Epetra_MpiComm&> ( comm ).Comm(), MPI_INFO_NULL );
+#else
+    ( void ) comm;
+#endif
+    const hid_t file ( H5Fopen ( fileName.c_str(), accessFlags, accessProperties ) );
+    H5Pclose ( accessProperties );
+
+    if ( file < 0 )
+    {
+        ERROR_MSG ( "ExporterHDF5: cannot open the file " + fileName );
+    }
+    return file;
+}
+
 template <typename MeshType>
 void ExporterHDF5<MeshType>::writeGeometry()
 {
@@ -1227,8 +1439,7 @@ void ExporterHDF5<MeshType>::readScalar (exporterData_Type& dvar)
     {
         varname += this->M_postfix;
     }
-    bool readTranspose (true);
-    M_HDF5->Read (varname, *subMap.map (this->mapType() ), subVar, readTranspose);
+    readValues (varname, *subMap.map (this->mapType() ), subVar);
 
     dvar.storedArrayPtr()->subset (*subVar, subMap, 0, start );
 
@@ -1250,7 +1461,6 @@ void ExporterHDF5<MeshType>::readVector ( exporterData_Type& dvar)
     MapEpetra subMap (dvar.storedArrayPtr()->blockMap(), start, size);
     Epetra_MultiVector* subVar (0);
 
-    bool readTranspose (true);
     std::string varname (dvar.variableName() ); // see also in writeAttributes
 
     if (this->M_postfix != "")
@@ -1258,7 +1468,7 @@ void ExporterHDF5<MeshType>::readVector ( exporterData_Type& dvar)
         varname += this->M_postfix;
     }
 
-    M_HDF5->Read (varname, *subMap.map (this->mapType() ), subVar, readTranspose);
+    readValues (varname, *subMap.map (this->mapType() ), subVar);
 
 
     // then put back value in our VectorEpetra
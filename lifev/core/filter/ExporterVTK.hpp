@@ -46,6 +46,10 @@ along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
 #include <lifev/core/filter/Exporter.hpp>
 #include <lifev/core/util/EncoderBase64.hpp>
 
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
 namespace LifeV
 {
 
@@ -93,12 +97,14 @@ public:
     };
 
     /*! @enum EXPORT_MODE
-        The export modes currently supported are ascii and binary
+        The export modes currently supported are ascii, binary and
+        zlib compressed binary (available only if LifeV is built with zlib)
      */
     enum EXPORT_MODE
     {
         ASCII_EXPORT = 1,
-        BINARY_EXPORT = 2
+        BINARY_EXPORT = 2,
+        COMPRESSED_BINARY_EXPORT = 3
     };
 
     /*! @enum FLOAT_PRECISION
@@ -370,6 +376,16 @@ private:
       @param values the list of values extracted from the line
     */
     void readASCIIData ( const std::string& line, std::vector<Real>& values );
+    //! A routine for encoding raw data with the zlib compressor of VTK
+    /*!
+      The data are split in blocks of fixed size, each one compressed with zlib.
+      The header (number of blocks, size of the blocks, size of the last block,
+      compressed size of each block) and the compressed blocks are base64-encoded
+      separately, as expected by the vtkZLibDataCompressor.
+      @param rawData the data to be compressed
+      @return the encoded string
+    */
+    std::string compressAndEncode ( const std::string& rawData );
     //@}
 
     //! @name Private members
@@ -429,6 +445,13 @@ void ExporterVTK<MeshType >::setDataFromGetPot (
         case 2:
             M_exportMode = BINARY_EXPORT;
             break;
+        case 3:
+#ifdef HAVE_ZLIB
+            M_exportMode = COMPRESSED_BINARY_EXPORT;
+#else
+            ERROR_MSG ( "Compressed export mode requires LifeV to be built with zlib!" );
+#endif
+            break;
         default:
             ERROR_MSG ( "Unsupported export mode!" );
             break;
@@ -711,6 +734,10 @@ ExporterVTK<MeshType>::composeDataArrayStream (const exporterData_Type& dvar,
                                     sizeof (int32_type) );
             lengthOfRawData += sizeof (int32_type);
             break;
+        case COMPRESSED_BINARY_EXPORT:
+            // the size of the data is written in the header of the compressed blocks
+            formatString = "binary";
+            break;
         default:
             ERROR_MSG ( "WARNING: this export mode cannot be handled in ExporterVTK\n" )
             break;
@@ -738,6 +765,7 @@ ExporterVTK<MeshType>::composeDataArrayStream (const exporterData_Type& dvar,
             }
             break;
         case BINARY_EXPORT:
+        case COMPRESSED_BINARY_EXPORT:
             for (UInt iDOF = 0; iDOF < numMyDOF; ++iDOF)
             {
                 const Int id = localToGlobalMap.find (iDOF)->second;
@@ -756,8 +784,15 @@ ExporterVTK<MeshType>::composeDataArrayStream (const exporterData_Type& dvar,
                 }
             }
 
-            encodedDataString = base64_encode (reinterpret_cast<const unsigned char*> ( dataToBeEncoded.str().c_str() ),
-                                               lengthOfRawData );
+            if ( M_exportMode == COMPRESSED_BINARY_EXPORT )
+            {
+                encodedDataString = compressAndEncode ( dataToBeEncoded.str() );
+            }
+            else
+            {
+                encodedDataString = base64_encode (reinterpret_cast<const unsigned char*> ( dataToBeEncoded.str().c_str() ),
+                                                   lengthOfRawData );
+            }
             dataArraysStringStream << encodedDataString;
 
             break;
@@ -815,6 +850,11 @@ ExporterVTK<MeshType>::readVTUFiles ( exporterData_Type& dvar )
             // this is essentially a consistency check: the number of DOF is explicitly
             // written in the VTK files. We will check that the number of values read
             // from file matches this number
+            if ( line.find ( "vtkZLibDataCompressor" ) != std::string::npos )
+            {
+                ERROR_MSG ( "Compressed VTU files cannot be imported" );
+            }
+
             found = line.find ( "NumberOfPoints" );
             if ( found != std::string::npos )
             {
@@ -970,6 +1010,48 @@ ExporterVTK<MeshType>::readASCIIData ( const std::string& line, std::vector<Real
 }
 
 
+template <typename MeshType>
+std::string
+ExporterVTK<MeshType>::compressAndEncode ( const std::string& rawData )
+{
+#ifdef HAVE_ZLIB
+    // same block size used by the VTK writers
+    const uint32_type blockSize ( 32768 );
+    const uint32_type rawSize ( rawData.size() );
+    const uint32_type lastBlockSize ( rawSize % blockSize );
+    const uint32_type numBlocks ( rawSize / blockSize + ( lastBlockSize > 0 ? 1 : 0 ) );
+
+    std::vector<uint32_type> header ( 3 + numBlocks );
+    header[0] = numBlocks;
+    header[1] = blockSize;
+    header[2] = lastBlockSize;
+
+    std::vector<Bytef> compressedData ( numBlocks * compressBound ( blockSize ) );
+    uLongf compressedSize ( 0 );
+
+    for ( uint32_type iBlock = 0; iBlock < numBlocks; ++iBlock )
+    {
+        const uLong sourceSize ( ( iBlock == numBlocks - 1 && lastBlockSize > 0 ) ? lastBlockSize : blockSize );
+        uLongf blockCompressedSize ( compressedData.size() - compressedSize );
+
+        const Int status = compress ( &compressedData[ compressedSize ], &blockCompressedSize,
+                                      reinterpret_cast<const Bytef*> ( rawData.data() ) + iBlock * blockSize,
+                                      sourceSize );
+        ASSERT ( status == Z_OK, "zlib compression failed" );
+
+        header[ 3 + iBlock ] = blockCompressedSize;
+        compressedSize += blockCompressedSize;
+    }
+
+    return base64_encode ( reinterpret_cast<const unsigned char*> ( &header[0] ), header.size() * sizeof (uint32_type) )
+           + base64_encode ( compressedData.empty() ? 0 : &compressedData[0], compressedSize );
+#else
+    ERROR_MSG ( "Compressed export mode requires LifeV to be built with zlib!" );
+    return rawData;
+#endif
+}
+
+
 /*
     preliminary attempt at managing simultaneously all data associated to Nodes
     as opposed to data associated to Cells.
@@ -1116,6 +1198,7 @@ void ExporterVTK<MeshType>::composePVTUStream (const exporterData_Type& dvar,
             formatString = "ascii";
             break;
         case BINARY_EXPORT:
+        case COMPRESSED_BINARY_EXPORT:
             formatString = "binary";
             break;
         default:
@@ -1345,7 +1428,12 @@ void ExporterVTK<MeshType>::composeVTUHeaderStream ( UInt numPoints,
 
     //header part of the file
     vtuHeaderStringStream << "<?xml version=\"1.0\"?>\n";
-    vtuHeaderStringStream << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"LittleEndian\">\n";
+    vtuHeaderStringStream << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"LittleEndian\"";
+    if ( M_exportMode == COMPRESSED_BINARY_EXPORT )
+    {
+        vtuHeaderStringStream << " compressor=\"vtkZLibDataCompressor\"";
+    }
+    vtuHeaderStringStream << ">\n";
     vtuHeaderStringStream << "\t<UnstructuredGrid>\n";
     vtuHeaderStringStream << "\t\t<Piece NumberOfPoints=\"" << numPoints << "\""
                           << " NumberOfCells=\"" << this->M_mesh->numElements() << "\">\n";
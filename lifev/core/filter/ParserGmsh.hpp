@@ -32,7 +32,10 @@
 #include <lifev/core/mesh/BareMesh.hpp>
 
 #include <fstream>
-#include <deque>
+#include <sstream>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
 
 namespace LifeV
 {
@@ -46,14 +49,6 @@ namespace
 typedef int gmsh_int_t;
 typedef double gmsh_float_t;
 
-typedef struct
-{
-    gmsh_int_t id;
-    short type;
-    std::vector<gmsh_int_t> tags;
-    std::vector<gmsh_int_t> nodes;
-} gmsh_elm_t;
-
 static const LifeV::UInt elm_nodes_num[] =
 {
     2,  3,  4,  4,  8, 6,  5,  3,   6,  9, 10, 27, 18, 14,
@@ -65,6 +60,152 @@ static const LifeV::UInt elm_nodes_num[] =
     0,  0,  0,  0,  0, 0,  0, 64, 125
 };
 
+// In-memory scanner over the whole mesh file. The file is read
+// with a single block read and the numbers are converted in place,
+// which avoids one stringstream per line on large ASCII meshes.
+class gmsh_scanner_t
+{
+public:
+    gmsh_scanner_t() : M_cur (0), M_end (0) {}
+
+    // Load the whole file in memory
+    bool load (std::ifstream& ifile)
+    {
+        ifile.seekg (0, std::ios::end);
+        const std::streamoff size = ifile.tellg();
+        ifile.seekg (0, std::ios::beg);
+        if (size <= 0)
+        {
+            return false;
+        }
+        // One extra blank acts as a terminator for strtod
+        M_data.assign (static_cast<std::size_t> (size) + 1, '\n');
+        ifile.read (&M_data[0], size);
+        M_cur = &M_data[0];
+        M_end = M_cur + size;
+        return !ifile.fail();
+    }
+
+    // Back to the beginning of the file
+    void rewind()
+    {
+        M_cur = M_data.empty() ? 0 : &M_data[0];
+    }
+
+    bool eof() const
+    {
+        return M_cur >= M_end;
+    }
+
+    // Same as std::getline, but trailing '\r' is removed
+    bool getline (std::string& line)
+    {
+        if (eof() )
+        {
+            line.clear();
+            return false;
+        }
+        const char* begin = M_cur;
+        while (M_cur < M_end && *M_cur != '\n')
+        {
+            ++M_cur;
+        }
+        const char* last = M_cur;
+        if (last > begin && * (last - 1) == '\r')
+        {
+            --last;
+        }
+        line.assign (begin, last);
+        if (M_cur < M_end)
+        {
+            ++M_cur;
+        }
+        return true;
+    }
+
+    // Raw copy (binary sections)
+    bool read (void* dst, std::size_t nbytes)
+    {
+        if (static_cast<std::size_t> (M_end - M_cur) < nbytes)
+        {
+            M_cur = M_end;
+            return false;
+        }
+        std::memcpy (dst, M_cur, nbytes);
+        M_cur += nbytes;
+        return true;
+    }
+
+    void ignore (std::size_t nbytes)
+    {
+        M_cur = (static_cast<std::size_t> (M_end - M_cur) < nbytes) ? M_end : M_cur + nbytes;
+    }
+
+    // True if only blanks are left on the current line
+    bool endOfLine()
+    {
+        skipBlanks();
+        return eof() || *M_cur == '\n';
+    }
+
+    // Skip the end of the current line
+    void nextLine()
+    {
+        while (M_cur < M_end && *M_cur++ != '\n') {};
+    }
+
+    // Integer on the current line
+    bool getInt (gmsh_int_t& value)
+    {
+        if (endOfLine() )
+        {
+            return false;
+        }
+        bool negative = false;
+        if (*M_cur == '-' || *M_cur == '+')
+        {
+            negative = (*M_cur++ == '-');
+        }
+        const char* begin = M_cur;
+        gmsh_int_t v = 0;
+        while (M_cur < M_end && *M_cur >= '0' && *M_cur <= '9')
+        {
+            v = 10 * v + (*M_cur++ - '0');
+        }
+        value = negative ? -v : v;
+        return M_cur != begin;
+    }
+
+    // Real number on the current line
+    bool getReal (gmsh_float_t& value)
+    {
+        if (endOfLine() )
+        {
+            return false;
+        }
+        // The data is always followed by a blank (see load), so strtod
+        // cannot run past the end of the buffer
+        char* next;
+        value = std::strtod (M_cur, &next);
+        const bool ok = (next != M_cur);
+        M_cur = next;
+        return ok;
+    }
+
+private:
+    void skipBlanks()
+    {
+        while (M_cur < M_end && (*M_cur == ' ' || *M_cur == '\t' || *M_cur == '\r') )
+        {
+            ++M_cur;
+        }
+    }
+
+    std::vector<char> M_data;
+    const char* M_cur;
+    const char* M_end;
+};
+
 namespace utils
 {
 namespace detail
@@ -148,6 +289,8 @@ struct adm_shapes
  * @fn     ReadGmshFile
  * @brief  Reads a .msh file (ASCII, binary or legacy).
  *
+ * The file is loaded in memory with a single read and parsed in place.
+ *
  * @param  filename, name of the file
  * @param  baremesh, a baremesh object to be filled
  * @param  regionFlag, the id of the mesh (default 0)
@@ -172,6 +315,15 @@ bool ReadGmshFile (const std::string& filename,
         return false;
     }
 
+    gmsh_scanner_t scanner;
+    if (!scanner.load (ifile) )
+    {
+        std::cerr << "[ERROR:GmshIO] Cannot read file '"
+                  << filename << "'." << std::endl;
+        return false;
+    }
+    ifile.close();
+
     // Clean baremesh object
     baremesh.clear();
 
@@ -183,11 +335,11 @@ bool ReadGmshFile (const std::string& filename,
     {
         bool status_ok = false;
         std::string line;
-        std::getline (ifile, line);
+        scanner.getline (line);
         if (line == "$MeshFormat")
         {
             // Parse the next line
-            std::getline (ifile, line);
+            scanner.getline (line);
             std::stringstream iss (line);
 
             float version;
@@ -199,14 +351,10 @@ bool ReadGmshFile (const std::string& filename,
             if (is_binary)
             {
                 // Check file endianness
-                union
-                {
-                    gmsh_int_t i;
-                    char c[sizeof (gmsh_int_t)];
-                } one;
-                ifile.read (one.c, sizeof (gmsh_int_t) );
-                ifile.ignore (1);
-                is_differ_endian = (one.i != 1);
+                gmsh_int_t one = 0;
+                scanner.read (&one, sizeof (gmsh_int_t) );
+                scanner.ignore (1);
+                is_differ_endian = (one != 1);
                 // Check if system is little-endian
                 if (is_differ_endian)
                 {
@@ -246,22 +394,22 @@ bool ReadGmshFile (const std::string& filename,
     // ===========
     {
         // Back to the initial position
-        ifile.seekg (0, std::ios::beg);
+        scanner.rewind();
 
         // Look for the node section
         std::string node_tag = (is_legacy) ? "$NOD" : "$Nodes";
 
         // Seeking to the correct position
         std::string line;
-        while (std::getline (ifile, line) && line != node_tag) {};
-        if (ifile.eof() )
+        while (scanner.getline (line) && line != node_tag) {};
+        if (scanner.eof() )
         {
             std::cerr << "[ERROR:GmshIO] Nodes section not found" << std::endl;
             return false;
         }
 
         // Next line is the number of nodes
-        std::getline (ifile, line);
+        scanner.getline (line);
         std::size_t num_nodes = atoi (line.c_str() );
         if (!num_nodes)
         {
@@ -273,28 +421,32 @@ bool ReadGmshFile (const std::string& filename,
         baremesh.points.reshape (3, num_nodes);
         baremesh.pointMarkers.resize (num_nodes);
 
-        std::stringstream iss;
-
         // Loading the nodes (same for legacy)
         for (std::size_t i = 0; i < num_nodes; ++i)
         {
-            gmsh_int_t id;
-            gmsh_float_t p[3];
+            gmsh_int_t id = 0;
+            gmsh_float_t p[3] = { 0., 0., 0. };
+            bool status_ok;
 
             if (is_binary)
             {
                 // Binary case
-                ifile.read (reinterpret_cast<char*> (&id), sizeof (gmsh_int_t) );
-                ifile.read (reinterpret_cast<char*> (p), 3 * sizeof (gmsh_float_t) );
+                status_ok = scanner.read (&id, sizeof (gmsh_int_t) )
+                            && scanner.read (p, 3 * sizeof (gmsh_float_t) );
             }
             else
             {
                 // ASCII case (also if legacy)
-                std::getline (ifile, line);
-                iss.clear();
-                iss.str (line.c_str() );
-                // Parsing
-                iss >> id >> p[0] >> p[1] >> p[2];
+                status_ok = scanner.getInt (id) && scanner.getReal (p[0])
+                            && scanner.getReal (p[1]) && scanner.getReal (p[2]);
+                scanner.nextLine();
+            }
+
+            if (!status_ok || id < 1 || static_cast<std::size_t> (id) > num_nodes)
+            {
+                std::cerr << "[ERROR:GmshIO] Wrong entry for node " << i + 1
+                          << std::endl;
+                return false;
             }
 
             // Adds the point
@@ -305,11 +457,11 @@ bool ReadGmshFile (const std::string& filename,
         }
         if (is_binary)
         {
-            ifile.ignore (1);
+            scanner.ignore (1);
         }
 
         // Check if next line is $EndNodes
-        std::getline (ifile, line);
+        scanner.getline (line);
         if (line != "$EndNodes" && line != "$ENDNOD")
         {
             std::cerr << "[ERROR:GmshIO] Something wrong with Nodes section"
@@ -332,14 +484,14 @@ bool ReadGmshFile (const std::string& filename,
 
         // Seeking to the correct position
         std::string line;
-        while (std::getline (ifile, line) && line != elm_tag) {};
-        if (ifile.eof() )
+        while (scanner.getline (line) && line != elm_tag) {};
+        if (scanner.eof() )
         {
             std::cerr << "[ERROR:GmshIO] Elements section not found" << std::endl;
             return false;
         }
         // Next line is the number of elements
-        std::getline (ifile, line);
+        scanner.getline (line);
         std::size_t num_elms = atoi (line.c_str() );
 
         // Don't know how many elements of each type there are, so we cannot
@@ -355,9 +507,10 @@ bool ReadGmshFile (const std::string& filename,
             utils::adm_shapes<GeoShape>::peak_id
         };
 
-        // Stores the (gmsh) elements nodes and the type
-        std::deque<gmsh_elm_t> elems[4];
-
+        // Nodes (flat, element by element) and marker of the (gmsh)
+        // elements, split by shape
+        std::vector<gmsh_int_t> elm_nodes[4];
+        std::vector<gmsh_int_t> elm_markers[4];
 
         // Loading the elements
         bool status_ok = false;
@@ -365,15 +518,16 @@ bool ReadGmshFile (const std::string& filename,
         {
             // Binary format
             gmsh_int_t elm_count = 0;
+            std::vector<gmsh_int_t> e;
             do
             {
                 // header = { elm_type, num_elems, num_tags }
                 gmsh_int_t header[3];
-                ifile.read (reinterpret_cast<char*> (header), 3 * sizeof (gmsh_int_t) );
+                status_ok = scanner.read (header, 3 * sizeof (gmsh_int_t) );
                 // The type of the element, from 0 (elem) to 3 (peak)
                 short s_type = static_cast<short> (std::find (s_ids, s_ids + 4, header[0]) - s_ids);
                 // Is the shape admissible?
-                if (s_type == 4)
+                if (!status_ok || s_type == 4)
                 {
                     // Found a shape that cannot be stored
                     std::cerr << "[ERROR:GmshIO] Found elements "
@@ -384,47 +538,44 @@ bool ReadGmshFile (const std::string& filename,
                 }
                 // Nodes of element of this type
                 gmsh_int_t nnodes = elm_nodes_num[header[0] - 1];
-                // Next we have the elements { tags, nodes, id } * num_elems
-                gmsh_int_t total_size = header[1] * (1 + header[2] + nnodes);
-                std::vector<gmsh_int_t> e (total_size);
+                // Next we have the elements { id, tags, nodes } * num_elems
+                gmsh_int_t elm_size = 1 + header[2] + nnodes;
+                e.resize (header[1] * elm_size);
                 // Read at once
-                ifile.read (reinterpret_cast<char*> (&e[0]), total_size * sizeof (gmsh_int_t) );
+                status_ok = scanner.read (&e[0], e.size() * sizeof (gmsh_int_t) );
+                if (!status_ok)
+                {
+                    break;
+                }
                 // Increment counter
                 elm_count += header[1];
-                // Fill the queue
+                // Fill the containers
+                elm_nodes[s_type].reserve (elm_nodes[s_type].size() + header[1] * nnodes);
                 for (gmsh_int_t k = 0; k < header[1]; ++k)
                 {
-                    gmsh_elm_t tmp;
-                    tmp.type = header[0];
-                    // Fill the tags
-                    tmp.tags.reserve (header[2]);
-                    std::copy (e.begin(), e.begin() + header[2] + 1, std::back_inserter (tmp.tags) );
-                    // Fill the nodes
-                    tmp.nodes.reserve (nnodes);
-                    std::copy (e.begin() + header[2] + 1, e.end(), std::back_inserter (tmp.nodes) );
-                    // Save
-                    elems[s_type].push_back (tmp);
+                    std::vector<gmsh_int_t>::const_iterator it = e.begin() + k * elm_size;
+                    // Marker (the first tag)
+                    elm_markers[s_type].push_back (header[2] > 0 ? * (it + 1) : 0);
+                    // Nodes
+                    elm_nodes[s_type].insert (elm_nodes[s_type].end(),
+                                              it + 1 + header[2], it + elm_size);
                 }
-                status_ok = true;
             }
             while (elm_count < static_cast<gmsh_int_t> (num_elms) );
             // Skip return
-            ifile.ignore (1);
+            scanner.ignore (1);
         }
         else
         {
             // ASCII format
-            typedef std::istream_iterator<gmsh_int_t> iss_it;
-            std::stringstream iss;
+            std::vector<gmsh_int_t> tags;
             for (std::size_t i = 0; i < num_elms; ++i)
             {
-                gmsh_int_t id, type, num_tags;
+                gmsh_int_t id = 0, type = 0, num_tags = 0;
 
                 // Gathering id, type and number of tags
-                std::getline (ifile, line);
-                iss.clear();
-                iss.str (line);
-                iss >> id >> type >> num_tags;
+                status_ok = scanner.getInt (id) && scanner.getInt (type)
+                            && scanner.getInt (num_tags);
                 if (is_legacy)
                 {
                     num_tags = 2;
@@ -433,7 +584,7 @@ bool ReadGmshFile (const std::string& filename,
                 // The type of the element, from 0 (elem) to 3 (peak)
                 short s_type = static_cast<short> (std::find (s_ids, s_ids + 4, type) - s_ids);
                 // Is the shape admissible?
-                if (s_type == 4)
+                if (!status_ok || s_type == 4)
                 {
                     // Found a shape that cannot be stored
                     std::cerr << "[ERROR:GmshIO] Element " << id
@@ -443,26 +594,30 @@ bool ReadGmshFile (const std::string& filename,
                     break;
                 }
 
-                // Parsing nodes and tags
-                gmsh_elm_t tmp;
-                tmp.type = type;
-                // Fill the tags
-                tmp.tags.resize (num_tags);
-                for (int k = 0; k < num_tags; ++k)
+                // Parsing the tags
+                tags.resize (num_tags);
+                for (int k = 0; k < num_tags && status_ok; ++k)
+                {
+                    status_ok = scanner.getInt (tags[k]);
+                }
+                // Marker (the second tag)
+                elm_markers[s_type].push_back (num_tags > 1 ? tags[1] : 0);
+                // Parsing the nodes, up to the end of the line
+                gmsh_int_t node;
+                while (status_ok && !scanner.endOfLine() )
                 {
-                    iss >> tmp.tags[k];
+                    status_ok = scanner.getInt (node);
+                    elm_nodes[s_type].push_back (node);
+                }
+                scanner.nextLine();
+                if (!status_ok)
+                {
+                    break;
                 }
-                // Fill the values
-                int nnodes = elm_nodes_num[type - 1];
-                tmp.nodes.reserve (nnodes);
-                std::copy (iss_it (iss), iss_it(), std::back_inserter (tmp.nodes) );
-                // Saving
-                elems[s_type].push_back (tmp);
-                status_ok = iss.eof();
             }
         }
         // Check if next line is $EndElements
-        std::getline (ifile, line);
+        scanner.getline (line);
         if (!status_ok || (line != "$EndElements" && line != "$ENDELM") )
         {
             std::cerr << "[ERROR:GmshIO] Something wrong with Elements section." << std::endl;
@@ -473,7 +628,7 @@ bool ReadGmshFile (const std::string& filename,
         if (verbose)
             std::clog << "[INFO:GmshIO] Highest dimension should be "
                       << baremesh.nDimensions << "." << std::endl;
-        if (!elems[0].size() )
+        if (!elm_markers[0].size() )
         {
             std::cerr << "[ERROR:GmshIO] No "
                       << baremesh.nDimensions << "d elements found!" << std::endl;
@@ -498,8 +653,14 @@ bool ReadGmshFile (const std::string& filename,
         for (LifeV::UInt s = 0; s < baremesh.nDimensions + 1; ++s)
         {
             // (n-s)-dimensional element
-            LifeV::UInt num_s_elems = elems[s].size();
+            LifeV::UInt num_s_elems = elm_markers[s].size();
             LifeV::UInt num_s_nodes = elm_nodes_num[s_ids[s] - 1];
+            if (elm_nodes[s].size() != num_s_elems * num_s_nodes)
+            {
+                std::cerr << "[ERROR:GmshIO] Wrong number of nodes for "
+                          << (baremesh.nDimensions - s) << "d elements." << std::endl;
+                return false;
+            }
             // Allocating memory inside baremesh
             if (s < 3)
             {
@@ -516,13 +677,13 @@ bool ReadGmshFile (const std::string& filename,
             for (LifeV::UInt i = 0; i < num_s_elems; ++i)
             {
                 // Marker (only the first one)
-                bare_mrk_ptr[s]->at (i) = elems[s][i].tags[1];
+                bare_mrk_ptr[s]->at (i) = elm_markers[s][i];
                 // Nodes
                 if (s < 3)
                 {
                     for (LifeV::UInt k = 0; k < num_s_nodes; ++k)
                     {
-                        (*bare_elm_ptr[s]) (k, i) = elems[s][i].nodes[k] - 1;
+                        (*bare_elm_ptr[s]) (k, i) = elm_nodes[s][i * num_s_nodes + k] - 1;
                     }
                 }
             }
@@ -243,7 +243,9 @@ void RBFlocallyRescaledScalar<Mesh>::interpolationOperator()
     for (std::unordered_set<ID>::iterator it = M_GIdsKnownMesh.begin(); it != M_GIdsKnownMesh.end(); ++it)
     {
         GlobalID[k] = *it;
-        MatrixGraph[k] = M_neighbors->pointPointNeighborsList() [GlobalID[k]];
+        MatrixGraph[k].clear();
+        MatrixGraph[k].insert ( M_neighbors->pointPointNeighborsList() [GlobalID[k]].begin(),
+                                M_neighbors->pointPointNeighborsList() [GlobalID[k]].end() );
         MatrixGraph[k].insert (GlobalID[k]);
         RBF_radius[k] = computeRBFradius ( M_fullMeshKnown, M_fullMeshKnown, MatrixGraph[k], GlobalID[k]);
         ElementsPerRow[k] = MatrixGraph[k].size();
@@ -316,7 +318,9 @@ void RBFlocallyRescaledScalar<mesh_Type>::projectionOperator()
                 }
             }
         }
-        MatrixGraph[k] = M_neighbors->pointPointNeighborsList() [nearestPoint];
+        MatrixGraph[k].clear();
+        MatrixGraph[k].insert ( M_neighbors->pointPointNeighborsList() [nearestPoint].begin(),
+                                M_neighbors->pointPointNeighborsList() [nearestPoint].end() );
         MatrixGraph[k].insert (nearestPoint);
         RBF_radius[k] = computeRBFradius ( M_fullMeshKnown, M_fullMeshUnknown, MatrixGraph[k], GlobalID[k]);
         ElementsPerRow[k] = MatrixGraph[k].size();
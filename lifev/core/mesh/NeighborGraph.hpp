@@ -0,0 +1,305 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+ *   @file
+     @brief Adjacency lists stored in compressed row (CSR) format
+
+     @date 10/2026
+ */
+
+#ifndef _NEIGHBORGRAPH_H_
+#define _NEIGHBORGRAPH_H_ 1
+
+#include <algorithm>
+#include <vector>
+
+#include <lifev/core/LifeV.hpp>
+
+namespace LifeV
+{
+
+//! @class NeighborGraph
+/*!
+  Adjacency lists of mesh entities (e.g. the points neighboring a point) stored
+  in compressed row format: the neighbors of the row i are the values in the
+  range [ offsets[ i ], offsets[ i + 1 ] ). The neighbors of each row are sorted
+  and unique.
+
+  The graph is assembled with a counting sort in two passes over the same list
+  of entries: in the first pass the entries are only counted, in the second one
+  they are stored. No per-entry allocation is done.
+
+  @code
+  graph.beginAssembly ( numRows );
+  for ( UInt pass = 0; pass < 2; ++pass )
+  {
+      if ( pass == 1 )
+      {
+          graph.allocateEntries();
+      }
+      // loop on the connectivity calling graph.addEntry ( row, value )
+  }
+  graph.endAssembly();
+  @endcode
+ */
+class NeighborGraph
+{
+public:
+
+    //! @name Public Types
+    //@{
+
+    typedef std::vector<UInt> offsets_Type;
+    typedef std::vector<ID> values_Type;
+    typedef values_Type::const_iterator const_iterator;
+
+    //! Range of the neighbors of a row
+    class Row
+    {
+    public:
+        typedef NeighborGraph::const_iterator const_iterator;
+
+        Row ( const_iterator begin, const_iterator end ) :
+            M_begin ( begin ),
+            M_end ( end )
+        {}
+
+        const_iterator begin() const
+        {
+            return M_begin;
+        }
+
+        const_iterator end() const
+        {
+            return M_end;
+        }
+
+        UInt size() const
+        {
+            return static_cast<UInt> ( M_end - M_begin );
+        }
+
+        bool empty() const
+        {
+            return M_begin == M_end;
+        }
+
+        //! Check if the given value is a neighbor (binary search)
+        bool contains ( ID const value ) const
+        {
+            return std::binary_search ( M_begin, M_end, value );
+        }
+
+    private:
+        const_iterator M_begin;
+        const_iterator M_end;
+    };
+
+    typedef Row row_Type;
+
+    //@}
+
+    //! @name Constructors & Destructors
+    //@{
+
+    NeighborGraph() :
+        M_offsets(),
+        M_values(),
+        M_position()
+    {}
+
+    //@}
+
+    //! @name Operators
+    //@{
+
+    //! Neighbors of the given row
+    row_Type operator[] ( ID const row ) const
+    {
+        return row_Type ( M_values.begin() + M_offsets[ row ],
+                          M_values.begin() + M_offsets[ row + 1 ] );
+    }
+
+    //@}
+
+    //! @name Assembly Methods
+    //@{
+
+    //! Start the assembly of a graph with the given number of rows
+    /*!
+     * The previous content is discarded. Entries added after this call are only counted.
+     * @param numRows. Number of rows of the graph
+     */
+    void beginAssembly ( UInt const numRows )
+    {
+        M_values.clear();
+        M_offsets.assign ( numRows + 1, 0 );
+        M_position.clear();
+    }
+
+    //! Allocate the storage for the entries counted since beginAssembly
+    /*!
+     * Entries added after this call are stored: they must be the same entries
+     * of the counting pass.
+     */
+    void allocateEntries()
+    {
+        for ( UInt i = 1; i < M_offsets.size(); ++i )
+        {
+            M_offsets[ i ] += M_offsets[ i - 1 ];
+        }
+        M_values.resize ( M_offsets.back() );
+        M_position.assign ( M_offsets.begin(), M_offsets.end() - 1 );
+    }
+
+    //! Add an entry to the graph
+    /*!
+     * @param row. The row of the entry
+     * @param value. The neighbor to add to the row
+     */
+    void addEntry ( ID const row, ID const value )
+    {
+        if ( M_position.empty() )
+        {
+            ++M_offsets[ row + 1 ];
+        }
+        else
+        {
+            M_values[ M_position[ row ]++ ] = value;
+        }
+    }
+
+    //! Sort the rows and remove the duplicated entries
+    void endAssembly()
+    {
+        clearVector ( M_position );
+
+        Int const numRows ( static_cast<Int> ( size() ) );
+        offsets_Type rowSize ( numRows + 1, 0 );
+
+        #pragma omp parallel for
+        for ( Int i = 0; i < numRows; ++i )
+        {
+            values_Type::iterator const rowBegin ( M_values.begin() + M_offsets[ i ] );
+            values_Type::iterator const rowEnd ( M_values.begin() + M_offsets[ i + 1 ] );
+            std::sort ( rowBegin, rowEnd );
+            rowSize[ i + 1 ] = std::unique ( rowBegin, rowEnd ) - rowBegin;
+        }
+
+        // compact the rows only if some duplicates have been removed
+        UInt newSize ( 0 );
+        for ( Int i = 0; i < numRows; ++i )
+        {
+            newSize += rowSize[ i + 1 ];
+        }
+        if ( newSize == M_values.size() )
+        {
+            return;
+        }
+
+        for ( Int i = 0; i < numRows; ++i )
+        {
+            std::copy ( M_values.begin() + M_offsets[ i ],
+                        M_values.begin() + M_offsets[ i ] + rowSize[ i + 1 ],
+                        M_values.begin() + rowSize[ i ] );
+            rowSize[ i + 1 ] += rowSize[ i ];
+        }
+        M_offsets.swap ( rowSize );
+        values_Type ( M_values.begin(), M_values.begin() + newSize ).swap ( M_values );
+    }
+
+    //! Set the graph from its compressed row arrays
+    /*!
+     * The arrays are swapped into the graph, the rows must be already sorted.
+     * @param offsets. Row offsets, of size numRows + 1
+     * @param values. Neighbors of all the rows
+     */
+    void setStructure ( offsets_Type& offsets, values_Type& values )
+    {
+        ASSERT ( !offsets.empty() && offsets.back() == values.size(), "inconsistent compressed row arrays" );
+        M_offsets.swap ( offsets );
+        M_values.swap ( values );
+        clearVector ( M_position );
+    }
+
+    //! Release the memory of the graph
+    void clear()
+    {
+        clearVector ( M_offsets );
+        clearVector ( M_values );
+        clearVector ( M_position );
+    }
+
+    //@}
+
+    //! @name Get Methods
+    //@{
+
+    //! Number of rows
+    UInt size() const
+    {
+        return M_offsets.empty() ? 0 : static_cast<UInt> ( M_offsets.size() - 1 );
+    }
+
+    //! True if the graph has no rows
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    //! Total number of entries
+    UInt numEntries() const
+    {
+        return static_cast<UInt> ( M_values.size() );
+    }
+
+    //! Row offsets
+    offsets_Type const& offsets() const
+    {
+        return M_offsets;
+    }
+
+    //! Neighbors of all the rows
+    values_Type const& values() const
+    {
+        return M_values;
+    }
+
+    //@}
+
+private:
+
+    offsets_Type M_offsets;
+    values_Type M_values;
+
+    //! Insertion position of each row during the filling pass
+    offsets_Type M_position;
+};
+
+} // namespace LifeV
+
+#endif // _NEIGHBORGRAPH_H_
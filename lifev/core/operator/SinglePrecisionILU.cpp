@@ -0,0 +1,272 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief SinglePrecisionILU
+
+    @date 10-2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <lifev/core/operator/SinglePrecisionILU.hpp>
+
+namespace LifeV
+{
+namespace Operators
+{
+
+SinglePrecisionILU::SinglePrecisionILU() :
+    M_map()
+{
+
+}
+
+SinglePrecisionILU::~SinglePrecisionILU()
+{
+
+}
+
+void
+SinglePrecisionILU::setUp ( const matrix_Type& matrix, const Real& absoluteThreshold, const Real& relativeThreshold )
+{
+    ASSERT ( matrix.Filled(), "SinglePrecisionILU::setUp: Error: the matrix must be filled" );
+    ASSERT ( matrix.RowMap().SameAs ( matrix.OperatorRangeMap() ), "SinglePrecisionILU::setUp: Error: the row map must be the range map" );
+
+    M_map.reset ( new map_Type ( matrix.OperatorRangeMap() ) );
+
+    const Int numRows ( matrix.NumMyRows() );
+
+    // Local diagonal block with sorted columns, the diagonal entry is always stored
+    M_rowPointers.assign ( 1, 0 );
+    M_columns.clear();
+    M_diagonalPointers.resize ( numRows );
+    std::vector<Real> values;
+    std::vector<std::pair<Int, Real> > row;
+
+    for ( Int i ( 0 ); i < numRows; ++i )
+    {
+        Int numEntries ( 0 );
+        Real* rowValues ( 0 );
+        Int* rowIndices ( 0 );
+        matrix.ExtractMyRowView ( i, numEntries, rowValues, rowIndices );
+
+        row.clear();
+        row.push_back ( std::make_pair ( i, 0. ) );
+        for ( Int k ( 0 ); k < numEntries; ++k )
+        {
+            const Int column ( matrix.RowMap().LID ( matrix.ColMap().GID ( rowIndices[ k ] ) ) );
+            if ( column == i )
+            {
+                row[ 0 ].second += rowValues[ k ];
+            }
+            else if ( column >= 0 )
+            {
+                row.push_back ( std::make_pair ( column, rowValues[ k ] ) );
+            }
+        }
+        std::sort ( row.begin(), row.end() );
+
+        for ( UInt k ( 0 ); k < row.size(); ++k )
+        {
+            if ( row[ k ].first == i )
+            {
+                M_diagonalPointers[ i ] = M_columns.size();
+                const Real sign ( row[ k ].second < 0. ? -1. : 1. );
+                row[ k ].second = absoluteThreshold * sign + relativeThreshold * row[ k ].second;
+            }
+            M_columns.push_back ( row[ k ].first );
+            values.push_back ( row[ k ].second );
+        }
+        M_rowPointers.push_back ( M_columns.size() );
+    }
+
+    // ILU(0) in double precision, row by row (IKJ variant)
+    std::vector<Int> position ( numRows, -1 );
+    for ( Int i ( 0 ); i < numRows; ++i )
+    {
+        for ( Int k ( M_rowPointers[ i ] ); k < M_rowPointers[ i + 1 ]; ++k )
+        {
+            position[ M_columns[ k ] ] = k;
+        }
+
+        for ( Int k ( M_rowPointers[ i ] ); k < M_diagonalPointers[ i ]; ++k )
+        {
+            const Int j ( M_columns[ k ] );
+            values[ k ] /= values[ M_diagonalPointers[ j ] ];
+
+            for ( Int l ( M_diagonalPointers[ j ] + 1 ); l < M_rowPointers[ j + 1 ]; ++l )
+            {
+                const Int p ( position[ M_columns[ l ] ] );
+                if ( p >= 0 )
+                {
+                    values[ p ] -= values[ k ] * values[ l ];
+                }
+            }
+        }
+
+        // Zero pivots are replaced by one, as if the row was decoupled
+        if ( values[ M_diagonalPointers[ i ] ] == 0. )
+        {
+            values[ M_diagonalPointers[ i ] ] = 1.;
+        }
+
+        for ( Int k ( M_rowPointers[ i ] ); k < M_rowPointers[ i + 1 ]; ++k )
+        {
+            position[ M_columns[ k ] ] = -1;
+        }
+    }
+
+    // The factors are stored in single precision
+    M_values.assign ( values.begin(), values.end() );
+    M_inverseDiagonal.resize ( numRows );
+    for ( Int i ( 0 ); i < numRows; ++i )
+    {
+        M_inverseDiagonal[ i ] = static_cast<float> ( 1. / values[ M_diagonalPointers[ i ] ] );
+    }
+}
+
+int
+SinglePrecisionILU::SetUseTranspose ( bool useTranspose )
+{
+    return useTranspose ? -1 : 0;
+}
+
+int
+SinglePrecisionILU::Apply ( const vector_Type& /*X*/, vector_Type& /*Y*/ ) const
+{
+    return -1;
+}
+
+int
+SinglePrecisionILU::ApplyInverse ( const vector_Type& X, vector_Type& Y ) const
+{
+    ASSERT ( M_map.get() != 0, "SinglePrecisionILU::ApplyInverse: Error: the factorization is not computed" );
+    ASSERT ( X.NumVectors() == Y.NumVectors(), "SinglePrecisionILU::ApplyInverse: Error: X and Y must have the same number of vectors" );
+    ASSERT ( X.MyLength() == M_map->NumMyElements() && Y.MyLength() == M_map->NumMyElements(),
+             "SinglePrecisionILU::ApplyInverse: Error: X and Y do not match the map of the operator" );
+
+    const Int numRows ( M_map->NumMyElements() );
+
+    // The right hand side is copied in the work vector first, so that X and Y can be the same
+    std::vector<float> z ( numRows );
+    for ( Int v ( 0 ); v < X.NumVectors(); ++v )
+    {
+        const Real* x ( X[ v ] );
+        for ( Int i ( 0 ); i < numRows; ++i )
+        {
+            z[ i ] = static_cast<float> ( x[ i ] );
+        }
+
+        // Forward substitution with L
+        for ( Int i ( 0 ); i < numRows; ++i )
+        {
+            float sum ( z[ i ] );
+            for ( Int k ( M_rowPointers[ i ] ); k < M_diagonalPointers[ i ]; ++k )
+            {
+                sum -= M_values[ k ] * z[ M_columns[ k ] ];
+            }
+            z[ i ] = sum;
+        }
+
+        // Backward substitution with U
+        for ( Int i ( numRows - 1 ); i >= 0; --i )
+        {
+            float sum ( z[ i ] );
+            for ( Int k ( M_diagonalPointers[ i ] + 1 ); k < M_rowPointers[ i + 1 ]; ++k )
+            {
+                sum -= M_values[ k ] * z[ M_columns[ k ] ];
+            }
+            z[ i ] = sum * M_inverseDiagonal[ i ];
+        }
+
+        Real* y ( Y[ v ] );
+        for ( Int i ( 0 ); i < numRows; ++i )
+        {
+            y[ i ] = z[ i ];
+        }
+    }
+
+    return 0;
+}
+
+double
+SinglePrecisionILU::NormInf() const
+{
+    return -1.;
+}
+
+const char*
+SinglePrecisionILU::Label() const
+{
+    return "SinglePrecisionILU";
+}
+
+bool
+SinglePrecisionILU::UseTranspose() const
+{
+    return false;
+}
+
+bool
+SinglePrecisionILU::HasNormInf() const
+{
+    return false;
+}
+
+const SinglePrecisionILU::comm_Type&
+SinglePrecisionILU::Comm() const
+{
+    ASSERT ( M_map.get() != 0, "SinglePrecisionILU::Comm: Error: the factorization is not computed" );
+    return M_map->Comm();
+}
+
+const SinglePrecisionILU::map_Type&
+SinglePrecisionILU::OperatorDomainMap() const
+{
+    ASSERT ( M_map.get() != 0, "SinglePrecisionILU::OperatorDomainMap: Error: the factorization is not computed" );
+    return *M_map;
+}
+
+const SinglePrecisionILU::map_Type&
+SinglePrecisionILU::OperatorRangeMap() const
+{
+    ASSERT ( M_map.get() != 0, "SinglePrecisionILU::OperatorRangeMap: Error: the factorization is not computed" );
+    return *M_map;
+}
+
+UInt
+SinglePrecisionILU::factorsBytes() const
+{
+    return M_values.size() * sizeof ( float ) + M_inverseDiagonal.size() * sizeof ( float )
+           + ( M_rowPointers.size() + M_columns.size() + M_diagonalPointers.size() ) * sizeof ( Int );
+}
+
+} // Namespace Operators
+} // Namespace LifeV
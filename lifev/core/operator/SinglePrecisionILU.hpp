@@ -0,0 +1,156 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief SinglePrecisionILU
+
+    @date 10-2026
+ */
+
+#ifndef _SINGLEPRECISIONILU_HPP_
+#define _SINGLEPRECISIONILU_HPP_
+
+#include <vector>
+
+#include <Epetra_Comm.h>
+#include <Epetra_CrsMatrix.h>
+#include <Epetra_Map.h>
+#include <Epetra_MultiVector.h>
+#include <Epetra_Operator.h>
+
+#include <lifev/core/operator/LinearOperator.hpp>
+
+namespace LifeV
+{
+namespace Operators
+{
+
+//! @class SinglePrecisionILU
+/*! @brief ILU(0) factorization of the local diagonal block, stored and applied in single precision.
+ *
+ *  The factorization is computed in double precision on the entries of the rows owned by the
+ *  process whose columns are owned too (block Jacobi without overlap), then the factors are
+ *  stored as floats. The triangular solves read half the bytes of the double precision ones,
+ *  while the input and the output of ApplyInverse remain double precision vectors, so that the
+ *  outer Krylov iteration is not affected.
+ */
+class SinglePrecisionILU : public LinearOperator
+{
+public:
+
+    //! @name Public Typedefs and Enumerators
+    //@{
+    typedef Epetra_CrsMatrix                       matrix_Type;
+    typedef Epetra_MultiVector                     vector_Type;
+    typedef Epetra_Comm                            comm_Type;
+    typedef Epetra_Map                             map_Type;
+    //@}
+
+    //! null constructor and destructor
+    //@{
+    SinglePrecisionILU();
+    ~SinglePrecisionILU();
+    //@}
+
+    //! @name Methods
+    //@{
+
+    //! Compute the factorization
+    /*!
+      The diagonal entries are replaced by absoluteThreshold * sign( a_ii ) + relativeThreshold * a_ii
+      before the factorization, as done by Ifpack.
+      @param matrix The matrix, its row map must be the range map
+      @param absoluteThreshold Absolute perturbation of the diagonal
+      @param relativeThreshold Relative perturbation of the diagonal
+     */
+    void setUp ( const matrix_Type& matrix, const Real& absoluteThreshold = 0., const Real& relativeThreshold = 1. );
+
+    //@}
+
+    //! @name Attribute set methods
+    //@{
+
+    //! If set true, transpose of this operator will be applied (not supported).
+    virtual int SetUseTranspose ( bool useTranspose );
+
+    //@}
+
+    //! @name Mathematical methods
+    //@{
+
+    //! Not supported: the preconditioner is only applied through ApplyInverse.
+    virtual int Apply ( const vector_Type& X, vector_Type& Y ) const;
+
+    //! Apply the inverse of the factorization to X, X and Y can be the same vector.
+    virtual int ApplyInverse ( const vector_Type& X, vector_Type& Y ) const;
+
+    //! Not supported.
+    double NormInf() const;
+
+    //@}
+
+    //! @name Attribute access methods
+    //@{
+
+    //! Returns a character string describing the operator
+    virtual const char* Label() const;
+
+    //! Returns the current UseTranspose setting.
+    virtual bool UseTranspose() const;
+
+    //! Returns true if the \e this object can provide an approximate Inf-norm, false otherwise.
+    virtual bool HasNormInf() const;
+
+    //! Returns a pointer to the Epetra_Comm communicator associated with this operator.
+    virtual const comm_Type& Comm() const;
+
+    //! Returns the Epetra_Map object associated with the domain of this operator.
+    virtual const map_Type& OperatorDomainMap() const;
+
+    //! Returns the Epetra_Map object associated with the range of this operator.
+    virtual const map_Type& OperatorRangeMap() const;
+
+    //! Returns the number of bytes of the factors.
+    UInt factorsBytes() const;
+
+    //@}
+
+private:
+
+    std::shared_ptr<map_Type> M_map;
+
+    // Factors in CSR format: the strictly lower part is L (unit diagonal), the rest is U
+    std::vector<Int>          M_rowPointers;
+    std::vector<Int>          M_columns;
+    std::vector<Int>          M_diagonalPointers;
+    std::vector<float>        M_values;
+    std::vector<float>        M_inverseDiagonal;
+};
+
+} /*end namespace Operators */
+} /*end namespace LifeV */
+#endif /* _SINGLEPRECISIONILU_HPP_ */
@@ -44,6 +44,8 @@
 #include <lifev/core/fem/BCManage.hpp>
 #include <lifev/core/fem/HyperbolicFluxNumerical.hpp>
 
+#include <lifev/core/util/OpenMPParameters.hpp>
+
 #include <lifev/core/solver/HyperbolicData.hpp>
 
 // LifeV namespace.
@@ -191,9 +193,16 @@ public:
     void setup ();
 
     //! Solve one time step of the hyperbolic problem.
+    /*!
+      The local fluxes of a block of elements are computed by the threads set in the OpenMP
+      parameters, then they are added to the global vector in the order of the elements.
+    */
     void solveOneTimeStep();
 
     //! Compute the global CFL condition.
+    /*!
+      The elements are shared among the threads set in the OpenMP parameters.
+    */
     Real CFL();
 
     //@}
@@ -245,8 +254,18 @@ public:
     */
     inline void setNumericalFlux ( const flux_Type& flux )
     {
-        typedef GodunovNumericalFlux<Mesh, SolverType> godunov_Type;
-        M_numericalFlux.reset ( new godunov_Type ( dynamic_cast<const godunov_Type&> ( flux ) ) );
+        M_numericalFlux.reset ( flux.clone() );
+    }
+
+    //! Set the OpenMP parameters of the element loops.
+    /*!
+      The numerical flux is evaluated concurrently by the threads, the physical flux,
+      the external fields and the boundary functions must be thread safe.
+      @param ompParams The OpenMP parameters.
+    */
+    inline void setOpenMPParameters ( const OpenMPParameters& ompParams )
+    {
+        M_ompParams = ompParams;
     }
 
     //! Set the solution vector.
@@ -333,7 +352,12 @@ protected:
     void localReconstruct ( const UInt& Elem );
 
     //! Compute the local contribute
-    void localEvolve      ( const UInt& iElem );
+    /*!
+      @param iElem The ID of the current element.
+      @param feBd Boundary finite element used for the faces of the element.
+      @param localFlux The local flux of the element.
+    */
+    void localEvolve      ( const UInt& iElem, CurrentFEManifold& feBd, VectorElemental& localFlux );
 
     //! Apply the flux limiters locally.
     void localAverage     ( const UInt& iElem );
@@ -385,12 +409,15 @@ protected:
     //! Computed numerical flux.
     vectorPtr_Type            M_globalFlux;
 
-    //! Auxiliary vector for local fluxes.
-    VectorElemental           M_localFlux;
-
     //! Vector of all local mass matrices, possibly with mass function.
     std::vector<MatrixElemental>  M_elmatMass;
 
+    //! Measures of all the elements, used by the CFL condition.
+    std::vector<Real>         M_elementMeasures;
+
+    //! OpenMP parameters of the element loops.
+    OpenMPParameters          M_ompParams;
+
 private:
 
     //! @name Private Constructors
@@ -409,6 +436,9 @@ private:
 
     //@}
 
+    //! Number of elements computed by each thread between two additions to the global vector of fluxes.
+    static const UInt S_elementsPerThread = 256;
+
 }; // class HyperbolicSolver
 
 // ===================================================
@@ -443,8 +473,9 @@ HyperbolicSolver ( const data_Type&          dataFile,
     M_uOld            ( new vector_Type ( ghostMap, Repeated ) ),
     M_globalFlux      ( new vector_Type ( ghostMap, Repeated ) ),
     // Local matrices and vectors.
-    M_localFlux       ( M_FESpace.refFE().nbDof(), 1 ),
-    M_elmatMass       ( )
+    M_elmatMass       ( ),
+    M_elementMeasures ( ),
+    M_ompParams       ( )
 {
 
     M_elmatMass.reserve ( M_FESpace.mesh()->numElements() );
@@ -479,8 +510,9 @@ HyperbolicSolver ( const data_Type&          dataFile,
     M_uOld            ( new vector_Type ( ghostMap, Repeated ) ),
     M_globalFlux      ( new vector_Type ( ghostMap, Repeated ) ),
     // Local matrices and vectors.
-    M_localFlux       ( M_FESpace.refFE().nbDof(), 1 ),
-    M_elmatMass       ( )
+    M_elmatMass       ( ),
+    M_elementMeasures ( ),
+    M_ompParams       ( )
 {
 
     M_elmatMass.reserve ( M_FESpace.mesh()->numElements() );
@@ -532,6 +564,8 @@ setup ()
         vectorMass = 1.;
     }
 
+    M_elementMeasures.resize ( meshNumberOfElements );
+
     // For each element it creates the mass matrix and factorize it using Cholesky.
     for ( UInt iElem (0); iElem < meshNumberOfElements; ++iElem )
     {
@@ -540,6 +574,9 @@ setup ()
         M_FESpace.fe().update ( M_FESpace.mesh()->element ( iElem),
                                 UPDATE_QUAD_NODES | UPDATE_WDET );
 
+        // Save the volumetric measure of the element
+        M_elementMeasures[ iElem ] = M_FESpace.fe().measure();
+
         // Local mass matrix
         MatrixElemental matElem (M_FESpace.refFE().nbDof(), 1, 1);
         matElem.zero();
@@ -577,31 +614,59 @@ solveOneTimeStep ()
     // Total number of elements in the mesh
     const UInt meshNumberOfElements ( M_FESpace.mesh()->numElements() );
 
-    // Loop on all the elements to perform the fluxes
-    for ( UInt iElem (0); iElem < meshNumberOfElements; ++iElem )
+    // Check if the boundary conditions were updated.
+    if ( !M_BCh->bcUpdateDone() )
     {
+        // Update the boundary conditions handler. We use the finite element of the boundary of the dual variable.
+        M_BCh->bcUpdate ( *M_FESpace.mesh(), M_FESpace.feBd(), M_FESpace.dof() );
+    }
 
-        // Update the property of the current element
-        M_FESpace.fe().update ( M_FESpace.mesh()->element (iElem), UPDATE_QUAD_NODES | UPDATE_WDET);
+    // The global vector is not thread safe: the local fluxes of a block of
+    // elements are computed in parallel, then added in the order of the elements
+    const UInt blockSize ( std::max<UInt> ( 1, std::min<UInt> ( meshNumberOfElements, S_elementsPerThread * M_ompParams.numThreads ) ) );
+    std::vector<VectorElemental> localFluxes ( blockSize, VectorElemental ( M_FESpace.refFE().nbDof(), 1 ) );
 
-        // Reconstruct step of the current element
-        localReconstruct ( iElem );
+    M_ompParams.apply();
+
+    #pragma omp parallel
+    {
+        // Each thread updates its own boundary finite element
+        CurrentFEManifold feBd ( M_FESpace.feBd() );
 
-        // Evolve step of the current element
-        localEvolve ( iElem  );
+        for ( UInt blockBegin ( 0 ); blockBegin < meshNumberOfElements; blockBegin += blockSize )
+        {
+            const UInt blockEnd ( std::min ( blockBegin + blockSize, meshNumberOfElements ) );
 
-        // Put the total flux of the current element in the global vector of fluxes
-        assembleVector ( *M_globalFlux,
-                         M_FESpace.fe().currentLocalId(),
-                         M_localFlux,
-                         M_FESpace.refFE().nbDof(),
-                         M_FESpace.dof(), 0 );
+            #pragma omp for schedule(runtime)
+            for ( UInt iElem = blockBegin; iElem < blockEnd; ++iElem )
+            {
+                // Reconstruct step of the current element
+                localReconstruct ( iElem );
 
-        // Average step of the current element
-        localAverage ( iElem );
+                // Evolve step of the current element
+                localEvolve ( iElem, feBd, localFluxes[ iElem - blockBegin ] );
+            }
 
+            #pragma omp single
+            {
+                for ( UInt iElem ( blockBegin ); iElem < blockEnd; ++iElem )
+                {
+                    // Put the total flux of the current element in the global vector of fluxes
+                    assembleVector ( *M_globalFlux,
+                                     M_FESpace.mesh()->element ( iElem ).localId(),
+                                     localFluxes[ iElem - blockBegin ],
+                                     M_FESpace.refFE().nbDof(),
+                                     M_FESpace.dof(), 0 );
+
+                    // Average step of the current element
+                    localAverage ( iElem );
+                }
+            }
+        }
     }
 
+    M_ompParams.restorePreviousNumThreads();
+
     // Assemble the global hybrid vector.
     M_globalFlux->globalAssemble();
 
@@ -631,111 +696,112 @@ CFL()
     // Total number of elements in the mesh
     const UInt meshNumberOfElements ( M_FESpace.mesh()->numElements() );
 
+    ASSERT ( M_elementMeasures.size() == meshNumberOfElements, "HyperbolicSolver::CFL: Error: setup must be called first" );
+
     // The local value for the CFL condition, without the time step
-    Real localCFL (0.), localCFLOld ( - 1. );
+    Real localCFLOld ( - 1. );
 
-    // Loop on all the elements to perform the fluxes
-    for ( UInt iElem (0); iElem < meshNumberOfElements; ++iElem )
-    {
-        // Update the property of the current element
-        M_FESpace.fe().update ( M_FESpace.mesh()->element (iElem), UPDATE_QUAD_NODES | UPDATE_WDET);
+    M_ompParams.apply();
 
-        // Volumetric measure of the current element
-        const Real K ( M_FESpace.fe().measure() );
+    #pragma omp parallel reduction(max:localCFLOld)
+    {
+        // Each thread updates its own boundary finite element
+        CurrentFEManifold feBd ( M_FESpace.feBd() );
 
-        // Loop on the faces of the element iElem and compute the local contribution
-        for ( UInt iFace (0); iFace < M_FESpace.mesh()->numLocalFaces(); ++iFace )
+        // Loop on all the elements to perform the fluxes
+        #pragma omp for schedule(runtime)
+        for ( UInt iElem = 0; iElem < meshNumberOfElements; ++iElem )
         {
+            // Volumetric measure of the current element
+            const Real K ( M_elementMeasures[ iElem ] );
 
-            const UInt iGlobalFace ( M_FESpace.mesh()->localFacetId ( iElem, iFace ) );
+            // Loop on the faces of the element iElem and compute the local contribution
+            for ( UInt iFace (0); iFace < M_FESpace.mesh()->numLocalFaces(); ++iFace )
+            {
 
-            // Update the normal vector of the current face in each quadrature point
-            M_FESpace.feBd().update ( M_FESpace.mesh()->boundaryFacet ( iGlobalFace ), UPDATE_W_ROOT_DET_METRIC | UPDATE_NORMALS | UPDATE_QUAD_NODES );
+                const UInt iGlobalFace ( M_FESpace.mesh()->localFacetId ( iElem, iFace ) );
 
-            // Take the left element to the face, see regionMesh for the meaning of left element
-            const UInt leftElement ( M_FESpace.mesh()->faceElement ( iGlobalFace, 0 ) );
+                // Update the normal vector of the current face in each quadrature point
+                feBd.update ( M_FESpace.mesh()->boundaryFacet ( iGlobalFace ), UPDATE_W_ROOT_DET_METRIC | UPDATE_NORMALS | UPDATE_QUAD_NODES );
 
-            // Take the right element to the face, see regionMesh for the meaning of right element
-            const UInt rightElement ( M_FESpace.mesh()->faceElement ( iGlobalFace, 1 ) );
+                // Take the left element to the face, see regionMesh for the meaning of left element
+                const UInt leftElement ( M_FESpace.mesh()->faceElement ( iGlobalFace, 0 ) );
 
-            // Solution in the left element
-            VectorElemental leftValue  ( M_FESpace.refFE().nbDof(), 1 );
+                // Take the right element to the face, see regionMesh for the meaning of right element
+                const UInt rightElement ( M_FESpace.mesh()->faceElement ( iGlobalFace, 1 ) );
 
-            // Solution in the right element
-            VectorElemental rightValue ( M_FESpace.refFE().nbDof(), 1 );
+                // Solution in the left element
+                VectorElemental leftValue  ( M_FESpace.refFE().nbDof(), 1 );
 
-            // Extract the solution in the current element, now is the leftElement
-            extract_vec ( *M_uOld,
-                          leftValue,
-                          M_FESpace.refFE(),
-                          M_FESpace.dof(),
-                          leftElement , 0 );
+                // Solution in the right element
+                VectorElemental rightValue ( M_FESpace.refFE().nbDof(), 1 );
 
-            if ( !Flag::testOneSet ( M_FESpace.mesh()->face ( iGlobalFace ).flag(),
-                                     EntityFlags::PHYSICAL_BOUNDARY | EntityFlags::SUBDOMAIN_INTERFACE ) )
-            {
                 // Extract the solution in the current element, now is the leftElement
                 extract_vec ( *M_uOld,
-                              rightValue,
+                              leftValue,
                               M_FESpace.refFE(),
                               M_FESpace.dof(),
-                              rightElement , 0 );
-            }
-            else if ( Flag::testOneSet ( M_FESpace.mesh()->face ( iGlobalFace ).flag(), EntityFlags::SUBDOMAIN_INTERFACE ) )
-            {
-                // TODO: this works only for P0 elements
-                // but extract_vec works only with lids while RightElement is a gid
-                rightValue[ 0 ] = (*M_uOld) [ rightElement ];
-            }
-            else // Flag::testOneSet ( M_FESpace.mesh()->face ( iGlobalFace ).flag(), PHYSICAL_BOUNDARY )
-            {
-                rightValue = leftValue;
-            }
+                              leftElement , 0 );
 
-            // Area of the current face
-            const Real e ( M_FESpace.feBd().measure() );
-
-            // Loop on all the quadrature points
-            for ( UInt ig (0); ig < M_FESpace.feBd().nbQuadPt(); ++ig )
-            {
-
-                // Cuurent quadrature point
-                KN<Real> quadPoint (3);
-                // normal vector
-                KN<Real> normal (3);
-
-                for (UInt icoor (0); icoor < 3; ++icoor)
+                if ( !Flag::testOneSet ( M_FESpace.mesh()->face ( iGlobalFace ).flag(),
+                                         EntityFlags::PHYSICAL_BOUNDARY | EntityFlags::SUBDOMAIN_INTERFACE ) )
                 {
-                    quadPoint (icoor) = M_FESpace.feBd().quadPt ( ig, icoor );
-                    normal (icoor)    = M_FESpace.feBd().normal ( icoor, ig ) ;
+                    // Extract the solution in the current element, now is the leftElement
+                    extract_vec ( *M_uOld,
+                                  rightValue,
+                                  M_FESpace.refFE(),
+                                  M_FESpace.dof(),
+                                  rightElement , 0 );
                 }
-
-                // Compute the local CFL without the time step
-                localCFL = e / K * M_numericalFlux->normInfinity ( leftValue[0],
-                                                                   rightValue[0],
-                                                                   normal,
-                                                                   iElem,
-                                                                   M_data.dataTime()->time(),
-                                                                   quadPoint (0),
-                                                                   quadPoint (1),
-                                                                   quadPoint (2) );
-
-                // Select the maximum between the old CFL condition and the new CFL condition
-                if ( localCFL > localCFLOld  )
+                else if ( Flag::testOneSet ( M_FESpace.mesh()->face ( iGlobalFace ).flag(), EntityFlags::SUBDOMAIN_INTERFACE ) )
                 {
-                    localCFLOld = localCFL;
+                    // TODO: this works only for P0 elements
+                    // but extract_vec works only with lids while RightElement is a gid
+                    rightValue[ 0 ] = (*M_uOld) [ rightElement ];
                 }
-                else
+                else // Flag::testOneSet ( M_FESpace.mesh()->face ( iGlobalFace ).flag(), PHYSICAL_BOUNDARY )
                 {
-                    localCFL = localCFLOld;
+                    rightValue = leftValue;
                 }
 
-            }
+                // Area of the current face
+                const Real e ( feBd.measure() );
 
-        }
+                // Loop on all the quadrature points
+                for ( UInt ig (0); ig < feBd.nbQuadPt(); ++ig )
+                {
+
+                    // Cuurent quadrature point
+                    KN<Real> quadPoint (3);
+                    // normal vector
+                    KN<Real> normal (3);
+
+                    for (UInt icoor (0); icoor < 3; ++icoor)
+                    {
+                        quadPoint (icoor) = feBd.quadPt ( ig, icoor );
+                        normal (icoor)    = feBd.normal ( icoor, ig ) ;
+                    }
+
+                    // Compute the local CFL without the time step
+                    const Real localCFL = e / K * M_numericalFlux->normInfinity ( leftValue[0],
+                                                                                  rightValue[0],
+                                                                                  normal,
+                                                                                  iElem,
+                                                                                  M_data.dataTime()->time(),
+                                                                                  quadPoint (0),
+                                                                                  quadPoint (1),
+                                                                                  quadPoint (2) );
+
+                    // Select the maximum between the old CFL condition and the new CFL condition
+                    localCFLOld = std::max ( localCFLOld, localCFL );
+
+                }
 
+            }
+        }
     }
 
+    M_ompParams.restorePreviousNumThreads();
 
     // Compute the time step according to CLF for the current process
     Real timeStepLocal[]  = { M_data.getCFLRelaxParameter() / localCFLOld };
@@ -792,7 +858,7 @@ localReconstruct ( const UInt& /* iElem */ )
 template< typename Mesh, typename SolverType >
 void
 HyperbolicSolver< Mesh, SolverType >::
-localEvolve ( const UInt& iElem )
+localEvolve ( const UInt& iElem, CurrentFEManifold& feBd, VectorElemental& localFlux )
 {
 
     // LAPACK wrapper of Epetra
@@ -813,14 +879,7 @@ localEvolve ( const UInt& iElem )
     Int NBRHS = 1;
 
     // Clean the local flux
-    M_localFlux.zero();
-
-    // Check if the boundary conditions were updated.
-    if ( !M_BCh->bcUpdateDone() )
-    {
-        // Update the boundary conditions handler. We use the finite element of the boundary of the dual variable.
-        M_BCh->bcUpdate ( *M_FESpace.mesh(), M_FESpace.feBd(), M_FESpace.dof() );
-    }
+    localFlux.zero();
 
     // Loop on the faces of the element iElem and compute the local contribution
     for ( UInt iFace (0); iFace < M_FESpace.mesh()->numLocalFaces(); ++iFace )
@@ -835,7 +894,7 @@ localEvolve ( const UInt& iElem )
         const UInt rightElement ( M_FESpace.mesh()->faceElement ( iGlobalFace, 1 ) );
 
         // Update the normal vector of the current face in each quadrature point
-        M_FESpace.feBd().update ( M_FESpace.mesh()->boundaryFacet ( iGlobalFace ), UPDATE_W_ROOT_DET_METRIC | UPDATE_NORMALS | UPDATE_QUAD_NODES );
+        feBd.update ( M_FESpace.mesh()->boundaryFacet ( iGlobalFace ), UPDATE_W_ROOT_DET_METRIC | UPDATE_NORMALS | UPDATE_QUAD_NODES );
 
         // Local flux of a face times the integration weight
         VectorElemental localFaceFluxWeight ( M_FESpace.refFE().nbDof(), 1 );
@@ -886,7 +945,7 @@ localEvolve ( const UInt& iElem )
             {
 
                 // Loop on all the quadrature points
-                for ( UInt ig (0); ig < M_FESpace.feBd().nbQuadPt(); ++ig)
+                for ( UInt ig (0); ig < feBd.nbQuadPt(); ++ig)
                 {
 
                     // Current quadrature point
@@ -897,8 +956,8 @@ localEvolve ( const UInt& iElem )
 
                     for (UInt icoor (0); icoor < 3; ++icoor)
                     {
-                        quadPoint (icoor) = M_FESpace.feBd().quadPt ( ig, icoor );
-                        normal (icoor)    = M_FESpace.feBd().normal ( icoor, ig ) ;
+                        quadPoint (icoor) = feBd.quadPt ( ig, icoor );
+                        normal (icoor)    = feBd.normal ( icoor, ig ) ;
                     }
 
                     // Compute the boundary contribution
@@ -912,7 +971,7 @@ localEvolve ( const UInt& iElem )
                                                quadPoint (2),
                                                rightValue[ 0 ] );
                     // Update the local flux of the current face with the quadrature weight
-                    localFaceFluxWeight[0] += localFaceFlux * M_FESpace.feBd().wRootDetMetric ( ig );
+                    localFaceFluxWeight[0] += localFaceFlux * feBd.wRootDetMetric ( ig );
                 }
 
             }
@@ -938,7 +997,7 @@ localEvolve ( const UInt& iElem )
         localFaceFluxWeight.zero();
 
         // Loop on all the quadrature points
-        for ( UInt ig (0); ig < M_FESpace.feBd().nbQuadPt(); ++ig )
+        for ( UInt ig (0); ig < feBd.nbQuadPt(); ++ig )
         {
 
             // Current quadrature point
@@ -949,8 +1008,8 @@ localEvolve ( const UInt& iElem )
 
             for (UInt icoor (0); icoor < 3; ++icoor)
             {
-                quadPoint (icoor) = M_FESpace.feBd().quadPt ( ig, icoor );
-                normal (icoor)    = M_FESpace.feBd().normal ( icoor, ig ) ;
+                quadPoint (icoor) = feBd.quadPt ( ig, icoor );
+                normal (icoor)    = feBd.normal ( icoor, ig ) ;
             }
 
             // If the normal is orientated inward, we change its sign and swap the left and value of the solution
@@ -970,7 +1029,7 @@ localEvolve ( const UInt& iElem )
                                                             quadPoint (2) );
 
             // Update the local flux of the current face with the quadrature weight
-            localFaceFluxWeight[0] += localFaceFlux * M_FESpace.feBd().wRootDetMetric ( ig );
+            localFaceFluxWeight[0] += localFaceFlux * feBd.wRootDetMetric ( ig );
 
         }
 
@@ -985,7 +1044,7 @@ localEvolve ( const UInt& iElem )
         ASSERT_PRE ( !INFO[0], "Lapack Computation M_elvecSource = LB^{-1} rhs is not achieved." );
 
         // Add to the local flux the local flux of the current face
-        M_localFlux += localFaceFluxWeight;
+        localFlux += localFaceFluxWeight;
 
     }
 
@@ -0,0 +1,211 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file test_ghostexchange.cpp
+    @brief Test of the update of the ghost entries with GhostExchange
+
+    The repeated vectors updated with the persistent plan of the MapEpetra
+    (startGhostUpdate/finishGhostUpdate, operator= and the Repeated copy
+    constructor) are compared with the result of an Epetra_Import with the
+    Insert and Add combine modes. The repeated map of each process contains
+    its block of a 1D chain plus two ghost entries on each side, listed before
+    the owned ones, so that the local ids of the two maps differ.
+
+    @date 10-2026
+ */
+
+// ===================================================
+//! Includes
+// ===================================================
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+
+#include <Epetra_Import.h>
+#include <Epetra_Vector.h>
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/array/MapEpetra.hpp>
+#include <lifev/core/array/MapEpetraData.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+// ===================================================
+//! Namespaces & define
+// ===================================================
+
+using namespace LifeV;
+
+namespace
+{
+
+// Fill the owned entries with values depending on the global id
+void fill ( VectorEpetra& vector, const Real& shift )
+{
+    const Epetra_BlockMap& map ( vector.blockMap() );
+    for ( Int i ( 0 ); i < map.NumMyElements(); ++i )
+    {
+        vector.epetraVector() [ 0 ][ i ] = std::cos ( map.GID ( i ) * 0.7 + shift );
+    }
+}
+
+// Largest difference between the vector and the reference computed by Epetra
+Real referenceError ( const VectorEpetra& vector, const Epetra_MultiVector& reference )
+{
+    Real localError ( 0. ), error ( 0. );
+    for ( Int i ( 0 ); i < reference.MyLength(); ++i )
+    {
+        localError = std::max ( localError, std::fabs ( vector.epetraVector() [ 0 ][ i ] - reference[ 0 ][ i ] ) );
+    }
+    vector.comm().MaxAll ( &localError, &error, 1 );
+    return error;
+}
+
+}
+
+// ===================================================
+//! Main
+// ===================================================
+int main ( int argc, char** argv )
+{
+#ifdef HAVE_MPI
+    MPI_Init ( &argc, &argv );
+    std::shared_ptr<Epetra_Comm> comm ( new Epetra_MpiComm ( MPI_COMM_WORLD ) );
+#else
+    std::shared_ptr<Epetra_Comm> comm ( new Epetra_SerialComm );
+#endif
+
+    const bool verbose ( comm->MyPID() == 0 );
+    bool passed ( true );
+
+    {
+        const Int numProcs ( comm->NumProc() );
+        const Int myPID ( comm->MyPID() );
+        const Int blockSize ( 7 );
+        const Int numGlobal ( blockSize * numProcs );
+
+        if ( verbose )
+        {
+            std::cout << "GhostExchange test on " << numProcs << " processes" << std::endl;
+        }
+
+        // Unique: a block of the chain; Repeated: the ghosts first, then the owned entries
+        MapEpetraData mapData;
+        const Int first ( myPID * blockSize );
+        for ( Int gid ( first ); gid < first + blockSize; ++gid )
+        {
+            mapData.unique.push_back ( gid );
+        }
+        for ( Int offset ( 1 ); offset <= 2; ++offset )
+        {
+            if ( first - offset >= 0 )
+            {
+                mapData.repeated.push_back ( first - offset );
+            }
+            if ( first + blockSize - 1 + offset < numGlobal )
+            {
+                mapData.repeated.push_back ( first + blockSize - 1 + offset );
+            }
+        }
+        mapData.repeated.insert ( mapData.repeated.end(), mapData.unique.begin(), mapData.unique.end() );
+
+        MapEpetra map ( mapData, comm );
+
+        const Epetra_BlockMap& uniqueMap ( *map.map ( Unique ) );
+        const Epetra_BlockMap& repeatedMap ( *map.map ( Repeated ) );
+        Epetra_Import importer ( repeatedMap, uniqueMap );
+
+        VectorEpetra uniqueVector ( map, Unique );
+        Epetra_Vector reference ( repeatedMap );
+
+        // Split update, repeated twice to reuse the persistent requests
+        VectorEpetra repeatedVector ( map, Repeated );
+        for ( Int step ( 0 ); step < 2; ++step )
+        {
+            fill ( uniqueVector, step );
+            reference.PutScalar ( 0. );
+            reference.Import ( uniqueVector.epetraVector(), importer, Insert );
+
+            repeatedVector = -1.;
+            repeatedVector.startGhostUpdate ( uniqueVector );
+            // Work that does not need the ghost entries could be done here
+            repeatedVector.finishGhostUpdate();
+            passed &= referenceError ( repeatedVector, reference ) == 0.;
+        }
+
+        // Assignment with the Insert and Add combine modes
+        VectorEpetra insertVector ( map, Repeated, Insert );
+        insertVector = -1.;
+        insertVector = uniqueVector;
+        passed &= referenceError ( insertVector, reference ) == 0.;
+
+        Epetra_Vector referenceAdd ( repeatedMap );
+        referenceAdd.PutScalar ( 0. );
+        referenceAdd.Import ( uniqueVector.epetraVector(), importer, Add );
+
+        VectorEpetra addVector ( map, Repeated, Add );
+        addVector = -1.;
+        addVector = uniqueVector;
+        passed &= referenceError ( addVector, referenceAdd ) == 0.;
+
+        // Repeated copy constructors
+        VectorEpetra copyVector ( uniqueVector, Repeated );
+        passed &= referenceError ( copyVector, referenceAdd ) == 0.;
+
+        VectorEpetra copyInsertVector ( uniqueVector, Repeated, Insert );
+        passed &= referenceError ( copyInsertVector, reference ) == 0.;
+
+        // The plan is shared by the copies of the map
+        MapEpetra mapCopy ( map );
+        VectorEpetra copyMapVector ( mapCopy, Repeated );
+        copyMapVector.startGhostUpdate ( uniqueVector );
+        copyMapVector.finishGhostUpdate();
+        passed &= referenceError ( copyMapVector, reference ) == 0.;
+    }
+
+    if ( verbose )
+    {
+        std::cout << ( passed ? "GhostExchange test passed" : "GhostExchange test FAILED" ) << std::endl;
+    }
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !passed )
+    {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
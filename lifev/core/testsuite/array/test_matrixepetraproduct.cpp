@@ -0,0 +1,287 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file test_matrixepetraproduct.cpp
+    @brief Test of the sparse product A * diag(d) * B + c * C with MatrixEpetraProduct
+
+    The products are compared with MatrixEpetra::multiply applied to B scaled
+    by d, plus c * C. The factors have the shapes of the blocks of a Stokes
+    problem (A: pressure x velocity, B: velocity x pressure). The test covers
+    the first product, an update of the values only, a change of the pattern
+    of B with the same number of entries (found by the numeric phase), a
+    product without d and C, and the same sequence with several threads.
+
+    @date 10-2026
+ */
+
+// ===================================================
+//! Includes
+// ===================================================
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+#include <Epetra_Vector.h>
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/array/MapEpetra.hpp>
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/MatrixEpetraProduct.hpp>
+#include <lifev/core/util/OpenMPParameters.hpp>
+
+// ===================================================
+//! Namespaces & define
+// ===================================================
+
+using namespace LifeV;
+
+namespace
+{
+
+typedef MatrixEpetra<Real>                    matrix_Type;
+typedef std::shared_ptr<matrix_Type>        matrixPtr_Type;
+typedef std::shared_ptr<const MapEpetra>    mapPtr_Type;
+
+const Int S_numPressure ( 12 );
+const Int S_numVelocity ( 30 );
+const Real S_tolerance ( 1e-12 );
+
+// Left factor: three velocity columns per pressure row
+matrixPtr_Type buildA ( const mapPtr_Type& pressureMap, const mapPtr_Type& velocityMap, const Real& seed )
+{
+    matrixPtr_Type A ( new matrix_Type ( *pressureMap, 3 ) );
+    const Epetra_Map& rows ( *pressureMap->map ( Unique ) );
+    for ( Int k ( 0 ); k < rows.NumMyElements(); ++k )
+    {
+        const Int i ( rows.GID ( k ) );
+        A->addToCoefficient ( i, ( 2 * i ) % S_numVelocity, 1. + seed );
+        A->addToCoefficient ( i, ( 2 * i + 1 ) % S_numVelocity, -0.5 - seed );
+        A->addToCoefficient ( i, ( 2 * i + 5 ) % S_numVelocity, 0.25 + 0.01 * i );
+    }
+    A->globalAssemble ( velocityMap, pressureMap );
+    return A;
+}
+
+// Right factor: two pressure columns per velocity row, the shift changes the pattern but not the number of entries
+matrixPtr_Type buildB ( const mapPtr_Type& velocityMap, const mapPtr_Type& pressureMap, const Int& shift, const Real& seed )
+{
+    matrixPtr_Type B ( new matrix_Type ( *velocityMap, 2 ) );
+    const Epetra_Map& rows ( *velocityMap->map ( Unique ) );
+    for ( Int k ( 0 ); k < rows.NumMyElements(); ++k )
+    {
+        const Int j ( rows.GID ( k ) );
+        B->addToCoefficient ( j, ( j + shift ) % S_numPressure, std::cos ( j + seed ) );
+        B->addToCoefficient ( j, ( 3 * j + 1 + shift ) % S_numPressure, 1. + 0.1 * j * seed );
+    }
+    B->globalAssemble ( pressureMap, velocityMap );
+    return B;
+}
+
+// Added matrix: tridiagonal on the pressure
+matrixPtr_Type buildC ( const mapPtr_Type& pressureMap, const Real& seed )
+{
+    matrixPtr_Type C ( new matrix_Type ( *pressureMap, 3 ) );
+    const Epetra_Map& rows ( *pressureMap->map ( Unique ) );
+    for ( Int k ( 0 ); k < rows.NumMyElements(); ++k )
+    {
+        const Int i ( rows.GID ( k ) );
+        C->addToCoefficient ( i, i, 2. + seed );
+        if ( i > 0 )
+        {
+            C->addToCoefficient ( i, i - 1, -1. );
+        }
+        if ( i < S_numPressure - 1 )
+        {
+            C->addToCoefficient ( i, i + 1, -1. );
+        }
+    }
+    C->globalAssemble();
+    return C;
+}
+
+// Diagonal scaling on the row map of B, the identity if seed is negative
+void fillDiagonal ( Epetra_Vector& diagonal, const Real& seed )
+{
+    for ( Int k ( 0 ); k < diagonal.MyLength(); ++k )
+    {
+        diagonal[ k ] = seed < 0. ? 1. : 1. / ( 2. + std::sin ( diagonal.Map().GID ( k ) + seed ) );
+    }
+}
+
+// Add scale * the row of the matrix to the entries (global column ids)
+void addRow ( std::map<Int, Real>& entries, const Epetra_CrsMatrix& matrix, const Int& row, const Real& scale )
+{
+    Int numEntries ( 0 );
+    Real* values ( 0 );
+    Int* indices ( 0 );
+    matrix.ExtractMyRowView ( matrix.RowMap().LID ( row ), numEntries, values, indices );
+    for ( Int k ( 0 ); k < numEntries; ++k )
+    {
+        entries[ matrix.ColMap().GID ( indices[ k ] ) ] += scale * values[ k ];
+    }
+}
+
+// Largest difference between the result and the product by MatrixEpetra::multiply, scaled and summed with C
+Real productError ( const matrix_Type& result, const matrix_Type& A, const Epetra_Vector& diagonal,
+                    const matrix_Type& B, const matrix_Type& C, const Real& coefficient )
+{
+    matrix_Type scaledB ( B );
+    scaledB.matrixPtr()->LeftScale ( diagonal );
+    matrix_Type reference ( A.map() );
+    A.multiply ( false, scaledB, false, reference );
+
+    const Epetra_CrsMatrix& r ( *result.matrixPtr() );
+    Real localError ( 0. ), error ( 0. );
+    for ( Int k ( 0 ); k < r.NumMyRows(); ++k )
+    {
+        const Int row ( r.RowMap().GID ( k ) );
+        std::map<Int, Real> entries;
+        addRow ( entries, r, row, 1. );
+        addRow ( entries, *reference.matrixPtr(), row, -1. );
+        addRow ( entries, *C.matrixPtr(), row, -coefficient );
+        for ( std::map<Int, Real>::const_iterator entry ( entries.begin() ); entry != entries.end(); ++entry )
+        {
+            localError = std::max ( localError, std::fabs ( entry->second ) );
+        }
+    }
+    r.Comm().MaxAll ( &localError, &error, 1 );
+    return error;
+}
+
+// The result must have the row and range maps of A and the domain map of B
+bool sameMaps ( const matrix_Type& result, const matrix_Type& A, const matrix_Type& B )
+{
+    const Epetra_CrsMatrix& r ( *result.matrixPtr() );
+    return r.RowMap().SameAs ( A.matrixPtr()->RowMap() )
+           && r.RangeMap().SameAs ( A.matrixPtr()->RangeMap() )
+           && r.DomainMap().SameAs ( B.matrixPtr()->DomainMap() );
+}
+
+// First product, update of the values, change of the pattern of B with the same number of entries
+bool checkSequence ( MatrixEpetraProduct& product, const mapPtr_Type& pressureMap, const mapPtr_Type& velocityMap )
+{
+    const Real coefficient ( -0.5 );
+    bool passed ( true );
+
+    matrixPtr_Type A ( buildA ( pressureMap, velocityMap, 0. ) );
+    matrixPtr_Type B ( buildB ( velocityMap, pressureMap, 0, 0. ) );
+    matrixPtr_Type C ( buildC ( pressureMap, 0. ) );
+    Epetra_Vector diagonal ( *velocityMap->map ( Unique ) );
+    fillDiagonal ( diagonal, 0. );
+
+    const matrixPtr_Type result ( product.multiply ( *A, &diagonal, *B, C.get(), coefficient ) );
+    passed &= productError ( *result, *A, diagonal, *B, *C, coefficient ) < S_tolerance && sameMaps ( *result, *A, *B );
+    passed &= product.numSymbolicPhases() == 1;
+
+    // New matrices with the same patterns, as rebuilt by the preconditioners
+    A = buildA ( pressureMap, velocityMap, 1. );
+    B = buildB ( velocityMap, pressureMap, 0, 1. );
+    C = buildC ( pressureMap, 1. );
+    fillDiagonal ( diagonal, 1. );
+
+    const matrixPtr_Type& updated ( product.multiply ( *A, &diagonal, *B, C.get(), coefficient ) );
+    passed &= productError ( *updated, *A, diagonal, *B, *C, coefficient ) < S_tolerance && sameMaps ( *updated, *A, *B );
+    passed &= product.numSymbolicPhases() == 1;
+    // The result is overwritten in place
+    passed &= updated == result;
+
+    // Pattern of B changed, same sizes: only the numeric phase can detect it
+    const Int numEntriesB ( B->matrixPtr()->NumGlobalNonzeros() );
+    A = buildA ( pressureMap, velocityMap, 2. );
+    B = buildB ( velocityMap, pressureMap, 1, 2. );
+    fillDiagonal ( diagonal, 2. );
+    passed &= B->matrixPtr()->NumGlobalNonzeros() == numEntriesB;
+
+    const matrixPtr_Type& changed ( product.multiply ( *A, &diagonal, *B, C.get(), coefficient ) );
+    passed &= productError ( *changed, *A, diagonal, *B, *C, coefficient ) < S_tolerance && sameMaps ( *changed, *A, *B );
+    passed &= product.numSymbolicPhases() == 2;
+
+    // Without the diagonal and C
+    const matrixPtr_Type& plain ( product.multiply ( *A, 0, *B ) );
+    fillDiagonal ( diagonal, -1. );
+    passed &= productError ( *plain, *A, diagonal, *B, *C, 0. ) < S_tolerance && sameMaps ( *plain, *A, *B );
+    passed &= product.numSymbolicPhases() == 3;
+
+    return passed;
+}
+
+}
+
+// ===================================================
+//! Main
+// ===================================================
+int main ( int argc, char** argv )
+{
+#ifdef HAVE_MPI
+    MPI_Init ( &argc, &argv );
+    std::shared_ptr<Epetra_Comm> comm ( new Epetra_MpiComm ( MPI_COMM_WORLD ) );
+#else
+    std::shared_ptr<Epetra_Comm> comm ( new Epetra_SerialComm );
+#endif
+
+    const bool verbose ( comm->MyPID() == 0 );
+    bool passed ( true );
+
+    {
+        const mapPtr_Type pressureMap ( new MapEpetra ( S_numPressure, comm ) );
+        const mapPtr_Type velocityMap ( new MapEpetra ( S_numVelocity, comm ) );
+
+        MatrixEpetraProduct product;
+        passed &= checkSequence ( product, pressureMap, velocityMap );
+
+        // The same sequence with four threads
+        OpenMPParameters ompParams;
+        ompParams.numThreads = 4;
+        MatrixEpetraProduct threadedProduct;
+        threadedProduct.setOpenMPParameters ( ompParams );
+        passed &= checkSequence ( threadedProduct, pressureMap, velocityMap );
+    }
+
+    if ( verbose )
+    {
+        std::cout << ( passed ? "MatrixEpetraProduct test passed" : "MatrixEpetraProduct test FAILED" ) << std::endl;
+    }
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !passed )
+    {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
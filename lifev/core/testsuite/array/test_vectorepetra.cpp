@@ -0,0 +1,184 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file test_vectorepetra.cpp
+    @brief Test of the operators of VectorEpetra with scaled operands
+
+    Each expression is compared with the same computation done entry by entry
+    on the local values, including the aliased cases (v = v * 2., v.add ( 2., v )).
+
+    @date 10-2026
+ */
+
+// ===================================================
+//! Includes
+// ===================================================
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/array/MapEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+// ===================================================
+//! Namespaces & define
+// ===================================================
+
+using namespace LifeV;
+
+namespace
+{
+
+const Real S_tolerance = 1e-14;
+
+// Fill the vector with values depending on the global id
+void fill ( VectorEpetra& vector, const Real& shift )
+{
+    const Epetra_BlockMap& map ( vector.blockMap() );
+    for ( Int i ( 0 ); i < map.NumMyElements(); ++i )
+    {
+        vector.epetraVector() [ 0 ][ i ] = std::sin ( map.GID ( i ) + shift );
+    }
+}
+
+// Largest difference between the vector and alpha * x + beta * y (x and y are filled with shift 0 and 1)
+Real combinationError ( const VectorEpetra& vector, const Real& alpha, const Real& beta )
+{
+    const Epetra_BlockMap& map ( vector.blockMap() );
+    Real localError ( 0. ), error ( 0. );
+    for ( Int i ( 0 ); i < map.NumMyElements(); ++i )
+    {
+        const Real expected ( alpha * std::sin ( map.GID ( i ) ) + beta * std::sin ( map.GID ( i ) + 1. ) );
+        localError = std::max ( localError, std::fabs ( vector.epetraVector() [ 0 ][ i ] - expected ) );
+    }
+    vector.comm().MaxAll ( &localError, &error, 1 );
+    return error;
+}
+
+}
+
+// ===================================================
+//! Main
+// ===================================================
+int main ( int argc, char** argv )
+{
+#ifdef HAVE_MPI
+    MPI_Init ( &argc, &argv );
+    std::shared_ptr<Epetra_Comm> comm ( new Epetra_MpiComm ( MPI_COMM_WORLD ) );
+#else
+    std::shared_ptr<Epetra_Comm> comm ( new Epetra_SerialComm );
+#endif
+
+    const bool verbose ( comm->MyPID() == 0 );
+    bool passed ( true );
+
+    {
+        MapEpetra map ( 103, comm );
+
+        VectorEpetra x ( map, Unique );
+        VectorEpetra y ( map, Unique );
+        fill ( x, 0. );
+        fill ( y, 1. );
+
+        VectorEpetra v ( map, Unique );
+
+        // Assignment
+        v = x * 2.;
+        passed &= combinationError ( v, 2., 0. ) < S_tolerance;
+        v = 3. * y;
+        passed &= combinationError ( v, 0., 3. ) < S_tolerance;
+        v = x / 4.;
+        passed &= combinationError ( v, 0.25, 0. ) < S_tolerance;
+
+        // Aliasing
+        v = x;
+        v = v * 2.;
+        passed &= combinationError ( v, 2., 0. ) < S_tolerance;
+        v = 0.5 * v + y;
+        passed &= combinationError ( v, 1., 1. ) < S_tolerance;
+
+        // Compound assignment
+        v = x;
+        v += 2. * y;
+        passed &= combinationError ( v, 1., 2. ) < S_tolerance;
+        v -= y * 3.;
+        passed &= combinationError ( v, 1., -1. ) < S_tolerance;
+        v += v * 2.;
+        passed &= combinationError ( v, 3., -3. ) < S_tolerance;
+
+        // Sums and differences of scaled operands
+        v = 2. * x + y;
+        passed &= combinationError ( v, 2., 1. ) < S_tolerance;
+        v = x - y * 3.;
+        passed &= combinationError ( v, 1., -3. ) < S_tolerance;
+        v = 2. * x - 0.5 * y;
+        passed &= combinationError ( v, 2., -0.5 ) < S_tolerance;
+        v = ( x + y ) * 2.;
+        passed &= combinationError ( v, 2., 2. ) < S_tolerance;
+
+        // The result of a product outlives the statement
+        const VectorEpetra scaled ( ( x + y ) * 2. );
+        passed &= combinationError ( scaled, 2., 2. ) < S_tolerance;
+
+        // Explicit fused calls
+        v = x;
+        v.add ( 2., y );
+        passed &= combinationError ( v, 1., 2. ) < S_tolerance;
+        v.add ( -1., v );
+        passed &= combinationError ( v, 0., 0. ) < S_tolerance;
+        v.update ( 3., x, 0. );
+        passed &= combinationError ( v, 3., 0. ) < S_tolerance;
+        v.update ( 1., y, -1. );
+        passed &= combinationError ( v, -3., 1. ) < S_tolerance;
+        v.update ( 1., v, 1. );
+        passed &= combinationError ( v, -6., 2. ) < S_tolerance;
+    }
+
+    if ( verbose )
+    {
+        std::cout << ( passed ? "VectorEpetra test passed" : "VectorEpetra test FAILED" ) << std::endl;
+    }
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !passed )
+    {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
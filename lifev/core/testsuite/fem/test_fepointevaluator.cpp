@@ -0,0 +1,198 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file test_fepointevaluator.cpp
+    @brief Test of the evaluation of finite element functions in a set of points
+
+    A P1 field interpolating a linear function on the unit cube is evaluated
+    in points inside the elements, on the faces, edges and vertices of the
+    mesh (hence also on the interfaces between the processes) and outside of
+    the mesh. The values and the gradients must be exact in the points inside
+    the mesh, and zero in the points outside.
+
+    @date 10-2026
+ */
+
+// ===================================================
+//! Includes
+// ===================================================
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/array/MapEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+#include <lifev/core/fem/FESpace.hpp>
+#include <lifev/core/fem/FEPointEvaluator.hpp>
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+
+// ===================================================
+//! Namespaces & define
+// ===================================================
+
+using namespace LifeV;
+
+namespace
+{
+
+typedef RegionMesh<LinearTetra>                       mesh_Type;
+typedef FESpace<mesh_Type, MapEpetra>                 feSpace_Type;
+typedef std::shared_ptr<feSpace_Type>               feSpacePtr_Type;
+typedef FEPointEvaluator<mesh_Type, MapEpetra>        evaluator_Type;
+typedef evaluator_Type::point_Type                    point_Type;
+
+const Real S_tolerance = 1e-12;
+
+Real linearFunction ( const Real& /*t*/, const Real& x, const Real& y, const Real& z, const ID& /*i*/ )
+{
+    return 1. + 2. * x - 3. * y + 0.5 * z;
+}
+
+const point_Type S_gradient ( 2., -3., 0.5 );
+
+}
+
+// ===================================================
+//! Main
+// ===================================================
+int main ( int argc, char** argv )
+{
+#ifdef HAVE_MPI
+    MPI_Init ( &argc, &argv );
+    std::shared_ptr<Epetra_Comm> comm ( new Epetra_MpiComm ( MPI_COMM_WORLD ) );
+#else
+    std::shared_ptr<Epetra_Comm> comm ( new Epetra_SerialComm );
+#endif
+
+    const bool verbose ( comm->MyPID() == 0 );
+    bool passed ( true );
+
+    {
+        // Unit cube with 4 x 4 x 4 cubes split in tetrahedra
+        std::shared_ptr<mesh_Type> fullMeshPtr ( new mesh_Type ( comm ) );
+        regularMesh3D ( *fullMeshPtr, 1, 4, 4, 4 );
+
+        std::shared_ptr<mesh_Type> localMeshPtr;
+        {
+            MeshPartitioner<mesh_Type> meshPartitioner;
+            meshPartitioner.doPartition ( fullMeshPtr, comm );
+            localMeshPtr = meshPartitioner.meshPartition();
+        }
+        fullMeshPtr.reset();
+
+        feSpacePtr_Type feSpace ( new feSpace_Type ( localMeshPtr, feTetraP1, quadRuleTetra4pt, quadRuleTria4pt, 1, comm ) );
+
+        VectorEpetra solution ( feSpace->map(), Unique );
+        feSpace->interpolate ( static_cast<feSpace_Type::function_Type> ( linearFunction ), solution, 0. );
+        const VectorEpetra repeatedSolution ( solution, Repeated );
+
+        // Points inside the elements, on the faces, edges and vertices of the mesh, and outside
+        std::vector<point_Type> points;
+        std::vector<bool> inside;
+
+        points.push_back ( point_Type ( 0.3, 0.4, 0.7 ) );
+        inside.push_back ( true );
+        points.push_back ( point_Type ( 0.61, 0.13, 0.27 ) );
+        inside.push_back ( true );
+        points.push_back ( point_Type ( 0.5, 0.33, 0.6 ) );
+        inside.push_back ( true );
+        points.push_back ( point_Type ( 0.25, 0.5, 0.9 ) );
+        inside.push_back ( true );
+        points.push_back ( point_Type ( 0.5, 0.5, 0.5 ) );
+        inside.push_back ( true );
+        points.push_back ( point_Type ( 0., 0., 0. ) );
+        inside.push_back ( true );
+        points.push_back ( point_Type ( 1., 1., 1. ) );
+        inside.push_back ( true );
+        points.push_back ( point_Type ( 1., 0.2, 0.8 ) );
+        inside.push_back ( true );
+        points.push_back ( point_Type ( 1.5, 0.5, 0.5 ) );
+        inside.push_back ( false );
+        points.push_back ( point_Type ( 0.5, -0.2, 0.5 ) );
+        inside.push_back ( false );
+        points.push_back ( point_Type ( 0.5, 0.5, 1. + 1e-3 ) );
+        inside.push_back ( false );
+
+        evaluator_Type evaluator ( feSpace, points );
+
+        std::vector<Real> values;
+        std::vector<Real> repeatedValues;
+        std::vector<point_Type> gradients;
+        evaluator.evaluate ( solution, values );
+        evaluator.evaluate ( repeatedSolution, repeatedValues );
+        evaluator.evaluateGradient ( solution, gradients );
+
+        for ( UInt i ( 0 ); i < points.size(); ++i )
+        {
+            const Real expected ( inside[ i ] ? linearFunction ( 0., points[ i ][ 0 ], points[ i ][ 1 ], points[ i ][ 2 ], 0 ) : 0. );
+            const point_Type expectedGradient ( inside[ i ] ? S_gradient : point_Type ( 0., 0., 0. ) );
+
+            Real gradientError ( 0. );
+            for ( UInt iCoor ( 0 ); iCoor < 3; ++iCoor )
+            {
+                gradientError = std::max ( gradientError, std::fabs ( gradients[ i ][ iCoor ] - expectedGradient[ iCoor ] ) );
+            }
+
+            // Each point inside the mesh has one owner, the same on all the processes
+            Int owner ( evaluator.owner ( i ) ), minOwner ( 0 ), maxOwner ( 0 );
+            comm->MinAll ( &owner, &minOwner, 1 );
+            comm->MaxAll ( &owner, &maxOwner, 1 );
+
+            passed &= evaluator.isFound ( i ) == inside[ i ];
+            passed &= minOwner == maxOwner && owner < comm->NumProc();
+            passed &= std::fabs ( values[ i ] - expected ) < S_tolerance;
+            passed &= std::fabs ( repeatedValues[ i ] - expected ) < S_tolerance;
+            passed &= gradientError < S_tolerance;
+        }
+    }
+
+    if ( verbose )
+    {
+        std::cout << ( passed ? "FEPointEvaluator test passed" : "FEPointEvaluator test FAILED" ) << std::endl;
+    }
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !passed )
+    {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
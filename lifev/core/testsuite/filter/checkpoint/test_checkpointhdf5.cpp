@@ -0,0 +1,253 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file test_checkpointhdf5.cpp
+    @brief Test of the restart and of the redistribution with CheckpointHDF5
+
+    Restart: three checkpoints are written, the second one is read and a new
+    checkpoint is written. The new checkpoint must be the fourth one and the
+    second and third ones must be unchanged.
+
+    Redistribution: the checkpoints written on all the processes are read on
+    the first process only, which writes a new checkpoint that is then read
+    on all the processes.
+
+    @date 10-2026
+ */
+
+// ===================================================
+//! Includes
+// ===================================================
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/array/MapEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+#include <lifev/core/filter/CheckpointHDF5.hpp>
+
+// ===================================================
+//! Namespaces & define
+// ===================================================
+
+using namespace LifeV;
+
+namespace
+{
+
+typedef VectorEpetra                    vector_Type;
+typedef std::shared_ptr<vector_Type>  vectorPtr_Type;
+typedef std::shared_ptr<Epetra_Comm>  commPtr_Type;
+
+const std::string S_prefix ( "test_checkpoint" );
+const Int S_numGlobalElements ( 53 );
+
+// Set the entries of the vector to gid + 100 * step
+void fill ( vector_Type& vector, const Real& step )
+{
+    const Epetra_BlockMap& map ( vector.blockMap() );
+    for ( Int i ( 0 ); i < map.NumMyElements(); ++i )
+    {
+        vector.epetraVector() [ 0 ][ i ] = map.GID ( i ) + 100. * step;
+    }
+}
+
+// Largest difference between the entries of the vector and gid + 100 * step
+Real stepError ( const vector_Type& vector, const Real& step )
+{
+    const Epetra_BlockMap& map ( vector.blockMap() );
+    Real localError ( 0. ), error ( 0. );
+    for ( Int i ( 0 ); i < map.NumMyElements(); ++i )
+    {
+        localError = std::max ( localError, std::fabs ( vector.epetraVector() [ 0 ][ i ] - map.GID ( i ) - 100. * step ) );
+    }
+    vector.comm().MaxAll ( &localError, &error, 1 );
+    return error;
+}
+
+// Remove the checkpoints of previous runs
+void cleanUp ( const Epetra_Comm& comm )
+{
+    if ( comm.MyPID() == 0 )
+    {
+        for ( UInt index ( 0 ); index < 10; ++index )
+        {
+            std::ostringstream name;
+            name << "./" << S_prefix << "." << std::setw ( 5 ) << std::setfill ( '0' ) << index << ".h5";
+            std::remove ( name.str().c_str() );
+        }
+    }
+    comm.Barrier();
+}
+
+}
+
+// ===================================================
+//! Main
+// ===================================================
+int main ( int argc, char** argv )
+{
+#ifdef HAVE_MPI
+    MPI_Init ( &argc, &argv );
+    commPtr_Type comm ( new Epetra_MpiComm ( MPI_COMM_WORLD ) );
+#else
+    commPtr_Type comm ( new Epetra_SerialComm );
+#endif
+
+    const bool verbose ( comm->MyPID() == 0 );
+    bool passed ( true );
+
+    cleanUp ( *comm );
+
+    // Restart from an older checkpoint
+    {
+        MapEpetra map ( S_numGlobalElements, comm );
+        vectorPtr_Type solution ( new vector_Type ( map, Unique ) );
+        vectorPtr_Type parameter ( new vector_Type ( map, Unique ) );
+        fill ( *parameter, -1. );
+
+        CheckpointHDF5 checkpoint ( comm, S_prefix );
+        checkpoint.addVector ( "solution", solution );
+        checkpoint.addVector ( "parameter", parameter );
+
+        for ( UInt step ( 0 ); step < 3; ++step )
+        {
+            fill ( *solution, step );
+            passed &= checkpoint.write ( step ) == step;
+        }
+
+        *solution = 0.;
+        *parameter = 0.;
+        passed &= checkpoint.read ( 1 ) == 1.;
+        passed &= stepError ( *solution, 1. ) == 0.;
+        passed &= stepError ( *parameter, -1. ) == 0.;
+
+        fill ( *solution, 10. );
+        passed &= checkpoint.write ( 10. ) == 3;
+        passed &= checkpoint.lastCheckpoint() == 3;
+
+        // The checkpoints following the one read are unchanged
+        for ( UInt step ( 1 ); step < 3; ++step )
+        {
+            passed &= checkpoint.read ( step ) == step;
+            passed &= stepError ( *solution, step ) == 0.;
+        }
+
+        passed &= checkpoint.read() == 10.;
+        passed &= stepError ( *solution, 10. ) == 0.;
+        passed &= stepError ( *parameter, -1. ) == 0.;
+    }
+
+    // Read on a different number of processes
+#ifdef HAVE_MPI
+    MPI_Comm subComm;
+    MPI_Comm_split ( MPI_COMM_WORLD, comm->MyPID() == 0 ? 0 : MPI_UNDEFINED, 0, &subComm );
+#endif
+    {
+        commPtr_Type serialComm;
+#ifdef HAVE_MPI
+        if ( subComm != MPI_COMM_NULL )
+        {
+            serialComm.reset ( new Epetra_MpiComm ( subComm ) );
+        }
+#else
+        serialComm.reset ( new Epetra_SerialComm );
+#endif
+
+        if ( serialComm )
+        {
+            MapEpetra map ( S_numGlobalElements, serialComm );
+            vectorPtr_Type solution ( new vector_Type ( map, Unique ) );
+            vectorPtr_Type parameter ( new vector_Type ( map, Unique ) );
+
+            CheckpointHDF5 checkpoint ( serialComm, S_prefix );
+            checkpoint.addVector ( "solution", solution );
+            checkpoint.addVector ( "parameter", parameter );
+
+            passed &= checkpoint.read() == 10.;
+            passed &= stepError ( *solution, 10. ) == 0.;
+            passed &= stepError ( *parameter, -1. ) == 0.;
+
+            fill ( *solution, 20. );
+            passed &= checkpoint.write ( 20. ) == 4;
+        }
+    }
+#ifdef HAVE_MPI
+    if ( subComm != MPI_COMM_NULL )
+    {
+        MPI_Comm_free ( &subComm );
+    }
+#endif
+    comm->Barrier();
+
+    {
+        MapEpetra map ( S_numGlobalElements, comm );
+        vectorPtr_Type solution ( new vector_Type ( map, Unique ) );
+        vectorPtr_Type parameter ( new vector_Type ( map, Unique ) );
+
+        CheckpointHDF5 checkpoint ( comm, S_prefix );
+        checkpoint.addVector ( "solution", solution );
+        checkpoint.addVector ( "parameter", parameter );
+
+        passed &= checkpoint.read() == 20.;
+        passed &= stepError ( *solution, 20. ) == 0.;
+        passed &= stepError ( *parameter, -1. ) == 0.;
+    }
+
+    // The result is known on all the processes
+    Int localPassed ( passed ), globalPassed ( 0 );
+    comm->MinAll ( &localPassed, &globalPassed, 1 );
+
+    if ( verbose )
+    {
+        std::cout << ( globalPassed ? "CheckpointHDF5 test passed" : "CheckpointHDF5 test FAILED" ) << std::endl;
+    }
+
+    cleanUp ( *comm );
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !globalPassed )
+    {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -329,7 +329,7 @@ hyperbolic::hyperbolic ( int argc,
 // ===================================================
 
 Real
-hyperbolic::run()
+hyperbolic::run ( const int& numThreads )
 {
     typedef RegionMesh<LinearTetra, neighborMarkerCommon_Type> RegionMesh;
     typedef SolverAztecOO                               solver_type;
@@ -490,6 +490,11 @@ hyperbolic::run()
                              ghost.ghostMapOnElementsFV(),
                              Members->comm );
 
+    // Set the number of threads of the assembly
+    OpenMPParameters ompParams;
+    ompParams.numThreads = numThreads;
+    hyperbolicSolver.setOpenMPParameters ( ompParams );
+
     // Stop chronoProblem
     chronoProblem.stop();
 
@@ -79,7 +79,11 @@ public:
      */
     //@{
 
-    LifeV::Real run();
+    //! Solve the problem and return the L2 error
+    /*!
+      @param numThreads Number of OpenMP threads of the HyperbolicSolver
+     */
+    LifeV::Real run ( const int& numThreads = 1 );
 
     //@}
 
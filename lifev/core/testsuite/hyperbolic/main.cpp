@@ -88,7 +88,10 @@ int main (int argc, char** argv)
     // Error of the problem
     error = Hyperbolic.run();
 
-    bool success = std::fabs ( error - errorKnown ) <= tolerance;
+    // The threaded assembly adds the fluxes in the same order, the error must be the same
+    const LifeV::Real threadedError ( Hyperbolic.run ( 4 ) );
+
+    bool success = std::fabs ( error - errorKnown ) <= tolerance && threadedError == error;
 
 #ifdef HAVE_MPI
     MPI_Finalize();
@@ -0,0 +1,410 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file test_godunovflux.cpp
+    @brief Test of the Godunov flux with a functor physical flux
+
+    The fluxes \f$ \mathbf{F}( u ) = f( u ) \mathbf{a} \f$ with
+    <ol>
+    <li> the Burgers flux \f$ f( u ) = u^2 / 2 \f$, convex or concave depending on the normal;</li>
+    <li> the flux \f$ f( u ) = u ( 1 - u ) \f$, concave or convex depending on the normal;</li>
+    <li> the flux \f$ f( u ) = \sin( u ) \f$, given as a general flux;</li>
+    </ol>
+    are given both as std::function to GodunovNumericalFlux and as functors, with their shape,
+    to GodunovFunctorNumericalFlux. For several normals and couples of states, the Godunov fluxes
+    and the local infinity norms of the CFL condition of GodunovFunctorNumericalFlux must agree
+    with the ones of GodunovNumericalFlux, up to the tolerance of the Brent algorithm, and with
+    the extrema over a fine sampling of the interval between the states. GodunovNumericalFlux is
+    skipped when its Brent algorithm may stop in a local extremum.
+
+    @date 10-2026
+ */
+
+// ===================================================
+//! Includes
+// ===================================================
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/fem/FESpace.hpp>
+#include <lifev/core/fem/HyperbolicFluxNumerical.hpp>
+#include <lifev/core/filter/GetPot.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+
+// ===================================================
+//! Namespaces & define
+// ===================================================
+
+using namespace LifeV;
+
+namespace
+{
+
+typedef RegionMesh<LinearTetra>         mesh_Type;
+typedef FESpace<mesh_Type, MapEpetra>   feSpace_Type;
+typedef KN<Real>                        normal_Type;
+
+const Real S_tolerance = 1e-8;
+
+// Number of samples of the interval between the states for the reference values
+const UInt S_numSamples = 100000;
+
+// Direction of the physical fluxes
+const Real S_direction[ 3 ] = { 0.8, -0.6, 0.5 };
+
+// Unit normals, the last one is orthogonal to the direction
+const UInt S_numNormals = 5;
+const Real S_normals[ S_numNormals ][ 3 ] = { {  1.,      0.,      0.      },
+                                              {  0.,     -1.,      0.      },
+                                              {  1. / 3., 2. / 3., -2. / 3. },
+                                              { -2. / 3., 1. / 3.,  2. / 3. },
+                                              {  0.6,     0.8,     0.      }
+                                            };
+
+// Couples of left and right states
+const UInt S_numStates = 8;
+const Real S_states[ S_numStates ][ 2 ] = { { -1.,  2.  },
+                                            {  2., -1.  },
+                                            {  0.5, 1.5 },
+                                            {  1.5, 0.5 },
+                                            { -2., -0.3 },
+                                            { -0.3, -2. },
+                                            {  0.2, 0.9 },
+                                            {  0.7, 0.7 }
+                                          };
+
+Real directionDotNormal ( const normal_Type& normal )
+{
+    Real value ( 0. );
+    for ( UInt i ( 0 ); i < 3; ++i )
+    {
+        value += S_direction[ i ] * normal[ i ];
+    }
+    return value;
+}
+
+// Burgers flux, convex
+struct BurgersFlux
+{
+    static Real f ( const Real& u )
+    {
+        return 0.5 * u * u;
+    }
+
+    static Real df ( const Real& u )
+    {
+        return u;
+    }
+
+    static NormalFluxShape shape ( const Real& directionDotNormal )
+    {
+        if ( directionDotNormal > 0. )
+        {
+            return NormalFluxShape ( NormalFluxShape::ConvexFlux, 0. );
+        }
+        if ( directionDotNormal < 0. )
+        {
+            return NormalFluxShape ( NormalFluxShape::ConcaveFlux, 0. );
+        }
+        return NormalFluxShape ( NormalFluxShape::MonotoneFlux );
+    }
+
+    // The states are in [-2, 2]
+    static Real stateScale()
+    {
+        return 1.;
+    }
+};
+
+// Concave flux
+struct ConcaveFlux
+{
+    static Real f ( const Real& u )
+    {
+        return u * ( 1. - u );
+    }
+
+    static Real df ( const Real& u )
+    {
+        return 1. - 2. * u;
+    }
+
+    static NormalFluxShape shape ( const Real& directionDotNormal )
+    {
+        if ( directionDotNormal > 0. )
+        {
+            return NormalFluxShape ( NormalFluxShape::ConcaveFlux, 0.5 );
+        }
+        if ( directionDotNormal < 0. )
+        {
+            return NormalFluxShape ( NormalFluxShape::ConvexFlux, 0.5 );
+        }
+        return NormalFluxShape ( NormalFluxShape::MonotoneFlux );
+    }
+
+    static Real stateScale()
+    {
+        return 1.;
+    }
+};
+
+// Flux neither convex nor concave, without shape
+struct GeneralFlux
+{
+    static Real f ( const Real& u )
+    {
+        return std::sin ( u );
+    }
+
+    static Real df ( const Real& u )
+    {
+        return std::cos ( u );
+    }
+
+    static NormalFluxShape shape ( const Real& /*directionDotNormal*/ )
+    {
+        return NormalFluxShape ( NormalFluxShape::GeneralFlux );
+    }
+
+    // The states are in [-1.2, 1.2], where the flux is monotone and the Brent algorithm finds the global extrema
+    static Real stateScale()
+    {
+        return 0.6;
+    }
+};
+
+// Physical flux as std::function, for GodunovNumericalFlux
+template < typename Law >
+Vector physicalFlux ( const Real& /*t*/, const Real& /*x*/, const Real& /*y*/, const Real& /*z*/,
+                      const std::vector<Real>& u )
+{
+    Vector value ( static_cast<UInt> ( 3 ) );
+    for ( UInt i ( 0 ); i < 3; ++i )
+    {
+        value ( i ) = Law::f ( u[ 0 ] ) * S_direction[ i ];
+    }
+    return value;
+}
+
+template < typename Law >
+Vector firstDerivativePhysicalFlux ( const Real& /*t*/, const Real& /*x*/, const Real& /*y*/, const Real& /*z*/,
+                                     const std::vector<Real>& u )
+{
+    Vector value ( static_cast<UInt> ( 3 ) );
+    for ( UInt i ( 0 ); i < 3; ++i )
+    {
+        value ( i ) = Law::df ( u[ 0 ] ) * S_direction[ i ];
+    }
+    return value;
+}
+
+// Physical flux as functor, for GodunovFunctorNumericalFlux
+template < typename Law >
+class FluxFunctor
+{
+public:
+
+    Real flux ( const Real& u, const normal_Type& normal, const std::vector<Real>& /*fields*/,
+                const Real& /*t*/, const Real& /*x*/, const Real& /*y*/, const Real& /*z*/ ) const
+    {
+        return Law::f ( u ) * directionDotNormal ( normal );
+    }
+
+    Real derivative ( const Real& u, const normal_Type& normal, const std::vector<Real>& /*fields*/,
+                      const Real& /*t*/, const Real& /*x*/, const Real& /*y*/, const Real& /*z*/ ) const
+    {
+        return Law::df ( u ) * directionDotNormal ( normal );
+    }
+
+    NormalFluxShape shape ( const normal_Type& normal, const std::vector<Real>& /*fields*/,
+                            const Real& /*t*/, const Real& /*x*/, const Real& /*y*/, const Real& /*z*/ ) const
+    {
+        return Law::shape ( directionDotNormal ( normal ) );
+    }
+};
+
+// Godunov flux and maximum of |F'(u) . n| between the states, from the values in a fine sampling of the interval
+template < typename Law >
+void sampledReference ( const Real& leftState, const Real& rightState, const Real& directionDotNormal,
+                        Real& flux, Real& norm )
+{
+    const Real lower ( std::min ( leftState, rightState ) );
+    const Real upper ( std::max ( leftState, rightState ) );
+
+    Real minFlux ( directionDotNormal * Law::f ( lower ) ), maxFlux ( minFlux );
+    norm = std::fabs ( directionDotNormal * Law::df ( lower ) );
+    for ( UInt k ( 1 ); k <= S_numSamples; ++k )
+    {
+        const Real u ( k == S_numSamples ? upper : lower + ( upper - lower ) * k / S_numSamples );
+        minFlux = std::min ( minFlux, directionDotNormal * Law::f ( u ) );
+        maxFlux = std::max ( maxFlux, directionDotNormal * Law::f ( u ) );
+        norm = std::max ( norm, std::fabs ( directionDotNormal * Law::df ( u ) ) );
+    }
+
+    flux = rightState > leftState ? minFlux : maxFlux;
+}
+
+// The Brent algorithm of GodunovNumericalFlux finds a local extremum: for convex and concave fluxes
+// it is the global one if the extremum of the shape is not inside the interval
+bool brentFindsExtremum ( const NormalFluxShape& shape, const Real& leftState, const Real& rightState )
+{
+    const bool isInside ( shape.extremum > std::min ( leftState, rightState )
+                          && shape.extremum < std::max ( leftState, rightState ) );
+    return !isInside || ( shape.type != NormalFluxShape::ConvexFlux && shape.type != NormalFluxShape::ConcaveFlux );
+}
+
+// Largest differences of the Godunov fluxes and of the infinity norms of GodunovFunctorNumericalFlux with respect
+// to the sampled values and, when its Brent algorithm finds the global extrema, to GodunovNumericalFlux
+template < typename Law >
+void compareFluxes ( const feSpace_Type& feSpace, const GetPot& dataFile, Real& fluxError, Real& normError )
+{
+    typedef typename GodunovNumericalFlux<mesh_Type>::vectorFunction_Type vectorFunction_Type;
+
+    const GodunovNumericalFlux<mesh_Type> referenceFlux ( vectorFunction_Type ( &physicalFlux<Law> ),
+                                                          vectorFunction_Type ( &firstDerivativePhysicalFlux<Law> ),
+                                                          feSpace, dataFile );
+    const GodunovFunctorNumericalFlux<mesh_Type, FluxFunctor<Law> > functorFlux ( FluxFunctor<Law>(), feSpace, dataFile );
+
+    fluxError = 0.;
+    normError = 0.;
+
+    normal_Type normal ( 3 );
+    for ( UInt iNormal ( 0 ); iNormal < S_numNormals; ++iNormal )
+    {
+        for ( UInt i ( 0 ); i < 3; ++i )
+        {
+            normal ( i ) = S_normals[ iNormal ][ i ];
+        }
+        const NormalFluxShape shape ( Law::shape ( directionDotNormal ( normal ) ) );
+
+        for ( UInt iStates ( 0 ); iStates < S_numStates; ++iStates )
+        {
+            const Real leftState ( Law::stateScale() * S_states[ iStates ][ 0 ] );
+            const Real rightState ( Law::stateScale() * S_states[ iStates ][ 1 ] );
+
+            const Real flux ( functorFlux ( leftState, rightState, normal, 0 ) );
+            const Real norm ( functorFlux.normInfinity ( leftState, rightState, normal, 0 ) );
+
+            Real sampledFlux ( 0. ), sampledNorm ( 0. );
+            sampledReference<Law> ( leftState, rightState, directionDotNormal ( normal ), sampledFlux, sampledNorm );
+            fluxError = std::max ( fluxError, std::fabs ( flux - sampledFlux ) );
+            normError = std::max ( normError, std::fabs ( norm - sampledNorm ) );
+
+            // The Godunov flux is the minimum of a convex flux, or the maximum of a concave one
+            const bool isMinimum ( rightState > leftState );
+            if ( brentFindsExtremum ( shape, leftState, rightState )
+                    || ( isMinimum && shape.type == NormalFluxShape::ConvexFlux )
+                    || ( !isMinimum && shape.type == NormalFluxShape::ConcaveFlux ) )
+            {
+                fluxError = std::max ( fluxError, std::fabs ( flux - referenceFlux ( leftState, rightState, normal, 0 ) ) );
+            }
+            if ( brentFindsExtremum ( shape, leftState, rightState ) )
+            {
+                normError = std::max ( normError, std::fabs ( norm - referenceFlux.normInfinity ( leftState, rightState, normal, 0 ) ) );
+            }
+        }
+    }
+}
+
+}
+
+// ===================================================
+//! Main
+// ===================================================
+int main ( int argc, char** argv )
+{
+#ifdef HAVE_MPI
+    MPI_Init ( &argc, &argv );
+    std::shared_ptr<Epetra_Comm> comm ( new Epetra_MpiComm ( MPI_COMM_WORLD ) );
+#else
+    std::shared_ptr<Epetra_Comm> comm ( new Epetra_SerialComm );
+#endif
+
+    const bool verbose ( comm->MyPID() == 0 );
+    bool passed ( true );
+
+    {
+        GetPot command_line ( argc, argv );
+        const std::string dataFileName = command_line.follow ( "data_godunovflux", 2, "-f", "--file" );
+        GetPot dataFile ( dataFileName );
+
+        // The fluxes do not depend on external fields, the finite element space is not used
+        std::shared_ptr<mesh_Type> meshPtr ( new mesh_Type ( comm ) );
+        regularMesh3D ( *meshPtr, 1, 1, 1, 1 );
+        feSpace_Type feSpace ( meshPtr, feTetraP0, quadRuleTetra1pt, quadRuleTria1pt, 1, comm );
+
+        Real fluxError ( 0. ), normError ( 0. );
+
+        compareFluxes<BurgersFlux> ( feSpace, dataFile, fluxError, normError );
+        passed &= fluxError < S_tolerance && normError < S_tolerance;
+        if ( verbose )
+        {
+            std::cout << "Burgers flux, flux error " << fluxError << ", CFL norm error " << normError << std::endl;
+        }
+
+        compareFluxes<ConcaveFlux> ( feSpace, dataFile, fluxError, normError );
+        passed &= fluxError < S_tolerance && normError < S_tolerance;
+        if ( verbose )
+        {
+            std::cout << "Concave flux, flux error " << fluxError << ", CFL norm error " << normError << std::endl;
+        }
+
+        compareFluxes<GeneralFlux> ( feSpace, dataFile, fluxError, normError );
+        passed &= fluxError < S_tolerance && normError < S_tolerance;
+        if ( verbose )
+        {
+            std::cout << "General flux, flux error " << fluxError << ", CFL norm error " << normError << std::endl;
+        }
+    }
+
+    if ( verbose )
+    {
+        std::cout << ( passed ? "GodunovFunctorNumericalFlux test passed" : "GodunovFunctorNumericalFlux test FAILED" ) << std::endl;
+    }
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !passed )
+    {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
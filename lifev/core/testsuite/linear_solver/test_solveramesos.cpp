@@ -0,0 +1,188 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file test_solveramesos.cpp
+    @brief Test of the reuse of the factorization in SolverAmesos
+
+    The same matrix object is refilled in place with new values: setMatrix()
+    must factorize it again, unless the reuse of the factorization has been
+    explicitly requested with setReuseFactorization().
+
+    @date 10-2026
+ */
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+#include <Teuchos_ParameterList.hpp>
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/array/MapEpetra.hpp>
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+#include <lifev/core/algorithm/SolverAmesos.hpp>
+
+using namespace LifeV;
+
+namespace
+{
+typedef MatrixEpetra<Real>              matrix_Type;
+typedef std::shared_ptr<matrix_Type>  matrixPtr_Type;
+typedef VectorEpetra                    vector_Type;
+
+const Real S_tolerance = 1e-10;
+
+// Fill the matrix with tridiag ( -1, diagonal, -1 ), keeping its pattern once it is filled
+void fillMatrix ( matrix_Type& matrix, const MapEpetra& map, const Real& diagonal )
+{
+    const Int numGlobalRows ( map.map ( Unique )->NumGlobalElements() );
+
+    if ( matrix.matrixPtr()->Filled() )
+    {
+        matrix.zero();
+    }
+
+    for ( Int i ( 0 ); i < map.map ( Unique )->NumMyElements(); ++i )
+    {
+        const Int row ( map.map ( Unique )->GID ( i ) );
+        matrix.addToCoefficient ( row, row, diagonal );
+        if ( row > 0 )
+        {
+            matrix.addToCoefficient ( row, row - 1, -1. );
+        }
+        if ( row < numGlobalRows - 1 )
+        {
+            matrix.addToCoefficient ( row, row + 1, -1. );
+        }
+    }
+
+    matrix.globalAssemble();
+}
+
+// Relative residual of the solution
+Real residual ( const matrix_Type& matrix, const vector_Type& solution, const vector_Type& rhs )
+{
+    vector_Type result ( matrix * solution );
+    result -= rhs;
+    return result.norm2() / rhs.norm2();
+}
+}
+
+int main ( int argc, char** argv )
+{
+#ifdef HAVE_MPI
+    MPI_Init ( &argc, &argv );
+    std::shared_ptr<Epetra_Comm> comm ( new Epetra_MpiComm ( MPI_COMM_WORLD ) );
+#else
+    std::shared_ptr<Epetra_Comm> comm ( new Epetra_SerialComm );
+#endif
+
+    const bool verbose ( comm->MyPID() == 0 );
+    bool passed ( true );
+
+    {
+        MapEpetra map ( 60, comm );
+
+        matrixPtr_Type matrix ( new matrix_Type ( map, 3 ) );
+        fillMatrix ( *matrix, map, 4. );
+
+        vector_Type rhs ( map, Unique );
+        rhs = 1.;
+        vector_Type solution ( map, Unique );
+        vector_Type previousSolution ( map, Unique );
+
+        Teuchos::ParameterList list;
+        list.set ( "SolverType", "Klu" );
+        list.set ( "Verbose", false );
+
+        SolverAmesos solver ( comm );
+        solver.setParametersList ( list );
+        solver.setParameters();
+
+        // First factorization
+        solver.setMatrix ( *matrix );
+        solution = 0.;
+        solver.solveSystem ( rhs, solution, matrix );
+        passed &= residual ( *matrix, solution, rhs ) < S_tolerance;
+        previousSolution = solution;
+
+        // Same matrix object refilled in place: the factors must be recomputed
+        fillMatrix ( *matrix, map, 8. );
+        solver.setMatrix ( *matrix );
+        solution = 0.;
+        solver.solveSystem ( rhs, solution, matrix );
+        passed &= residual ( *matrix, solution, rhs ) < S_tolerance;
+        vector_Type difference ( solution - previousSolution );
+        passed &= difference.normInf() > 1e-3;
+        previousSolution = solution;
+
+        // The reuse of the preconditioner does not affect the direct solver
+        solver.setReusePreconditioner ( true );
+        fillMatrix ( *matrix, map, 6. );
+        solver.setMatrix ( *matrix );
+        solution = 0.;
+        solver.solveSystem ( rhs, solution, matrix );
+        passed &= residual ( *matrix, solution, rhs ) < S_tolerance;
+        previousSolution = solution;
+
+        // Explicit reuse of the factorization: the factors of the previous matrix are kept
+        solver.setReuseFactorization ( true );
+        fillMatrix ( *matrix, map, 10. );
+        solver.setMatrix ( *matrix );
+        solution = 0.;
+        solver.solveSystem ( rhs, solution, matrix );
+        difference = solution - previousSolution;
+        passed &= difference.normInf() < S_tolerance;
+
+        // After a reset the new values are factorized
+        solver.resetFactorization();
+        solver.setMatrix ( *matrix );
+        solution = 0.;
+        solver.solveSystem ( rhs, solution, matrix );
+        passed &= residual ( *matrix, solution, rhs ) < S_tolerance;
+    }
+
+    if ( verbose )
+    {
+        std::cout << ( passed ? "SolverAmesos test passed" : "SolverAmesos test FAILED" ) << std::endl;
+    }
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !passed )
+    {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
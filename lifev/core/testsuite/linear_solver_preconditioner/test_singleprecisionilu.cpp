@@ -0,0 +1,241 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file test_singleprecisionilu.cpp
+    @brief Test of the single precision ILU(0) preconditioner
+
+    On the five points Laplacian of a square grid:
+    <ol>
+    <li> ApplyInverse of Operators::SinglePrecisionILU is compared with the
+         ILU(0) of Ifpack without overlap, up to the single precision roundoff;
+    <li> the system is solved with GMRES (LinearSolver, Belos) preconditioned
+         by PreconditionerSinglePrecision, the true residual must converge.
+    </ol>
+
+    @date 10-2026
+ */
+
+// ===================================================
+//! Includes
+// ===================================================
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+#include <cmath>
+
+#include <Ifpack.h>
+#include <Ifpack_Preconditioner.h>
+#include <Teuchos_ParameterList.hpp>
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/array/MapEpetra.hpp>
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+#include <lifev/core/algorithm/LinearSolver.hpp>
+#include <lifev/core/algorithm/PreconditionerSinglePrecision.hpp>
+#include <lifev/core/operator/SinglePrecisionILU.hpp>
+
+// ===================================================
+//! Namespaces & define
+// ===================================================
+
+using namespace LifeV;
+
+namespace
+{
+
+typedef MatrixEpetra<Real>              matrix_Type;
+typedef std::shared_ptr<matrix_Type>  matrixPtr_Type;
+typedef VectorEpetra                    vector_Type;
+typedef std::shared_ptr<vector_Type>  vectorPtr_Type;
+
+// Single precision roundoff, amplified by the triangular solves
+const Real S_applyTolerance = 1e-5;
+const Real S_solverTolerance = 1e-10;
+const Int  S_maxIterations = 200;
+
+// Five points Laplacian on a n x n grid, with the Dirichlet nodes eliminated
+void fillLaplacian ( matrix_Type& matrix, const MapEpetra& map, const Int& n )
+{
+    for ( Int iRow ( 0 ); iRow < map.map ( Unique )->NumMyElements(); ++iRow )
+    {
+        const Int row ( map.map ( Unique )->GID ( iRow ) );
+        const Int i ( row / n );
+        const Int j ( row % n );
+
+        matrix.addToCoefficient ( row, row, 4. );
+        if ( i > 0 )
+        {
+            matrix.addToCoefficient ( row, row - n, -1. );
+        }
+        if ( i < n - 1 )
+        {
+            matrix.addToCoefficient ( row, row + n, -1. );
+        }
+        if ( j > 0 )
+        {
+            matrix.addToCoefficient ( row, row - 1, -1. );
+        }
+        if ( j < n - 1 )
+        {
+            matrix.addToCoefficient ( row, row + 1, -1. );
+        }
+    }
+    matrix.globalAssemble();
+}
+
+}
+
+// ===================================================
+//! Main
+// ===================================================
+int main ( int argc, char** argv )
+{
+#ifdef HAVE_MPI
+    MPI_Init ( &argc, &argv );
+    std::shared_ptr<Epetra_Comm> comm ( new Epetra_MpiComm ( MPI_COMM_WORLD ) );
+#else
+    std::shared_ptr<Epetra_Comm> comm ( new Epetra_SerialComm );
+#endif
+
+    const bool verbose ( comm->MyPID() == 0 );
+    bool passed ( true );
+
+    {
+        const Int n ( 20 );
+        MapEpetra map ( n * n, comm );
+
+        matrixPtr_Type matrix ( new matrix_Type ( map, 5 ) );
+        fillLaplacian ( *matrix, map, n );
+
+        vector_Type x ( map, Unique );
+        for ( Int i ( 0 ); i < x.epetraVector().MyLength(); ++i )
+        {
+            x.epetraVector() [ 0 ][ i ] = std::sin ( 0.3 * x.blockMap().GID ( i ) ) + 1.;
+        }
+
+        // ApplyInverse compared with the ILU(0) of Ifpack on the local blocks
+        Operators::SinglePrecisionILU singlePrecisionILU;
+        singlePrecisionILU.setUp ( *matrix->matrixPtr() );
+
+        Ifpack factory;
+        std::shared_ptr<Ifpack_Preconditioner> ifpackILU ( factory.Create ( "ILU", matrix->matrixPtr().get(), 0 ) );
+        Teuchos::ParameterList ifpackList;
+        ifpackList.set ( "fact: level-of-fill", 0 );
+        ifpackList.set ( "fact: absolute threshold", 0. );
+        ifpackList.set ( "fact: relative threshold", 1. );
+        ifpackILU->SetParameters ( ifpackList );
+        ifpackILU->Initialize();
+        ifpackILU->Compute();
+
+        vector_Type singlePrecisionResult ( map, Unique );
+        vector_Type ifpackResult ( map, Unique );
+        singlePrecisionILU.ApplyInverse ( x.epetraVector(), singlePrecisionResult.epetraVector() );
+        ifpackILU->ApplyInverse ( x.epetraVector(), ifpackResult.epetraVector() );
+
+        vector_Type difference ( singlePrecisionResult - ifpackResult );
+        const Real applyError ( difference.normInf() / ifpackResult.normInf() );
+        passed &= applyError < S_applyTolerance;
+
+        // The same vector can be input and output
+        vector_Type inPlace ( x );
+        singlePrecisionILU.ApplyInverse ( inPlace.epetraVector(), inPlace.epetraVector() );
+        difference = inPlace - singlePrecisionResult;
+        passed &= difference.normInf() == 0.;
+
+        if ( verbose )
+        {
+            std::cout << "ApplyInverse, relative difference with Ifpack: " << applyError << std::endl;
+        }
+
+        // GMRES preconditioned by PreconditionerSinglePrecision
+        Teuchos::ParameterList solverList;
+        solverList.set ( "Solver Type", "Belos" );
+        solverList.set ( "Reuse Preconditioner", false );
+        solverList.set ( "Quit On Failure", false );
+        solverList.set ( "Silent", true );
+        Teuchos::ParameterList& operatorList ( solverList.sublist ( "Solver: Operator List" ) );
+        operatorList.set ( "Solver Manager Type", "BlockGmres" );
+        operatorList.set ( "Preconditioner Side", "Right" );
+        Teuchos::ParameterList& belosList ( operatorList.sublist ( "Trilinos: Belos List" ) );
+        belosList.set ( "Convergence Tolerance", S_solverTolerance );
+        belosList.set ( "Maximum Iterations", S_maxIterations );
+        belosList.set ( "Num Blocks", S_maxIterations );
+        belosList.set ( "Block Size", 1 );
+        belosList.set ( "Verbosity", 0 );
+
+        std::shared_ptr<Preconditioner> preconditioner ( new PreconditionerSinglePrecision ( comm ) );
+
+        LinearSolver linearSolver;
+        linearSolver.setCommunicator ( comm );
+        linearSolver.setParameters ( solverList );
+        linearSolver.setPreconditioner ( preconditioner );
+        linearSolver.setOperator ( matrix );
+
+        vectorPtr_Type rhs ( new vector_Type ( ( *matrix ) * x ) );
+        vectorPtr_Type solution ( new vector_Type ( map, Unique ) );
+        *solution = 0.;
+        linearSolver.setRightHandSide ( rhs );
+        const Int numIterations ( linearSolver.solve ( solution ) );
+
+        vector_Type residual ( ( *matrix ) * ( *solution ) );
+        residual -= *rhs;
+        const Real relativeResidual ( residual.norm2() / rhs->norm2() );
+        passed &= numIterations > 0 && numIterations < S_maxIterations;
+        passed &= relativeResidual < 100. * S_solverTolerance;
+
+        difference = *solution - x;
+        passed &= difference.normInf() < 1e-6;
+
+        if ( verbose )
+        {
+            std::cout << "GMRES with PreconditionerSinglePrecision: " << numIterations
+                      << " iterations, relative residual " << relativeResidual << std::endl;
+        }
+    }
+
+    if ( verbose )
+    {
+        std::cout << ( passed ? "SinglePrecisionILU test passed" : "SinglePrecisionILU test FAILED" ) << std::endl;
+    }
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !passed )
+    {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -40,6 +40,8 @@
 #define _DARCYSOLVERLINEAR_HPP_ 1
 
 
+#include <algorithm>
+
 #include <Epetra_LAPACK.h>
 #include <Epetra_BLAS.h>
 
@@ -337,7 +339,9 @@ public:
     //@{
 
     //! Constructor for the class.
-    DarcySolverLinear () {};
+    DarcySolverLinear () :
+        M_localFactorsUpdated ( false ),
+        M_constantLocalMatrices ( false ) {};
 
     //! Virtual destructor.
     virtual ~DarcySolverLinear () {};
@@ -411,6 +415,7 @@ public:
     virtual void setInversePermeability ( const matrixFctPtr_Type& invPermFct )
     {
         M_inversePermeabilityFct = invPermFct;
+        M_localFactorsUpdated = false;
     }
 
     //! Set the coefficient for the reaction term.
@@ -421,6 +426,7 @@ public:
     void setReactionTerm ( const scalarFctPtr_Type& reactionTermFct )
     {
         M_reactionTermFct = reactionTermFct;
+        M_localFactorsUpdated = false;
     }
 
     //! Set the hybrid field vector.
@@ -488,6 +494,20 @@ public:
         M_displayer.reset ( new displayerPtr_Type::element_type ( comm ) );
     }
 
+    //! Set if the local matrices are constant between two calls of buildSystem.
+    /*!
+      If the inverse of the permeability, the reaction term and, for the derived
+      classes, the time dependent terms do not change, the local factorizations
+      computed by the static condensation are kept and only the local right hand
+      sides are condensed at each call of buildSystem.
+      @param constantLocalMatrices True if the local matrices are constant.
+    */
+    void setConstantLocalMatrices ( const bool constantLocalMatrices )
+    {
+        M_constantLocalMatrices = constantLocalMatrices;
+        M_localFactorsUpdated = false;
+    }
+
     //@}
 
     //! @name Get Methods
@@ -666,32 +686,51 @@ protected:
     virtual void localVectorComputation ( const UInt& iElem,
                                           VectorElemental& elvecMix );
 
+    //! Number of reals needed to store the local factors of one element
+    /*!
+      The factors are stored column-wise, one block after the other:
+      L (dual x dual), L^{-1} B (dual x primal), L^{-1} C (dual x hybrid),
+      LB (primal x primal), LB^{-1} B^T A^{-1} C (primal x hybrid) and the
+      local hybrid matrix (hybrid x hybrid).
+      @return The size of the local factors.
+    */
+    UInt localFactorsSize () const;
+
+    //! Factorize the local matrices
+    /*!
+      Perform the matrix part of the static condensation: compute the Cholesky
+      factorizations of the local matrices and the local hybrid matrix.
+      @param localFactors Pointer to the storage of the local factors of the current element.
+      @param elmatMix The local matrix in mixed form.
+      @param elmatReactionTerm The local matrix for the reaction term.
+    */
+    void localMatrixFactorization ( Real* localFactors,
+                                    MatrixElemental& elmatMix,
+                                    MatrixElemental& elmatReactionTerm );
+
     //! Performs static condensation
     /*!
       Locally eliminate pressure and velocity DOFs, create the local
-      hybrid matrix and local hybrid right hand side.
+      hybrid matrix and local hybrid right hand side, using the factors
+      computed by localMatrixFactorization.
       @param localMatrixHybrid The matrix which will store the hybrid local matrix.
       @param localVectorHybrid The vector which will store the hybrid local vector.
-      @param elmatMix The local matrix in mixed form.
-      @param elmatReactionTerm The local matrix for the reaction term.
+      @param localFactors Pointer to the local factors of the current element.
       @param elvecMix The local vector in mixed form.
     */
     void staticCondensation ( MatrixElemental& localMatrixHybrid,
                               VectorElemental& localVectorHybrid,
-                              MatrixElemental& elmatMix,
-                              MatrixElemental& elmatReactionTerm,
+                              const Real* localFactors,
                               VectorElemental& elvecMix );
 
     //! Compute locally, as a post process, the primal and dual variable given the hybrid.
     /*!
       @param localSolution A vector which stores the dual, primal and hybrid local solution.
-      @param elmatMix The local matrix in mixed form.
-      @param elmatReactionTerm The local matrix for the reaction term.
+      @param localFactors Pointer to the local factors of the current element.
       @param elvecMix The local vector in mixed form.
     */
     void localComputePrimalAndDual ( VectorElemental& localSolution,
-                                     MatrixElemental& elmatMix,
-                                     MatrixElemental& elmatReactionTerm,
+                                     const Real* localFactors,
                                      VectorElemental& elvecMix );
 
     //! Do some computation after the calculation of the primal and dual variable.
@@ -795,6 +834,21 @@ protected:
 
     //@}
 
+    // Static condensation stuff.
+    //! @name Static condensation stuff
+    //@{
+
+    //! Local factors of all the elements, stored contiguously element by element.
+    std::vector<Real> M_localFactors;
+
+    //! True if M_localFactors stores the factors of the current local matrices.
+    bool M_localFactorsUpdated;
+
+    //! True if the local matrices do not change between two calls of buildSystem.
+    bool M_constantLocalMatrices;
+
+    //@}
+
 }; // class DarcySolverLinear
 
 //
@@ -865,6 +919,14 @@ buildSystem ()
     // Prepare all the stuff before the loop on all the volume elements.
     preLoopElementsComputation ();
 
+    // The local matrices are factorized again, unless they are constant and already factorized.
+    const bool updateLocalFactors = !M_constantLocalMatrices || !M_localFactorsUpdated;
+    const UInt factorsSize = localFactorsSize ();
+    if ( updateLocalFactors )
+    {
+        M_localFactors.resize ( meshNumberOfElements * factorsSize );
+    }
+
     //! Loop on all the volume elements.
     for ( UInt iElem (0); iElem < meshNumberOfElements; ++iElem )
     {
@@ -873,15 +935,23 @@ buildSystem ()
         localMatrixHybrid.zero();
         localVectorHybrid.zero();
 
-        // Compute the Hdiv mass matrix as a local matrix depending on the current element.
-        localMatrixComputation ( iElem, elmatMix, elmatReactionTerm );
+        // Local factors of the current element.
+        Real* localFactors = &M_localFactors[ iElem * factorsSize ];
+
+        if ( updateLocalFactors )
+        {
+            // Compute the Hdiv mass matrix as a local matrix depending on the current element.
+            localMatrixComputation ( iElem, elmatMix, elmatReactionTerm );
+
+            // Factorize the local matrices and compute the local hybrid matrix.
+            localMatrixFactorization ( localFactors, elmatMix, elmatReactionTerm );
+        }
 
         // Compute the source vectors as a local vectors depending on the current element.
         localVectorComputation ( iElem, elvecMix );
 
         // Perform the static condensation to compute the local hybrid matrix and the local hybrid right hand side.
-        staticCondensation ( localMatrixHybrid, localVectorHybrid,
-                             elmatMix, elmatReactionTerm, elvecMix );
+        staticCondensation ( localMatrixHybrid, localVectorHybrid, localFactors, elvecMix );
 
         /* Assemble the global hybrid matrix.
            M_primal_FESpace is used instead of M_hybridField_FESpace for currentLocalId,
@@ -904,6 +974,9 @@ buildSystem ()
     }
     //! End of loop volume operation.
 
+    // The local factors can be used by computePrimalAndDual.
+    M_localFactorsUpdated = true;
+
     chronoStaticCondensation.stop();
     M_displayer->leaderPrintMax ( " done in " , chronoStaticCondensation.diff() );
 
@@ -1037,14 +1110,32 @@ computePrimalAndDual ()
                                     primalNbDof, 1,
                                     hybridNbDof, 1 );
 
+    /* The local matrices are the ones used in buildSystem, reuse their factors
+       if available, otherwise factorize them element by element. */
+    const UInt factorsSize = localFactorsSize ();
+    std::vector<Real> elementFactors ( M_localFactorsUpdated ? 0 : factorsSize );
+
     //! Loop on all the volume elements.
     for ( UInt iElem (0); iElem < meshNumberOfElements; ++iElem )
     {
         // Clear the local solution vector.
         localSolution.zero();
 
-        // Compute the Hdiv mass matrix as a local matrix depending on the current element.
-        localMatrixComputation ( iElem,  elmatMix, elmatReactionTerm );
+        Real* localFactors;
+        if ( M_localFactorsUpdated )
+        {
+            localFactors = &M_localFactors[ iElem * factorsSize ];
+        }
+        else
+        {
+            localFactors = &elementFactors[0];
+
+            // Compute the Hdiv mass matrix as a local matrix depending on the current element.
+            localMatrixComputation ( iElem,  elmatMix, elmatReactionTerm );
+
+            // Factorize the local matrices.
+            localMatrixFactorization ( localFactors, elmatMix, elmatReactionTerm );
+        }
 
         // Compute the source vectors as local vector depending on the current element.
         localVectorComputation ( iElem, elvecMix );
@@ -1057,7 +1148,7 @@ computePrimalAndDual ()
                       M_primalField->getFESpace().fe().currentLocalId (), 2 );
 
         // Given the local hybrid variable, computes locally the primal and dual variable.
-        localComputePrimalAndDual ( localSolution, elmatMix, elmatReactionTerm, elvecMix );
+        localComputePrimalAndDual ( localSolution, localFactors, elvecMix );
 
         // Put the primal variable of the current finite element in the global vector M_primalField.
         assembleVector ( M_primalField->getVector (),
@@ -1261,15 +1352,32 @@ localVectorComputation ( const UInt& iElem, VectorElemental& elvecMix )
 
 } // localVectorComputation
 
-// Perform the static condensation for the local hybrid matrix.
+// Number of reals needed to store the local factors of one element.
+template < typename MeshType >
+UInt
+DarcySolverLinear < MeshType >::
+localFactorsSize () const
+{
+    // Primal variable degrees of freedom.
+    const UInt primalNbDof = M_primalField->getFESpace().refFE().nbDof();
+    // Dual variable degrees of freedom.
+    const UInt dualNbDof = M_dualField->getFESpace().refFE().nbDof();
+    // Hybrid variable degree of freedom.
+    const UInt hybridNbDof = M_hybridField->getFESpace().refFE().nbDof();
+
+    return dualNbDof * ( dualNbDof + primalNbDof + hybridNbDof )
+           + primalNbDof * ( primalNbDof + hybridNbDof )
+           + hybridNbDof * hybridNbDof;
+
+} // localFactorsSize
+
+// Factorize the local matrices and compute the local hybrid matrix.
 template < typename MeshType >
 void
 DarcySolverLinear < MeshType >::
-staticCondensation ( MatrixElemental& localMatrixHybrid,
-                     VectorElemental& localVectorHybrid,
-                     MatrixElemental& elmatMix,
-                     MatrixElemental& elmatReactionTerm,
-                     VectorElemental& elvecMix  )
+localMatrixFactorization ( Real* localFactors,
+                           MatrixElemental& elmatMix,
+                           MatrixElemental& elmatReactionTerm )
 {
 
     // LAPACK wrapper of Epetra.
@@ -1281,8 +1389,6 @@ staticCondensation ( MatrixElemental& localMatrixHybrid,
     // Flags for the BLAS and LAPACK routine.
     Int INFO[1] = {0};
 
-    // Number of columns of the right hand side := 1.
-    const Int NBRHS = 1;
     // Primal variable degrees of freedom.
     const Int primalNbDof = M_primalField->getFESpace().refFE().nbDof();
     // Dual variable degrees of freedom.
@@ -1304,24 +1410,35 @@ staticCondensation ( MatrixElemental& localMatrixHybrid,
     // Parameter that indicates whether the matrix has diagonal unit ('N' means no).
     const char NODIAG = 'N';
 
-    // Create and assign the local matrices A, B and C.
-    MatrixElemental::matrix_type A = elmatMix.block ( 0, 0 );
-    MatrixElemental::matrix_type B = elmatMix.block ( 0, 1 );
-    MatrixElemental::matrix_type C = elmatMix.block ( 0, 2 );
+    // Local matrices, stored column-wise in the local factors.
+    Real* A   = localFactors;
+    Real* B   = A + dualNbDof * dualNbDof;
+    Real* C   = B + dualNbDof * primalNbDof;
+    Real* BtB = C + dualNbDof * hybridNbDof;
+    Real* BtC = BtB + primalNbDof * primalNbDof;
+    Real* CtC = BtC + primalNbDof * hybridNbDof;
+
+    // Assign the local matrices A, B and C.
+    for ( Int j ( 0 ); j < dualNbDof; ++j )
+        for ( Int i ( 0 ); i < dualNbDof; ++i )
+        {
+            A[ i + j * dualNbDof ] = elmatMix.block ( 0, 0 ) ( i, j );
+        }
 
-    // Create and assign the local vectors fv and fp.
-    VectorElemental::super fv = elvecMix.block ( 0 );
-    VectorElemental::super fp = elvecMix.block ( 1 );
+    for ( Int j ( 0 ); j < primalNbDof; ++j )
+        for ( Int i ( 0 ); i < dualNbDof; ++i )
+        {
+            B[ i + j * dualNbDof ] = elmatMix.block ( 0, 1 ) ( i, j );
+        }
 
-    // Create local matrices.
-    MatrixElemental::matrix_type BtB ( primalNbDof, primalNbDof );
-    MatrixElemental::matrix_type CtC ( hybridNbDof, hybridNbDof );
-    MatrixElemental::matrix_type BtC ( primalNbDof, hybridNbDof );
+    for ( Int j ( 0 ); j < hybridNbDof; ++j )
+        for ( Int i ( 0 ); i < dualNbDof; ++i )
+        {
+            C[ i + j * dualNbDof ] = elmatMix.block ( 0, 2 ) ( i, j );
+        }
 
     // Clean the local matrices.
-    BtB *= 0.;
-    CtC *= 0.;
-    BtC *= 0.;
+    std::fill ( BtB, CtC + hybridNbDof * hybridNbDof, ZERO );
 
     //! Matrix operations.
     /* Put in A the matrix L and L^T, where L and L^T is the Cholesky factorization of A.
@@ -1336,7 +1453,7 @@ staticCondensation ( MatrixElemental& localMatrixHybrid,
 
     /* Put in C the matrix L^{-1} * C, solving a triangular system.
        For more details see http://www.netlib.org/lapack/lapack-3.1.1/SRC/dtrtrs.f */
-    lapack.TRTRS ( UPLO, NOTRANS, NODIAG, dualNbDof, hybridNbDof, A, dualNbDof, C, hybridNbDof, INFO );
+    lapack.TRTRS ( UPLO, NOTRANS, NODIAG, dualNbDof, hybridNbDof, A, dualNbDof, C, dualNbDof, INFO );
     ASSERT_PRE ( !INFO[0], "Lapack Computation C = L^{-1} C  is not achieved." );
 
     /* Put in BtB the matrix  B^T * L^{-T} * L^{-1} * B = B^T * A^{-1} * B
@@ -1347,7 +1464,11 @@ staticCondensation ( MatrixElemental& localMatrixHybrid,
     /* Put in BtB the matrix
        BtB + M_elmatReactionTerm = B^T * A^{-1} * B + elmatReactionTerm
        BtB stored only on lower part. */
-    BtB += elmatReactionTerm.mat();
+    for ( Int j ( 0 ); j < primalNbDof; ++j )
+        for ( Int i ( j ); i < primalNbDof; ++i )
+        {
+            BtB[ i + j * primalNbDof ] += elmatReactionTerm.mat() ( i, j );
+        }
 
     /* Put in CtC the matrix C^T * L^{-T} * L^{-1} * C = C^T * A^{-1} * C
        CtC stored only on lower part.
@@ -1389,6 +1510,77 @@ staticCondensation ( MatrixElemental& localMatrixHybrid,
        CtC stores -C^T * A^{-1} * C + C^T * A^{-t} * B * ( B^T * A^{-1} * B + elmatReactionTerm )^{-1} * B^T * A^{-1} * C
     */
 
+    /* Previously the matrix CtC is stored only in the lower part, but at the moment there is not
+       a function assembleMatrix that store a lower triangular sparse matrix.
+       Remind to correct these line in the future. */
+    for ( Int j ( 0 ); j < hybridNbDof; ++j )
+        for ( Int i ( j + 1 ); i < hybridNbDof; ++i )
+        {
+            CtC[ j + i * hybridNbDof ] = CtC[ i + j * hybridNbDof ];
+        }
+
+} // localMatrixFactorization
+
+// Perform the static condensation for the local hybrid matrix.
+template < typename MeshType >
+void
+DarcySolverLinear < MeshType >::
+staticCondensation ( MatrixElemental& localMatrixHybrid,
+                     VectorElemental& localVectorHybrid,
+                     const Real* localFactors,
+                     VectorElemental& elvecMix  )
+{
+
+    // LAPACK wrapper of Epetra.
+    Epetra_LAPACK lapack;
+
+    // BLAS wrapper of Epetra.
+    Epetra_BLAS blas;
+
+    // Flags for the BLAS and LAPACK routine.
+    Int INFO[1] = {0};
+
+    // Number of columns of the right hand side := 1.
+    const Int NBRHS = 1;
+    // Primal variable degrees of freedom.
+    const Int primalNbDof = M_primalField->getFESpace().refFE().nbDof();
+    // Dual variable degrees of freedom.
+    const Int dualNbDof = M_dualField->getFESpace().refFE().nbDof();
+    // Hybrid variable degree of freedom.
+    const Int hybridNbDof = M_hybridField->getFESpace().refFE().nbDof();
+
+    const Real ONE = 1.0;
+    const Real MINUSONE = -1.0;
+    const Real ZERO = 0.0;
+
+    // Parameter that indicate the Lower storage of matrices.
+    const char UPLO = 'L';
+
+    // Paramater that indicate the Transpose of matrices.
+    const char TRANS = 'T';
+    const char NOTRANS = 'N';
+
+    // Parameter that indicates whether the matrix has diagonal unit ('N' means no).
+    const char NODIAG = 'N';
+
+    /* Local factors computed by localMatrixFactorization
+       A stores L and L^T where L and L^T is the Cholesky factorization of A
+       B stores L^{-1} * B
+       C stores L^{-1} * C
+       BtB stores LB and LB^T where LB and LB^T is the factorization of B^T * A^{-1} * B + elmatReactionTerm
+       BtC stores LB^{-1} * B^T * A^{-1} * C
+       CtC stores the local hybrid matrix */
+    const Real* A   = localFactors;
+    const Real* B   = A + dualNbDof * dualNbDof;
+    const Real* C   = B + dualNbDof * primalNbDof;
+    const Real* BtB = C + dualNbDof * hybridNbDof;
+    const Real* BtC = BtB + primalNbDof * primalNbDof;
+    const Real* CtC = BtC + primalNbDof * hybridNbDof;
+
+    // Create and assign the local vectors fv and fp.
+    VectorElemental::super fv = elvecMix.block ( 0 );
+    VectorElemental::super fp = elvecMix.block ( 1 );
+
     //! Vector operations.
 
     /* Put in fp the vector LB^{-1} * fp = LB^{-1} Fp
@@ -1412,35 +1604,34 @@ staticCondensation ( MatrixElemental& localMatrixHybrid,
        = C^T * A^{-1} * ( B^T * ( B^T * A^{-1} * B + elmatReactionTerm )^{-1} * Fp - Fv )
        localVectorHybrid is fully stored.
        For more details see http://www.netlib.org/blas/dgemm.f */
-    blas.GEMM ( TRANS, NOTRANS, hybridNbDof, NBRHS, hybridNbDof, MINUSONE, C, hybridNbDof, fv, dualNbDof,
+    blas.GEMM ( TRANS, NOTRANS, hybridNbDof, NBRHS, dualNbDof, MINUSONE, C, dualNbDof, fv, dualNbDof,
                 ONE, localVectorHybrid, hybridNbDof );
 
     /* Put in fp the vector B^T * L^{-T} * fv =  B^T * A^{-1} * Fv
        fp fully stored.
        For more details see http://www.netlib.org/blas/dgemm.f */
-    blas.GEMM ( TRANS, TRANS, primalNbDof, NBRHS, dualNbDof, ONE, B, dualNbDof, fv, NBRHS, ZERO, fp, NBRHS );
+    blas.GEMM ( TRANS, NOTRANS, primalNbDof, NBRHS, dualNbDof, ONE, B, dualNbDof, fv, dualNbDof, ZERO, fp, primalNbDof );
 
     /* Put in fp the vector LB^{-1} * fp = LB^{-1} * B^T * A^{-1} * Fv
        For more details see http://www.netlib.org/lapack/lapack-3.1.1/SRC/dtrtrs.f */
-    lapack.TRTRS ( UPLO, NOTRANS, NODIAG, primalNbDof, NBRHS, BtB, primalNbDof, fp, NBRHS, INFO );
+    lapack.TRTRS ( UPLO, NOTRANS, NODIAG, primalNbDof, NBRHS, BtB, primalNbDof, fp, primalNbDof, INFO );
     ASSERT_PRE ( !INFO[0], "Lapack Computation fp = LB^{-1} rhs is not achieved." );
 
     /* Put in M_elvecHyb the vector BtC^T * fp + localVectorHybrid =
        C^T * A^{-1} * [ B^T * ( B^T * A^{-1} * B + elmatReactionTerm )^{-1} * ( B^T * A^{-1} + Fp ) - Fv ]
        localVectorHybrid is fully stored.
        For more details see http://www.netlib.org/blas/dgemm.f */
-    blas.GEMM ( TRANS, NOTRANS, hybridNbDof, NBRHS, primalNbDof, ONE, BtC, primalNbDof, fp, NBRHS, ONE,
+    blas.GEMM ( TRANS, NOTRANS, hybridNbDof, NBRHS, primalNbDof, ONE, BtC, primalNbDof, fp, primalNbDof, ONE,
                 localVectorHybrid, hybridNbDof );
 
     //! End of vector operations.
 
-    /* Previously the matrix CtC is stored only in the lower part, but at the moment there is not
-       a function assembleMatrix that store a lower triangular sparse matrix.
-       Remind to correct these line in the future. */
-    symmetrizeMatrix ( hybridNbDof, CtC );
-
     // Update the hybrid element matrix.
-    localMatrixHybrid.block (0, 0) = CtC;
+    for ( Int j ( 0 ); j < hybridNbDof; ++j )
+        for ( Int i ( 0 ); i < hybridNbDof; ++i )
+        {
+            localMatrixHybrid.block ( 0, 0 ) ( i, j ) = CtC[ i + j * hybridNbDof ];
+        }
 
 } // staticCondensation
 
@@ -1449,8 +1640,7 @@ template < typename MeshType >
 void
 DarcySolverLinear < MeshType >::
 localComputePrimalAndDual ( VectorElemental& localSolution,
-                            MatrixElemental& elmatMix,
-                            MatrixElemental& elmatReactionTerm,
+                            const Real* localFactors,
                             VectorElemental& elvecMix )
 {
 
@@ -1475,7 +1665,6 @@ localComputePrimalAndDual ( VectorElemental& localSolution,
 
     const Real ONE = 1.0;
     const Real MINUSONE = -1.0;
-    const Real ZERO = 0.0;
 
     // Parameter that indicate the Lower storage of matrices.
     const char UPLO = 'L';
@@ -1485,78 +1674,21 @@ localComputePrimalAndDual ( VectorElemental& localSolution,
     // Parameter that indicates whether the matrix has diagonal unit ('N' means no)
     const char NODIAG = 'N';
 
-    // No need for CtC in this part, and last dsyrk, the only differences.
-    MatrixElemental::matrix_type A = elmatMix.block ( 0, 0 );
-    MatrixElemental::matrix_type B = elmatMix.block ( 0, 1 );
-    MatrixElemental::matrix_type C = elmatMix.block ( 0, 2 );
-
-    VectorElemental::super fv = elvecMix.block ( 0 );
-    VectorElemental::super fp = elvecMix.block ( 1 );
-
-    // Matrix Operations
-
-    // Create local matrices.
-    MatrixElemental::matrix_type BtB ( primalNbDof, primalNbDof );
-    MatrixElemental::matrix_type BtC ( primalNbDof, hybridNbDof );
-
-    // Clean the local matrices.
-    BtB *= 0.;
-    BtC *= 0.;
-
-    // Matrix Operations
-
-    /* Put in A the matrix L and L^T, where L and L^T is the Cholesky factorization of A.
-       For more details see http://www.netlib.org/lapack/double/dpotrf.f */
-    lapack.POTRF ( UPLO, dualNbDof, A, dualNbDof, INFO );
-    ASSERT_PRE ( !INFO[0], "Lapack factorization of A is not achieved." );
-
-    /* Put in B the matrix L^{-1} * B, solving a triangular system.
-       For more details see http://www.netlib.org/lapack/lapack-3.1.1/SRC/dtrtrs.f */
-    lapack.TRTRS ( UPLO, NOTRANS, NODIAG, dualNbDof, primalNbDof, A, dualNbDof, B, dualNbDof, INFO );
-    ASSERT_PRE ( !INFO[0], "Lapack Computation B = L^{-1} B  is not achieved." );
-
-    /* Put in C the matrix L^{-1} * C, solving a triangular system.
-       For more details see http://www.netlib.org/lapack/lapack-3.1.1/SRC/dtrtrs.f */
-    lapack.TRTRS ( UPLO, NOTRANS, NODIAG, dualNbDof, hybridNbDof, A, dualNbDof, C, dualNbDof, INFO );
-    ASSERT_PRE ( !INFO[0], "Lapack Computation C = L^{-1} C  is not achieved." );
-
-    /* Put in BtB the matrix  B^T * L^{-T} * L^{-1} * B = B^T * A^{-1} * B
-       BtB stored only on lower part.
-       For more details see http://www.netlib.org/slatec/lin/dsyrk.f */
-    blas.SYRK ( UPLO, TRANS, primalNbDof, dualNbDof, ONE, B, dualNbDof, ZERO, BtB, primalNbDof );
-
-    /* Put in BtB the matrix
-       BtB + elmatReactionTerm = B^T * A^{-1} * B + elmatReactionTerm
-       BtB stored only on lower part. */
-    BtB += elmatReactionTerm.mat();
-
-    /* Put in BtC the matrix B^T * L^{-T} * L^{-1} * C = B^T * A^{-1} * C
-       BtC fully stored.
-       For more details see http://www.netlib.org/blas/dgemm.f */
-    blas.GEMM ( TRANS, NOTRANS, primalNbDof, hybridNbDof, dualNbDof, ONE, B, dualNbDof, C,
-                dualNbDof, ZERO, BtC, primalNbDof );
-
-    /* Put in BtB the matrix LB and LB^T where LB and LB^T is the cholesky
-       factorization of B^T * A^{-1} * B + elmatReactionTerm.
-       For more details see http://www.netlib.org/lapack/double/dpotrf.f */
-    lapack.POTRF ( UPLO, primalNbDof, BtB, primalNbDof, INFO );
-    ASSERT_PRE ( !INFO[0], "Lapack factorization of BtB is not achieved." );
-
-    /* Put in BtC the matrix LB^{-1} * BtC = LB^{-1} * B^T * A^{-1} * C.
-       For more details see http://www.netlib.org/lapack/lapack-3.1.1/SRC/dtrtrs.f */
-    lapack.TRTRS ( UPLO, NOTRANS, NODIAG, primalNbDof, hybridNbDof, BtB, primalNbDof, BtC, primalNbDof, INFO );
-    ASSERT_PRE ( !INFO[0], "Lapack Computation BtC = LB^{-1} BtC is not achieved." );
-
-    //! End of matrix operations.
-
-    /* Sum up of the previews steps
+    /* Local factors computed by localMatrixFactorization, no need for CtC in this part.
        A stores L and L^T where L and L^T is the Cholesky factorization of A
        B stores L^{-1} * B
        C stores L^{-1} * C
        BtB stores LB and LB^T where LB and LB^T is the factorization of
              B^T * A^{-1} * B + elmatReactionTerm
-       BtC stores LB^{-1} * B^T * A^{-1} * C
-     */
+       BtC stores LB^{-1} * B^T * A^{-1} * C */
+    const Real* A   = localFactors;
+    const Real* B   = A + dualNbDof * dualNbDof;
+    const Real* C   = B + dualNbDof * primalNbDof;
+    const Real* BtB = C + dualNbDof * hybridNbDof;
+    const Real* BtC = BtB + primalNbDof * primalNbDof;
+
+    VectorElemental::super fv = elvecMix.block ( 0 );
+    VectorElemental::super fp = elvecMix.block ( 1 );
 
     //! Vector operations, computation of primal and dual variable.
 
@@ -1573,7 +1705,7 @@ localComputePrimalAndDual ( VectorElemental& localSolution,
     /* Put in fp the vector B^T * L^{-T} * fv + fp =  B^T * A^{-1} * fv + fp
        fp fully stored.
        For more details see http://www.netlib.org/blas/dgemm.f */
-    blas.GEMM ( TRANS, TRANS, primalNbDof, NBRHS, dualNbDof, ONE, B, dualNbDof, fv, NBRHS, ONE, fp, NBRHS );
+    blas.GEMM ( TRANS, NOTRANS, primalNbDof, NBRHS, dualNbDof, ONE, B, dualNbDof, fv, dualNbDof, ONE, fp, primalNbDof );
 
     /* Put in fp the vector LB^{-1} * fp = LB^{-1} * ( B^T * A^{-1} * fv + fp )
        For more details see http://www.netlib.org/lapack/lapack-3.1.1/SRC/dtrtrs.f */
@@ -1610,7 +1742,7 @@ localComputePrimalAndDual ( VectorElemental& localSolution,
     /* Put in localDual the vector - C * localHybrid - localDual =
        = - L^{-1} * ( C * lambda_K + B^T * primal_K - fv )
        For more details see http://www.netlib.org/slatec/lin/dgemv.f */
-    blas.GEMV ( NOTRANS, dualNbDof, hybridNbDof, MINUSONE, C, hybridNbDof, localSolution.block ( 2 ),
+    blas.GEMV ( NOTRANS, dualNbDof, hybridNbDof, MINUSONE, C, dualNbDof, localSolution.block ( 2 ),
                 MINUSONE, localSolution.block ( 0 ) );
 
     /* Put in localDual the vector L^{-T} * localDual =
@@ -349,6 +349,14 @@ protected:
     //! @name Protected methods
     //@{
 
+    //! Perform all the operations before doing the loop on volume elements.
+    /*!
+      Call the Darcy solver preLoopElementsComputation method and invalidate the
+      stored local factors if the time step or the time scheme coefficient, which
+      scale the mass term in the local matrices, changed since their computation.
+    */
+    virtual void preLoopElementsComputation ();
+
     //! Compute element matrices
     /*!
       Call the Darcy solver localMatrixComputation method and
@@ -437,6 +445,9 @@ private:
     //! Local mass matrices.
     matrixElementalContainer_Type M_localMassMatrix;
 
+    //! Coefficient of the mass term, alpha_0 / dt, in the stored local factors.
+    Real M_localFactorsMassCoefficient;
+
     //@}
 
     // Algebraic stuff
@@ -469,6 +480,7 @@ DarcySolverTransient () :
     darcySolverLinear_Type::DarcySolverLinear (),
     // Time advance data.
     M_timeAdvance                 ( new timeAdvance_Type ),
+    M_localFactorsMassCoefficient ( 0. ),
     // Linear solver.
     M_reusePrec                   ( false ),
     M_updated                     ( false ),
@@ -575,6 +587,9 @@ setMass ( const scalarFctPtr_Type& massFct )
     // Save the mass function.
     M_massFct = massFct;
 
+    // The local matrices depend on the mass term.
+    this->M_localFactorsUpdated = false;
+
     // The total number of elements in the mesh.
     const UInt meshNumberOfElements = this->M_primalField->getFESpace().mesh()->numElements();
 
@@ -617,6 +632,27 @@ setMass ( const scalarFctPtr_Type& massFct )
 
 } // setMass
 
+// Invalidate the local factors if the coefficient of the mass term changed.
+template < typename MeshType >
+void
+DarcySolverTransient < MeshType >::
+preLoopElementsComputation ()
+{
+    // Call the Darcy solver preLoopElementsComputation.
+    darcySolverLinear_Type::preLoopElementsComputation ();
+
+    // The local matrices contain the mass matrix scaled by alpha_0 / dt.
+    const Real massCoefficient = M_timeAdvance->coefficientFirstDerivative ( 0 ) /
+                                 this->M_data->dataTimePtr()->timeStep();
+
+    if ( massCoefficient != M_localFactorsMassCoefficient )
+    {
+        this->M_localFactorsUpdated = false;
+        M_localFactorsMassCoefficient = massCoefficient;
+    }
+
+} // preLoopElementsComputation
+
 // Call the Darcy solver localMatrixComputation method and compute the mass matrix for the time dependent term.
 template < typename MeshType >
 void
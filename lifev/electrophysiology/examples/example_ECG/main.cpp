@@ -95,10 +95,7 @@
 //--------------------------------------------------------
 // For the pseudo- ECG
 //--------------------------------------------------------
-#include <lifev/electrophysiology/examples/example_ECG/Norm.hpp>
-#include <lifev/core/solver/ADRAssembler.hpp>
-#include <lifev/core/algorithm/LinearSolver.hpp>
-#include <lifev/core/algorithm/PreconditionerML.hpp>
+#include <lifev/electrophysiology/util/ElectroECG.hpp>
 
 // ---------------------------------------------------------------
 // The most important file to include is the Integrate.hpp file
@@ -223,10 +220,6 @@ Int main ( Int argc, char** argv )
                                         const ID&   /*i*/ ) >   function_Type;
         typedef VectorEpetra                        vector_Type;
         typedef MatrixEpetra<Real>                  matrix_Type;
-        typedef LifeV::Preconditioner               basePrec_Type;
-        typedef std::shared_ptr<basePrec_Type>    basePrecPtr_Type;
-        typedef LifeV::PreconditionerML             prec_Type;
-        typedef std::shared_ptr<prec_Type>        precPtr_Type;
         typedef ElectroETAMonodomainSolver< mesh_Type, IonicMinimalModel >        monodomainSolver_Type;
         typedef std::shared_ptr< monodomainSolver_Type >                        monodomainSolverPtr_Type;
 
@@ -533,44 +526,6 @@ Int main ( Int argc, char** argv )
                 }
             }
         }
-        //*******************************************//
-        // Setting up the pseudo-ECG                 //
-        //*******************************************//
-        Real ecg_position_X = monodomainList.get ("ecg_position_X", 1.);
-        Real ecg_position_Y = monodomainList.get ("ecg_position_Y", 1.);
-        Real ecg_position_Z = monodomainList.get ("ecg_position_Z", 0.5);
-        vector_Type ecgDistance = (* (splitting->globalSolution().at (0) ) ) ;
-        ecgDistance *= 0.;
-        FESpacePtr->interpolate ( static_cast<function_Type> ( Norm::f ), ecgDistance, 0.0 );
-        Norm::setPosition ( ecg_position_X , ecg_position_Y , ecg_position_Z ); // Set electrode position
-
-        Real pseudoEcgReal (0.);
-        Real Global_pseudoEcgReal (0.);
-        vector_Type solutionLaplacian = ( (* (splitting->globalSolution().at (0) ) ) );
-        vector_Type pseudoEcgVec = ( (* (splitting->globalSolution().at (0) ) ) );
-
-        // Discrete Laplacian matrix
-        // setting up the assembler
-        ADRAssembler<mesh_Type, matrix_Type, vector_Type> adrAssembler;
-        adrAssembler.setup ( FESpacePtr, FESpacePtr );
-        // define the matrices
-        std::shared_ptr<matrix_Type> systemMatrixL ( new matrix_Type ( FESpacePtr->map() ) );
-        std::shared_ptr<matrix_Type> systemMatrixM ( new matrix_Type ( FESpacePtr->map() ) );
-        std::shared_ptr<vector_Type> rhs_Laplacian ( new vector_Type ( FESpacePtr->map() ) );
-        std::shared_ptr<vector_Type> pseudoEcgVec_ptr ( new vector_Type ( FESpacePtr->map() ) );
-
-        // fill the matrix
-        adrAssembler.addDiffusion ( systemMatrixL, -1.0 );
-        adrAssembler.addMass ( systemMatrixM, 1.0 );
-        // closed
-        systemMatrixL->globalAssemble();
-        systemMatrixM->globalAssemble();
-
-        // uncomment to check the matrices with MATLAB
-        //    matrix_Type LaplacianMatrix ( *systemMatrixL );
-        //    matrix_Type MassMatrix ( *systemMatrixM );
-        //    LaplacianMatrix.spy("matriceL_check");
-        //    MassMatrix.spy("matriceM_check");
         //********************************************//
         // Setting up the time data                   //
         //********************************************//
@@ -593,6 +548,21 @@ Int main ( Int argc, char** argv )
         splitting -> setupStiffnessMatrix();
         splitting -> setupGlobalMatrix();
 
+        //*******************************************//
+        // Setting up the pseudo-ECG                 //
+        //*******************************************//
+        Real ecg_position_X = monodomainList.get ("ecg_position_X", 1.);
+        Real ecg_position_Y = monodomainList.get ("ecg_position_Y", 1.);
+        Real ecg_position_Z = monodomainList.get ("ecg_position_Z", 0.5);
+
+        // ecg_output.txt contains phi_e = 1/(4 pi) int D grad(Vm) . grad(1/r), see ElectroECG.
+        // The former output was the nodal sum of Lapl(Vm)/r, with an isotropic Laplacian: it had
+        // the opposite sign, no 1/(4 pi) factor and it scaled with the number of nodes.
+        ElectroECG<mesh_Type> pseudoEcg ( FESpacePtr );
+        pseudoEcg.addElectrode ( Vector3D ( ecg_position_X, ecg_position_Y, ecg_position_Z ) );
+        pseudoEcg.setup ( splitting->stiffnessMatrixPtr() );
+        std::vector<Real> pseudoEcgValues;
+
         //********************************************//
         // Creating exporters to save the solution    //
         //********************************************//
@@ -619,34 +589,6 @@ Int main ( Int argc, char** argv )
 
         std::ofstream output  ("ecg_output.txt");
 
-        //**************************************************//
-        // Solver initialization for the discrete Laplacian //
-        //**************************************************//
-        if (  Comm->MyPID() == 0 )
-        {
-            std::cout << std::endl << "[Solvers initialization]" << std::endl;
-        }
-        prec_Type* precRawPtr;
-        basePrecPtr_Type precPtr;
-        precRawPtr = new prec_Type;
-        precRawPtr->setDataFromGetPot ( dataFile, "prec" );
-        precPtr.reset ( precRawPtr );
-        if (  Comm->MyPID() == 0 )
-        {
-            std::cout << "Setting up LinearSolver (Belos)... " << std::flush;
-        }
-        Teuchos::RCP< Teuchos::ParameterList > belosList2 = Teuchos::rcp ( new Teuchos::ParameterList );
-        belosList2 = Teuchos::getParametersFromXmlFile ( "SolverParamList2.xml" );
-        LinearSolver linearSolver2;
-        linearSolver2.setCommunicator ( Comm );
-        linearSolver2.setParameters ( *belosList2 );
-        linearSolver2.setPreconditioner ( precPtr );
-        if (  Comm->MyPID() == 0 )
-        {
-            std::cout << "done" << std::endl;
-        }
-        linearSolver2.showMe();
-
         //********************************************//
         // Solving the system                         //
         //********************************************//
@@ -674,12 +616,6 @@ Int main ( Int argc, char** argv )
 
                 // APD calculation
                 previouspotential = (* (splitting->globalSolution().at (0) ) );
-                //--------------------------------------
-                // ECG initialization
-                pseudoEcgReal = 0.;
-                pseudoEcgVec_ptr.reset ( new vector_Type ( FESpacePtr->map(), Unique ) );
-                rhs_Laplacian.reset ( new vector_Type ( FESpacePtr->map(), Unique ) );
-                //-----------------------------------------------------------------
 
                 control = 0;
 
@@ -729,15 +665,6 @@ Int main ( Int argc, char** argv )
                 }
                 nbTimeStep++;
 
-                // ECG : discrete laplacian of the solution
-                (*rhs_Laplacian) = (*systemMatrixL) * (* (splitting->globalSolution().at (0) ) );
-
-                linearSolver2.setOperator ( systemMatrixM );
-                linearSolver2.setRightHandSide ( rhs_Laplacian );
-                linearSolver2.solve ( pseudoEcgVec_ptr );
-
-                pseudoEcgVec = (*pseudoEcgVec_ptr) / ecgDistance;
-
                 //      // APD calculation
                 for (int i = 0; i <= sz - 1; i++)
                 {
@@ -754,19 +681,17 @@ Int main ( Int argc, char** argv )
                             delta_apd[i] = (trep - tact[i]) - apd[i];
                             apd[i] = trep - tact[i];
                         }
-
-                        //          // Pseudo-ECG summation
-                        pseudoEcgReal += pseudoEcgVec[i];
                     }
                 }
                 *APDptr = apd;
                 *DELTA_APDptr = delta_apd;
 
-                MPI_Allreduce (&pseudoEcgReal, &Global_pseudoEcgReal, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD); // rapporte a une variable connue de tous les procs
+                // ECG : lead-field weights applied to the potential
+                pseudoEcg.compute ( * (splitting->globalSolution().at (0) ), pseudoEcgValues );
 
                 if (  Comm->MyPID() == 0 )
                 {
-                    output << Global_pseudoEcgReal << "\n";
+                    output << pseudoEcgValues[0] << "\n";
                 }
             }
         }
@@ -36,6 +36,8 @@
   @last update 04 - 2014
  */
 
+#include <cmath>
+
 #include <lifev/electrophysiology/solver/IonicModels/ElectroIonicModel.hpp>
 
 
@@ -51,7 +53,12 @@ ElectroIonicModel::ElectroIonicModel() :
     M_membraneCapacitance (1.),
     M_appliedCurrent    (0.),
     M_appliedCurrentPtr(),
-    M_pacingProtocol ()
+    M_pacingProtocol (),
+    M_lookupTable (),
+    M_lookupTableMinPotential (0.),
+    M_lookupTableInverseStep (0.),
+    M_lookupTableNumberOfCells (0),
+    M_lookupTableNumberOfFunctions (0)
 {
 }
 
@@ -62,7 +69,12 @@ ElectroIonicModel::ElectroIonicModel ( int n ) :
     M_membraneCapacitance (1.),
     M_appliedCurrent    (0.),
     M_appliedCurrentPtr(),
-    M_pacingProtocol ()
+    M_pacingProtocol (),
+    M_lookupTable (),
+    M_lookupTableMinPotential (0.),
+    M_lookupTableInverseStep (0.),
+    M_lookupTableNumberOfCells (0),
+    M_lookupTableNumberOfFunctions (0)
 {
 }
 
@@ -73,7 +85,12 @@ ElectroIonicModel::ElectroIonicModel ( int n, int g ) :
     M_membraneCapacitance (1.),
     M_appliedCurrent    (0.),
     M_appliedCurrentPtr(),
-    M_pacingProtocol ()
+    M_pacingProtocol (),
+    M_lookupTable (),
+    M_lookupTableMinPotential (0.),
+    M_lookupTableInverseStep (0.),
+    M_lookupTableNumberOfCells (0),
+    M_lookupTableNumberOfFunctions (0)
 {
 }
 
@@ -83,7 +100,12 @@ ElectroIonicModel::ElectroIonicModel ( const ElectroIonicModel& Ionic ) :
     M_restingConditions ( Ionic.restingConditions() ),
     M_membraneCapacitance ( Ionic.M_membraneCapacitance ),
     M_appliedCurrent    ( Ionic.M_appliedCurrent ),
-    M_pacingProtocol (Ionic.M_pacingProtocol)
+    M_pacingProtocol (Ionic.M_pacingProtocol),
+    M_lookupTable ( Ionic.M_lookupTable ),
+    M_lookupTableMinPotential ( Ionic.M_lookupTableMinPotential ),
+    M_lookupTableInverseStep ( Ionic.M_lookupTableInverseStep ),
+    M_lookupTableNumberOfCells ( Ionic.M_lookupTableNumberOfCells ),
+    M_lookupTableNumberOfFunctions ( Ionic.M_lookupTableNumberOfFunctions )
 {
     if (Ionic.M_appliedCurrentPtr)
     {
@@ -106,10 +128,84 @@ ElectroIonicModel& ElectroIonicModel::operator = ( const ElectroIonicModel& Ioni
         M_appliedCurrentPtr = Ionic.M_appliedCurrentPtr;
     }
     M_pacingProtocol = Ionic.M_pacingProtocol;
+    M_lookupTable = Ionic.M_lookupTable;
+    M_lookupTableMinPotential = Ionic.M_lookupTableMinPotential;
+    M_lookupTableInverseStep = Ionic.M_lookupTableInverseStep;
+    M_lookupTableNumberOfCells = Ionic.M_lookupTableNumberOfCells;
+    M_lookupTableNumberOfFunctions = Ionic.M_lookupTableNumberOfFunctions;
 
     return      *this;
 }
 
+void ElectroIonicModel::setupLookupTable ( const Real minPotential, const Real maxPotential, const Real step )
+{
+    ASSERT ( maxPotential > minPotential && step > 0., "Invalid range of the lookup table" );
+
+    clearLookupTable();
+
+    const UInt numberOfFunctions ( numberOfTabulatedFunctions() );
+    if ( numberOfFunctions == 0 )
+    {
+        return;
+    }
+
+    const UInt numberOfCells ( static_cast<UInt> ( std::ceil ( ( maxPotential - minPotential ) / step ) ) );
+    const Real gridStep ( ( maxPotential - minPotential ) / numberOfCells );
+
+    // The table is filled by direct evaluations, since it is still empty
+    std::vector<Real> table ( ( numberOfCells + 1 ) * numberOfFunctions );
+    for ( UInt node (0); node <= numberOfCells; ++node )
+    {
+        computeRegularizedTabulatedFunctions ( minPotential + node * gridStep, gridStep,
+                                               &table[ node * numberOfFunctions ] );
+    }
+
+    M_lookupTable.swap ( table );
+    M_lookupTableMinPotential = minPotential;
+    M_lookupTableInverseStep = 1. / gridStep;
+    M_lookupTableNumberOfCells = numberOfCells;
+    M_lookupTableNumberOfFunctions = numberOfFunctions;
+}
+
+void ElectroIonicModel::clearLookupTable()
+{
+    M_lookupTable.clear();
+    M_lookupTableMinPotential = 0.;
+    M_lookupTableInverseStep = 0.;
+    M_lookupTableNumberOfCells = 0;
+    M_lookupTableNumberOfFunctions = 0;
+}
+
+Real ElectroIonicModel::verifyLookupTable()
+{
+    if ( !hasLookupTable() )
+    {
+        return 0.;
+    }
+
+    const UInt numberOfFunctions ( M_lookupTableNumberOfFunctions );
+    const Real gridStep ( 1. / M_lookupTableInverseStep );
+    std::vector<Real> interpolated ( numberOfFunctions );
+    std::vector<Real> exact ( numberOfFunctions );
+
+    Real maxError (0.);
+    for ( UInt cell (0); cell < M_lookupTableNumberOfCells; ++cell )
+    {
+        const Real V ( M_lookupTableMinPotential + ( cell + 0.5 ) * gridStep );
+
+        evaluateTabulatedFunctions ( V, &interpolated[0] );
+        computeRegularizedTabulatedFunctions ( V, gridStep, &exact[0] );
+
+        for ( UInt i (0); i < numberOfFunctions; ++i )
+        {
+            const Real error ( std::abs ( interpolated[i] - exact[i] ) / std::max ( 1., std::abs ( exact[i] ) ) );
+            maxError = std::max ( maxError, error );
+        }
+    }
+
+    return maxError;
+}
+
 std::vector< std::vector<Real> > ElectroIonicModel::getJac (const std::vector<Real>& v, Real h)
 {
     std::vector< std::vector<Real> > J ( M_numberOfEquations, std::vector<Real> (M_numberOfEquations, 0.0) );
@@ -515,6 +611,32 @@ void ElectroIonicModel::initialize ( std::vector<vectorPtr_Type>& v )
     }
 }
 
+// ===================================================
+//! Private Methods
+// ===================================================
+void ElectroIonicModel::computeRegularizedTabulatedFunctions ( const Real V, const Real step, Real* values )
+{
+    computeTabulatedFunctions ( V, values );
+
+    // Rates like x / ( exp(x) - 1 ) are 0/0 at isolated potentials, which may be nodes of the grid,
+    // and suffer from cancellation close to them: there the value is replaced by the mean of the
+    // values on both sides, which are accurate and differ from the smooth function by O(shift^2)
+    const UInt numberOfFunctions ( numberOfTabulatedFunctions() );
+    const Real shift ( 1.e-3 * step );
+    std::vector<Real> left ( numberOfFunctions );
+    std::vector<Real> right ( numberOfFunctions );
+    computeTabulatedFunctions ( V - shift, &left[0] );
+    computeTabulatedFunctions ( V + shift, &right[0] );
+
+    for ( UInt i (0); i < numberOfFunctions; ++i )
+    {
+        const Real mean ( 0.5 * ( left[i] + right[i] ) );
+        if ( !std::isfinite ( values[i] ) || std::abs ( values[i] - mean ) > 1.e-6 * std::max ( 1., std::abs ( mean ) ) )
+        {
+            values[i] = mean;
+        }
+    }
+}
 
 }
 
@@ -170,6 +170,41 @@ public:
      */
     virtual void setup( Teuchos::ParameterList& parameterList) { }
 
+    //! Tabulate the functions of the potential used by the gating variables
+    /*!
+     *  The steady states and time constants (or the opening and closing rates) of the
+     *  gating variables depend only on the potential: the models that support it
+     *  (see numberOfTabulatedFunctions) evaluate them once on a uniform grid of the
+     *  potential and then interpolate linearly in computeGatingRhs and
+     *  computeGatingVariablesWithRushLarsen. Outside of the range of the table the
+     *  functions are evaluated directly.
+     *  The table has to be set up again if the parameters of the model change.
+     *  Nothing is done if the model does not support the lookup table.
+     *
+     * @param minPotential lower bound of the table
+     * @param maxPotential upper bound of the table
+     * @param step spacing of the grid, rounded down so that the grid fits the range
+     */
+    void setupLookupTable ( const Real minPotential, const Real maxPotential, const Real step );
+
+    //! Remove the lookup table: the functions of the potential are evaluated directly
+    void clearLookupTable();
+
+    //! Compare the lookup table with the direct evaluation of the functions
+    /*!
+     *  The functions are evaluated at the midpoints of the cells of the grid, where
+     *  the interpolation error is the largest.
+     *
+     * @return maximum over the functions and the midpoints of |interpolated - exact| / max( 1, |exact| )
+     */
+    Real verifyLookupTable();
+
+    //! returns true if the functions of the potential are interpolated in a lookup table
+    inline bool hasLookupTable() const
+    {
+        return !M_lookupTable.empty();
+    }
+
     //! returns the number of equations of the ionic model
     /*!
      * @param
@@ -537,6 +572,52 @@ public:
 
 protected:
 
+    //! @name Lookup table of the functions of the potential
+    //@{
+
+    //! Number of functions of the potential which can be tabulated, 0 if the model does not support the lookup table
+    virtual UInt numberOfTabulatedFunctions() const
+    {
+        return 0;
+    }
+
+    //! Direct evaluation of the tabulated functions
+    /*!
+     * @param V potential
+     * @param values array with numberOfTabulatedFunctions() entries
+     */
+    virtual void computeTabulatedFunctions ( const Real /*V*/, Real* /*values*/ ) {}
+
+    //! Evaluation of the tabulated functions, interpolated in the lookup table if it has been set up
+    /*!
+     * @param V potential
+     * @param values array with numberOfTabulatedFunctions() entries
+     */
+    inline void evaluateTabulatedFunctions ( const Real V, Real* values )
+    {
+        const Real position ( ( V - M_lookupTableMinPotential ) * M_lookupTableInverseStep );
+
+        // Also catches NaN potentials and empty tables
+        if ( ! ( position >= 0. && position < M_lookupTableNumberOfCells ) )
+        {
+            computeTabulatedFunctions ( V, values );
+            return;
+        }
+
+        const UInt cell ( static_cast<UInt> ( position ) );
+        const Real weight ( position - cell );
+        const UInt numberOfFunctions ( M_lookupTableNumberOfFunctions );
+        const Real* left ( &M_lookupTable[ cell * numberOfFunctions ] );
+        const Real* right ( left + numberOfFunctions );
+
+        for ( UInt i (0); i < numberOfFunctions; ++i )
+        {
+            values[i] = left[i] + weight * ( right[i] - left[i] );
+        }
+    }
+
+    //@}
+
     //Number of equations in the model
     short int  M_numberOfEquations;
 
@@ -558,6 +639,19 @@ protected:
     //Function describing the pacing protocol of the model - NEEDS TO BE CONFIRMED
     function_Type M_pacingProtocol;
 
+    //Values of the tabulated functions of the potential, stored node by node
+    std::vector<Real> M_lookupTable;
+
+    //Grid of the lookup table
+    Real M_lookupTableMinPotential;
+    Real M_lookupTableInverseStep;
+    UInt M_lookupTableNumberOfCells;
+    UInt M_lookupTableNumberOfFunctions;
+
+private:
+
+    //! Direct evaluation of the tabulated functions, removing the 0/0 singularities of the rates
+    void computeRegularizedTabulatedFunctions ( const Real V, const Real step, Real* values );
 
 };
 
@@ -74,7 +74,8 @@ IonicHodgkinHuxley::IonicHodgkinHuxley ( Teuchos::ParameterList& parameterList
     M_restingConditions.at (3) = 0.596120753508460;
 }
 
-IonicHodgkinHuxley::IonicHodgkinHuxley ( const IonicHodgkinHuxley& model )
+IonicHodgkinHuxley::IonicHodgkinHuxley ( const IonicHodgkinHuxley& model ) :
+    super       ( model )
 {
 
     M_gNa        =  model.M_gNa;
@@ -96,6 +97,8 @@ IonicHodgkinHuxley::IonicHodgkinHuxley ( const IonicHodgkinHuxley& model )
 // ===================================================
 IonicHodgkinHuxley& IonicHodgkinHuxley::operator= ( const IonicHodgkinHuxley& model )
 {
+    super::operator= ( model );
+
     M_gNa        =  model.M_gNa;
     M_gK        =  model.M_gK;
     M_gL        =  model.M_gL;
@@ -124,12 +127,15 @@ void IonicHodgkinHuxley::computeGatingRhs ( const   std::vector<Real>&  v,
     Real N = v[2];
     Real H = v[3];
 
-    Real alpham = 0.1 * (25. - V) / (std::exp ( (25. - V) / 10.) - 1.);
-    Real betam = 4.*std::exp (-V / 18.0);
-    Real alphah = 0.07 * std::exp (-V / 20.);
-    Real betah = 1.0 / (std::exp ( (30. - V) / 10.) + 1.);
-    Real alphan = 0.01 * (10. - V) / (std::exp ( (10. - V) / 10.) - 1.);
-    Real betan = 0.125 * std::exp (-V / 80.0);
+    Real rates[6];
+    evaluateTabulatedFunctions (V, rates);
+
+    Real alpham = rates[0];
+    Real betam = rates[1];
+    Real alphan = rates[2];
+    Real betan = rates[3];
+    Real alphah = rates[4];
+    Real betah = rates[5];
 
     rhs[0] = alpham * (1 - M) - betam * M;
     rhs[1] = alphan * (1 - N) - betan * N;
@@ -170,12 +176,15 @@ void IonicHodgkinHuxley::computeGatingVariablesWithRushLarsen ( std::vector<Real
     Real N = v[2];
     Real H = v[3];
 
-    Real alpham = 0.1 * (25. - V) / (std::exp ( (25. - V) / 10.) - 1.);
-    Real betam = 4.*std::exp (-V / 18.0);
-    Real alphah = 0.07 * std::exp (-V / 20.);
-    Real betah = 1.0 / (std::exp ( (30. - V) / 10.) + 1.);
-    Real alphan = 0.01 * (10. - V) / (std::exp ( (10. - V) / 10.) - 1.);
-    Real betan = 0.125 * std::exp (-V / 80.0);
+    Real rates[6];
+    evaluateTabulatedFunctions (V, rates);
+
+    Real alpham = rates[0];
+    Real betam = rates[1];
+    Real alphan = rates[2];
+    Real betan = rates[3];
+    Real alphah = rates[4];
+    Real betah = rates[5];
 
     Real taum = alpham + betam;
     Real taun = alphan + betan;
@@ -191,6 +200,16 @@ void IonicHodgkinHuxley::computeGatingVariablesWithRushLarsen ( std::vector<Real
 
 }
 
+void IonicHodgkinHuxley::computeTabulatedFunctions ( const Real V, Real* values )
+{
+    values[0] = 0.1 * (25. - V) / (std::exp ( (25. - V) / 10.) - 1.);
+    values[1] = 4.*std::exp (-V / 18.0);
+    values[2] = 0.01 * (10. - V) / (std::exp ( (10. - V) / 10.) - 1.);
+    values[3] = 0.125 * std::exp (-V / 80.0);
+    values[4] = 0.07 * std::exp (-V / 20.);
+    values[5] = 1.0 / (std::exp ( (30. - V) / 10.) + 1.);
+}
+
 void IonicHodgkinHuxley::showMe()
 {
 
@@ -198,6 +198,22 @@ public:
 
     //@}
 
+protected:
+
+    //! @name Lookup table
+    //@{
+
+    //! The opening and closing rates of M, N and H
+    UInt numberOfTabulatedFunctions() const
+    {
+        return 6;
+    }
+
+    //! Compute alpham, betam, alphan, betan, alphah and betah
+    void computeTabulatedFunctions ( const Real V, Real* values );
+
+    //@}
+
 private:
     //! Model Parameters
 
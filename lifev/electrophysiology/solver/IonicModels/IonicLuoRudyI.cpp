@@ -112,7 +112,8 @@ IonicLuoRudyI::IonicLuoRudyI ( Teuchos::ParameterList& parameterList     )   :
     M_restingConditions.at (7) = parameterList.get ("Ca0", 2e-4  );
 }
 
-IonicLuoRudyI::IonicLuoRudyI ( const IonicLuoRudyI& model )
+IonicLuoRudyI::IonicLuoRudyI ( const IonicLuoRudyI& model ) :
+    super       ( model )
 {
     M_ENa        =  model.M_ENa;
     M_gNa        =  model.M_gNa;
@@ -137,6 +138,8 @@ IonicLuoRudyI::IonicLuoRudyI ( const IonicLuoRudyI& model )
 // ===================================================
 IonicLuoRudyI& IonicLuoRudyI::operator= ( const IonicLuoRudyI& model )
 {
+    super::operator= ( model );
+
     M_ENa        =  model.M_ENa;
     M_gNa        =  model.M_gNa;
     M_gsi        =  model.M_gsi;
@@ -172,18 +175,21 @@ void IonicLuoRudyI::computeGatingRhs ( const   std::vector<Real>&  v,
     Real X = v[6];
     Real Ca = v[7];
 
+    Real rates[12];
+    evaluateTabulatedFunctions (V, rates);
+
     //m
-    rhs[0] = dm (V, m);
+    rhs[0] = rates[0] * ( 1.0 - m ) - rates[1] * m;
     //h
-    rhs[1] = dh (V, h);
+    rhs[1] = rates[2] * ( 1.0 - h ) - rates[3] * h;
     //j
-    rhs[2] = dj (V, j);
+    rhs[2] = rates[4] * ( 1.0 - j ) - rates[5] * j;
     //d
-    rhs[3] = dd (V, d);
+    rhs[3] = rates[6] * ( 1.0 - d ) - rates[7] * d;
     //f
-    rhs[4] = df (V, f);
+    rhs[4] = rates[8] * ( 1.0 - f ) - rates[9] * f;
     //X
-    rhs[5] = dX (V, X);
+    rhs[5] = rates[10] * ( 1.0 - X ) - rates[11] * X;
     //Ca
     rhs[6] = dCa (V, d, f, Ca);
 }
@@ -240,15 +246,36 @@ void IonicLuoRudyI::computeGatingVariablesWithRushLarsen ( std::vector<Real>& v,
     Real f = v[5];
     Real X = v[6];
 
-    v[1] = minf (V) - ( minf (V) - m ) * std::exp (- dt / tm (V) );
-    v[2] = hinf (V) - ( hinf (V) - h ) * std::exp (- dt / th (V) );
-    v[3] = jinf (V) - ( jinf (V) - j ) * std::exp (- dt / tj (V) );
-    v[4] = dinf (V) - ( dinf (V) - d ) * std::exp (- dt / td (V) );
-    v[5] = finf (V) - ( finf (V) - f ) * std::exp (- dt / tf (V) );
-    v[6] = Xinf (V) - ( Xinf (V) - X ) * std::exp (- dt / tX (V) );
+    Real rates[12];
+    evaluateTabulatedFunctions (V, rates);
+
+    // The gate x relaxes to a / ( a + b ) with time constant 1 / ( a + b )
+    Real gates[6] = { m, h, j, d, f, X };
+    for ( UInt i (0); i < 6; ++i )
+    {
+        const Real tau = 1.0 / ( rates[2 * i] + rates[2 * i + 1] );
+        const Real inf = rates[2 * i] * tau;
+        v[i + 1] = inf - ( inf - gates[i] ) * std::exp (- dt / tau );
+    }
 
 }
 
+void IonicLuoRudyI::computeTabulatedFunctions ( const Real V, Real* values )
+{
+    values[0] = am (V);
+    values[1] = bm (V);
+    values[2] = ah (V);
+    values[3] = bh (V);
+    values[4] = aj (V);
+    values[5] = bj (V);
+    values[6] = ad (V);
+    values[7] = bd (V);
+    values[8] = af (V);
+    values[9] = bf (V);
+    values[10] = aX (V);
+    values[11] = bX (V);
+}
+
 Real IonicLuoRudyI::computeLocalPotentialRhs ( const std::vector<Real>& v )
 {
     Real dPotential (0.0);
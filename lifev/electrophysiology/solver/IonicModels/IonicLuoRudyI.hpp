@@ -509,6 +509,22 @@ public:
     //                           const Real timeStep )=0;
     //@}
 
+protected:
+
+    //! @name Lookup table
+    //@{
+
+    //! The opening and closing rates of m, h, j, d, f and X
+    UInt numberOfTabulatedFunctions() const
+    {
+        return 12;
+    }
+
+    //! Compute am, bm, ah, bh, aj, bj, ad, bd, af, bf, aX and bX
+    void computeTabulatedFunctions ( const Real V, Real* values );
+
+    //@}
+
 private:
     //! Model Parameters
 
@@ -346,7 +346,8 @@ IonicTenTusscher06::IonicTenTusscher06 ( Teuchos::ParameterList& parameterList
     M_restingConditions.at (18) = parameterList.get ("Rprime", 0.8978);
 }
 
-IonicTenTusscher06::IonicTenTusscher06 ( const IonicTenTusscher06& model )
+IonicTenTusscher06::IonicTenTusscher06 ( const IonicTenTusscher06& model ) :
+    super       ( model )
 {
     knak = model.knak;
     KmNa = model.KmNa;
@@ -426,6 +427,8 @@ IonicTenTusscher06::IonicTenTusscher06 ( const IonicTenTusscher06& model )
 // ===================================================
 IonicTenTusscher06& IonicTenTusscher06::operator= ( const IonicTenTusscher06& model )
 {
+    super::operator= ( model );
+
     knak = model.knak;
     KmNa = model.KmNa;
     KmK = model.KmK;
@@ -527,30 +530,33 @@ void IonicTenTusscher06::computeGatingRhs ( const   std::vector<Real>&  v,
     Real CaSR = v[17];
     Real RR = v[18];
 
+    Real gates[22];
+    evaluateTabulatedFunctions (V, gates);
+
     //m
-    rhs[0] = dM (V, m);
+    rhs[0] = (gates[0] - m) / gates[1];
     //h
-    rhs[1] = dH (V, h);
+    rhs[1] = (gates[2] - h) / gates[3];
     //j
-    rhs[2] = dJ (V, j);
+    rhs[2] = (gates[4] - j) / gates[5];
     //d
-    rhs[3] = dD (V, d);
+    rhs[3] = (gates[6] - d) / gates[7];
     //f
-    rhs[4] = dF (V, f);
+    rhs[4] = (gates[8] - f) / gates[9];
     //f2
-    rhs[5] = dF2 (V, f2);
+    rhs[5] = (gates[10] - f2) / gates[11];
     //fCass
     rhs[6] = dFCaSS (V, fcass);
     //r
-    rhs[7] = dR (V, r);
+    rhs[7] = (gates[12] - r) / gates[13];
     //s
-    rhs[8] = dS (V, s);
+    rhs[8] = (gates[14] - s) / gates[15];
     //Xr1
-    rhs[9] = dXr1 (V, xr1);
+    rhs[9] = (gates[16] - xr1) / gates[17];
     //Xr2
-    rhs[10] = dXr2 (V, xr2);
+    rhs[10] = (gates[18] - xr2) / gates[19];
     //Xs
-    rhs[11] = dXs (V, xs);
+    rhs[11] = (gates[20] - xs) / gates[21];
     //Nai
     rhs[12] = dNai (V, m, h, j, Nai, Cai);
     //Ki
@@ -663,6 +669,32 @@ Real IonicTenTusscher06::computeLocalPotentialRhs ( const std::vector<Real>& v)
 }
 
 
+void IonicTenTusscher06::computeTabulatedFunctions ( const Real V, Real* values )
+{
+    values[0] = M_INF (V);
+    values[1] = TAU_M (V);
+    values[2] = H_INF (V);
+    values[3] = TAU_H (V);
+    values[4] = J_INF (V);
+    values[5] = TAU_J (V);
+    values[6] = D_INF (V);
+    values[7] = TAU_D (V);
+    values[8] = F_INF (V);
+    values[9] = TAU_F (V);
+    values[10] = F2_INF (V);
+    values[11] = TAU_F2 (V);
+    values[12] = R_INF (V);
+    values[13] = TAU_R (V);
+    values[14] = S_INF (V);
+    values[15] = TAU_S (V);
+    values[16] = Xr1_INF (V);
+    values[17] = TAU_Xr1 (V);
+    values[18] = Xr2_INF (V);
+    values[19] = TAU_Xr2 (V);
+    values[20] = Xs_INF (V);
+    values[21] = TAU_Xs (V);
+}
+
 void IonicTenTusscher06::computeGatingVariablesWithRushLarsen ( std::vector<Real>& v, const Real dt )
 {
     Real V = v[0];
@@ -685,18 +717,21 @@ void IonicTenTusscher06::computeGatingVariablesWithRushLarsen ( std::vector<Real
     Real CaSR = v[17];
     Real RR = v[18];
 
-    v[1] = M_INF (V) - ( M_INF (V) - m ) * std::exp (- dt / TAU_M (V) );
-    v[2] = H_INF (V) - ( H_INF (V) - h ) * std::exp (- dt / TAU_H (V) );
-    v[3] = J_INF (V) - ( J_INF (V) - j ) * std::exp (- dt / TAU_J (V) );
-    v[4] = D_INF (V) - ( D_INF (V) - d ) * std::exp (- dt / TAU_D (V) );
-    v[5] = F_INF (V) - ( F_INF (V) - f ) * std::exp (- dt / TAU_F (V) );
-    v[6] = F2_INF (V) - ( F2_INF (V) - f2 ) * std::exp (- dt / TAU_F2 (V) );
+    Real gates[22];
+    evaluateTabulatedFunctions (V, gates);
+
+    v[1] = gates[0] - ( gates[0] - m ) * std::exp (- dt / gates[1] );
+    v[2] = gates[2] - ( gates[2] - h ) * std::exp (- dt / gates[3] );
+    v[3] = gates[4] - ( gates[4] - j ) * std::exp (- dt / gates[5] );
+    v[4] = gates[6] - ( gates[6] - d ) * std::exp (- dt / gates[7] );
+    v[5] = gates[8] - ( gates[8] - f ) * std::exp (- dt / gates[9] );
+    v[6] = gates[10] - ( gates[10] - f2 ) * std::exp (- dt / gates[11] );
     v[7] = FCaSS_INF (CaSS) - ( FCaSS_INF (CaSS) - fcass ) * std::exp ( -dt / TAU_FCaSS (CaSS) );
-    v[8] = R_INF (V) - ( R_INF (V) - r ) * std::exp (- dt / TAU_R (V) );
-    v[9] = S_INF (V) - ( S_INF (V) - s ) * std::exp (- dt / TAU_S (V) );
-    v[10] = Xr1_INF (V) - ( Xr1_INF (V) - xr1 ) * std::exp (- dt / TAU_Xr1 (V) );
-    v[11] = Xr2_INF (V) - ( Xr2_INF (V) - xr2 ) * std::exp (- dt / TAU_Xr2 (V) );
-    v[12] = Xs_INF (V) - ( Xs_INF (V) - xs ) * std::exp (- dt / TAU_Xs (V) );
+    v[8] = gates[12] - ( gates[12] - r ) * std::exp (- dt / gates[13] );
+    v[9] = gates[14] - ( gates[14] - s ) * std::exp (- dt / gates[15] );
+    v[10] = gates[16] - ( gates[16] - xr1 ) * std::exp (- dt / gates[17] );
+    v[11] = gates[18] - ( gates[18] - xr2 ) * std::exp (- dt / gates[19] );
+    v[12] = gates[20] - ( gates[20] - xs ) * std::exp (- dt / gates[21] );
     v[13] = solveNai (V, m, h, j, Nai, Cai, dt);
     v[14] = solveKi (V, r, s, xr1, xr2, xs, Nai, Ki, dt);
     v[15] =  solveCai (V, Nai, Cai, CaSR, CaSS, dt);
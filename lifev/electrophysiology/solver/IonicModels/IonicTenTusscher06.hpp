@@ -1208,6 +1208,21 @@ public:
         return flag;
     }
 
+protected:
+
+    //! @name Lookup table
+    //@{
+
+    //! The steady states and time constants of m, h, j, d, f, f2, r, s, Xr1, Xr2 and Xs
+    UInt numberOfTabulatedFunctions() const
+    {
+        return 22;
+    }
+
+    //! Compute the pairs ( X_INF, TAU_X ) of the gates depending only on the potential
+    void computeTabulatedFunctions ( const Real V, Real* values );
+
+    //@}
 
 private:
     //! Model Parameters
@@ -87,6 +87,21 @@ Int main ( Int argc, char** argv )
     //********************************************//
     ionicModel.showMe();
 
+    //********************************************//
+    // Check the lookup table of the rates: the   //
+    // time loop below uses the exact rates.      //
+    //********************************************//
+    std::cout << "Checking the lookup table of the rates...";
+    ionicModel.setupLookupTable (-50., 150., 0.05);
+    Real lookupTableError = ionicModel.verifyLookupTable();
+    ionicModel.clearLookupTable();
+    std::cout << " Error: " << lookupTableError << std::endl;
+    if ( lookupTableError > 1e-4 )
+    {
+        std::cout << "\nTest Failed!\n";
+        return EXIT_FAILURE;
+    }
+
     //********************************************//
     // Initialize the solution with the default   //
     // values                                     //
@@ -0,0 +1,244 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file main.cpp
+    @brief Test of ElectroECG against the discrete Laplacian pseudo-ECG
+
+    A depolarization front on the unit cube is seen from two electrodes. The
+    former pseudo-ECG of example_ECG solves M L = -K V for the discrete
+    Laplacian L of the potential and divides it by the distance from the
+    electrode. With an isotropic unit conductivity ElectroECG must return
+    -1/(4 pi sigma) sum_i (M L)_i / r_i, up to the tolerance of the mass solve.
+
+    @date 10-2026
+ */
+
+// ===================================================
+//! Includes
+// ===================================================
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+#include <cmath>
+#include <vector>
+
+#include <Teuchos_ParameterList.hpp>
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/array/MapEpetra.hpp>
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+#include <lifev/core/algorithm/LinearSolver.hpp>
+#include <lifev/core/fem/FESpace.hpp>
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/solver/ADRAssembler.hpp>
+
+#include <lifev/electrophysiology/util/ElectroECG.hpp>
+
+// ===================================================
+//! Namespaces & define
+// ===================================================
+
+using namespace LifeV;
+
+namespace
+{
+
+typedef RegionMesh<LinearTetra>                  mesh_Type;
+typedef FESpace<mesh_Type, MapEpetra>            feSpace_Type;
+typedef std::shared_ptr<feSpace_Type>          feSpacePtr_Type;
+typedef MatrixEpetra<Real>                       matrix_Type;
+typedef std::shared_ptr<matrix_Type>           matrixPtr_Type;
+typedef VectorEpetra                             vector_Type;
+typedef std::shared_ptr<vector_Type>           vectorPtr_Type;
+
+const Real S_extracellularConductivity = 2.;
+const Real S_solverTolerance = 1e-12;
+const Real S_tolerance = 1e-8;
+const Int  S_maxIterations = 200;
+
+// Depolarization front moving along x
+Real potential ( const Real& /*t*/, const Real& x, const Real& y, const Real& /*z*/, const ID& /*i*/ )
+{
+    return std::tanh ( ( x - 0.4 - 0.2 * y ) / 0.15 );
+}
+
+// Inverse of the distance from the electrode: the former example_ECG
+// interpolated the distance (Norm.hpp) and divided the nodal values by it
+class InverseDistance
+{
+public:
+    explicit InverseDistance ( const Vector3D& position ) :
+        M_position ( position )
+    {}
+
+    Real operator() ( const Real& /*t*/, const Real& x, const Real& y, const Real& z, const ID& /*i*/ ) const
+    {
+        return 1. / std::sqrt ( ( x - M_position[ 0 ] ) * ( x - M_position[ 0 ] )
+                                + ( y - M_position[ 1 ] ) * ( y - M_position[ 1 ] )
+                                + ( z - M_position[ 2 ] ) * ( z - M_position[ 2 ] ) );
+    }
+
+private:
+    Vector3D M_position;
+};
+
+}
+
+// ===================================================
+//! Main
+// ===================================================
+int main ( int argc, char** argv )
+{
+#ifdef HAVE_MPI
+    MPI_Init ( &argc, &argv );
+    std::shared_ptr<Epetra_Comm> comm ( new Epetra_MpiComm ( MPI_COMM_WORLD ) );
+#else
+    std::shared_ptr<Epetra_Comm> comm ( new Epetra_SerialComm );
+#endif
+
+    const bool verbose ( comm->MyPID() == 0 );
+    bool passed ( true );
+
+    {
+        // Unit cube with 10 x 10 x 10 cubes split in tetrahedra
+        std::shared_ptr<mesh_Type> fullMeshPtr ( new mesh_Type ( comm ) );
+        regularMesh3D ( *fullMeshPtr, 1, 10, 10, 10 );
+
+        std::shared_ptr<mesh_Type> localMeshPtr;
+        {
+            MeshPartitioner<mesh_Type> meshPartitioner;
+            meshPartitioner.doPartition ( fullMeshPtr, comm );
+            localMeshPtr = meshPartitioner.meshPartition();
+        }
+        fullMeshPtr.reset();
+
+        feSpacePtr_Type feSpace ( new feSpace_Type ( localMeshPtr, feTetraP1, quadRuleTetra4pt, quadRuleTria4pt, 1, comm ) );
+
+        vector_Type transmembranePotential ( feSpace->map(), Unique );
+        feSpace->interpolate ( static_cast<feSpace_Type::function_Type> ( potential ), transmembranePotential, 0. );
+
+        // Stiffness matrix with a unit conductivity, and mass matrix
+        ADRAssembler<mesh_Type, matrix_Type, vector_Type> adrAssembler;
+        adrAssembler.setup ( feSpace, feSpace );
+        matrixPtr_Type stiffnessMatrix ( new matrix_Type ( feSpace->map() ) );
+        matrixPtr_Type massMatrix ( new matrix_Type ( feSpace->map() ) );
+        adrAssembler.addDiffusion ( stiffnessMatrix, 1. );
+        adrAssembler.addMass ( massMatrix, 1. );
+        stiffnessMatrix->globalAssemble();
+        massMatrix->globalAssemble();
+
+        std::vector<Vector3D> electrodes;
+        electrodes.push_back ( Vector3D ( 1.5, 0.5, 0.5 ) );
+        electrodes.push_back ( Vector3D ( -0.3, 1.2, 0.8 ) );
+
+        ElectroECG<mesh_Type> pseudoEcg ( feSpace, S_extracellularConductivity );
+        for ( UInt e ( 0 ); e < electrodes.size(); ++e )
+        {
+            pseudoEcg.addElectrode ( electrodes[ e ] );
+        }
+        pseudoEcg.setup ( stiffnessMatrix );
+
+        std::vector<Real> values;
+        pseudoEcg.compute ( transmembranePotential, values );
+        passed &= values.size() == electrodes.size();
+
+        // Discrete Laplacian of the former example_ECG: M L = -K V
+        Teuchos::ParameterList solverList;
+        solverList.set ( "Solver Type", "Belos" );
+        solverList.set ( "Reuse Preconditioner", false );
+        solverList.set ( "Quit On Failure", false );
+        solverList.set ( "Silent", true );
+        Teuchos::ParameterList& operatorList ( solverList.sublist ( "Solver: Operator List" ) );
+        operatorList.set ( "Solver Manager Type", "BlockGmres" );
+        Teuchos::ParameterList& belosList ( operatorList.sublist ( "Trilinos: Belos List" ) );
+        belosList.set ( "Convergence Tolerance", S_solverTolerance );
+        belosList.set ( "Maximum Iterations", S_maxIterations );
+        belosList.set ( "Num Blocks", S_maxIterations );
+        belosList.set ( "Block Size", 1 );
+        belosList.set ( "Verbosity", 0 );
+
+        LinearSolver linearSolver;
+        linearSolver.setCommunicator ( comm );
+        linearSolver.setParameters ( solverList );
+        linearSolver.setOperator ( massMatrix );
+
+        vectorPtr_Type rhsLaplacian ( new vector_Type ( ( *stiffnessMatrix ) * transmembranePotential ) );
+        *rhsLaplacian *= -1.;
+        vectorPtr_Type laplacian ( new vector_Type ( feSpace->map(), Unique ) );
+        *laplacian = 0.;
+        linearSolver.setRightHandSide ( rhsLaplacian );
+        linearSolver.solve ( laplacian );
+
+        const vector_Type massLaplacian ( ( *massMatrix ) * ( *laplacian ) );
+
+        for ( UInt e ( 0 ); e < electrodes.size() && e < values.size(); ++e )
+        {
+            vector_Type inverseDistance ( feSpace->map(), Unique );
+            feSpace->interpolate ( InverseDistance ( electrodes[ e ] ), inverseDistance, 0. );
+
+            // Former nodal sum, and the same sum weighted by the mass matrix
+            const Real formerEcg ( laplacian->dot ( inverseDistance ) );
+            const Real weightedEcg ( massLaplacian.dot ( inverseDistance ) );
+            const Real expected ( - weightedEcg / ( 4. * M_PI * S_extracellularConductivity ) );
+
+            const Real error ( std::abs ( values[ e ] - expected ) / std::abs ( expected ) );
+            passed &= error < S_tolerance;
+
+            if ( verbose )
+            {
+                std::cout << "Electrode " << e << ": ElectroECG " << values[ e ]
+                          << ", from the discrete Laplacian " << expected
+                          << " (relative difference " << error << ")"
+                          << ", former nodal sum " << formerEcg << std::endl;
+            }
+        }
+    }
+
+    if ( verbose )
+    {
+        std::cout << ( passed ? "ElectroECG test passed" : "ElectroECG test FAILED" ) << std::endl;
+    }
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !passed )
+    {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,245 @@
+//@HEADER
+/*
+ *******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+ *******************************************************************************
+ */
+//@HEADER
+
+/*!
+    @file
+    @brief Pseudo-ECG on a set of virtual electrodes
+
+    @date 10-2026
+
+    The extracellular potential in an electrode placed at \f$x_e\f$ in an
+    infinite homogeneous volume conductor is
+
+    \f[
+    \phi_e(x_e) = \frac{1}{4 \pi \sigma_e} \int_\Omega D \nabla V_m \cdot \nabla \frac{1}{\|x - x_e\|} \, dx.
+    \f]
+
+    With the stiffness matrix \f$K_{ij} = \int_\Omega D \nabla \varphi_j \cdot \nabla \varphi_i\f$
+    of the monodomain problem and the interpolant \f$w\f$ of \f$1/\|x - x_e\|\f$, the integral
+    is \f$ w^T K V_m \f$. The lead-field weights \f$g = K^T w\f$ depend only on the geometry,
+    so that they are computed once and the pseudo-ECG of each time step is a dot product.
+ */
+
+#ifndef ELECTROECG_H
+#define ELECTROECG_H 1
+
+#include <cmath>
+#include <vector>
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+#include <lifev/core/array/VectorSmall.hpp>
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/MapEpetra.hpp>
+#include <lifev/core/fem/FESpace.hpp>
+
+namespace LifeV
+{
+
+//! ElectroECG - Pseudo-ECG on a set of virtual electrodes
+/*!
+  Usage:
+  <ol>
+  <li> add the electrodes with addElectrode, they must lie outside the tissue;
+  <li> call setup with the stiffness matrix of the monodomain problem, once it has been assembled;
+  <li> call compute at each output time.
+  </ol>
+
+  The weights of all the electrodes are stored in a dense block with one row per local dof,
+  so that compute reads the potential once for all the electrodes and needs a single reduction.
+  The leads (e.g. the 12 standard leads) are linear combinations of the electrode values.
+
+  The former pseudo-ECG of example_ECG was \f$\sum_i L_i / r_i\f$, where \f$M L = -K_I V_m\f$ is
+  the discrete Laplacian with the mass matrix \f$M\f$ and the stiffness matrix \f$K_I\f$ without
+  the diffusion tensor. When \f$D\f$ is the identity, the value of compute is
+  \f$-\frac{1}{4 \pi \sigma_e} \sum_i (M L)_i / r_i\f$: the sign is opposite, and the nodal
+  values of the Laplacian are weighted by the mass matrix instead of being summed, so that
+  the value does not grow with the number of nodes.
+ */
+template<typename Mesh>
+class ElectroECG
+{
+public:
+
+    //! @name Public Types
+    //@{
+
+    typedef Mesh                                     mesh_Type;
+    typedef VectorEpetra                             vector_Type;
+    typedef MatrixEpetra<Real>                       matrix_Type;
+    typedef std::shared_ptr<matrix_Type>           matrixPtr_Type;
+    typedef FESpace<mesh_Type, MapEpetra>            feSpace_Type;
+    typedef std::shared_ptr<feSpace_Type>          feSpacePtr_Type;
+
+    //@}
+
+    //! @name Constructors & Destructor
+    //@{
+
+    //! Constructor
+    /*!
+      @param feSpacePtr Finite element space of the transmembrane potential
+      @param extracellularConductivity Conductivity of the volume conductor
+     */
+    explicit ElectroECG ( const feSpacePtr_Type& feSpacePtr, const Real& extracellularConductivity = 1. ) :
+        M_feSpacePtr ( feSpacePtr ),
+        M_extracellularConductivity ( extracellularConductivity ),
+        M_numLocalEntries ( 0 )
+    {}
+
+    //! Destructor
+    virtual ~ElectroECG() {}
+
+    //@}
+
+    //! @name Methods
+    //@{
+
+    //! Add an electrode
+    /*!
+      @param position Position of the electrode
+      @return The index of the electrode
+     */
+    UInt addElectrode ( const Vector3D& position )
+    {
+        M_electrodes.push_back ( position );
+        M_weights.clear();
+        return M_electrodes.size() - 1;
+    }
+
+    //! Compute the lead-field weights of all the electrodes
+    /*!
+      @param stiffnessMatrixPtr Stiffness matrix of the monodomain problem (with the diffusion tensor)
+     */
+    void setup ( const matrixPtr_Type& stiffnessMatrixPtr );
+
+    //! Compute the pseudo-ECG of all the electrodes (collective call)
+    /*!
+      @param potential Transmembrane potential
+      @param values Values in the electrodes, the same on all the processes
+     */
+    void compute ( const vector_Type& potential, std::vector<Real>& values ) const;
+
+    //@}
+
+    //! @name Get Methods
+    //@{
+
+    //! Number of electrodes
+    UInt numElectrodes() const
+    {
+        return M_electrodes.size();
+    }
+
+    //! Position of the i-th electrode
+    const Vector3D& electrode ( const UInt& i ) const
+    {
+        return M_electrodes[ i ];
+    }
+
+    //@}
+
+private:
+
+    feSpacePtr_Type       M_feSpacePtr;
+    Real                  M_extracellularConductivity;
+    std::vector<Vector3D> M_electrodes;
+
+    //! Weights of the local entries: M_weights[ i * numElectrodes() + e ] for the entry i and the electrode e
+    std::vector<Real>     M_weights;
+    Int                   M_numLocalEntries;
+};
+
+// ===================================================
+// Methods
+// ===================================================
+
+template<typename Mesh>
+void ElectroECG<Mesh>::setup ( const matrixPtr_Type& stiffnessMatrixPtr )
+{
+    const UInt nbElectrodes ( numElectrodes() );
+
+    vector_Type inverseDistance ( M_feSpacePtr->map(), Unique );
+    vector_Type weights ( M_feSpacePtr->map(), Unique );
+
+    M_numLocalEntries = weights.epetraVector().MyLength();
+    M_weights.assign ( M_numLocalEntries * nbElectrodes, 0. );
+
+    for ( UInt e ( 0 ); e < nbElectrodes; ++e )
+    {
+        const Vector3D position ( M_electrodes[ e ] );
+        auto function = [position] ( const Real& /*t*/, const Real & x, const Real & y, const Real & z, const ID& /*i*/ )
+        {
+            return 1. / std::sqrt ( ( x - position[ 0 ] ) * ( x - position[ 0 ] )
+                                    + ( y - position[ 1 ] ) * ( y - position[ 1 ] )
+                                    + ( z - position[ 2 ] ) * ( z - position[ 2 ] ) );
+        };
+        M_feSpacePtr->interpolate ( function, inverseDistance, 0. );
+
+        stiffnessMatrixPtr->multiply ( true, inverseDistance, weights );
+
+        const Real* localWeights ( weights.epetraVector() [ 0 ] );
+        for ( Int i ( 0 ); i < M_numLocalEntries; ++i )
+        {
+            M_weights[ i * nbElectrodes + e ] = localWeights[ i ] / ( 4. * M_PI * M_extracellularConductivity );
+        }
+    }
+}
+
+template<typename Mesh>
+void ElectroECG<Mesh>::compute ( const vector_Type& potential, std::vector<Real>& values ) const
+{
+    if ( potential.mapType() != Unique )
+    {
+        compute ( vector_Type ( potential, Unique ), values );
+        return;
+    }
+
+    const UInt nbElectrodes ( numElectrodes() );
+    ASSERT ( M_weights.size() == static_cast<size_t> ( M_numLocalEntries ) * nbElectrodes, "ElectroECG: setup must be called after adding the electrodes" );
+    ASSERT ( potential.epetraVector().MyLength() == M_numLocalEntries, "ElectroECG: the potential does not match the map of the weights" );
+
+    std::vector<Real> localValues ( nbElectrodes, 0. );
+    const Real* localPotential ( potential.epetraVector() [ 0 ] );
+    for ( Int i ( 0 ); i < M_numLocalEntries; ++i )
+    {
+        const Real* weights ( &M_weights[ i * nbElectrodes ] );
+        for ( UInt e ( 0 ); e < nbElectrodes; ++e )
+        {
+            localValues[ e ] += weights[ e ] * localPotential[ i ];
+        }
+    }
+
+    values.assign ( nbElectrodes, 0. );
+    if ( nbElectrodes > 0 )
+    {
+        M_feSpacePtr->map().comm().SumAll ( &localValues[ 0 ], &values[ 0 ], nbElectrodes );
+    }
+}
+
+} // namespace LifeV
+
+#endif // ELECTROECG_H
@@ -225,7 +225,7 @@ integrate ( const RequestLoopElement<MeshType>& request,
 
   This function is repeated 4 times:
   versions with and without QR adapter
-  versions with and without Offset
+  versions with and without OpenMP parameters
 
  */
 template < typename MeshType, typename TestSpaceType, typename ExpressionType, typename QRAdapterType>
@@ -266,6 +266,48 @@ integrate ( const RequestLoopElement<MeshType>& request,
            (request.mesh(), QRAdapterNeverAdapt (quadrature), testSpace, expression, offset);
 }
 
+template < typename MeshType, typename TestSpaceType, typename ExpressionType, typename QRAdapterType>
+IntegrateVectorElement<MeshType, TestSpaceType, ExpressionType, QRAdapterType>
+integrate ( const RequestLoopElement<MeshType>& request,
+            const QRAdapterBase<QRAdapterType>& qrAdapterBase,
+            const std::shared_ptr<TestSpaceType>& testSpace,
+            const ExpressionType& expression,
+            const OpenMPParameters& ompParams,
+            const UInt offset = 0);
+template < typename MeshType, typename TestSpaceType, typename ExpressionType, typename QRAdapterType>
+IntegrateVectorElement<MeshType, TestSpaceType, ExpressionType, QRAdapterType>
+integrate ( const RequestLoopElement<MeshType>& request,
+            const QRAdapterBase<QRAdapterType>& qrAdapterBase,
+            const std::shared_ptr<TestSpaceType>& testSpace,
+            const ExpressionType& expression,
+            const OpenMPParameters& ompParams,
+            const UInt offset)
+{
+    return IntegrateVectorElement<MeshType, TestSpaceType, ExpressionType, QRAdapterType>
+           (request.mesh(), qrAdapterBase.implementation(), testSpace, expression, ompParams, offset);
+}
+
+template < typename MeshType, typename TestSpaceType, typename ExpressionType>
+IntegrateVectorElement<MeshType, TestSpaceType, ExpressionType, QRAdapterNeverAdapt>
+integrate ( const RequestLoopElement<MeshType>& request,
+            const QuadratureRule& quadrature,
+            const std::shared_ptr<TestSpaceType>& testSpace,
+            const ExpressionType& expression,
+            const OpenMPParameters& ompParams,
+            const UInt offset = 0);
+template < typename MeshType, typename TestSpaceType, typename ExpressionType>
+IntegrateVectorElement<MeshType, TestSpaceType, ExpressionType, QRAdapterNeverAdapt>
+integrate ( const RequestLoopElement<MeshType>& request,
+            const QuadratureRule& quadrature,
+            const std::shared_ptr<TestSpaceType>& testSpace,
+            const ExpressionType& expression,
+            const OpenMPParameters& ompParams,
+            const UInt offset)
+{
+    return IntegrateVectorElement<MeshType, TestSpaceType, ExpressionType, QRAdapterNeverAdapt>
+           (request.mesh(), QRAdapterNeverAdapt (quadrature), testSpace, expression, ompParams, offset);
+}
+
 //! Compute stress function for vectorial expressions
 /*!
   @author Samuel Quinodoz <samuel.quinodoz@epfl.ch>
@@ -427,8 +469,9 @@ EvaluateAtQuadrature ( const RequestLoopElement<MeshType>& request,
   for performing an integration, here to assemble a benchmark
   with a loop on the elements.
 
-  This function is repeated 2 times:
+  This function is repeated 4 times:
   versions with and without QR adapter
+  versions with and without OpenMP parameters
 
  */
 template < typename MeshType, typename ExpressionType, typename QRAdapterType>
@@ -451,6 +494,28 @@ integrate ( const RequestLoopElement<MeshType>& request,
            (request.mesh(), QRAdapterNeverAdapt (quadrature), expression);
 }
 
+template < typename MeshType, typename ExpressionType, typename QRAdapterType>
+IntegrateValueElement<MeshType, ExpressionType, QRAdapterType>
+integrate ( const RequestLoopElement<MeshType>& request,
+            const QRAdapterBase<QRAdapterType>& qrAdapterBase,
+            const ExpressionType& expression,
+            const OpenMPParameters& ompParams)
+{
+    return IntegrateValueElement<MeshType, ExpressionType, QRAdapterType>
+           (request.mesh(), qrAdapterBase.implementation(), expression, ompParams);
+}
+
+template < typename MeshType, typename ExpressionType>
+IntegrateValueElement<MeshType, ExpressionType, QRAdapterNeverAdapt>
+integrate ( const RequestLoopElement<MeshType>& request,
+            const QuadratureRule& quadrature,
+            const ExpressionType& expression,
+            const OpenMPParameters& ompParams)
+{
+    return IntegrateValueElement<MeshType, ExpressionType, QRAdapterNeverAdapt>
+           (request.mesh(), QRAdapterNeverAdapt (quadrature), expression, ompParams);
+}
+
 // =============================================================
 // Methods to integrate over a portion of the mesh
 // =============================================================
@@ -478,6 +543,32 @@ integrate ( const RequestLoopVolumeID<MeshType>& request,
            (request.volumeList(), request.indexList(), qrAdapter.implementation(), testSpace, solutionSpace, expression);
 }
 
+template < typename MeshType, typename TestSpaceType, typename SolutionSpaceType, typename ExpressionType>
+IntegrateMatrixVolumeID<MeshType, TestSpaceType, SolutionSpaceType, ExpressionType, QRAdapterNeverAdapt>
+integrate ( const RequestLoopVolumeID<MeshType>& request,
+            const QuadratureRule& quadrature,
+            const std::shared_ptr<TestSpaceType>& testSpace,
+            const std::shared_ptr<SolutionSpaceType>& solutionSpace,
+            const ExpressionType& expression,
+            const OpenMPParameters& ompParams)
+{
+    return IntegrateMatrixVolumeID<MeshType, TestSpaceType, SolutionSpaceType, ExpressionType, QRAdapterNeverAdapt>
+           (request.volumeList(), request.indexList(), QRAdapterNeverAdapt (quadrature), testSpace, solutionSpace, expression, ompParams);
+}
+
+template < typename MeshType, typename TestSpaceType, typename SolutionSpaceType, typename ExpressionType, typename QRAdapterType>
+IntegrateMatrixVolumeID<MeshType, TestSpaceType, SolutionSpaceType, ExpressionType, QRAdapterType>
+integrate ( const RequestLoopVolumeID<MeshType>& request,
+            const QRAdapterBase<QRAdapterType>& qrAdapter,
+            const std::shared_ptr<TestSpaceType>& testSpace,
+            const std::shared_ptr<SolutionSpaceType>& solutionSpace,
+            const ExpressionType& expression,
+            const OpenMPParameters& ompParams)
+{
+    return IntegrateMatrixVolumeID<MeshType, TestSpaceType, SolutionSpaceType, ExpressionType, QRAdapterType>
+           (request.volumeList(), request.indexList(), qrAdapter.implementation(), testSpace, solutionSpace, expression, ompParams);
+}
+
 template < typename MeshType, typename TestSpaceType, typename ExpressionType>
 IntegrateVectorVolumeID<MeshType, TestSpaceType, ExpressionType, QRAdapterNeverAdapt>
 integrate ( const RequestLoopVolumeID<MeshType>& request,
@@ -499,6 +590,30 @@ integrate ( const RequestLoopVolumeID<MeshType>& request,
            (request.volumeList(), request.indexList(), qrAdapter.implementation(), testSpace, expression);
 }
 
+template < typename MeshType, typename TestSpaceType, typename ExpressionType>
+IntegrateVectorVolumeID<MeshType, TestSpaceType, ExpressionType, QRAdapterNeverAdapt>
+integrate ( const RequestLoopVolumeID<MeshType>& request,
+            const QuadratureRule& quadrature,
+            const std::shared_ptr<TestSpaceType>& testSpace,
+            const ExpressionType& expression,
+            const OpenMPParameters& ompParams)
+{
+    return IntegrateVectorVolumeID<MeshType, TestSpaceType, ExpressionType, QRAdapterNeverAdapt>
+           (request.volumeList(), request.indexList(), QRAdapterNeverAdapt (quadrature), testSpace, expression, ompParams);
+}
+
+template < typename MeshType, typename TestSpaceType, typename ExpressionType, typename QRAdapterType>
+IntegrateVectorVolumeID<MeshType, TestSpaceType, ExpressionType, QRAdapterType>
+integrate ( const RequestLoopVolumeID<MeshType>& request,
+            const QRAdapterBase<QRAdapterType>& qrAdapter,
+            const std::shared_ptr<TestSpaceType>& testSpace,
+            const ExpressionType& expression,
+            const OpenMPParameters& ompParams)
+{
+    return IntegrateVectorVolumeID<MeshType, TestSpaceType, ExpressionType, QRAdapterType>
+           (request.volumeList(), request.indexList(), qrAdapter.implementation(), testSpace, expression, ompParams);
+}
+
 /* Integration on the boundary of the domain */
 
 
@@ -513,6 +628,18 @@ integrate ( const RequestLoopFaceID<MeshType>& request,
            (request.mesh(), request.id(), quadratureBoundary, testSpace, expression);
 }
 
+template < typename MeshType, typename TestSpaceType, typename ExpressionType>
+IntegrateVectorFaceID<MeshType, TestSpaceType, ExpressionType>
+integrate ( const RequestLoopFaceID<MeshType>& request,
+            const QuadratureBoundary& quadratureBoundary,
+            const std::shared_ptr<TestSpaceType>& testSpace,
+            const ExpressionType& expression,
+            const OpenMPParameters& ompParams)
+{
+    return IntegrateVectorFaceID<MeshType, TestSpaceType, ExpressionType>
+           (request.mesh(), request.id(), quadratureBoundary, testSpace, expression, ompParams);
+}
+
 
 template < typename MeshType, typename TestSpaceType, typename SolutionSpaceType, typename ExpressionType>
 IntegrateMatrixFaceID<MeshType, TestSpaceType, SolutionSpaceType, ExpressionType>
@@ -526,6 +653,19 @@ integrate ( const RequestLoopFaceID<MeshType>& request,
            (request.mesh(), request.id(), quadratureBoundary, testSpace, solutionSpace, expression);
 }
 
+template < typename MeshType, typename TestSpaceType, typename SolutionSpaceType, typename ExpressionType>
+IntegrateMatrixFaceID<MeshType, TestSpaceType, SolutionSpaceType, ExpressionType>
+integrate ( const RequestLoopFaceID<MeshType>& request,
+            const QuadratureBoundary& quadratureBoundary,
+            const std::shared_ptr<TestSpaceType> testSpace,
+            const std::shared_ptr<SolutionSpaceType> solutionSpace,
+            const ExpressionType& expression,
+            const OpenMPParameters& ompParams)
+{
+    return IntegrateMatrixFaceID<MeshType, TestSpaceType, SolutionSpaceType, ExpressionType>
+           (request.mesh(), request.id(), quadratureBoundary, testSpace, solutionSpace, expression, ompParams);
+}
+
 
 template < typename MeshType,
          typename TestSpaceType,
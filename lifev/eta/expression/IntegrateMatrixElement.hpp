@@ -56,6 +56,9 @@
 #include <boost/shared_ptr.hpp>
 #include <boost/scoped_ptr.hpp>
 
+#include <algorithm>
+#include <vector>
+
 
 
 namespace LifeV
@@ -200,6 +203,14 @@ public:
     template <typename MatrixType>
     void addTo (MatrixType& mat);
 
+    //! Method that performs the assembly on the elements of a subdomain
+    /*!
+      As addTo, on the elements listed at construction. If more than
+      one thread is requested in the OpenMP parameters, the elemental
+      matrices are computed in parallel by blocks of elements and added
+      to the global matrix in the order of the list, so that the result
+      is the same as the serial one.
+     */
     template <typename MatrixType>
     void addToSubdomain (MatrixType& mat);
 
@@ -269,6 +280,15 @@ private:
     //! No empty constructor
     IntegrateMatrixElement();
 
+    //! Assembly on the elements of the subdomain with several threads
+    template <typename MatrixType>
+    void addToSubdomainThreaded (MatrixType& mat);
+
+    //! Select the quadrature of an element and compute its elemental matrix with the current FEs of this integrator
+    void integrateSubdomainElement (const UInt iElement,
+                                    ETMatrixElemental& elementalMatrix,
+                                    bool& isPreviousAdapted);
+
     //! Perform the computations for a single element
     /*!
      * This method computes the elemental matrix for a given element
@@ -313,6 +333,9 @@ private:
     // Data for multi-threaded assembly
     OpenMPParameters M_ompParams;
 
+    //! Number of elements computed by each thread between two additions to the open global matrix
+    static const UInt S_elementsPerThread = 128;
+
     // Data for integration on one subRegion, flag and elements on which perform the integration
     const UInt M_regionFlag;
     const UInt M_numVolumeElements;
@@ -826,85 +849,130 @@ void
 IntegrateMatrixElement<MeshType, TestSpaceType, SolutionSpaceType, ExpressionType, QRAdapterType>::
 addToSubdomain ( MatrixType& mat )
 {
-    UInt nbElements ( M_numVolumeElements );
-    //UInt nbQuadPt_std (M_qrAdapter.standardQR().nbQuadPt() );
-    UInt nbTestDof (M_testSpace->refFE().nbDof() );
-    UInt nbSolutionDof (M_solutionSpace->refFE().nbDof() );
+    if ( M_volumeElements == nullptr )
+    {
+        return;
+    }
+
+    if (M_ompParams.numThreads > 1)
+    {
+        addToSubdomainThreaded (mat);
+        return;
+    }
 
     ETMatrixElemental elementalMatrix (TestSpaceType::field_dim * M_testSpace->refFE().nbDof(),
                                        SolutionSpaceType::field_dim * M_solutionSpace->refFE().nbDof() );
 
-    evaluation_Type evaluation (M_evaluation);
+    // Defaulted to true for security
+    bool isPreviousAdapted (true);
 
-    if( M_volumeElements != nullptr )
+    for (UInt iVolumeElement (0); iVolumeElement < M_numVolumeElements; ++iVolumeElement)
     {
+        integrateSubdomainElement (M_volumeElements[iVolumeElement], elementalMatrix, isPreviousAdapted);
 
-        std::stringstream convertNumbEl;
-        convertNumbEl << nbElements;
-
-        // Defaulted to true for security
-        bool isPreviousAdapted (true);
-
-        for (UInt iVolumeElement (0); iVolumeElement < nbElements; ++iVolumeElement)
-        {
-
-            UInt iElement = M_volumeElements[iVolumeElement];
+        elementalMatrix.pushToGlobal (mat);
+    }
+}
 
-            // Extracting the marker
-            // UInt markerID = M_testSpace->mesh()->element ( iElement ).markerID( );
+template < typename MeshType, typename TestSpaceType, typename SolutionSpaceType, typename ExpressionType, typename QRAdapterType>
+template <typename MatrixType>
+void
+IntegrateMatrixElement<MeshType, TestSpaceType, SolutionSpaceType, ExpressionType, QRAdapterType>::
+addToSubdomainThreaded ( MatrixType& mat )
+{
+    const UInt nbElements ( M_numVolumeElements );
 
-            // Update the quadrature rule adapter
-            M_qrAdapter.update (iElement);
+    // The open global matrix is not thread safe: the elemental matrices of a block
+    // of elements are computed in parallel, then added in the order of the list
+    const UInt blockSize (std::max<UInt> (1, std::min<UInt> (nbElements, S_elementsPerThread * M_ompParams.numThreads) ) );
+    std::vector<ETMatrixElemental> elementalMatrices (blockSize,
+                                                      ETMatrixElemental (TestSpaceType::field_dim * M_testSpace->refFE().nbDof(),
+                                                                         SolutionSpaceType::field_dim * M_solutionSpace->refFE().nbDof() ) );
 
-            if (M_qrAdapter.isAdaptedElement() )
-            {
-                // Set the quadrature rule everywhere
-                evaluation.setQuadrature ( M_qrAdapter.adaptedQR() );
-                M_globalCFE_adapted -> setQuadratureRule ( M_qrAdapter.adaptedQR() );
-                M_testCFE_adapted -> setQuadratureRule ( M_qrAdapter.adaptedQR() );
-                M_solutionCFE_adapted -> setQuadratureRule ( M_qrAdapter.adaptedQR() );
+    // OpenMP setup and pragmas around the loop
+    M_ompParams.apply();
 
-                // Reset the CurrentFEs in the evaluation
-                evaluation.setGlobalCFE ( M_globalCFE_adapted );
-                evaluation.setTestCFE ( M_testCFE_adapted );
-                evaluation.setSolutionCFE ( M_solutionCFE_adapted );
+    #pragma omp parallel
+    {
+        // The copy owns its quadrature adapter, current FEs and evaluation
+        IntegrateMatrixElement<MeshType, TestSpaceType, SolutionSpaceType, ExpressionType, QRAdapterType> integrator (*this);
 
-                integrateElement (iElement, M_qrAdapter.adaptedQR().nbQuadPt(), nbTestDof, nbSolutionDof,
-                                  elementalMatrix, evaluation, *M_globalCFE_adapted , //*globalCFE,
-                                  *M_testCFE_adapted, *M_solutionCFE_adapted);
+        // Defaulted to true for security
+        bool isPreviousAdapted (true);
 
-                isPreviousAdapted = true;
+        for (UInt blockBegin (0); blockBegin < nbElements; blockBegin += blockSize)
+        {
+            const UInt blockEnd (std::min (blockBegin + blockSize, nbElements) );
 
+            #pragma omp for schedule(runtime)
+            for (UInt iVolumeElement = blockBegin; iVolumeElement < blockEnd; ++iVolumeElement)
+            {
+                integrator.integrateSubdomainElement (M_volumeElements[iVolumeElement],
+                                                      elementalMatrices[ iVolumeElement - blockBegin ],
+                                                      isPreviousAdapted);
             }
-            else
+
+            #pragma omp single
             {
-                // Change in the evaluation if needed
-                if (isPreviousAdapted)
+                for (UInt iVolumeElement (blockBegin); iVolumeElement < blockEnd; ++iVolumeElement)
                 {
-                    M_evaluation.setQuadrature ( M_qrAdapter.standardQR() );
-                    M_evaluation.setGlobalCFE ( M_globalCFE_std );
-                    M_evaluation.setTestCFE ( M_testCFE_std );
-                    M_evaluation.setSolutionCFE ( M_solutionCFE_std );
-
-                    isPreviousAdapted = false;
+                    elementalMatrices[ iVolumeElement - blockBegin ].pushToGlobal (mat);
                 }
-
-                integrateElement (iElement, M_qrAdapter.standardQR().nbQuadPt(), nbTestDof, nbSolutionDof,
-                                  elementalMatrix, evaluation, *M_globalCFE_std , //*globalCFE,
-                                  *M_testCFE_std, *M_solutionCFE_std);
-
             }
-
-            elementalMatrix.pushToGlobal (mat);
         }
-
     }
 
+    M_ompParams.restorePreviousNumThreads();
 }
 
+template < typename MeshType, typename TestSpaceType, typename SolutionSpaceType, typename ExpressionType, typename QRAdapterType>
+void
+IntegrateMatrixElement<MeshType, TestSpaceType, SolutionSpaceType, ExpressionType, QRAdapterType>::
+integrateSubdomainElement (const UInt iElement, ETMatrixElemental& elementalMatrix, bool& isPreviousAdapted)
+{
+    UInt nbTestDof (M_testSpace->refFE().nbDof() );
+    UInt nbSolutionDof (M_solutionSpace->refFE().nbDof() );
 
+    // Update the quadrature rule adapter
+    M_qrAdapter.update (iElement);
 
+    if (M_qrAdapter.isAdaptedElement() )
+    {
+        // Set the quadrature rule everywhere
+        M_evaluation.setQuadrature ( M_qrAdapter.adaptedQR() );
+        M_globalCFE_adapted -> setQuadratureRule ( M_qrAdapter.adaptedQR() );
+        M_testCFE_adapted -> setQuadratureRule ( M_qrAdapter.adaptedQR() );
+        M_solutionCFE_adapted -> setQuadratureRule ( M_qrAdapter.adaptedQR() );
+
+        // Reset the CurrentFEs in the evaluation
+        M_evaluation.setGlobalCFE ( M_globalCFE_adapted );
+        M_evaluation.setTestCFE ( M_testCFE_adapted );
+        M_evaluation.setSolutionCFE ( M_solutionCFE_adapted );
+
+        integrateElement (iElement, M_qrAdapter.adaptedQR().nbQuadPt(), nbTestDof, nbSolutionDof,
+                          elementalMatrix, M_evaluation, *M_globalCFE_adapted,
+                          *M_testCFE_adapted, *M_solutionCFE_adapted);
+
+        isPreviousAdapted = true;
+    }
+    else
+    {
+        // Change in the evaluation if needed
+        if (isPreviousAdapted)
+        {
+            M_evaluation.setQuadrature ( M_qrAdapter.standardQR() );
+            M_evaluation.setGlobalCFE ( M_globalCFE_std );
+            M_evaluation.setTestCFE ( M_testCFE_std );
+            M_evaluation.setSolutionCFE ( M_solutionCFE_std );
 
+            isPreviousAdapted = false;
+        }
+
+        integrateElement (iElement, M_qrAdapter.standardQR().nbQuadPt(), nbTestDof, nbSolutionDof,
+                          elementalMatrix, M_evaluation, *M_globalCFE_std,
+                          *M_testCFE_std, *M_solutionCFE_std);
+    }
+}
 
 
 
@@ -38,6 +38,8 @@
 
 #include <lifev/core/LifeV.hpp>
 
+#include <lifev/core/util/OpenMPParameters.hpp>
+
 #include <lifev/eta/fem/QuadratureBoundary.hpp>
 #include <lifev/eta/fem/ETCurrentFE.hpp>
 #include <lifev/eta/fem/ETCurrentBDFE.hpp>
@@ -50,6 +52,8 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <algorithm>
+#include <vector>
 
 
 namespace LifeV
@@ -95,6 +99,15 @@ public:
                            const std::shared_ptr<SolutionSpaceType> solutionSpace,
                            const ExpressionType& expression);
 
+    //! Full data constructor with the OpenMP parameters of the assembly
+    IntegrateMatrixFaceID (const std::shared_ptr<MeshType>& mesh,
+                           const UInt boundaryID,
+                           const QuadratureBoundary& quadratureBD,
+                           const std::shared_ptr<TestSpaceType> testSpace,
+                           const std::shared_ptr<SolutionSpaceType> solutionSpace,
+                           const ExpressionType& expression,
+                           const OpenMPParameters& ompParams);
+
     //! Copy constructor
     IntegrateMatrixFaceID ( const IntegrateMatrixFaceID < MeshType, TestSpaceType, SolutionSpaceType, ExpressionType>& integrator);
 
@@ -137,6 +150,11 @@ public:
       performed: update the values, update the local vector,
       sum over the quadrature nodes, assemble in the global
       vector.
+
+      If more than one thread is requested in the OpenMP parameters,
+      the elemental matrices are computed in parallel by blocks of
+      faces and added to the global matrix in the order of the
+      faces, so that the result is the same as the serial one.
      */
     template <typename MatrixType>
     void addTo (MatrixType& mat);
@@ -158,8 +176,18 @@ private:
     // No default constructor
     IntegrateMatrixFaceID();
 
+    //! Assembly with several threads
+    template <typename MatrixType>
+    void addToThreaded (MatrixType& mat);
+
+    //! Compute the elemental matrix of a boundary face with the current FEs of this integrator
+    void integrateFace (const UInt iFace, ETMatrixElemental& elementalMatrix);
+
     //@}
 
+    //! Number of faces computed by each thread between two additions to the global matrix
+    static const UInt S_facesPerThread = 128;
+
     // Pointer on the mesh
     std::shared_ptr<MeshType> M_mesh;
 
@@ -182,6 +210,9 @@ private:
     std::vector<ETCurrentFE<3, SolutionSpaceType::field_dim>*> M_solutionCFE;
 
     ETMatrixElemental M_elementalMatrix;
+
+    // OpenMP parameters of the assembly
+    OpenMPParameters M_ompParams;
 };
 
 
@@ -212,7 +243,8 @@ IntegrateMatrixFaceID (const std::shared_ptr<MeshType>& mesh,
         M_testCFE (4),
         M_solutionCFE (4),
 
-        M_elementalMatrix (TestSpaceType::field_dim * testSpace->refFE().nbDof(), SolutionSpaceType::field_dim * solutionSpace->refFE().nbDof() )
+        M_elementalMatrix (TestSpaceType::field_dim * testSpace->refFE().nbDof(), SolutionSpaceType::field_dim * solutionSpace->refFE().nbDof() ),
+        M_ompParams()
 {
     for (UInt i (0); i < 4; ++i)
     {
@@ -273,6 +305,21 @@ IntegrateMatrixFaceID (const std::shared_ptr<MeshType>& mesh,
 }
 
 
+template < typename MeshType, typename TestSpaceType, typename SolutionSpaceType, typename ExpressionType>
+IntegrateMatrixFaceID < MeshType, TestSpaceType, SolutionSpaceType, ExpressionType>::
+IntegrateMatrixFaceID (const std::shared_ptr<MeshType>& mesh,
+                       const UInt boundaryID,
+                       const QuadratureBoundary& quadratureBD,
+                       const std::shared_ptr<TestSpaceType> testSpace,
+                       const std::shared_ptr<SolutionSpaceType> solutionSpace,
+                       const ExpressionType& expression,
+                       const OpenMPParameters& ompParams)
+    :   IntegrateMatrixFaceID (mesh, boundaryID, quadratureBD, testSpace, solutionSpace, expression)
+{
+    M_ompParams = ompParams;
+}
+
+
 template < typename MeshType, typename TestSpaceType, typename SolutionSpaceType, typename ExpressionType>
 IntegrateMatrixFaceID < MeshType, TestSpaceType, SolutionSpaceType, ExpressionType>::
 IntegrateMatrixFaceID ( const IntegrateMatrixFaceID < MeshType, TestSpaceType, SolutionSpaceType, ExpressionType>& integrator)
@@ -287,7 +334,8 @@ IntegrateMatrixFaceID ( const IntegrateMatrixFaceID < MeshType, TestSpaceType, S
         M_testCFE (4),
         M_solutionCFE (4),
 
-        M_elementalMatrix (integrator.M_elementalMatrix)
+        M_elementalMatrix (integrator.M_elementalMatrix),
+        M_ompParams (integrator.M_ompParams)
 {
     for (UInt i (0); i < 4; ++i)
     {
@@ -382,9 +430,13 @@ void
 IntegrateMatrixFaceID < MeshType, TestSpaceType, SolutionSpaceType, ExpressionType>::
 addTo (MatrixType& mat)
 {
+    if (M_ompParams.numThreads > 1)
+    {
+        addToThreaded (mat);
+        return;
+    }
+
     UInt nbBoundaryFaces (M_mesh->numBFaces() );
-    UInt nbTestDof (M_testSpace->refFE().nbDof() );
-    UInt nbSolutionDof (M_solutionSpace->refFE().nbDof() );
 
     for (UInt iFace (0); iFace < nbBoundaryFaces; ++iFace)
     {
@@ -394,71 +446,140 @@ addTo (MatrixType& mat)
             continue;
         }
 
-        // Zeros out the elemental vector
-        M_elementalMatrix.zero();
+        integrateFace (iFace, M_elementalMatrix);
 
-        // Get the number of the face in the adjacent element
-        UInt faceIDinAdjacentElement (M_mesh->face (iFace).firstAdjacentElementPosition() );
+        M_elementalMatrix.pushToGlobal (mat);
+    }
+}
 
-        // Get the ID of the adjacent element
-        UInt adjacentElementID (M_mesh->face (iFace).firstAdjacentElementIdentity() );
+template < typename MeshType, typename TestSpaceType, typename SolutionSpaceType, typename ExpressionType>
+template <typename MatrixType>
+void
+IntegrateMatrixFaceID < MeshType, TestSpaceType, SolutionSpaceType, ExpressionType>::
+addToThreaded (MatrixType& mat)
+{
+    const UInt nbBoundaryFaces (M_mesh->numBFaces() );
 
-        // Update the currentFEs
-        M_globalCFE[faceIDinAdjacentElement]
-        ->update (M_mesh->element (adjacentElementID) );
-        M_testCFE[faceIDinAdjacentElement]
-        ->update (M_mesh->element (adjacentElementID), evaluation_Type::S_testUpdateFlag);
-        M_solutionCFE[faceIDinAdjacentElement]
-        ->update (M_mesh->element (adjacentElementID), evaluation_Type::S_solutionUpdateFlag);
+    std::vector<UInt> faces;
+    for (UInt iFace (0); iFace < nbBoundaryFaces; ++iFace)
+    {
+        if ( M_mesh->face (iFace).markerID() == M_boundaryId )
+        {
+            faces.push_back (iFace);
+        }
+    }
+    const UInt nbFaces (faces.size() );
 
+    // The open global matrix is not thread safe: the elemental matrices of a block
+    // of faces are computed in parallel, then added in the order of the faces
+    const UInt blockSize (std::max<UInt> (1, std::min<UInt> (nbFaces, S_facesPerThread * M_ompParams.numThreads) ) );
+    std::vector<ETMatrixElemental> elementalMatrices (blockSize, M_elementalMatrix);
 
-        // Update the evaluation
-        M_evaluation.setQuadrature (M_quadratureBoundary.qr (faceIDinAdjacentElement) );
-        M_evaluation.setGlobalCFE (M_globalCFE[faceIDinAdjacentElement]);
-        M_evaluation.setTestCFE (M_testCFE[faceIDinAdjacentElement]);
-        M_evaluation.setSolutionCFE (M_solutionCFE[faceIDinAdjacentElement]);
+    // OpenMP setup and pragmas around the loop
+    M_ompParams.apply();
 
-        M_evaluation.update (adjacentElementID);
+    #pragma omp parallel
+    {
+        // The copy owns its current FEs and evaluation
+        IntegrateMatrixFaceID < MeshType, TestSpaceType, SolutionSpaceType, ExpressionType> integrator (*this);
 
-        // Loop on the blocks
-        for (UInt iblock (0); iblock < TestSpaceType::field_dim; ++iblock)
+        for (UInt blockBegin (0); blockBegin < nbFaces; blockBegin += blockSize)
         {
-            for (UInt jblock (0); jblock < SolutionSpaceType::field_dim; ++jblock)
+            const UInt blockEnd (std::min (blockBegin + blockSize, nbFaces) );
+
+            #pragma omp for schedule(runtime)
+            for (UInt iFace = blockBegin; iFace < blockEnd; ++iFace)
             {
+                integrator.integrateFace (faces[ iFace ], elementalMatrices[ iFace - blockBegin ]);
+            }
 
-                // Set the row global indices in the local matrix
-                for (UInt i (0); i < nbTestDof; ++i)
+            #pragma omp single
+            {
+                for (UInt iFace (blockBegin); iFace < blockEnd; ++iFace)
                 {
-                    M_elementalMatrix.setRowIndex
-                    (i + iblock * nbTestDof,
-                     M_testSpace->dof().localToGlobalMap (adjacentElementID, i) + iblock * M_testSpace->dof().numTotalDof() );
+                    elementalMatrices[ iFace - blockBegin ].pushToGlobal (mat);
                 }
+            }
+        }
+    }
 
-                for (UInt j (0); j < nbSolutionDof; ++j)
-                {
-                    M_elementalMatrix.setColumnIndex
-                    (j + jblock * nbSolutionDof,
-                     M_solutionSpace->dof().localToGlobalMap (adjacentElementID, j) + jblock * M_solutionSpace->dof().numTotalDof() );
-                }
+    M_ompParams.restorePreviousNumThreads();
+}
+
+// ===================================================
+// Private Methods
+// ===================================================
+
+template < typename MeshType, typename TestSpaceType, typename SolutionSpaceType, typename ExpressionType>
+void
+IntegrateMatrixFaceID < MeshType, TestSpaceType, SolutionSpaceType, ExpressionType>::
+integrateFace (const UInt iFace, ETMatrixElemental& elementalMatrix)
+{
+    UInt nbTestDof (M_testSpace->refFE().nbDof() );
+    UInt nbSolutionDof (M_solutionSpace->refFE().nbDof() );
 
+    // Zeros out the elemental vector
+    elementalMatrix.zero();
 
-                // Make the assembly
-                for (UInt iQuadPt (0); iQuadPt < M_quadratureBoundary.qr (faceIDinAdjacentElement).nbQuadPt(); ++iQuadPt)
+    // Get the number of the face in the adjacent element
+    UInt faceIDinAdjacentElement (M_mesh->face (iFace).firstAdjacentElementPosition() );
+
+    // Get the ID of the adjacent element
+    UInt adjacentElementID (M_mesh->face (iFace).firstAdjacentElementIdentity() );
+
+    // Update the currentFEs
+    M_globalCFE[faceIDinAdjacentElement]
+    ->update (M_mesh->element (adjacentElementID) );
+    M_testCFE[faceIDinAdjacentElement]
+    ->update (M_mesh->element (adjacentElementID), evaluation_Type::S_testUpdateFlag);
+    M_solutionCFE[faceIDinAdjacentElement]
+    ->update (M_mesh->element (adjacentElementID), evaluation_Type::S_solutionUpdateFlag);
+
+
+    // Update the evaluation
+    M_evaluation.setQuadrature (M_quadratureBoundary.qr (faceIDinAdjacentElement) );
+    M_evaluation.setGlobalCFE (M_globalCFE[faceIDinAdjacentElement]);
+    M_evaluation.setTestCFE (M_testCFE[faceIDinAdjacentElement]);
+    M_evaluation.setSolutionCFE (M_solutionCFE[faceIDinAdjacentElement]);
+
+    M_evaluation.update (adjacentElementID);
+
+    // Loop on the blocks
+    for (UInt iblock (0); iblock < TestSpaceType::field_dim; ++iblock)
+    {
+        for (UInt jblock (0); jblock < SolutionSpaceType::field_dim; ++jblock)
+        {
+
+            // Set the row global indices in the local matrix
+            for (UInt i (0); i < nbTestDof; ++i)
+            {
+                elementalMatrix.setRowIndex
+                (i + iblock * nbTestDof,
+                 M_testSpace->dof().localToGlobalMap (adjacentElementID, i) + iblock * M_testSpace->dof().numTotalDof() );
+            }
+
+            for (UInt j (0); j < nbSolutionDof; ++j)
+            {
+                elementalMatrix.setColumnIndex
+                (j + jblock * nbSolutionDof,
+                 M_solutionSpace->dof().localToGlobalMap (adjacentElementID, j) + jblock * M_solutionSpace->dof().numTotalDof() );
+            }
+
+
+            // Make the assembly
+            for (UInt iQuadPt (0); iQuadPt < M_quadratureBoundary.qr (faceIDinAdjacentElement).nbQuadPt(); ++iQuadPt)
+            {
+                for (UInt i (0); i < nbTestDof; ++i)
                 {
-                    for (UInt i (0); i < nbTestDof; ++i)
+                    for (UInt j (0); j < nbSolutionDof; ++j)
                     {
-                        for (UInt j (0); j < nbSolutionDof; ++j)
-                        {
-                            M_elementalMatrix.element (i + iblock * nbTestDof, j + jblock * nbSolutionDof) +=
-                                M_evaluation.value_qij (iQuadPt, i + iblock * nbTestDof, j + jblock * nbSolutionDof)
-                                * M_globalCFE[faceIDinAdjacentElement]->M_wMeas[iQuadPt];
-                        }
+                        elementalMatrix.element (i + iblock * nbTestDof, j + jblock * nbSolutionDof) +=
+                            M_evaluation.value_qij (iQuadPt, i + iblock * nbTestDof, j + jblock * nbSolutionDof)
+                            * M_globalCFE[faceIDinAdjacentElement]->M_wMeas[iQuadPt];
                     }
                 }
             }
         }
-
-        M_elementalMatrix.pushToGlobal (mat);
     }
 }
 
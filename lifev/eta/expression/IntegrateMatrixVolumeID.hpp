@@ -38,6 +38,8 @@
 
 #include <lifev/core/LifeV.hpp>
 
+#include <lifev/core/util/OpenMPParameters.hpp>
+
 #include <lifev/core/fem/QuadratureRule.hpp>
 #include <lifev/core/mesh/RegionMesh.hpp>
 #include <lifev/eta/fem/ETCurrentFE.hpp>
@@ -50,6 +52,8 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <algorithm>
+#include <vector>
 
 
 namespace LifeV
@@ -104,6 +108,15 @@ public:
                              const std::shared_ptr<SolutionSpaceType>& solutionSpace,
                              const ExpressionType& expression);
 
+    //! Full data constructor with the OpenMP parameters of the assembly
+    IntegrateMatrixVolumeID (const vectorVolumesPtr_Type volumeList,
+                             const vectorIndexPtr_Type indexList,
+                             const QRAdapterType& qrAdapter,
+                             const std::shared_ptr<TestSpaceType>& testSpace,
+                             const std::shared_ptr<SolutionSpaceType>& solutionSpace,
+                             const ExpressionType& expression,
+                             const OpenMPParameters& ompParams);
+
     //! Copy constructor
     IntegrateMatrixVolumeID ( const IntegrateMatrixVolumeID < MeshType, TestSpaceType, SolutionSpaceType, ExpressionType, QRAdapterType>& integrator);
 
@@ -146,6 +159,11 @@ public:
       performed: update the values, update the local vector,
       sum over the quadrature nodes, assemble in the global
       vector.
+
+      If more than one thread is requested in the OpenMP parameters,
+      the elemental matrices are computed in parallel by blocks of
+      volumes and added to the global matrix in the order of the
+      volumes, so that the result is the same as the serial one.
      */
     template <typename MatrixType>
     void addTo (MatrixType& mat);
@@ -167,8 +185,18 @@ private:
     // No default constructor
     IntegrateMatrixVolumeID();
 
+    //! Assembly with several threads
+    template <typename MatrixType>
+    void addToThreaded (MatrixType& mat);
+
+    //! Compute the elemental matrix of the i-th volume of the list with the current FEs of this integrator
+    void integrateVolume (const UInt iElement, ETMatrixElemental& elementalMatrix, bool& isPreviousAdapted);
+
     //@}
 
+    //! Number of volumes computed by each thread between two additions to the global matrix
+    static const UInt S_volumesPerThread = 128;
+
     //List of volumes with a marker
     vectorVolumesPtr_Type M_volumeList;
     vectorIndexPtr_Type M_indexList;
@@ -193,6 +221,9 @@ private:
     ETCurrentFE<3, SolutionSpaceType::field_dim>* M_solutionCFE_adapted;
 
     ETMatrixElemental M_elementalMatrix;
+
+    // OpenMP parameters of the assembly
+    OpenMPParameters M_ompParams;
 };
 
 
@@ -229,7 +260,8 @@ IntegrateMatrixVolumeID (const vectorVolumesPtr_Type volumeList,
         M_solutionCFE_adapted (new ETCurrentFE<3, SolutionSpaceType::field_dim> (solutionSpace->refFE(), testSpace->geoMap(), qrAdapter.standardQR() ) ),
 
         M_elementalMatrix (TestSpaceType::field_dim * testSpace->refFE().nbDof(),
-                           SolutionSpaceType::field_dim * solutionSpace->refFE().nbDof() )
+                           SolutionSpaceType::field_dim * solutionSpace->refFE().nbDof() ),
+        M_ompParams()
 {
     M_evaluation.setQuadrature (qrAdapter.standardQR() );
     M_evaluation.setGlobalCFE (M_globalCFE_std);
@@ -237,6 +269,20 @@ IntegrateMatrixVolumeID (const vectorVolumesPtr_Type volumeList,
     M_evaluation.setSolutionCFE (M_solutionCFE_std);
 }
 
+template < typename MeshType, typename TestSpaceType, typename SolutionSpaceType, typename ExpressionType, typename QRAdapterType>
+IntegrateMatrixVolumeID<MeshType, TestSpaceType, SolutionSpaceType, ExpressionType, QRAdapterType>::
+IntegrateMatrixVolumeID (const vectorVolumesPtr_Type volumeList,
+                         const vectorIndexPtr_Type indexList,
+                         const QRAdapterType& qrAdapter,
+                         const std::shared_ptr<TestSpaceType>& testSpace,
+                         const std::shared_ptr<SolutionSpaceType>& solutionSpace,
+                         const ExpressionType& expression,
+                         const OpenMPParameters& ompParams)
+    :   IntegrateMatrixVolumeID (volumeList, indexList, qrAdapter, testSpace, solutionSpace, expression)
+{
+    M_ompParams = ompParams;
+}
+
 template < typename MeshType, typename TestSpaceType, typename SolutionSpaceType, typename ExpressionType, typename QRAdapterType>
 IntegrateMatrixVolumeID<MeshType, TestSpaceType, SolutionSpaceType, ExpressionType, QRAdapterType>::
 IntegrateMatrixVolumeID (const IntegrateMatrixVolumeID<MeshType, TestSpaceType, SolutionSpaceType, ExpressionType, QRAdapterType>& integrator)
@@ -257,7 +303,8 @@ IntegrateMatrixVolumeID (const IntegrateMatrixVolumeID<MeshType, TestSpaceType,
         M_solutionCFE_adapted (new ETCurrentFE<3, SolutionSpaceType::field_dim> (M_solutionSpace->refFE(), M_solutionSpace->geoMap(), integrator.M_qrAdapter.standardQR() )
                               ),
 
-        M_elementalMatrix (integrator.M_elementalMatrix)
+        M_elementalMatrix (integrator.M_elementalMatrix),
+        M_ompParams (integrator.M_ompParams)
 {
     M_evaluation.setQuadrature (integrator.M_qrAdapter.standardQR() );
     M_evaluation.setGlobalCFE (M_globalCFE_std);
@@ -302,152 +349,217 @@ void
 IntegrateMatrixVolumeID<MeshType, TestSpaceType, SolutionSpaceType, ExpressionType, QRAdapterType>::
 addTo (MatrixType& mat)
 {
-    // Defaulted to true for security
-    bool isPreviousAdapted (true);
-
     //number of volumes
     UInt nbElements ( (*M_volumeList).size() );
     UInt nbIndexes ( (*M_indexList).size() );
 
     ASSERT ( nbElements == nbIndexes, "The number of indexes is different from the number of volumes!!!");
 
-    UInt nbQuadPt_std (M_qrAdapter.standardQR().nbQuadPt() );
-    UInt nbTestDof (M_testSpace->refFE().nbDof() );
-    UInt nbSolutionDof (M_solutionSpace->refFE().nbDof() );
+    if (M_ompParams.numThreads > 1)
+    {
+        addToThreaded (mat);
+        return;
+    }
+
+    // Defaulted to true for security
+    bool isPreviousAdapted (true);
 
     for (UInt iElement (0); iElement < nbElements; ++iElement)
     {
-        // Zeros out the matrix
-        M_elementalMatrix.zero();
+        integrateVolume (iElement, M_elementalMatrix, isPreviousAdapted);
 
-        // Update the quadrature rule adapter
-        M_qrAdapter.update ( (*M_indexList) [iElement] );
+        M_elementalMatrix.pushToGlobal (mat);
+    }
+}
 
-        if (M_qrAdapter.isAdaptedElement() )
-        {
-            // Set the quadrature rule everywhere
-            M_evaluation.setQuadrature ( M_qrAdapter.adaptedQR() );
-            M_globalCFE_adapted -> setQuadratureRule ( M_qrAdapter.adaptedQR() );
-            M_testCFE_adapted -> setQuadratureRule ( M_qrAdapter.adaptedQR() );
-            M_solutionCFE_adapted -> setQuadratureRule ( M_qrAdapter.adaptedQR() );
+template < typename MeshType, typename TestSpaceType, typename SolutionSpaceType, typename ExpressionType, typename QRAdapterType>
+template <typename MatrixType>
+void
+IntegrateMatrixVolumeID<MeshType, TestSpaceType, SolutionSpaceType, ExpressionType, QRAdapterType>::
+addToThreaded (MatrixType& mat)
+{
+    const UInt nbElements ( (*M_volumeList).size() );
+
+    // The open global matrix is not thread safe: the elemental matrices of a block
+    // of volumes are computed in parallel, then added in the order of the volumes
+    const UInt blockSize (std::max<UInt> (1, std::min<UInt> (nbElements, S_volumesPerThread * M_ompParams.numThreads) ) );
+    std::vector<ETMatrixElemental> elementalMatrices (blockSize, M_elementalMatrix);
 
-            // Reset the CurrentFEs in the evaluation
-            M_evaluation.setGlobalCFE ( M_globalCFE_adapted );
-            M_evaluation.setTestCFE ( M_testCFE_adapted );
-            M_evaluation.setSolutionCFE ( M_solutionCFE_adapted );
+    // OpenMP setup and pragmas around the loop
+    M_ompParams.apply();
 
-            M_evaluation.update ( (*M_indexList) [iElement] );
+    #pragma omp parallel
+    {
+        // The copy owns its quadrature adapter, current FEs and evaluation
+        IntegrateMatrixVolumeID<MeshType, TestSpaceType, SolutionSpaceType, ExpressionType, QRAdapterType> integrator (*this);
 
-            // Update the CurrentFEs
-            M_globalCFE_adapted->update (* ( (*M_volumeList) [iElement]), evaluation_Type::S_globalUpdateFlag | ET_UPDATE_WDET);
-            M_testCFE_adapted->update (* ( (*M_volumeList) [iElement]), evaluation_Type::S_testUpdateFlag);
-            M_solutionCFE_adapted->update (* ( (*M_volumeList) [iElement]), evaluation_Type::S_solutionUpdateFlag);
+        // Defaulted to true for security
+        bool isPreviousAdapted (true);
 
+        for (UInt blockBegin (0); blockBegin < nbElements; blockBegin += blockSize)
+        {
+            const UInt blockEnd (std::min (blockBegin + blockSize, nbElements) );
+
+            #pragma omp for schedule(runtime)
+            for (UInt iElement = blockBegin; iElement < blockEnd; ++iElement)
+            {
+                integrator.integrateVolume (iElement, elementalMatrices[ iElement - blockBegin ], isPreviousAdapted);
+            }
 
-            // Assembly
-            for (UInt iblock (0); iblock < TestSpaceType::field_dim; ++iblock)
+            #pragma omp single
             {
-                for (UInt jblock (0); jblock < SolutionSpaceType::field_dim; ++jblock)
+                for (UInt iElement (blockBegin); iElement < blockEnd; ++iElement)
                 {
+                    elementalMatrices[ iElement - blockBegin ].pushToGlobal (mat);
+                }
+            }
+        }
+    }
 
-                    // Set the row global indices in the local matrix
-                    for (UInt i (0); i < nbTestDof; ++i)
-                    {
-                        M_elementalMatrix.setRowIndex
-                        (i + iblock * nbTestDof,
-                         M_testSpace->dof().localToGlobalMap ( (*M_indexList) [iElement], i) + iblock * M_testSpace->dof().numTotalDof() );
-                    }
+    M_ompParams.restorePreviousNumThreads();
+}
 
-                    // Set the column global indices in the local matrix
-                    for (UInt j (0); j < nbSolutionDof; ++j)
-                    {
-                        M_elementalMatrix.setColumnIndex
-                        (j + jblock * nbSolutionDof,
-                         M_solutionSpace->dof().localToGlobalMap ( (*M_indexList) [iElement], j) + jblock * M_solutionSpace->dof().numTotalDof() );
-                    }
+// ===================================================
+// Private Methods
+// ===================================================
+
+template < typename MeshType, typename TestSpaceType, typename SolutionSpaceType, typename ExpressionType, typename QRAdapterType>
+void
+IntegrateMatrixVolumeID<MeshType, TestSpaceType, SolutionSpaceType, ExpressionType, QRAdapterType>::
+integrateVolume (const UInt iElement, ETMatrixElemental& elementalMatrix, bool& isPreviousAdapted)
+{
+    UInt nbQuadPt_std (M_qrAdapter.standardQR().nbQuadPt() );
+    UInt nbTestDof (M_testSpace->refFE().nbDof() );
+    UInt nbSolutionDof (M_solutionSpace->refFE().nbDof() );
+
+    // Zeros out the matrix
+    elementalMatrix.zero();
+
+    // Update the quadrature rule adapter
+    M_qrAdapter.update ( (*M_indexList) [iElement] );
+
+    if (M_qrAdapter.isAdaptedElement() )
+    {
+        // Set the quadrature rule everywhere
+        M_evaluation.setQuadrature ( M_qrAdapter.adaptedQR() );
+        M_globalCFE_adapted -> setQuadratureRule ( M_qrAdapter.adaptedQR() );
+        M_testCFE_adapted -> setQuadratureRule ( M_qrAdapter.adaptedQR() );
+        M_solutionCFE_adapted -> setQuadratureRule ( M_qrAdapter.adaptedQR() );
+
+        // Reset the CurrentFEs in the evaluation
+        M_evaluation.setGlobalCFE ( M_globalCFE_adapted );
+        M_evaluation.setTestCFE ( M_testCFE_adapted );
+        M_evaluation.setSolutionCFE ( M_solutionCFE_adapted );
+
+        M_evaluation.update ( (*M_indexList) [iElement] );
+
+        // Update the CurrentFEs
+        M_globalCFE_adapted->update (* ( (*M_volumeList) [iElement]), evaluation_Type::S_globalUpdateFlag | ET_UPDATE_WDET);
+        M_testCFE_adapted->update (* ( (*M_volumeList) [iElement]), evaluation_Type::S_testUpdateFlag);
+        M_solutionCFE_adapted->update (* ( (*M_volumeList) [iElement]), evaluation_Type::S_solutionUpdateFlag);
+
+
+        // Assembly
+        for (UInt iblock (0); iblock < TestSpaceType::field_dim; ++iblock)
+        {
+            for (UInt jblock (0); jblock < SolutionSpaceType::field_dim; ++jblock)
+            {
+
+                // Set the row global indices in the local matrix
+                for (UInt i (0); i < nbTestDof; ++i)
+                {
+                    elementalMatrix.setRowIndex
+                    (i + iblock * nbTestDof,
+                     M_testSpace->dof().localToGlobalMap ( (*M_indexList) [iElement], i) + iblock * M_testSpace->dof().numTotalDof() );
+                }
 
-                    for (UInt iQuadPt (0); iQuadPt < M_qrAdapter.adaptedQR().nbQuadPt(); ++iQuadPt)
+                // Set the column global indices in the local matrix
+                for (UInt j (0); j < nbSolutionDof; ++j)
+                {
+                    elementalMatrix.setColumnIndex
+                    (j + jblock * nbSolutionDof,
+                     M_solutionSpace->dof().localToGlobalMap ( (*M_indexList) [iElement], j) + jblock * M_solutionSpace->dof().numTotalDof() );
+                }
+
+                for (UInt iQuadPt (0); iQuadPt < M_qrAdapter.adaptedQR().nbQuadPt(); ++iQuadPt)
+                {
+                    for (UInt i (0); i < nbTestDof; ++i)
                     {
-                        for (UInt i (0); i < nbTestDof; ++i)
+                        for (UInt j (0); j < nbSolutionDof; ++j)
                         {
-                            for (UInt j (0); j < nbSolutionDof; ++j)
-                            {
-                                M_elementalMatrix.element (i + iblock * nbTestDof, j + jblock * nbSolutionDof) +=
-                                    M_evaluation.value_qij (iQuadPt, i + iblock * nbTestDof, j + jblock * nbSolutionDof)
-                                    * M_globalCFE_adapted->wDet (iQuadPt);
+                            elementalMatrix.element (i + iblock * nbTestDof, j + jblock * nbSolutionDof) +=
+                                M_evaluation.value_qij (iQuadPt, i + iblock * nbTestDof, j + jblock * nbSolutionDof)
+                                * M_globalCFE_adapted->wDet (iQuadPt);
 
-                            }
                         }
                     }
                 }
             }
+        }
 
-            isPreviousAdapted = true;
+        isPreviousAdapted = true;
 
-        }
-        else
+    }
+    else
+    {
+        // Change in the evaluation if needed
+        if (isPreviousAdapted)
         {
-            // Change in the evaluation if needed
-            if (isPreviousAdapted)
-            {
-                M_evaluation.setQuadrature ( M_qrAdapter.standardQR() );
-                M_evaluation.setGlobalCFE ( M_globalCFE_std );
-                M_evaluation.setTestCFE ( M_testCFE_std );
-                M_evaluation.setSolutionCFE ( M_solutionCFE_std );
+            M_evaluation.setQuadrature ( M_qrAdapter.standardQR() );
+            M_evaluation.setGlobalCFE ( M_globalCFE_std );
+            M_evaluation.setTestCFE ( M_testCFE_std );
+            M_evaluation.setSolutionCFE ( M_solutionCFE_std );
 
-                isPreviousAdapted = false;
-            }
+            isPreviousAdapted = false;
+        }
 
-            // Update the currentFEs
-            M_globalCFE_std->update (* ( (*M_volumeList) [iElement]), evaluation_Type::S_globalUpdateFlag | ET_UPDATE_WDET);
-            M_testCFE_std->update (* ( (*M_volumeList) [iElement]), evaluation_Type::S_testUpdateFlag);
-            M_solutionCFE_std->update (* ( (*M_volumeList) [iElement]), evaluation_Type::S_solutionUpdateFlag);
+        // Update the currentFEs
+        M_globalCFE_std->update (* ( (*M_volumeList) [iElement]), evaluation_Type::S_globalUpdateFlag | ET_UPDATE_WDET);
+        M_testCFE_std->update (* ( (*M_volumeList) [iElement]), evaluation_Type::S_testUpdateFlag);
+        M_solutionCFE_std->update (* ( (*M_volumeList) [iElement]), evaluation_Type::S_solutionUpdateFlag);
 
-            // Update the evaluation
-            M_evaluation.update ( (*M_indexList) [iElement] );
+        // Update the evaluation
+        M_evaluation.update ( (*M_indexList) [iElement] );
 
-            // Loop on the blocks
+        // Loop on the blocks
 
-            for (UInt iblock (0); iblock < TestSpaceType::field_dim; ++iblock)
+        for (UInt iblock (0); iblock < TestSpaceType::field_dim; ++iblock)
+        {
+            for (UInt jblock (0); jblock < SolutionSpaceType::field_dim; ++jblock)
             {
-                for (UInt jblock (0); jblock < SolutionSpaceType::field_dim; ++jblock)
-                {
 
-                    // Set the row global indices in the local matrix
-                    for (UInt i (0); i < nbTestDof; ++i)
-                    {
-                        M_elementalMatrix.setRowIndex
-                        (i + iblock * nbTestDof,
-                         M_testSpace->dof().localToGlobalMap ( (*M_indexList) [iElement], i) + iblock * M_testSpace->dof().numTotalDof() );
-                    }
+                // Set the row global indices in the local matrix
+                for (UInt i (0); i < nbTestDof; ++i)
+                {
+                    elementalMatrix.setRowIndex
+                    (i + iblock * nbTestDof,
+                     M_testSpace->dof().localToGlobalMap ( (*M_indexList) [iElement], i) + iblock * M_testSpace->dof().numTotalDof() );
+                }
 
-                    // Set the column global indices in the local matrix
-                    for (UInt j (0); j < nbSolutionDof; ++j)
-                    {
-                        M_elementalMatrix.setColumnIndex
-                        (j + jblock * nbSolutionDof,
-                         M_solutionSpace->dof().localToGlobalMap ( (*M_indexList) [iElement], j) + jblock * M_solutionSpace->dof().numTotalDof() );
-                    }
+                // Set the column global indices in the local matrix
+                for (UInt j (0); j < nbSolutionDof; ++j)
+                {
+                    elementalMatrix.setColumnIndex
+                    (j + jblock * nbSolutionDof,
+                     M_solutionSpace->dof().localToGlobalMap ( (*M_indexList) [iElement], j) + jblock * M_solutionSpace->dof().numTotalDof() );
+                }
 
-                    for (UInt iQuadPt (0); iQuadPt < nbQuadPt_std; ++iQuadPt)
+                for (UInt iQuadPt (0); iQuadPt < nbQuadPt_std; ++iQuadPt)
+                {
+                    for (UInt i (0); i < nbTestDof; ++i)
                     {
-                        for (UInt i (0); i < nbTestDof; ++i)
+                        for (UInt j (0); j < nbSolutionDof; ++j)
                         {
-                            for (UInt j (0); j < nbSolutionDof; ++j)
-                            {
-                                M_elementalMatrix.element (i + iblock * nbTestDof, j + jblock * nbSolutionDof) +=
-                                    M_evaluation.value_qij (iQuadPt, i + iblock * nbTestDof, j + jblock * nbSolutionDof)
-                                    * M_globalCFE_std->wDet (iQuadPt);
+                            elementalMatrix.element (i + iblock * nbTestDof, j + jblock * nbSolutionDof) +=
+                                M_evaluation.value_qij (iQuadPt, i + iblock * nbTestDof, j + jblock * nbSolutionDof)
+                                * M_globalCFE_std->wDet (iQuadPt);
 
-                            }
                         }
                     }
                 }
             }
-
         }
 
-        M_elementalMatrix.pushToGlobal (mat);
     }
 }
 
@@ -38,6 +38,8 @@
 
 #include <lifev/core/LifeV.hpp>
 
+#include <lifev/core/util/OpenMPParameters.hpp>
+
 #include <lifev/core/fem/QuadratureRule.hpp>
 #include <lifev/eta/fem/ETCurrentFE.hpp>
 #include <lifev/eta/fem/MeshGeometricMap.hpp>
@@ -47,6 +49,9 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <memory>
+#include <vector>
+
 
 
 namespace LifeV
@@ -89,6 +94,12 @@ public:
                            const QRAdapterType& qrAdapter,
                            const ExpressionType& expression);
 
+    //! Full data constructor with the OpenMP parameters of the integration
+    IntegrateValueElement (const std::shared_ptr<MeshType>& mesh,
+                           const QRAdapterType& qrAdapter,
+                           const ExpressionType& expression,
+                           const OpenMPParameters& ompParams);
+
     //! Copy constructor
     IntegrateValueElement ( const IntegrateValueElement < MeshType, ExpressionType, QRAdapterType>& integrator);
 
@@ -122,6 +133,11 @@ public:
       in this method. Everything for the assembly is then
       performed: update the values, sum over the quadrature nodes,
       sum into the global value.
+
+      If more than one thread is requested in the OpenMP parameters,
+      the contributions of the elements are computed in parallel and
+      summed in the order of the elements, so that the result is the
+      same as the serial one.
      */
     void addTo (Real& value);
 
@@ -135,6 +151,20 @@ private:
     //! No empty constructor
     IntegrateValueElement();
 
+    //! Integration with several threads
+    void addToThreaded (Real& value);
+
+    //! Contribution of a single element
+    Real integrateElement (const UInt iElement,
+                           QRAdapterType& qrAdapter,
+                           evaluation_Type& evaluation,
+                           ETCurrentFE<MeshType::S_geoDimensions, 1>& globalCFE_std,
+                           ETCurrentFE<MeshType::S_geoDimensions, 1>& globalCFE_adapted,
+                           bool& isPreviousAdapted);
+
+    //! Geometric current FE for the shape of the mesh
+    static ETCurrentFE<MeshType::S_geoDimensions, 1>* newGlobalCFE (const QuadratureRule& qr);
+
     //@}
 
     // Pointer on the mesh
@@ -152,6 +182,8 @@ private:
     // CurrentFE for the adapted quadrature
     ETCurrentFE<MeshType::S_geoDimensions, 1>* M_globalCFE_adapted;
 
+    // OpenMP parameters of the integration
+    OpenMPParameters M_ompParams;
 };
 
 
@@ -170,8 +202,8 @@ IntegrateValueElement (const std::shared_ptr<MeshType>& mesh,
                        const ExpressionType& expression)
     :   M_mesh (mesh),
         M_qrAdapter (qrAdapter),
-        M_evaluation (expression)
-
+        M_evaluation (expression),
+        M_ompParams()
 {
     switch (MeshType::geoShape_Type::BasRefSha::S_shape)
     {
@@ -202,13 +234,25 @@ IntegrateValueElement (const std::shared_ptr<MeshType>& mesh,
     M_evaluation.setGlobalCFE (M_globalCFE_std);
 }
 
+template < typename MeshType, typename ExpressionType, typename QRAdapterType>
+IntegrateValueElement < MeshType, ExpressionType, QRAdapterType>::
+IntegrateValueElement (const std::shared_ptr<MeshType>& mesh,
+                       const QRAdapterType& qrAdapter,
+                       const ExpressionType& expression,
+                       const OpenMPParameters& ompParams)
+    :   IntegrateValueElement (mesh, qrAdapter, expression)
+{
+    M_ompParams = ompParams;
+}
+
 
 template < typename MeshType, typename ExpressionType, typename QRAdapterType>
 IntegrateValueElement < MeshType, ExpressionType, QRAdapterType>::
 IntegrateValueElement ( const IntegrateValueElement < MeshType, ExpressionType, QRAdapterType>& integrator)
     :   M_mesh (integrator.M_mesh),
         M_qrAdapter (integrator.M_qrAdapter),
-        M_evaluation (integrator.M_evaluation)
+        M_evaluation (integrator.M_evaluation),
+        M_ompParams (integrator.M_ompParams)
 {
     switch (MeshType::geoShape_Type::BasRefSha::S_shape)
     {
@@ -269,8 +313,13 @@ void
 IntegrateValueElement < MeshType, ExpressionType, QRAdapterType>::
 addTo (Real& value)
 {
+    if (M_ompParams.numThreads > 1)
+    {
+        addToThreaded (value);
+        return;
+    }
+
     UInt nbElements (M_mesh->numElements() );
-    UInt nbQuadPt_std (M_qrAdapter.standardQR().nbQuadPt() );
 
     // This flag reports whether the previous element
     // needed an adapted integration. It is set to true
@@ -279,64 +328,151 @@ addTo (Real& value)
 
     for (UInt iElement (0); iElement < nbElements; ++iElement)
     {
-        // Update the quadrature adapter
-        M_qrAdapter.update (iElement);
+        value += integrateElement (iElement, M_qrAdapter, M_evaluation,
+                                   *M_globalCFE_std, *M_globalCFE_adapted, isPreviousAdapted);
+    }
+}
+
+template < typename MeshType, typename ExpressionType, typename QRAdapterType>
+void
+IntegrateValueElement < MeshType, ExpressionType, QRAdapterType>::
+addToThreaded (Real& value)
+{
+    const UInt nbElements (M_mesh->numElements() );
+
+    // The contributions of the elements are summed in the order of the
+    // elements, the result does not depend on the number of threads
+    std::vector<Real> elementValues (nbElements, 0.);
 
-        // Check if the current element needs an adapted
-        // quadrature rule.
-        if ( M_qrAdapter.isAdaptedElement() )
+    // OpenMP setup and pragmas around the loop
+    M_ompParams.apply();
+
+    #pragma omp parallel
+    {
+        QRAdapterType qrAdapter (M_qrAdapter);
+
+        std::unique_ptr<ETCurrentFE<MeshType::S_geoDimensions, 1> > globalCFE_std (newGlobalCFE (qrAdapter.standardQR() ) );
+        std::unique_ptr<ETCurrentFE<MeshType::S_geoDimensions, 1> > globalCFE_adapted (newGlobalCFE (qrAdapter.standardQR() ) );
+
+        evaluation_Type evaluation (M_evaluation);
+
+        // Set to true by default for security
+        bool isPreviousAdapted (true);
+
+        #pragma omp for schedule(runtime)
+        for (UInt iElement = 0; iElement < nbElements; ++iElement)
         {
+            elementValues[ iElement ] = integrateElement (iElement, qrAdapter, evaluation,
+                                                          *globalCFE_std, *globalCFE_adapted, isPreviousAdapted);
+        }
+    }
 
-            // Set the adapted QR
-            M_evaluation.setQuadrature ( M_qrAdapter.adaptedQR() );
-            M_globalCFE_adapted->setQuadratureRule ( M_qrAdapter.adaptedQR() );
+    M_ompParams.restorePreviousNumThreads();
 
-            // Set the right CFE (even if the previous one was
-            // adapted! The memory locations might have changed!
-            M_evaluation.setGlobalCFE ( M_globalCFE_adapted );
+    for (UInt iElement (0); iElement < nbElements; ++iElement)
+    {
+        value += elementValues[ iElement ];
+    }
+}
+
+// ===================================================
+// Private Methods
+// ===================================================
+
+template < typename MeshType, typename ExpressionType, typename QRAdapterType>
+Real
+IntegrateValueElement < MeshType, ExpressionType, QRAdapterType>::
+integrateElement (const UInt iElement,
+                  QRAdapterType& qrAdapter,
+                  evaluation_Type& evaluation,
+                  ETCurrentFE<MeshType::S_geoDimensions, 1>& globalCFE_std,
+                  ETCurrentFE<MeshType::S_geoDimensions, 1>& globalCFE_adapted,
+                  bool& isPreviousAdapted)
+{
+    Real elementValue (0.);
 
-            // Update the currentFE
-            M_globalCFE_adapted->update (M_mesh->element (iElement), evaluation_Type::S_globalUpdateFlag | ET_UPDATE_WDET);
+    // Update the quadrature adapter
+    qrAdapter.update (iElement);
+
+    // Check if the current element needs an adapted
+    // quadrature rule.
+    if ( qrAdapter.isAdaptedElement() )
+    {
 
-            // Update the evaluation
-            M_evaluation.update (iElement);
+        // Set the adapted QR
+        evaluation.setQuadrature ( qrAdapter.adaptedQR() );
+        globalCFE_adapted.setQuadratureRule ( qrAdapter.adaptedQR() );
 
-            // Make the assembly
-            for (UInt iQuadPt (0); iQuadPt < M_qrAdapter.adaptedQR().nbQuadPt(); ++iQuadPt)
-            {
-                value += M_evaluation.value_q (iQuadPt)
-                         * M_globalCFE_adapted->wDet (iQuadPt);
-            }
+        // Set the right CFE (even if the previous one was
+        // adapted! The memory locations might have changed!
+        evaluation.setGlobalCFE ( &globalCFE_adapted );
 
-            // Finally, set the flag
-            isPreviousAdapted = true;
+        // Update the currentFE
+        globalCFE_adapted.update (M_mesh->element (iElement), evaluation_Type::S_globalUpdateFlag | ET_UPDATE_WDET);
+
+        // Update the evaluation
+        evaluation.update (iElement);
+
+        // Make the assembly
+        for (UInt iQuadPt (0); iQuadPt < qrAdapter.adaptedQR().nbQuadPt(); ++iQuadPt)
+        {
+            elementValue += evaluation.value_q (iQuadPt)
+                            * globalCFE_adapted.wDet (iQuadPt);
         }
-        else
+
+        // Finally, set the flag
+        isPreviousAdapted = true;
+    }
+    else
+    {
+        // Check if the previous one was adapted
+        if (isPreviousAdapted)
+        {
+            evaluation.setQuadrature ( qrAdapter.standardQR() );
+            evaluation.setGlobalCFE ( &globalCFE_std );
+            // Update the flag
+            isPreviousAdapted = false;
+        }
+
+        // Update the currentFEs
+        globalCFE_std.update (M_mesh->element (iElement), evaluation_Type::S_globalUpdateFlag | ET_UPDATE_WDET);
+
+        // Update the evaluation
+        evaluation.update (iElement);
+
+
+        // Make the assembly
+        for (UInt iQuadPt (0); iQuadPt < qrAdapter.standardQR().nbQuadPt(); ++iQuadPt)
         {
-            // Check if the previous one was adapted
-            if (isPreviousAdapted)
-            {
-                M_evaluation.setQuadrature ( M_qrAdapter.standardQR() );
-                M_evaluation.setGlobalCFE ( M_globalCFE_std );
-                // Update the flag
-                isPreviousAdapted = false;
-            }
-
-            // Update the currentFEs
-            M_globalCFE_std->update (M_mesh->element (iElement), evaluation_Type::S_globalUpdateFlag | ET_UPDATE_WDET);
-
-            // Update the evaluation
-            M_evaluation.update (iElement);
-
-
-            // Make the assembly
-            for (UInt iQuadPt (0); iQuadPt < nbQuadPt_std; ++iQuadPt)
-            {
-                value += M_evaluation.value_q (iQuadPt)
-                         * M_globalCFE_std->wDet (iQuadPt);
-            }
+            elementValue += evaluation.value_q (iQuadPt)
+                            * globalCFE_std.wDet (iQuadPt);
         }
     }
+
+    return elementValue;
+}
+
+template < typename MeshType, typename ExpressionType, typename QRAdapterType>
+ETCurrentFE<MeshType::S_geoDimensions, 1>*
+IntegrateValueElement < MeshType, ExpressionType, QRAdapterType>::
+newGlobalCFE (const QuadratureRule& qr)
+{
+    switch (MeshType::geoShape_Type::BasRefSha::S_shape)
+    {
+        case LINE:
+            return new ETCurrentFE<MeshType::S_geoDimensions, 1> (feSegP0, geometricMapFromMesh<MeshType>(), qr );
+        case TRIANGLE:
+            return new ETCurrentFE<MeshType::S_geoDimensions, 1> (feTriaP0, geometricMapFromMesh<MeshType>(), qr );
+        case QUAD:
+            return new ETCurrentFE<MeshType::S_geoDimensions, 1> (feQuadQ0, geometricMapFromMesh<MeshType>(), qr );
+        case TETRA:
+            return new ETCurrentFE<MeshType::S_geoDimensions, 1> (feTetraP0, geometricMapFromMesh<MeshType>(), qr );
+        case HEXA:
+            return new ETCurrentFE<MeshType::S_geoDimensions, 1> (feHexaQ0, geometricMapFromMesh<MeshType>(), qr );
+        default:
+            ERROR_MSG ("Unrecognized element shape");
+    }
+    return 0;
 }
 
 
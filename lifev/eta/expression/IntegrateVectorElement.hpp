@@ -38,6 +38,8 @@
 
 #include <lifev/core/LifeV.hpp>
 
+#include <lifev/core/util/OpenMPParameters.hpp>
+
 #include <lifev/core/fem/QuadratureRule.hpp>
 #include <lifev/eta/fem/ETCurrentFE.hpp>
 #include <lifev/eta/fem/MeshGeometricMap.hpp>
@@ -50,6 +52,10 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 
 
 namespace LifeV
@@ -94,6 +100,14 @@ public:
                             const ExpressionType& expression,
                             const UInt offset = 0);
 
+    //! Full data constructor with the OpenMP parameters of the assembly
+    IntegrateVectorElement (const std::shared_ptr<MeshType>& mesh,
+                            const QRAdapterType& qrAdapter,
+                            const std::shared_ptr<TestSpaceType>& testSpace,
+                            const ExpressionType& expression,
+                            const OpenMPParameters& ompParams,
+                            const UInt offset = 0);
+
     //! Copy constructor
     IntegrateVectorElement ( const IntegrateVectorElement < MeshType, TestSpaceType, ExpressionType, QRAdapterType>& integrator);
 
@@ -136,6 +150,11 @@ public:
       performed: update the values, update the local vector,
       sum over the quadrature nodes, assemble in the global
       vector.
+
+      If more than one thread is requested in the OpenMP parameters,
+      the elemental vectors are computed in parallel by blocks of
+      elements and added to the global vector in the order of the
+      elements, so that the result is the same as the serial one.
      */
     template <typename VectorType>
     void addTo (VectorType& vec);
@@ -150,8 +169,44 @@ private:
     // No default constructor
     IntegrateVectorElement();
 
+    //! Assembly with several threads
+    template <typename VectorType>
+    void addToThreaded (VectorType& vec);
+
+    //! Perform the computations for a single element
+    /*!
+     * This method computes the elemental vector for a given element
+     * index, the quadrature and the current FEs must be already set
+     * in the evaluation
+     */
+    void integrateElement (const UInt iElement,
+                           const UInt nbQuadPt,
+                           const UInt nbTestDof,
+                           ETVectorElemental& elementalVector,
+                           evaluation_Type& evaluation,
+                           ETCurrentFE<MeshType::S_geoDimensions, 1>& globalCFE,
+                           ETCurrentFE<TestSpaceType::space_dim, TestSpaceType::field_dim>& testCFE);
+
+    //! Select the quadrature of the element and compute its elemental vector
+    void integrateElement (const UInt iElement,
+                           const UInt nbTestDof,
+                           ETVectorElemental& elementalVector,
+                           QRAdapterType& qrAdapter,
+                           evaluation_Type& evaluation,
+                           ETCurrentFE<MeshType::S_geoDimensions, 1>& globalCFE_std,
+                           ETCurrentFE<MeshType::S_geoDimensions, 1>& globalCFE_adapted,
+                           ETCurrentFE<TestSpaceType::space_dim, TestSpaceType::field_dim>& testCFE_std,
+                           ETCurrentFE<TestSpaceType::space_dim, TestSpaceType::field_dim>& testCFE_adapted,
+                           bool& isPreviousAdapted);
+
+    //! Geometric current FE for the shape of the mesh
+    static ETCurrentFE<MeshType::S_geoDimensions, 1>* newGlobalCFE (const QuadratureRule& qr);
+
     //@}
 
+    //! Number of elements computed by each thread between two additions to the global vector
+    static const UInt S_elementsPerThread = 512;
+
     // Pointer on the mesh
     std::shared_ptr<MeshType> M_mesh;
 
@@ -174,6 +229,9 @@ private:
 
     // Offset
     UInt M_offset;
+
+    // OpenMP parameters of the assembly
+    OpenMPParameters M_ompParams;
 };
 
 
@@ -202,7 +260,8 @@ IntegrateVectorElement (const std::shared_ptr<MeshType>& mesh,
 
         M_elementalVector (TestSpaceType::field_dim * testSpace->refFE().nbDof() ),
 
-        M_offset (offset)
+        M_offset (offset),
+        M_ompParams()
 {
     switch (MeshType::geoShape_Type::BasRefSha::S_shape)
     {
@@ -235,6 +294,19 @@ IntegrateVectorElement (const std::shared_ptr<MeshType>& mesh,
     M_evaluation.setTestCFE (M_testCFE_std);
 }
 
+template < typename MeshType, typename TestSpaceType, typename ExpressionType, typename QRAdapterType>
+IntegrateVectorElement < MeshType, TestSpaceType, ExpressionType, QRAdapterType>::
+IntegrateVectorElement (const std::shared_ptr<MeshType>& mesh,
+                        const QRAdapterType& qrAdapter,
+                        const std::shared_ptr<TestSpaceType>& testSpace,
+                        const ExpressionType& expression,
+                        const OpenMPParameters& ompParams,
+                        const UInt offset)
+    :   IntegrateVectorElement (mesh, qrAdapter, testSpace, expression, offset)
+{
+    M_ompParams = ompParams;
+}
+
 
 template < typename MeshType, typename TestSpaceType, typename ExpressionType, typename QRAdapterType>
 IntegrateVectorElement < MeshType, TestSpaceType, ExpressionType, QRAdapterType>::
@@ -248,7 +320,8 @@ IntegrateVectorElement ( const IntegrateVectorElement < MeshType, TestSpaceType,
         M_testCFE_adapted (new ETCurrentFE<TestSpaceType::space_dim, TestSpaceType::field_dim> (M_testSpace->refFE(), M_testSpace->geoMap(), integrator.M_qrAdapter.standardQR() ) ),
 
         M_elementalVector (integrator.M_elementalVector),
-        M_offset (integrator.M_offset)
+        M_offset (integrator.M_offset),
+        M_ompParams (integrator.M_ompParams)
 {
     switch (MeshType::geoShape_Type::BasRefSha::S_shape)
     {
@@ -314,8 +387,13 @@ void
 IntegrateVectorElement < MeshType, TestSpaceType, ExpressionType, QRAdapterType>::
 addTo (VectorType& vec)
 {
+    if (M_ompParams.numThreads > 1)
+    {
+        addToThreaded (vec);
+        return;
+    }
+
     UInt nbElements (M_mesh->numElements() );
-    UInt nbQuadPt_std (M_qrAdapter.standardQR().nbQuadPt() );
     UInt nbTestDof (M_testSpace->refFE().nbDof() );
 
     // Defaulted to true for security
@@ -323,107 +401,193 @@ addTo (VectorType& vec)
 
     for (UInt iElement (0); iElement < nbElements; ++iElement)
     {
-        // Zeros out the elemental vector
-        M_elementalVector.zero();
+        integrateElement (iElement, nbTestDof, M_elementalVector, M_qrAdapter, M_evaluation,
+                          *M_globalCFE_std, *M_globalCFE_adapted,
+                          *M_testCFE_std, *M_testCFE_adapted, isPreviousAdapted);
 
-        // Update the quadrature rule adapter
-        M_qrAdapter.update (iElement);
+        M_elementalVector.pushToGlobal (vec);
+    }
+}
 
+template < typename MeshType, typename TestSpaceType, typename ExpressionType, typename QRAdapterType>
+template <typename VectorType>
+void
+IntegrateVectorElement < MeshType, TestSpaceType, ExpressionType, QRAdapterType>::
+addToThreaded (VectorType& vec)
+{
+    const UInt nbElements (M_mesh->numElements() );
+    const UInt nbTestDof (M_testSpace->refFE().nbDof() );
 
-        if (M_qrAdapter.isAdaptedElement() )
-        {
-            // Reset the quadrature in the different structures
-            M_evaluation.setQuadrature ( M_qrAdapter.adaptedQR() );
-            M_globalCFE_adapted -> setQuadratureRule ( M_qrAdapter.adaptedQR() );
-            M_testCFE_adapted -> setQuadratureRule ( M_qrAdapter.adaptedQR() );
+    // The global vector is not thread safe: the elemental vectors of a block
+    // of elements are computed in parallel, then added in the order of the elements
+    const UInt blockSize (std::max<UInt> (1, std::min<UInt> (nbElements, S_elementsPerThread * M_ompParams.numThreads) ) );
+    std::vector<ETVectorElemental> elementalVectors (blockSize, M_elementalVector);
 
-            // Reset the CurrentFEs in the evaluation
-            M_evaluation.setGlobalCFE ( M_globalCFE_adapted );
-            M_evaluation.setTestCFE ( M_testCFE_adapted );
+    // OpenMP setup and pragmas around the loop
+    M_ompParams.apply();
 
-            // Update with the correct element
-            M_evaluation.update (iElement);
+    #pragma omp parallel
+    {
+        QRAdapterType qrAdapter (M_qrAdapter);
 
-            // Update the currentFEs
-            M_globalCFE_adapted->update (M_mesh->element (iElement), evaluation_Type::S_globalUpdateFlag | ET_UPDATE_WDET);
-            M_testCFE_adapted->update (M_mesh->element (iElement), evaluation_Type::S_testUpdateFlag);
+        std::unique_ptr<ETCurrentFE<MeshType::S_geoDimensions, 1> > globalCFE_std (newGlobalCFE (qrAdapter.standardQR() ) );
+        std::unique_ptr<ETCurrentFE<MeshType::S_geoDimensions, 1> > globalCFE_adapted (newGlobalCFE (qrAdapter.standardQR() ) );
 
+        ETCurrentFE<TestSpaceType::space_dim, TestSpaceType::field_dim>
+        testCFE_std (M_testSpace->refFE(), M_testSpace->geoMap(), M_qrAdapter.standardQR() );
 
-            // Assembly
-            for (UInt iblock (0); iblock < TestSpaceType::field_dim; ++iblock)
+        ETCurrentFE<TestSpaceType::space_dim, TestSpaceType::field_dim>
+        testCFE_adapted (M_testSpace->refFE(), M_testSpace->geoMap(), M_qrAdapter.standardQR() );
+
+        evaluation_Type evaluation (M_evaluation);
+
+        // Defaulted to true for security
+        bool isPreviousAdapted (true);
+
+        for (UInt blockBegin (0); blockBegin < nbElements; blockBegin += blockSize)
+        {
+            const UInt blockEnd (std::min (blockBegin + blockSize, nbElements) );
+
+            #pragma omp for schedule(runtime)
+            for (UInt iElement = blockBegin; iElement < blockEnd; ++iElement)
             {
-                // Set the row global indices in the local vector
-                for (UInt i (0); i < nbTestDof; ++i)
-                {
-                    M_elementalVector.setRowIndex
-                    (i + iblock * nbTestDof,
-                     M_testSpace->dof().localToGlobalMap (iElement, i) + iblock * M_testSpace->dof().numTotalDof() );
-                }
+                integrateElement (iElement, nbTestDof, elementalVectors[ iElement - blockBegin ],
+                                  qrAdapter, evaluation,
+                                  *globalCFE_std, *globalCFE_adapted,
+                                  testCFE_std, testCFE_adapted, isPreviousAdapted);
+            }
 
-                // Make the assembly
-                for (UInt iQuadPt (0); iQuadPt < M_qrAdapter.adaptedQR().nbQuadPt(); ++iQuadPt)
+            #pragma omp single
+            {
+                for (UInt iElement (blockBegin); iElement < blockEnd; ++iElement)
                 {
-                    for (UInt i (0); i < nbTestDof; ++i)
-                    {
-                        M_elementalVector.element (i + iblock * nbTestDof) +=
-                            M_evaluation.value_qi (iQuadPt, i + iblock * nbTestDof)
-                            * M_globalCFE_adapted->wDet (iQuadPt);
-
-                    }
+                    elementalVectors[ iElement - blockBegin ].pushToGlobal (vec);
                 }
             }
+        }
+    }
 
-            // Finally, set the flag
-            isPreviousAdapted = true;
+    M_ompParams.restorePreviousNumThreads();
+}
+
+// ===================================================
+// Private Methods
+// ===================================================
+
+template < typename MeshType, typename TestSpaceType, typename ExpressionType, typename QRAdapterType>
+void
+IntegrateVectorElement < MeshType, TestSpaceType, ExpressionType, QRAdapterType>::
+integrateElement (const UInt iElement, const UInt nbQuadPt, const UInt nbTestDof,
+                  ETVectorElemental& elementalVector,
+                  evaluation_Type& evaluation,
+                  ETCurrentFE<MeshType::S_geoDimensions, 1>& globalCFE,
+                  ETCurrentFE<TestSpaceType::space_dim, TestSpaceType::field_dim>& testCFE)
+{
+    // Zeros out the elemental vector
+    elementalVector.zero();
+
+    // Update the currentFEs
+    globalCFE.update (M_mesh->element (iElement), evaluation_Type::S_globalUpdateFlag | ET_UPDATE_WDET);
+    testCFE.update (M_mesh->element (iElement), evaluation_Type::S_testUpdateFlag);
+
+    // Update the evaluation
+    evaluation.update (iElement);
+
+    // Loop on the blocks
+    for (UInt iblock (0); iblock < TestSpaceType::field_dim; ++iblock)
+    {
+        // Set the row global indices in the local vector
+        for (UInt i (0); i < nbTestDof; ++i)
+        {
+            elementalVector.setRowIndex
+            (i + iblock * nbTestDof,
+             M_testSpace->dof().localToGlobalMap (iElement, i) + iblock * M_testSpace->dof().numTotalDof() + M_offset);
         }
-        else
+
+        // Make the assembly
+        for (UInt iQuadPt (0); iQuadPt < nbQuadPt; ++iQuadPt)
         {
-            // Check if the last one was adapted
-            if (isPreviousAdapted)
+            for (UInt i (0); i < nbTestDof; ++i)
             {
-                M_evaluation.setQuadrature ( M_qrAdapter.standardQR() );
-                M_evaluation.setGlobalCFE ( M_globalCFE_std );
-                M_evaluation.setTestCFE ( M_testCFE_std );
-
-                isPreviousAdapted = false;
+                elementalVector.element (i + iblock * nbTestDof) +=
+                    evaluation.value_qi (iQuadPt, i + iblock * nbTestDof)
+                    * globalCFE.wDet (iQuadPt);
             }
+        }
+    }
+}
 
+template < typename MeshType, typename TestSpaceType, typename ExpressionType, typename QRAdapterType>
+void
+IntegrateVectorElement < MeshType, TestSpaceType, ExpressionType, QRAdapterType>::
+integrateElement (const UInt iElement, const UInt nbTestDof,
+                  ETVectorElemental& elementalVector,
+                  QRAdapterType& qrAdapter,
+                  evaluation_Type& evaluation,
+                  ETCurrentFE<MeshType::S_geoDimensions, 1>& globalCFE_std,
+                  ETCurrentFE<MeshType::S_geoDimensions, 1>& globalCFE_adapted,
+                  ETCurrentFE<TestSpaceType::space_dim, TestSpaceType::field_dim>& testCFE_std,
+                  ETCurrentFE<TestSpaceType::space_dim, TestSpaceType::field_dim>& testCFE_adapted,
+                  bool& isPreviousAdapted)
+{
+    // Update the quadrature rule adapter
+    qrAdapter.update (iElement);
 
-            // Update the currentFEs
-            M_globalCFE_std->update (M_mesh->element (iElement), evaluation_Type::S_globalUpdateFlag | ET_UPDATE_WDET);
-            M_testCFE_std->update (M_mesh->element (iElement), evaluation_Type::S_testUpdateFlag);
-
-            // Update the evaluation
-            M_evaluation.update (iElement);
+    if (qrAdapter.isAdaptedElement() )
+    {
+        // Reset the quadrature in the different structures
+        evaluation.setQuadrature ( qrAdapter.adaptedQR() );
+        globalCFE_adapted.setQuadratureRule ( qrAdapter.adaptedQR() );
+        testCFE_adapted.setQuadratureRule ( qrAdapter.adaptedQR() );
 
-            // Loop on the blocks
-            for (UInt iblock (0); iblock < TestSpaceType::field_dim; ++iblock)
-            {
-                // Set the row global indices in the local vector
-                for (UInt i (0); i < nbTestDof; ++i)
-                {
-                    M_elementalVector.setRowIndex
-                    (i + iblock * nbTestDof,
-                     M_testSpace->dof().localToGlobalMap (iElement, i) + iblock * M_testSpace->dof().numTotalDof() + M_offset);
-                }
+        // Reset the CurrentFEs in the evaluation
+        evaluation.setGlobalCFE ( &globalCFE_adapted );
+        evaluation.setTestCFE ( &testCFE_adapted );
 
-                // Make the assembly
-                for (UInt iQuadPt (0); iQuadPt < nbQuadPt_std; ++iQuadPt)
-                {
-                	for (UInt i (0); i < nbTestDof; ++i)
-                    {
-                        M_elementalVector.element (i + iblock * nbTestDof) +=
-                            M_evaluation.value_qi (iQuadPt, i + iblock * nbTestDof)
-                            * M_globalCFE_std->wDet (iQuadPt);
+        integrateElement (iElement, qrAdapter.adaptedQR().nbQuadPt(), nbTestDof,
+                          elementalVector, evaluation, globalCFE_adapted, testCFE_adapted);
 
-                    }
-                }
-            }
+        // Finally, set the flag
+        isPreviousAdapted = true;
+    }
+    else
+    {
+        // Check if the last one was adapted
+        if (isPreviousAdapted)
+        {
+            evaluation.setQuadrature ( qrAdapter.standardQR() );
+            evaluation.setGlobalCFE ( &globalCFE_std );
+            evaluation.setTestCFE ( &testCFE_std );
 
+            isPreviousAdapted = false;
         }
 
-        M_elementalVector.pushToGlobal (vec);
+        integrateElement (iElement, qrAdapter.standardQR().nbQuadPt(), nbTestDof,
+                          elementalVector, evaluation, globalCFE_std, testCFE_std);
+    }
+}
+
+template < typename MeshType, typename TestSpaceType, typename ExpressionType, typename QRAdapterType>
+ETCurrentFE<MeshType::S_geoDimensions, 1>*
+IntegrateVectorElement < MeshType, TestSpaceType, ExpressionType, QRAdapterType>::
+newGlobalCFE (const QuadratureRule& qr)
+{
+    switch (MeshType::geoShape_Type::BasRefSha::S_shape)
+    {
+        case LINE:
+            return new ETCurrentFE<MeshType::S_geoDimensions, 1> (feSegP0, geometricMapFromMesh<MeshType>(), qr );
+        case TRIANGLE:
+            return new ETCurrentFE<MeshType::S_geoDimensions, 1> (feTriaP0, geometricMapFromMesh<MeshType>(), qr );
+        case QUAD:
+            return new ETCurrentFE<MeshType::S_geoDimensions, 1> (feQuadQ0, geometricMapFromMesh<MeshType>(), qr );
+        case TETRA:
+            return new ETCurrentFE<MeshType::S_geoDimensions, 1> (feTetraP0, geometricMapFromMesh<MeshType>(), qr );
+        case HEXA:
+            return new ETCurrentFE<MeshType::S_geoDimensions, 1> (feHexaQ0, geometricMapFromMesh<MeshType>(), qr );
+        default:
+            ERROR_MSG ("Unrecognized element shape");
     }
+    return 0;
 }
 
 
@@ -38,6 +38,8 @@
 
 #include <lifev/core/LifeV.hpp>
 
+#include <lifev/core/util/OpenMPParameters.hpp>
+
 #include <lifev/eta/fem/QuadratureBoundary.hpp>
 #include <lifev/eta/fem/ETCurrentFE.hpp>
 #include <lifev/eta/fem/ETCurrentBDFE.hpp>
@@ -49,6 +51,8 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <algorithm>
+#include <vector>
 
 
 namespace LifeV
@@ -93,6 +97,14 @@ public:
                            const std::shared_ptr<TestSpaceType>& testSpace,
                            const ExpressionType& expression);
 
+    //! Full data constructor with the OpenMP parameters of the assembly
+    IntegrateVectorFaceID (const std::shared_ptr<MeshType>& mesh,
+                           const UInt boundaryID,
+                           const QuadratureBoundary& quadratureBD,
+                           const std::shared_ptr<TestSpaceType>& testSpace,
+                           const ExpressionType& expression,
+                           const OpenMPParameters& ompParams);
+
     //! Copy constructor
     IntegrateVectorFaceID ( const IntegrateVectorFaceID < MeshType, TestSpaceType, ExpressionType>& integrator);
 
@@ -135,6 +147,11 @@ public:
       performed: update the values, update the local vector,
       sum over the quadrature nodes, assemble in the global
       vector.
+
+      If more than one thread is requested in the OpenMP parameters,
+      the elemental vectors are computed in parallel by blocks of
+      faces and added to the global vector in the order of the
+      faces, so that the result is the same as the serial one.
      */
     template <typename VectorType>
     void addTo (VectorType& vec);
@@ -149,8 +166,18 @@ private:
     // No default constructor
     IntegrateVectorFaceID();
 
+    //! Assembly with several threads
+    template <typename VectorType>
+    void addToThreaded (VectorType& vec);
+
+    //! Compute the elemental vector of a boundary face with the current FEs of this integrator
+    void integrateFace (const UInt iFace, ETVectorElemental& elementalVector);
+
     //@}
 
+    //! Number of faces computed by each thread between two additions to the global vector
+    static const UInt S_facesPerThread = 512;
+
     // Pointer on the mesh
     std::shared_ptr<MeshType> M_mesh;
 
@@ -170,6 +197,9 @@ private:
     std::vector<ETCurrentFE<3, TestSpaceType::field_dim>*> M_testCFE;
 
     ETVectorElemental M_elementalVector;
+
+    // OpenMP parameters of the assembly
+    OpenMPParameters M_ompParams;
 };
 
 
@@ -197,7 +227,8 @@ IntegrateVectorFaceID (const std::shared_ptr<MeshType>& mesh,
         M_globalCFE (4),
         M_testCFE (4),
 
-        M_elementalVector (TestSpaceType::field_dim * testSpace->refFE().nbDof() )
+        M_elementalVector (TestSpaceType::field_dim * testSpace->refFE().nbDof() ),
+        M_ompParams()
 {
     for (UInt i (0); i < 4; ++i)
     {
@@ -252,6 +283,19 @@ IntegrateVectorFaceID (const std::shared_ptr<MeshType>& mesh,
     M_evaluation.setTestCFE (M_testCFE[0]);
 }
 
+template < typename MeshType, typename TestSpaceType, typename ExpressionType>
+IntegrateVectorFaceID < MeshType, TestSpaceType, ExpressionType>::
+IntegrateVectorFaceID (const std::shared_ptr<MeshType>& mesh,
+                       const UInt boundaryID,
+                       const QuadratureBoundary& quadratureBD,
+                       const std::shared_ptr<TestSpaceType>& testSpace,
+                       const ExpressionType& expression,
+                       const OpenMPParameters& ompParams)
+    :   IntegrateVectorFaceID (mesh, boundaryID, quadratureBD, testSpace, expression)
+{
+    M_ompParams = ompParams;
+}
+
 
 template < typename MeshType, typename TestSpaceType, typename ExpressionType>
 IntegrateVectorFaceID < MeshType, TestSpaceType, ExpressionType>::
@@ -265,7 +309,8 @@ IntegrateVectorFaceID ( const IntegrateVectorFaceID < MeshType, TestSpaceType, E
         M_globalCFE (4),
         M_testCFE (4),
 
-        M_elementalVector (integrator.M_elementalVector)
+        M_elementalVector (integrator.M_elementalVector),
+        M_ompParams (integrator.M_ompParams)
 {
     for (UInt i (0); i < 4; ++i)
     {
@@ -355,12 +400,13 @@ void
 IntegrateVectorFaceID < MeshType, TestSpaceType, ExpressionType>::
 addTo (VectorType& vec)
 {
-    UInt nbBoundaryFaces (M_mesh->numBFaces() );
-    UInt nbTestDof (M_testSpace->refFE().nbDof() );
+    if (M_ompParams.numThreads > 1)
+    {
+        addToThreaded (vec);
+        return;
+    }
 
-    /*CurrentBoundaryFE origFE(M_testSpace->refFE().boundaryFE(),
-                             M_testSpace->geoMap().boundaryMap(),
-                             quadRuleTria3pt);*/
+    UInt nbBoundaryFaces (M_mesh->numBFaces() );
 
     for (UInt iFace (0); iFace < nbBoundaryFaces; ++iFace)
     {
@@ -370,55 +416,121 @@ addTo (VectorType& vec)
             continue;
         }
 
-        //origFE.updateMeasNormalQuadPt(M_mesh->face(iFace));
+        integrateFace (iFace, M_elementalVector);
 
-        // Zeros out the elemental vector
-        M_elementalVector.zero();
+        M_elementalVector.pushToGlobal (vec);
+    }
+}
 
-        // Get the number of the face in the adjacent element
-        UInt faceIDinAdjacentElement (M_mesh->face (iFace).firstAdjacentElementPosition() );
+template < typename MeshType, typename TestSpaceType, typename ExpressionType>
+template <typename VectorType>
+void
+IntegrateVectorFaceID < MeshType, TestSpaceType, ExpressionType>::
+addToThreaded (VectorType& vec)
+{
+    const UInt nbBoundaryFaces (M_mesh->numBFaces() );
 
-        // Get the ID of the adjacent element
-        UInt adjacentElementID (M_mesh->face (iFace).firstAdjacentElementIdentity() );
+    std::vector<UInt> faces;
+    for (UInt iFace (0); iFace < nbBoundaryFaces; ++iFace)
+    {
+        if ( M_mesh->face (iFace).markerID() == M_boundaryId )
+        {
+            faces.push_back (iFace);
+        }
+    }
+    const UInt nbFaces (faces.size() );
 
-        // Update the currentFEs
-        M_globalCFE[faceIDinAdjacentElement]
-        ->update (M_mesh->element (adjacentElementID) );
-        M_testCFE[faceIDinAdjacentElement]
-        ->update (M_mesh->element (adjacentElementID), evaluation_Type::S_testUpdateFlag);
+    // The global vector is not thread safe: the elemental vectors of a block
+    // of faces are computed in parallel, then added in the order of the faces
+    const UInt blockSize (std::max<UInt> (1, std::min<UInt> (nbFaces, S_facesPerThread * M_ompParams.numThreads) ) );
+    std::vector<ETVectorElemental> elementalVectors (blockSize, M_elementalVector);
 
-        // Update the evaluation
-        M_evaluation.setQuadrature (M_quadratureBoundary.qr (faceIDinAdjacentElement) );
-        M_evaluation.setGlobalCFE (M_globalCFE[faceIDinAdjacentElement]);
-        M_evaluation.setTestCFE (M_testCFE[faceIDinAdjacentElement]);
+    // OpenMP setup and pragmas around the loop
+    M_ompParams.apply();
 
-        M_evaluation.update (adjacentElementID);
+    #pragma omp parallel
+    {
+        // The copy owns its current FEs and evaluation
+        IntegrateVectorFaceID < MeshType, TestSpaceType, ExpressionType> integrator (*this);
 
-        // Loop on the blocks
-        for (UInt iblock (0); iblock < TestSpaceType::field_dim; ++iblock)
+        for (UInt blockBegin (0); blockBegin < nbFaces; blockBegin += blockSize)
         {
-            // Set the row global indices in the local vector
-            for (UInt i (0); i < nbTestDof; ++i)
+            const UInt blockEnd (std::min (blockBegin + blockSize, nbFaces) );
+
+            #pragma omp for schedule(runtime)
+            for (UInt iFace = blockBegin; iFace < blockEnd; ++iFace)
             {
-                M_elementalVector.setRowIndex
-                (i + iblock * nbTestDof,
-                 M_testSpace->dof().localToGlobalMap (adjacentElementID, i) + iblock * M_testSpace->dof().numTotalDof() );
+                integrator.integrateFace (faces[ iFace ], elementalVectors[ iFace - blockBegin ]);
             }
 
-            // Make the assembly
-            for (UInt iQuadPt (0); iQuadPt < M_quadratureBoundary.qr (faceIDinAdjacentElement).nbQuadPt(); ++iQuadPt)
+            #pragma omp single
             {
-                for (UInt i (0); i < nbTestDof; ++i)
+                for (UInt iFace (blockBegin); iFace < blockEnd; ++iFace)
                 {
-                    M_elementalVector.element (i + iblock * nbTestDof) +=
-                        M_evaluation.value_qi (iQuadPt, i + iblock * nbTestDof)
-                        * M_globalCFE[faceIDinAdjacentElement]->M_wMeas[iQuadPt];
-
+                    elementalVectors[ iFace - blockBegin ].pushToGlobal (vec);
                 }
             }
         }
+    }
 
-        M_elementalVector.pushToGlobal (vec);
+    M_ompParams.restorePreviousNumThreads();
+}
+
+// ===================================================
+// Private Methods
+// ===================================================
+
+template < typename MeshType, typename TestSpaceType, typename ExpressionType>
+void
+IntegrateVectorFaceID < MeshType, TestSpaceType, ExpressionType>::
+integrateFace (const UInt iFace, ETVectorElemental& elementalVector)
+{
+    UInt nbTestDof (M_testSpace->refFE().nbDof() );
+
+    // Zeros out the elemental vector
+    elementalVector.zero();
+
+    // Get the number of the face in the adjacent element
+    UInt faceIDinAdjacentElement (M_mesh->face (iFace).firstAdjacentElementPosition() );
+
+    // Get the ID of the adjacent element
+    UInt adjacentElementID (M_mesh->face (iFace).firstAdjacentElementIdentity() );
+
+    // Update the currentFEs
+    M_globalCFE[faceIDinAdjacentElement]
+    ->update (M_mesh->element (adjacentElementID) );
+    M_testCFE[faceIDinAdjacentElement]
+    ->update (M_mesh->element (adjacentElementID), evaluation_Type::S_testUpdateFlag);
+
+    // Update the evaluation
+    M_evaluation.setQuadrature (M_quadratureBoundary.qr (faceIDinAdjacentElement) );
+    M_evaluation.setGlobalCFE (M_globalCFE[faceIDinAdjacentElement]);
+    M_evaluation.setTestCFE (M_testCFE[faceIDinAdjacentElement]);
+
+    M_evaluation.update (adjacentElementID);
+
+    // Loop on the blocks
+    for (UInt iblock (0); iblock < TestSpaceType::field_dim; ++iblock)
+    {
+        // Set the row global indices in the local vector
+        for (UInt i (0); i < nbTestDof; ++i)
+        {
+            elementalVector.setRowIndex
+            (i + iblock * nbTestDof,
+             M_testSpace->dof().localToGlobalMap (adjacentElementID, i) + iblock * M_testSpace->dof().numTotalDof() );
+        }
+
+        // Make the assembly
+        for (UInt iQuadPt (0); iQuadPt < M_quadratureBoundary.qr (faceIDinAdjacentElement).nbQuadPt(); ++iQuadPt)
+        {
+            for (UInt i (0); i < nbTestDof; ++i)
+            {
+                elementalVector.element (i + iblock * nbTestDof) +=
+                    M_evaluation.value_qi (iQuadPt, i + iblock * nbTestDof)
+                    * M_globalCFE[faceIDinAdjacentElement]->M_wMeas[iQuadPt];
+
+            }
+        }
     }
 }
 
@@ -38,6 +38,8 @@
 
 #include <lifev/core/LifeV.hpp>
 
+#include <lifev/core/util/OpenMPParameters.hpp>
+
 #include <lifev/core/fem/QuadratureRule.hpp>
 #include <lifev/core/mesh/RegionMesh.hpp>
 #include <lifev/eta/fem/ETCurrentFE.hpp>
@@ -50,6 +52,8 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <algorithm>
+#include <vector>
 
 
 namespace LifeV
@@ -103,6 +107,14 @@ public:
                              const std::shared_ptr<TestSpaceType>& testSpace,
                              const ExpressionType& expression);
 
+    //! Full data constructor with the OpenMP parameters of the assembly
+    IntegrateVectorVolumeID (const vectorVolumesPtr_Type volumeList,
+                             const vectorIndexesPtr_Type indexList,
+                             const QRAdapterType& qrAdapter,
+                             const std::shared_ptr<TestSpaceType>& testSpace,
+                             const ExpressionType& expression,
+                             const OpenMPParameters& ompParams);
+
     //! Copy constructor
     IntegrateVectorVolumeID ( const IntegrateVectorVolumeID < MeshType, TestSpaceType, ExpressionType, QRAdapterType>& integrator);
 
@@ -145,6 +157,11 @@ public:
       performed: update the values, update the local vector,
       sum over the quadrature nodes, assemble in the global
       vector.
+
+      If more than one thread is requested in the OpenMP parameters,
+      the elemental vectors are computed in parallel by blocks of
+      volumes and added to the global vector in the order of the
+      volumes, so that the result is the same as the serial one.
      */
     template <typename Vector>
     void addTo (Vector& vec);
@@ -159,8 +176,18 @@ private:
     // No default constructor
     IntegrateVectorVolumeID();
 
+    //! Assembly with several threads
+    template <typename Vector>
+    void addToThreaded (Vector& vec);
+
+    //! Compute the elemental vector of the i-th volume of the list with the current FEs of this integrator
+    void integrateVolume (const UInt iElement, ETVectorElemental& elementalVector, bool& isPreviousAdapted);
+
     //@}
 
+    //! Number of volumes computed by each thread between two additions to the global vector
+    static const UInt S_volumesPerThread = 512;
+
     //List of volumes with a marker
     vectorVolumesPtr_Type M_volumeList;
     vectorIndexesPtr_Type M_indexList;
@@ -181,6 +208,9 @@ private:
     ETCurrentFE<3, TestSpaceType::field_dim>* M_testCFE_adapted;
 
     ETVectorElemental M_elementalVector;
+
+    // OpenMP parameters of the assembly
+    OpenMPParameters M_ompParams;
 };
 
 
@@ -211,7 +241,8 @@ IntegrateVectorVolumeID (const vectorVolumesPtr_Type volumeList,
         M_testCFE_std (new ETCurrentFE<3, TestSpaceType::field_dim> (testSpace->refFE(), testSpace->geoMap(), qrAdapter.standardQR() ) ),
         M_testCFE_adapted (new ETCurrentFE<3, TestSpaceType::field_dim> (testSpace->refFE(), testSpace->geoMap(), qrAdapter.standardQR() ) ),
 
-        M_elementalVector (TestSpaceType::field_dim * testSpace->refFE().nbDof() )
+        M_elementalVector (TestSpaceType::field_dim * testSpace->refFE().nbDof() ),
+        M_ompParams()
 {
     M_evaluation.setQuadrature (qrAdapter.standardQR() );
     M_evaluation.setGlobalCFE (M_globalCFE_std);
@@ -219,6 +250,20 @@ IntegrateVectorVolumeID (const vectorVolumesPtr_Type volumeList,
 }
 
 
+template < typename MeshType, typename TestSpaceType, typename ExpressionType, typename QRAdapterType>
+IntegrateVectorVolumeID < MeshType, TestSpaceType, ExpressionType, QRAdapterType>::
+IntegrateVectorVolumeID (const vectorVolumesPtr_Type volumeList,
+                         const vectorIndexesPtr_Type indexList,
+                         const QRAdapterType& qrAdapter,
+                         const std::shared_ptr<TestSpaceType>& testSpace,
+                         const ExpressionType& expression,
+                         const OpenMPParameters& ompParams)
+    :   IntegrateVectorVolumeID (volumeList, indexList, qrAdapter, testSpace, expression)
+{
+    M_ompParams = ompParams;
+}
+
+
 template <typename MeshType, typename TestSpaceType, typename ExpressionType, typename QRAdapterType>
 IntegrateVectorVolumeID <MeshType, TestSpaceType, ExpressionType, QRAdapterType>::
 IntegrateVectorVolumeID ( const IntegrateVectorVolumeID <MeshType,  TestSpaceType, ExpressionType, QRAdapterType>& integrator)
@@ -234,7 +279,8 @@ IntegrateVectorVolumeID ( const IntegrateVectorVolumeID <MeshType,  TestSpaceTyp
         M_testCFE_std (new ETCurrentFE<3, TestSpaceType::field_dim> (M_testSpace->refFE(), M_testSpace->geoMap(), integrator.M_qrAdapter.standardQR() ) ),
         M_testCFE_adapted (new ETCurrentFE<3, TestSpaceType::field_dim> (M_testSpace->refFE(), M_testSpace->geoMap(), integrator.M_qrAdapter.standardQR() ) ),
 
-        M_elementalVector (integrator.M_elementalVector)
+        M_elementalVector (integrator.M_elementalVector),
+        M_ompParams (integrator.M_ompParams)
 {
     M_evaluation.setQuadrature (integrator.M_qrAdapter.standardQR() );
     M_evaluation.setGlobalCFE (M_globalCFE_std);
@@ -275,120 +321,186 @@ void
 IntegrateVectorVolumeID <MeshType, TestSpaceType, ExpressionType, QRAdapterType>::
 addTo (Vector& vec)
 {
-    // Defaulted to true for security
-    bool isPreviousAdapted (true);
-
     //number of volumes
     UInt nbElements ( (*M_volumeList).size() );
     UInt nbIndexes ( (*M_indexList).size() );
 
     ASSERT ( nbElements == nbIndexes, "The number of indexes is different from the number of volumes!!!");
 
-    UInt nbQuadPt_std (M_qrAdapter.standardQR().nbQuadPt() );
-    UInt nbTestDof (M_testSpace->refFE().nbDof() );
+    if (M_ompParams.numThreads > 1)
+    {
+        addToThreaded (vec);
+        return;
+    }
+
+    // Defaulted to true for security
+    bool isPreviousAdapted (true);
 
     for (UInt iElement (0); iElement < nbElements; ++iElement)
     {
-        // Zeros out the elemental vector
-        M_elementalVector.zero();
+        integrateVolume (iElement, M_elementalVector, isPreviousAdapted);
 
-        // Update the quadrature rule adapter
-        M_qrAdapter.update ( (*M_indexList) [iElement] );
+        M_elementalVector.pushToGlobal (vec);
+    }
+}
 
+template < typename MeshType, typename TestSpaceType, typename ExpressionType, typename QRAdapterType>
+template <typename Vector>
+void
+IntegrateVectorVolumeID <MeshType, TestSpaceType, ExpressionType, QRAdapterType>::
+addToThreaded (Vector& vec)
+{
+    const UInt nbElements ( (*M_volumeList).size() );
 
-        if (M_qrAdapter.isAdaptedElement() )
-        {
-            // Reset the quadrature in the different structures
-            M_evaluation.setQuadrature ( M_qrAdapter.adaptedQR() );
-            M_globalCFE_adapted -> setQuadratureRule ( M_qrAdapter.adaptedQR() );
-            M_testCFE_adapted -> setQuadratureRule ( M_qrAdapter.adaptedQR() );
+    // The global vector is not thread safe: the elemental vectors of a block
+    // of volumes are computed in parallel, then added in the order of the volumes
+    const UInt blockSize (std::max<UInt> (1, std::min<UInt> (nbElements, S_volumesPerThread * M_ompParams.numThreads) ) );
+    std::vector<ETVectorElemental> elementalVectors (blockSize, M_elementalVector);
 
-            // Reset the CurrentFEs in the evaluation
-            M_evaluation.setGlobalCFE ( M_globalCFE_adapted );
-            M_evaluation.setTestCFE ( M_testCFE_adapted );
+    // OpenMP setup and pragmas around the loop
+    M_ompParams.apply();
 
-            // Update with the correct element
-            M_evaluation.update ( (*M_indexList) [iElement] );
+    #pragma omp parallel
+    {
+        // The copy owns its quadrature adapter, current FEs and evaluation
+        IntegrateVectorVolumeID <MeshType, TestSpaceType, ExpressionType, QRAdapterType> integrator (*this);
 
-            // Update the currentFEs
-            M_globalCFE_adapted->update (* ( (*M_volumeList) [iElement]), evaluation_Type::S_globalUpdateFlag | ET_UPDATE_WDET);
-            M_testCFE_adapted->update (* ( (*M_volumeList) [iElement]), evaluation_Type::S_testUpdateFlag);
+        // Defaulted to true for security
+        bool isPreviousAdapted (true);
 
+        for (UInt blockBegin (0); blockBegin < nbElements; blockBegin += blockSize)
+        {
+            const UInt blockEnd (std::min (blockBegin + blockSize, nbElements) );
 
-            // Assembly
-            for (UInt iblock (0); iblock < TestSpaceType::field_dim; ++iblock)
+            #pragma omp for schedule(runtime)
+            for (UInt iElement = blockBegin; iElement < blockEnd; ++iElement)
             {
-                // Set the row global indices in the local vector
-                for (UInt i (0); i < nbTestDof; ++i)
+                integrator.integrateVolume (iElement, elementalVectors[ iElement - blockBegin ], isPreviousAdapted);
+            }
+
+            #pragma omp single
+            {
+                for (UInt iElement (blockBegin); iElement < blockEnd; ++iElement)
                 {
-                    M_elementalVector.setRowIndex
-                    (i + iblock * nbTestDof,
-                     M_testSpace->dof().localToGlobalMap ( (*M_indexList) [iElement], i) + iblock * M_testSpace->dof().numTotalDof() );
+                    elementalVectors[ iElement - blockBegin ].pushToGlobal (vec);
                 }
+            }
+        }
+    }
+
+    M_ompParams.restorePreviousNumThreads();
+}
+
+// ===================================================
+// Private Methods
+// ===================================================
+
+template < typename MeshType, typename TestSpaceType, typename ExpressionType, typename QRAdapterType>
+void
+IntegrateVectorVolumeID <MeshType, TestSpaceType, ExpressionType, QRAdapterType>::
+integrateVolume (const UInt iElement, ETVectorElemental& elementalVector, bool& isPreviousAdapted)
+{
+    UInt nbQuadPt_std (M_qrAdapter.standardQR().nbQuadPt() );
+    UInt nbTestDof (M_testSpace->refFE().nbDof() );
+
+    // Zeros out the elemental vector
+    elementalVector.zero();
+
+    // Update the quadrature rule adapter
+    M_qrAdapter.update ( (*M_indexList) [iElement] );
+
+
+    if (M_qrAdapter.isAdaptedElement() )
+    {
+        // Reset the quadrature in the different structures
+        M_evaluation.setQuadrature ( M_qrAdapter.adaptedQR() );
+        M_globalCFE_adapted -> setQuadratureRule ( M_qrAdapter.adaptedQR() );
+        M_testCFE_adapted -> setQuadratureRule ( M_qrAdapter.adaptedQR() );
+
+        // Reset the CurrentFEs in the evaluation
+        M_evaluation.setGlobalCFE ( M_globalCFE_adapted );
+        M_evaluation.setTestCFE ( M_testCFE_adapted );
+
+        // Update with the correct element
+        M_evaluation.update ( (*M_indexList) [iElement] );
+
+        // Update the currentFEs
+        M_globalCFE_adapted->update (* ( (*M_volumeList) [iElement]), evaluation_Type::S_globalUpdateFlag | ET_UPDATE_WDET);
+        M_testCFE_adapted->update (* ( (*M_volumeList) [iElement]), evaluation_Type::S_testUpdateFlag);
+
 
-                // Make the assembly
-                for (UInt iQuadPt (0); iQuadPt < M_qrAdapter.adaptedQR().nbQuadPt(); ++iQuadPt)
+        // Assembly
+        for (UInt iblock (0); iblock < TestSpaceType::field_dim; ++iblock)
+        {
+            // Set the row global indices in the local vector
+            for (UInt i (0); i < nbTestDof; ++i)
+            {
+                elementalVector.setRowIndex
+                (i + iblock * nbTestDof,
+                 M_testSpace->dof().localToGlobalMap ( (*M_indexList) [iElement], i) + iblock * M_testSpace->dof().numTotalDof() );
+            }
+
+            // Make the assembly
+            for (UInt iQuadPt (0); iQuadPt < M_qrAdapter.adaptedQR().nbQuadPt(); ++iQuadPt)
+            {
+                for (UInt i (0); i < nbTestDof; ++i)
                 {
-                    for (UInt i (0); i < nbTestDof; ++i)
-                    {
-                        M_elementalVector.element (i + iblock * nbTestDof) +=
-                            M_evaluation.value_qi (iQuadPt, i + iblock * nbTestDof)
-                            * M_globalCFE_adapted->wDet (iQuadPt);
+                    elementalVector.element (i + iblock * nbTestDof) +=
+                        M_evaluation.value_qi (iQuadPt, i + iblock * nbTestDof)
+                        * M_globalCFE_adapted->wDet (iQuadPt);
 
-                    }
                 }
             }
-
-            // Finally, set the flag
-            isPreviousAdapted = true;
         }
-        else
+
+        // Finally, set the flag
+        isPreviousAdapted = true;
+    }
+    else
+    {
+
+        // Check if the last one was adapted
+        if (isPreviousAdapted)
         {
+            M_evaluation.setQuadrature ( M_qrAdapter.standardQR() );
+            M_evaluation.setGlobalCFE ( M_globalCFE_std );
+            M_evaluation.setTestCFE ( M_testCFE_std );
 
-            // Check if the last one was adapted
-            if (isPreviousAdapted)
-            {
-                M_evaluation.setQuadrature ( M_qrAdapter.standardQR() );
-                M_evaluation.setGlobalCFE ( M_globalCFE_std );
-                M_evaluation.setTestCFE ( M_testCFE_std );
+            isPreviousAdapted = false;
+        }
 
-                isPreviousAdapted = false;
-            }
 
+        // Update the currentFEs
+        M_globalCFE_std->update (* ( (*M_volumeList) [iElement]), evaluation_Type::S_globalUpdateFlag | ET_UPDATE_WDET);
+        M_testCFE_std->update (* ( (*M_volumeList) [iElement]), evaluation_Type::S_testUpdateFlag);
 
-            // Update the currentFEs
-            M_globalCFE_std->update (* ( (*M_volumeList) [iElement]), evaluation_Type::S_globalUpdateFlag | ET_UPDATE_WDET);
-            M_testCFE_std->update (* ( (*M_volumeList) [iElement]), evaluation_Type::S_testUpdateFlag);
+        // Update the evaluation
+        M_evaluation.update ( (*M_indexList) [iElement] );
 
-            // Update the evaluation
-            M_evaluation.update ( (*M_indexList) [iElement] );
+        // Loop on the blocks
+        for (UInt iblock (0); iblock < TestSpaceType::field_dim; ++iblock)
+        {
+            // Set the row global indices in the local vector
+            for (UInt i (0); i < nbTestDof; ++i)
+            {
+                elementalVector.setRowIndex
+                (i + iblock * nbTestDof,
+                 M_testSpace->dof().localToGlobalMap ( (*M_indexList) [iElement], i) + iblock * M_testSpace->dof().numTotalDof() );
+            }
 
-            // Loop on the blocks
-            for (UInt iblock (0); iblock < TestSpaceType::field_dim; ++iblock)
+            // Make the assembly
+            for (UInt iQuadPt (0); iQuadPt < nbQuadPt_std; ++iQuadPt)
             {
-                // Set the row global indices in the local vector
                 for (UInt i (0); i < nbTestDof; ++i)
                 {
-                    M_elementalVector.setRowIndex
-                    (i + iblock * nbTestDof,
-                     M_testSpace->dof().localToGlobalMap ( (*M_indexList) [iElement], i) + iblock * M_testSpace->dof().numTotalDof() );
-                }
+                    elementalVector.element (i + iblock * nbTestDof) +=
+                        M_evaluation.value_qi (iQuadPt, i + iblock * nbTestDof) *
+                        M_globalCFE_std->wDet (iQuadPt);
 
-                // Make the assembly
-                for (UInt iQuadPt (0); iQuadPt < nbQuadPt_std; ++iQuadPt)
-                {
-                    for (UInt i (0); i < nbTestDof; ++i)
-                    {
-                        M_elementalVector.element (i + iblock * nbTestDof) +=
-                            M_evaluation.value_qi (iQuadPt, i + iblock * nbTestDof) *
-                            M_globalCFE_std->wDet (iQuadPt);
-
-                    }
                 }
             }
-
         }
-        M_elementalVector.pushToGlobal (vec);
+
     }
 }
 
@@ -269,13 +269,15 @@ public:
 
     void setupInternalConstants()
     {
+        const ReferenceElement::tabulationPtr_Type geoTabulation (M_geometricMap->tabulation (*M_quadrature) );
+
         M_phiMap.resize (M_nbQuadPt);
         for (UInt q (0); q < M_nbQuadPt; ++q)
         {
             M_phiMap[q].resize (M_nbMapDof);
             for (UInt i (0); i < M_nbMapDof; ++i)
             {
-                M_phiMap[q][i] = M_geometricMap->phi (i, M_quadrature->quadPointCoor (q) );
+                M_phiMap[q][i] = geoTabulation->phi (q, i);
             }
         }
 
@@ -289,7 +291,7 @@ public:
                 M_dphiGeometricMap[q][i].resize (spaceDim);
                 for (UInt j (0); j < spaceDim; ++j)
                 {
-                    M_dphiGeometricMap[q][i][j] = M_geometricMap->dPhi (i, j, M_quadrature->quadPointCoor (q) );
+                    M_dphiGeometricMap[q][i][j] = geoTabulation->dPhi (q, i, j);
                 }
             }
         }
@@ -1054,7 +1054,12 @@ ETCurrentFE<spaceDim, 1>::
 setupInternalConstants()
 {
     // The first group of values can be computed as it
-    // it does not depend on the current element
+    // it does not depend on the current element.
+    // They are copied from the tabulations of the reference
+    // elements, shared by all the current FEs using the same
+    // quadrature rule.
+    const ReferenceElement::tabulationPtr_Type tabulation (M_referenceFE->tabulation (*M_quadratureRule) );
+    const ReferenceElement::tabulationPtr_Type geoTabulation (M_geometricMap->tabulation (*M_quadratureRule) );
 
     // PHI
     M_phi.resize (M_nbQuadPt);
@@ -1063,7 +1068,7 @@ setupInternalConstants()
         M_phi[q].resize (M_nbFEDof);
         for (UInt j (0); j < M_nbFEDof; ++j)
         {
-            M_phi[q][j] = M_referenceFE->phi (j, M_quadratureRule->quadPointCoor (q) );
+            M_phi[q][j] = tabulation->phi (q, j);
         }
     }
 
@@ -1078,7 +1083,7 @@ setupInternalConstants()
         M_phiMap[q].resize (M_nbMapDof);
         for (UInt i (0); i < M_nbMapDof; ++i)
         {
-            M_phiMap[q][i] = M_geometricMap->phi (i, M_quadratureRule->quadPointCoor (q) );
+            M_phiMap[q][i] = geoTabulation->phi (q, i);
         }
     }
 
@@ -1092,7 +1097,7 @@ setupInternalConstants()
             M_dphiReferenceFE[q][i].resize (spaceDim);
             for (UInt j (0); j < spaceDim; ++j)
             {
-                M_dphiReferenceFE[q][i][j] = M_referenceFE->dPhi (i, j, M_quadratureRule->quadPointCoor (q) );
+                M_dphiReferenceFE[q][i][j] = tabulation->dPhi (q, i, j);
             }
         }
     }
@@ -1107,12 +1112,12 @@ setupInternalConstants()
             M_dphiGeometricMap[q][i].resize (spaceDim);
             for (UInt j (0); j < spaceDim; ++j)
             {
-                M_dphiGeometricMap[q][i][j] = M_geometricMap->dPhi (i, j, M_quadratureRule->quadPointCoor (q) );
+                M_dphiGeometricMap[q][i][j] = geoTabulation->dPhi (q, i, j);
             }
         }
     }
-    
-    // DPHI2REFERENCEFE
+
+    // D2PHIREFERENCEFE
     M_d2phiReferenceFE.resize (M_nbQuadPt);
     for (UInt q (0); q < M_nbQuadPt; ++q)
     {
@@ -1125,31 +1130,12 @@ setupInternalConstants()
                 M_d2phiReferenceFE[q][i][j].resize (spaceDim);
                 for (UInt k (0); k < spaceDim; ++k)
                 {
-                    M_d2phiReferenceFE[q][i][j][k] = M_referenceFE->d2Phi (i, j, k, M_quadratureRule->quadPointCoor (q) );
+                    M_d2phiReferenceFE[q][i][j][k] = tabulation->d2Phi (q, i, j, k);
                 }
             }
         }
     }
 
-    // D2PHIREFERENCEFE
-    M_d2phiReferenceFE.resize (M_nbQuadPt);
-    for (UInt q (0); q < M_nbQuadPt; ++q)
-    {
-    	M_d2phiReferenceFE[q].resize (M_nbFEDof);
-    	for (UInt i (0); i < M_nbFEDof; ++i)
-    	{
-    		M_d2phiReferenceFE[q][i].resize (spaceDim);
-    		for (UInt j (0); j < spaceDim; ++j)
-    		{
-    			M_d2phiReferenceFE[q][i][j].resize (spaceDim);
-    			for (UInt k (0); k < spaceDim; ++k)
-    			{
-    				M_d2phiReferenceFE[q][i][j][k] = M_referenceFE->d2Phi (i, j, k, M_quadratureRule->quadPointCoor (q) );
-    			}
-    		}
-    	}
-    }
-
     // The second group of values cannot be computed
     // now because it depends on the current element.
     // So, we just make space for it.
@@ -777,7 +777,12 @@ ETCurrentFE<spaceDim, fieldDim>::
 setupInternalConstants()
 {
     // The first group of values can be computed as it
-    // it does not depend on the current element
+    // it does not depend on the current element.
+    // They are copied from the tabulations of the reference
+    // elements, shared by all the current FEs using the same
+    // quadrature rule.
+    const ReferenceElement::tabulationPtr_Type tabulation (M_referenceFE->tabulation (*M_quadratureRule) );
+    const ReferenceElement::tabulationPtr_Type geoTabulation (M_geometricMap->tabulation (*M_quadratureRule) );
 
     // PHI
     M_phi.resize ( M_nbQuadPt );
@@ -789,7 +794,7 @@ setupInternalConstants()
         // set only appropriate values, other are initialized to 0 by default constructor (of VectorSmall)
         for ( UInt j ( 0 ); j < M_nbFEDof; ++j )
         {
-            M_phi[q][j][0] = M_referenceFE->phi ( j, M_quadratureRule->quadPointCoor ( q ) );
+            M_phi[q][j][0] = tabulation->phi ( q, j );
 
             // copy other values according to the vectorial basis functions
             for ( UInt k ( 1 ); k < S_fieldDimension; ++k )
@@ -809,7 +814,7 @@ setupInternalConstants()
         M_phiMap[q].resize (M_nbMapDof);
         for (UInt i (0); i < M_nbMapDof; ++i)
         {
-            M_phiMap[q][i] = M_geometricMap->phi (i, M_quadratureRule->quadPointCoor (q) );
+            M_phiMap[q][i] = geoTabulation->phi (q, i);
         }
     }
 
@@ -823,7 +828,7 @@ setupInternalConstants()
             M_dphiReferenceFE[q][i].resize (spaceDim);
             for (UInt j (0); j < spaceDim; ++j)
             {
-                M_dphiReferenceFE[q][i][j] = M_referenceFE->dPhi (i, j, M_quadratureRule->quadPointCoor (q) );
+                M_dphiReferenceFE[q][i][j] = tabulation->dPhi (q, i, j);
             }
         }
     }
@@ -838,7 +843,7 @@ setupInternalConstants()
             M_dphiGeometricMap[q][i].resize (spaceDim);
             for (UInt j (0); j < spaceDim; ++j)
             {
-                M_dphiGeometricMap[q][i][j] = M_geometricMap->dPhi (i, j, M_quadratureRule->quadPointCoor (q) );
+                M_dphiGeometricMap[q][i][j] = geoTabulation->dPhi (q, i, j);
             }
         }
     }
@@ -857,7 +862,7 @@ setupInternalConstants()
     			M_d2phiReferenceFE[q][i][j].resize (spaceDim);
     			for (UInt k (0); k < spaceDim; ++k)
     			{
-    				M_d2phiReferenceFE[q][i][j][k] = M_referenceFE->d2Phi (i, j, k, M_quadratureRule->quadPointCoor (q) );
+    				M_d2phiReferenceFE[q][i][j][k] = tabulation->d2Phi (q, i, j, k);
     			}
     		}
     	}
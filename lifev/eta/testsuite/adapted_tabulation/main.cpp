@@ -0,0 +1,167 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Test of the tabulations of the reference elements with adapted quadrature rules
+
+    As the level set adapted integrators do for every cut element, a new
+    quadrature rule (same name, different nodes) is set in an ETCurrentFE.
+    The values of the basis functions must match the ones of the reference
+    element in the new nodes, and the number of tabulations kept by the
+    reference elements must stay bounded.
+
+    @date 10-2026
+ */
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/fem/GeometricMap.hpp>
+#include <lifev/core/fem/QuadratureRule.hpp>
+#include <lifev/core/fem/ReferenceFEScalar.hpp>
+
+#include <lifev/eta/fem/ETCurrentFE.hpp>
+
+using namespace LifeV;
+
+namespace
+{
+
+const Real S_tolerance = 1e-14;
+
+// Rule with the name of qr and its nodes contracted towards the first vertex
+QuadratureRule adaptedRule ( const QuadratureRule& qr, const Real& factor )
+{
+    std::vector<GeoVector> coordinates;
+    std::vector<Real> weights;
+    for ( UInt q ( 0 ); q < qr.nbQuadPt(); ++q )
+    {
+        coordinates.push_back ( qr.quadPointCoor ( q ) * factor );
+        weights.push_back ( qr.weight ( q ) * factor * factor * factor );
+    }
+
+    QuadratureRule adapted ( qr );
+    adapted.setPoints ( coordinates, weights );
+    return adapted;
+}
+
+// Compare the values of the basis functions in the current FE with the reference element
+bool checkPhi ( const ETCurrentFE<3, 1>& currentFE, const ReferenceElement& refFE, const QuadratureRule& qr )
+{
+    Real error ( 0. );
+    for ( UInt q ( 0 ); q < qr.nbQuadPt(); ++q )
+    {
+        for ( UInt i ( 0 ); i < refFE.nbDof(); ++i )
+        {
+            error = std::max ( error, std::fabs ( currentFE.phi ( i, q ) - refFE.phi ( i, qr.quadPointCoor ( q ) ) ) );
+        }
+    }
+    return error < S_tolerance;
+}
+
+// Compare a tabulation with the reference element
+bool checkTabulation ( const ReferenceElement::Tabulation& tabulation, const ReferenceElement& refFE, const QuadratureRule& qr )
+{
+    Real error ( 0. );
+    for ( UInt q ( 0 ); q < qr.nbQuadPt(); ++q )
+    {
+        for ( UInt i ( 0 ); i < refFE.nbDof(); ++i )
+        {
+            error = std::max ( error, std::fabs ( tabulation.phi ( q, i ) - refFE.phi ( i, qr.quadPointCoor ( q ) ) ) );
+            for ( UInt icoor ( 0 ); icoor < refFE.nbLocalCoor(); ++icoor )
+            {
+                error = std::max ( error, std::fabs ( tabulation.dPhi ( q, i, icoor ) - refFE.dPhi ( i, icoor, qr.quadPointCoor ( q ) ) ) );
+            }
+        }
+    }
+    return error < S_tolerance;
+}
+
+}
+
+int main ( int argc, char** argv )
+{
+#ifdef HAVE_MPI
+    MPI_Init ( &argc, &argv );
+#endif
+
+    bool passed ( true );
+    {
+        const ReferenceFEScalar& refFE ( feTetraP2 );
+        const GeometricMap& geoMap ( geoLinearTetra );
+        const QuadratureRule& qr ( quadRuleTetra4pt );
+
+        ETCurrentFE<3, 1> currentFE ( refFE, geoMap, qr );
+        passed &= checkPhi ( currentFE, refFE, qr );
+
+        // Kept by the caller across the evictions
+        const QuadratureRule firstRule ( adaptedRule ( qr, 0.99 ) );
+        const ReferenceElement::tabulationPtr_Type firstTabulation ( refFE.tabulation ( firstRule ) );
+
+        // One new rule per cut element
+        for ( UInt element ( 0 ); element < 50; ++element )
+        {
+            const QuadratureRule rule ( adaptedRule ( qr, ( element + 1. ) / 60. ) );
+            currentFE.setQuadratureRule ( rule );
+            passed &= checkPhi ( currentFE, refFE, rule );
+        }
+
+        passed &= refFE.nbTabulations() <= ReferenceElement::S_maxNbTabulations;
+        passed &= geoMap.nbTabulations() <= ReferenceElement::S_maxNbTabulations;
+        passed &= checkTabulation ( *firstTabulation, refFE, firstRule );
+
+        // Back to the standard rule, whose tabulation has been evicted
+        currentFE.setQuadratureRule ( qr );
+        passed &= checkPhi ( currentFE, refFE, qr );
+        passed &= checkTabulation ( *refFE.tabulation ( qr ), refFE, qr );
+
+        // A rule used for every element stays in the cache
+        const ReferenceElement::tabulationPtr_Type standardTabulation ( refFE.tabulation ( qr ) );
+        passed &= refFE.tabulation ( qr ) == standardTabulation;
+    }
+
+    std::cout << ( passed ? "Adapted tabulation test passed" : "Adapted tabulation test FAILED" ) << std::endl;
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !passed )
+    {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
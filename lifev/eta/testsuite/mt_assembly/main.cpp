@@ -28,6 +28,10 @@
     @file
     @brief Test for building matrices with a static graph and ETA
 
+    The element, face and volume-ID integrators are then timed with an
+    increasing number of threads, up to the requested one, and their
+    results are compared with the serial ones.
+
     @author Radu Popescu <radu.popescu@epfl.ch>
     @date 2012-03-19
  */
@@ -36,6 +40,8 @@
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 
 #include <cstdlib>
+#include <iomanip>
+#include <vector>
 
 #include <Epetra_ConfigDefs.h>
 #ifdef EPETRA_MPI
@@ -59,8 +65,10 @@
 #include <lifev/core/mesh/RegionMesh.hpp>
 
 #include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
 
 #include <lifev/eta/fem/ETFESpace.hpp>
+#include <lifev/eta/fem/QuadratureBoundary.hpp>
 
 #include <lifev/eta/expression/Integrate.hpp>
 #include <lifev/eta/expression/BuildGraph.hpp>
@@ -73,6 +81,7 @@ using namespace LifeV;
 
 typedef RegionMesh<LinearTetra> mesh_Type;
 typedef MatrixEpetra<Real> matrix_Type;
+typedef VectorEpetra vector_Type;
 
 int main ( int argc, char** argv )
 {
@@ -217,6 +226,173 @@ int main ( int argc, char** argv )
         std::cout << " Closed matrix norm : " << closedMatrixNorm << std::endl;
     }
 
+    // Scaling of the other integrators: each one is timed with 1, 2, 4, ... threads up to
+    // the requested number. The threaded assembly adds the contributions in the same order
+    // as the serial one: the results must be identical for any number of threads
+    std::vector<UInt> threadCounts;
+    for (UInt numThreads (1); numThreads < static_cast<UInt> (ompParams.numThreads); numThreads *= 2)
+    {
+        threadCounts.push_back (numThreads);
+    }
+    threadCounts.push_back (std::max<UInt> (ompParams.numThreads, 1) );
+
+    // Faces of the bottom wall of the structured mesh
+    const UInt boundaryFlag (5);
+    QuadratureBoundary boundaryQR (buildTetraBDQR (quadRuleTria4pt) );
+
+    // Volumes on which the VolumeID integrators loop: every other element
+    std::shared_ptr<std::vector<mesh_Type::element_Type*> > volumes (new std::vector<mesh_Type::element_Type*>);
+    std::shared_ptr<std::vector<UInt> > volumeIndexes (new std::vector<UInt>);
+    for (UInt iElement (0); iElement < uSpace->mesh()->numElements(); iElement += 2)
+    {
+        volumes->push_back (&uSpace->mesh()->element (iElement) );
+        volumeIndexes->push_back (iElement);
+    }
+
+    const UInt numIntegrators (6);
+    const std::string integratorNames[ numIntegrators ] =
+    {
+        "element vector", "element value", "face vector", "face matrix", "volume vector", "volume matrix"
+    };
+    std::vector<Real> serialTimes (numIntegrators, 0.);
+
+    vector_Type serialRhs ( uSpace->map(), Repeated );
+    vector_Type serialFaceRhs ( uSpace->map(), Repeated );
+    vector_Type serialVolumeRhs ( uSpace->map(), Repeated );
+    Real serialIntegral (0.);
+    Real serialFaceMatrixNorm (0.);
+    Real serialVolumeMatrixNorm (0.);
+
+    Real rhsDiff (0.);
+    Real integralDiff (0.);
+    Real matrixNormDiff (0.);
+
+    if (verbose)
+    {
+        std::cout << " -- Scaling of the threaded assembly (time in s, speedup)" << std::endl;
+    }
+
+    for (UInt iCount (0); iCount < threadCounts.size(); ++iCount)
+    {
+        using namespace ExpressionAssembly;
+
+        OpenMPParameters countParams (ompParams);
+        countParams.numThreads = threadCounts[ iCount ];
+
+        vector_Type rhs ( uSpace->map(), Repeated );
+        vector_Type faceRhs ( uSpace->map(), Repeated );
+        vector_Type volumeRhs ( uSpace->map(), Repeated );
+        matrix_Type faceMatrix ( uSpace->map() );
+        matrix_Type volumeMatrix ( uSpace->map() );
+        Real integral (0.);
+
+        std::vector<Real> times (numIntegrators, 0.);
+
+        timer.start();
+        integrate (  elements (uSpace->mesh() ),
+                     quadRuleTetra4pt,
+                     uSpace,
+                     value (2.0) * phi_i, countParams
+                  ) >> rhs;
+        timer.stop();
+        times[ 0 ] = timer.elapsedTime();
+
+        timer.start();
+        integrate (  elements (uSpace->mesh() ),
+                     quadRuleTetra4pt,
+                     value (2.0), countParams
+                  ) >> integral;
+        timer.stop();
+        times[ 1 ] = timer.elapsedTime();
+
+        timer.start();
+        integrate (  boundary (uSpace->mesh(), boundaryFlag),
+                     boundaryQR,
+                     uSpace,
+                     value (2.0) * phi_i, countParams
+                  ) >> faceRhs;
+        timer.stop();
+        times[ 2 ] = timer.elapsedTime();
+
+        timer.start();
+        integrate (  boundary (uSpace->mesh(), boundaryFlag),
+                     boundaryQR,
+                     uSpace,
+                     uSpace,
+                     phi_i * phi_j, countParams
+                  ) >> faceMatrix;
+        timer.stop();
+        times[ 3 ] = timer.elapsedTime();
+
+        timer.start();
+        integrate (  integrationOverSelectedVolumes<mesh_Type> (volumes, volumeIndexes),
+                     quadRuleTetra4pt,
+                     uSpace,
+                     value (2.0) * phi_i, countParams
+                  ) >> volumeRhs;
+        timer.stop();
+        times[ 4 ] = timer.elapsedTime();
+
+        timer.start();
+        integrate (  integrationOverSelectedVolumes<mesh_Type> (volumes, volumeIndexes),
+                     quadRuleTetra4pt,
+                     uSpace,
+                     uSpace,
+                     dot ( grad (phi_i) , grad (phi_j) ), countParams
+                  ) >> volumeMatrix;
+        timer.stop();
+        times[ 5 ] = timer.elapsedTime();
+
+        faceMatrix.globalAssemble();
+        volumeMatrix.globalAssemble();
+
+        if (iCount == 0)
+        {
+            serialTimes = times;
+            serialRhs = rhs;
+            serialFaceRhs = faceRhs;
+            serialVolumeRhs = volumeRhs;
+            serialIntegral = integral;
+            serialFaceMatrixNorm = faceMatrix.normFrobenius();
+            serialVolumeMatrixNorm = volumeMatrix.normFrobenius();
+        }
+        else
+        {
+            rhs -= serialRhs;
+            faceRhs -= serialFaceRhs;
+            volumeRhs -= serialVolumeRhs;
+            rhsDiff = std::max (rhsDiff, std::max (rhs.normInf(), std::max (faceRhs.normInf(), volumeRhs.normInf() ) ) );
+
+            Real localIntegralDiff ( std::abs (integral - serialIntegral) );
+            Real globalIntegralDiff (0.);
+            Comm->MaxAll (&localIntegralDiff, &globalIntegralDiff, 1);
+            integralDiff = std::max (integralDiff, globalIntegralDiff);
+
+            matrixNormDiff = std::max (matrixNormDiff, std::max (std::abs (faceMatrix.normFrobenius() - serialFaceMatrixNorm),
+                                                                 std::abs (volumeMatrix.normFrobenius() - serialVolumeMatrixNorm) ) );
+        }
+
+        if (verbose)
+        {
+            std::cout << " ---> " << countParams.numThreads << " thread(s)" << std::endl;
+            for (UInt i (0); i < numIntegrators; ++i)
+            {
+                std::cout << "      " << std::setw (16) << std::left << integratorNames[ i ] << std::right
+                          << std::setw (12) << times[ i ]
+                          << std::setw (8) << std::setprecision (3)
+                          << ( times[ i ] > 0. ? serialTimes[ i ] / times[ i ] : 0. )
+                          << std::setprecision (6) << std::endl;
+            }
+        }
+    }
+
+    if (verbose)
+    {
+        std::cout << " Difference with the serial assembly (vectors): " << rhsDiff << std::endl;
+        std::cout << " Difference with the serial assembly (value): " << integralDiff << std::endl;
+        std::cout << " Difference with the serial assembly (matrix norms): " << matrixNormDiff << std::endl;
+    }
+
 #ifdef HAVE_MPI
     MPI_Finalize();
 #endif
@@ -230,7 +406,7 @@ int main ( int argc, char** argv )
 
     Real testTolerance (1e-10);
 
-    if ( closedMatrixNormDiff >= testTolerance )
+    if ( closedMatrixNormDiff >= testTolerance || rhsDiff != 0. || integralDiff != 0. || matrixNormDiff != 0. )
     {
         return ( EXIT_FAILURE );
     }
@@ -1983,15 +1983,18 @@ FSIHandler::evalResidual(vector_Type& residual, const vector_Type& solution, con
                 old_second_der_terms->zero();
                 M_structureTimeAdvanceBDF->second_der_old_dts(*old_second_der_terms);
 
-                *res_ds = ( ( ( 1.0 / ( M_dt * M_dt ) * M_structureTimeAdvanceBDF->massCoefficient() ) * ( (*M_structure->mass_matrix_no_bc() ) * (*ds_k) ) ) +
-                          ( (*M_structure->stiffness_matrix_no_bc() ) * (*ds_k) ) +
-                          ( ( 1.0 / ( M_dt * M_dt ) ) * ( ( *M_structure->mass_matrix_no_bc() ) * ( *old_second_der_terms ) ) ) );
+                // res_ds = M ( c ds_k + old / dt^2 ) + K ds_k, the scaled sums without temporaries
+                old_second_der_terms->update ( 1.0 / ( M_dt * M_dt ) * M_structureTimeAdvanceBDF->massCoefficient(), *ds_k, 1.0 / ( M_dt * M_dt ) );
+                *res_ds = ( *M_structure->mass_matrix_no_bc() ) * ( *old_second_der_terms );
+                *res_ds += ( *M_structure->stiffness_matrix_no_bc() ) * ( *ds_k );
             }
             else
             {
-                *res_ds = ( ( ( 1.0/ ( M_dt * M_dt * M_structureTimeAdvance->get_beta() ) ) * ( (*M_structure->mass_matrix_no_bc() ) * (*ds_k) ) ) +
-                          ( (*M_structure->stiffness_matrix_no_bc() ) * (*ds_k) ) -
-                          ( (*M_structure->mass_matrix_no_bc() ) * (*M_structureTimeAdvance->get_csi()) ) );
+                // res_ds = M ( ds_k / ( dt^2 beta ) - csi ) + K ds_k, the scaled sums without temporaries
+                vector_Type inertia ( *M_structureTimeAdvance->get_csi() );
+                inertia.update ( 1.0 / ( M_dt * M_dt * M_structureTimeAdvance->get_beta() ), *ds_k, -1.0 );
+                *res_ds = ( *M_structure->mass_matrix_no_bc() ) * inertia;
+                *res_ds += ( *M_structure->stiffness_matrix_no_bc() ) * ( *ds_k );
             }
         }
         else
@@ -2088,11 +2091,11 @@ FSIHandler::evalResidual(vector_Type& residual, const vector_Type& solution, con
 
         if ( M_useBDF )
         {
-            *structure_vel = ( ( M_structureTimeAdvanceBDF->coefficientFirstDerivative()/ M_dt ) * (*ds_k) );
+            structure_vel->update ( M_structureTimeAdvanceBDF->coefficientFirstDerivative() / M_dt, *ds_k, 0. );
         }
         else
         {
-            *structure_vel = ( ( M_structureTimeAdvance->get_gamma()/(M_dt * M_structureTimeAdvance->get_beta() ) ) * (*ds_k) );
+            structure_vel->update ( M_structureTimeAdvance->get_gamma() / ( M_dt * M_structureTimeAdvance->get_beta() ), *ds_k, 0. );
         }
         
 		vectorPtr_Type res_couplingVel_omega_f ( new vector_Type ( M_fluid->uFESpace()->map() ) );
@@ -2107,7 +2110,9 @@ FSIHandler::evalResidual(vector_Type& residual, const vector_Type& solution, con
 
 		M_FluidToStructureInterpolant->restrictOmegaToGamma_Known(res_couplingVel_omega_f, res_couplingVel_gamma_f);
 
-		*res_lambda = (*velocity_km1_gamma - *res_couplingVel_gamma_f + *M_rhsCouplingVelocities );
+		*res_lambda = *velocity_km1_gamma;
+		res_lambda->add ( -1., *res_couplingVel_gamma_f );
+		*res_lambda += *M_rhsCouplingVelocities;
 
 		//--------------------------------------------//
 		// Residual, part 4: compute the ALE residual //
@@ -2168,17 +2173,20 @@ FSIHandler::evalResidual(vector_Type& residual, const vector_Type& solution, con
 				old_second_der_terms->zero();
 				M_structureTimeAdvanceBDF->second_der_old_dts(*old_second_der_terms);
 
-				*res_ds = ( ( ( 1.0 / ( M_dt * M_dt ) * M_structureTimeAdvanceBDF->massCoefficient() ) * ( (*M_structure->mass_matrix_no_bc() ) * (*ds_k) ) ) +
-						    ( (*M_structure->stiffness_matrix_no_bc() ) * (*ds_k) ) +
-						    ( (*M_coupling->lambdaToStructureMomentum() ) * (*lambda_k) ) +
-						    ( ( 1.0 / ( M_dt * M_dt ) ) * ( ( *M_structure->mass_matrix_no_bc() ) * ( *old_second_der_terms ) ) ) );
+				// res_ds = M ( c ds_k + old / dt^2 ) + K ds_k + C lambda_k, the scaled sums without temporaries
+				old_second_der_terms->update ( 1.0 / ( M_dt * M_dt ) * M_structureTimeAdvanceBDF->massCoefficient(), *ds_k, 1.0 / ( M_dt * M_dt ) );
+				*res_ds = ( *M_structure->mass_matrix_no_bc() ) * ( *old_second_der_terms );
+				*res_ds += ( *M_structure->stiffness_matrix_no_bc() ) * ( *ds_k );
+				*res_ds += ( *M_coupling->lambdaToStructureMomentum() ) * ( *lambda_k );
 			}
 			else
 			{
-				*res_ds = ( ( ( 1.0/ ( M_dt * M_dt * M_structureTimeAdvance->get_beta() ) ) * ( (*M_structure->mass_matrix_no_bc() ) * (*ds_k) ) ) +
-							( (*M_structure->stiffness_matrix_no_bc() ) * (*ds_k) ) +
-							( (*M_coupling->lambdaToStructureMomentum() ) * (*lambda_k) ) -
-							( (*M_structure->mass_matrix_no_bc() ) * (*M_structureTimeAdvance->get_csi()) ) );
+				// res_ds = M ( ds_k / ( dt^2 beta ) - csi ) + K ds_k + C lambda_k, the scaled sums without temporaries
+				vector_Type inertia ( *M_structureTimeAdvance->get_csi() );
+				inertia.update ( 1.0 / ( M_dt * M_dt * M_structureTimeAdvance->get_beta() ), *ds_k, -1.0 );
+				*res_ds = ( *M_structure->mass_matrix_no_bc() ) * inertia;
+				*res_ds += ( *M_structure->stiffness_matrix_no_bc() ) * ( *ds_k );
+				*res_ds += ( *M_coupling->lambdaToStructureMomentum() ) * ( *lambda_k );
 			}
 		}
 		else
@@ -51,7 +51,8 @@ MultiscaleCommunicatorsManager::MultiscaleCommunicatorsManager() :
     M_serialProcesses    (),
     M_parallelModelsID   (),
     M_parallelModelsLoad (),
-    M_parallelProcesses  ()
+    M_parallelProcesses  (),
+    M_modelsCost         ()
 {
 
 #ifdef HAVE_LIFEV_DEBUG
@@ -103,7 +104,7 @@ MultiscaleCommunicatorsManager::splitCommunicator()
 
     // Parallel models: identify number of processes per model
     std::vector<Real> localNumberOfProcesses ( M_parallelModelsID.size(), 0 );
-    parallelProcessesDistribution ( localNumberOfProcesses, numberOfProcesses );
+    parallelProcessesDistribution ( localNumberOfProcesses, M_parallelModelsLoad, numberOfProcesses );
 
     // Parallel models: assign processes number to the models
     parallelProcessesAssignment ( M_parallelProcesses, localNumberOfProcesses, numberOfProcesses );
@@ -191,6 +192,88 @@ MultiscaleCommunicatorsManager::showMe()
     }
 }
 
+void
+MultiscaleCommunicatorsManager::showLoadBalance()
+{
+
+#ifdef HAVE_LIFEV_DEBUG
+    debugStream ( 8005 ) << "MultiscaleCommunicatorsManager::showLoadBalance() \n";
+#endif
+
+    UInt parallelModelsNumber ( M_parallelModelsID.size() );
+    if ( parallelModelsNumber == 0 )
+    {
+        return;
+    }
+
+    // Each process provides the time spent on its own parallel models: the slowest process gives the cost of the model
+    std::vector<Real> localTime ( parallelModelsNumber, 0 );
+    std::vector<Real> globalTime ( parallelModelsNumber, 0 );
+    for ( UInt i (0) ; i < parallelModelsNumber ; ++i )
+    {
+        modelsCost_Type::const_iterator cost = M_modelsCost.find ( M_parallelModelsID[i] );
+        if ( cost != M_modelsCost.end() )
+        {
+            localTime[i] = cost->second;
+        }
+    }
+    M_comm->MaxAll ( &localTime[0], &globalTime[0], parallelModelsNumber );
+
+    // The work of a model is its time multiplied by the number of processes used to solve it
+    Real totalWork (0);
+    modelsLoad_Type measuredLoad ( parallelModelsNumber, 0 );
+    for ( UInt i (0) ; i < parallelModelsNumber ; ++i )
+    {
+        measuredLoad[i] = globalTime[i] * M_parallelProcesses[i].size();
+        totalWork += measuredLoad[i];
+    }
+
+    if ( totalWork <= 0 )
+    {
+        return;
+    }
+
+    for ( UInt i (0) ; i < parallelModelsNumber ; ++i )
+    {
+        measuredLoad[i] *= 100 / totalWork;
+    }
+
+    // Compute the balanced distribution of the processes
+    std::vector<Real> localNumberOfProcesses ( parallelModelsNumber, 0 );
+    parallelProcessesDistribution ( localNumberOfProcesses, measuredLoad, M_comm->NumProc() );
+
+    if ( M_comm->MyPID() == 0 )
+    {
+        std::cout << "Measured parallel models load" << std::endl;
+        for ( UInt i ( 0 ) ; i < parallelModelsNumber ; ++i )
+        {
+            std::cout << "Model " << M_parallelModelsID[i]
+                      << ", time " << globalTime[i]
+                      << " s, processes " << M_parallelProcesses[i].size()
+                      << ", measured load " << measuredLoad[i]
+                      << "%, suggested processes " << localNumberOfProcesses[i] << std::endl;
+        }
+        std::cout << std::endl;
+
+        std::cout << "Suggested mpiGroups   = '" << std::endl;
+        UInt groupID ( 1 );
+        if ( M_serialModelsID.size() > 0 )
+        {
+            std::cout << "            " << groupID++ << "       -1     ";
+            for ( UInt i ( 0 ) ; i < M_serialModelsID.size() ; ++i )
+            {
+                std::cout << ( i > 0 ? "," : "" ) << M_serialModelsID[i];
+            }
+            std::cout << std::endl;
+        }
+        for ( UInt i ( 0 ) ; i < parallelModelsNumber ; ++i )
+        {
+            std::cout << "            " << groupID++ << "       " << measuredLoad[i] << "     " << M_parallelModelsID[i] << std::endl;
+        }
+        std::cout << "            '" << std::endl << std::endl;
+    }
+}
+
 // ===================================================
 // Set Methods
 // ===================================================
@@ -223,7 +306,7 @@ MultiscaleCommunicatorsManager::addGroup ( const Real& load, const modelsID_Type
 // Private Methods
 // ===================================================
 void
-MultiscaleCommunicatorsManager::parallelProcessesDistribution ( std::vector<Real>& localNumberOfProcesses, const Int& numberOfProcesses )
+MultiscaleCommunicatorsManager::parallelProcessesDistribution ( std::vector<Real>& localNumberOfProcesses, const modelsLoad_Type& modelsLoad, const Int& numberOfProcesses )
 {
 
 #ifdef HAVE_LIFEV_DEBUG
@@ -233,7 +316,7 @@ MultiscaleCommunicatorsManager::parallelProcessesDistribution ( std::vector<Real
     // Preliminary distribution
     for ( UInt i (0) ; i < M_parallelModelsID.size() ; ++i )
     {
-        localNumberOfProcesses[i] = numberOfProcesses * ( M_parallelModelsLoad[i] / 100 );
+        localNumberOfProcesses[i] = numberOfProcesses * ( modelsLoad[i] / 100 );
     }
 
     //    if ( M_comm->MyPID() == 0 )
@@ -68,6 +68,7 @@ public:
     typedef std::vector< Real >                                     modelsLoad_Type;
     typedef modelsLoad_Type::iterator                               modelsLoadIterator_Type;
     typedef std::vector< std::vector< Int > >                       modelsProcessesList_Type;
+    typedef std::map< UInt, Real >                                  modelsCost_Type;
 
     //@}
 
@@ -109,6 +110,16 @@ public:
     //! Display some information about the communicators
     void showMe();
 
+    //! Display the distribution of the processes suggested by the measured cost of the models
+    /*!
+     * The cost of each parallel model is given by the CPU time spent in its solve
+     * multiplied by the number of processes of its communicator. The resulting loads are
+     * used to compute a new distribution of the processes, which is printed in the
+     * same format of the "Problem/mpiGroups" field of the data file.
+     * This method must be called by all the processes of the main communicator.
+     */
+    void showLoadBalance();
+
     //@}
 
 
@@ -133,6 +144,16 @@ public:
      */
     void addGroup ( const Real& load, const modelsID_Type& modelsID );
 
+    //! Add the cost measured on this process for one model
+    /*!
+     * @param modelID ID of the model.
+     * @param cost CPU time spent by the process to solve the model.
+     */
+    void addModelCost ( const UInt& modelID, const Real& cost )
+    {
+        M_modelsCost[modelID] += cost;
+    }
+
     //@}
 
 
@@ -166,7 +187,7 @@ private:
     //! @name Private Methods
     //@{
 
-    void parallelProcessesDistribution ( std::vector<Real>& localNumberOfProcesses, const Int& numberOfProcesses );
+    void parallelProcessesDistribution ( std::vector<Real>& localNumberOfProcesses, const modelsLoad_Type& modelsLoad, const Int& numberOfProcesses );
 
     void parallelProcessesAssignment ( std::vector< std::vector< Int > >& parallelProcesses, const std::vector<Real>& localNumberOfProcesses, const Int& numberOfProcesses );
 
@@ -197,6 +218,9 @@ private:
     modelsID_Type                       M_parallelModelsID;
     modelsLoad_Type                     M_parallelModelsLoad;
     modelsProcessesList_Type            M_parallelProcesses;
+
+    // Measured cost of the models owned by the process
+    modelsCost_Type                     M_modelsCost;
 };
 
 } // Namespace multiscale
@@ -36,6 +36,8 @@
 
 #include <lifev/multiscale/models/MultiscaleModelMultiscale.hpp>
 
+#include <lifev/core/util/LifeChrono.hpp>
+
 #include <lifev/multiscale/algorithms/MultiscaleAlgorithmAitken.hpp>
 #include <lifev/multiscale/algorithms/MultiscaleAlgorithmBroyden.hpp>
 #include <lifev/multiscale/algorithms/MultiscaleAlgorithmExplicit.hpp>
@@ -63,6 +65,7 @@ MultiscaleModelMultiscale::MultiscaleModelMultiscale() :
     multiscaleModel_Type       (),
     M_commManager              (),
     M_modelsList               (),
+    M_modelsFileID             (),
     M_couplingsList            (),
     M_algorithm                ()
 {
@@ -168,6 +171,7 @@ MultiscaleModelMultiscale::setupData ( const std::string& fileName )
     // Load Models
     std::string path = dataFile ( "Problem/modelsPath", "./" );
     M_modelsList.resize ( M_commManager.myModelsNumber() );
+    M_modelsFileID.resize ( M_commManager.myModelsNumber() );
     for ( UInt fileModelsLine ( 0 ); fileModelsLine < modelsLinesNumber; ++fileModelsLine )
     {
         fileID = dataFile ( "Problem/models", 0, fileModelsLine * modelsColumnsNumber );
@@ -207,6 +211,7 @@ MultiscaleModelMultiscale::setupData ( const std::string& fileName )
 
             M_modelsList[myIDCounter] = multiscaleModelPtr_Type ( multiscaleModelFactory_Type::instance().createObject ( model, multiscaleModelsMap ) );
             M_modelsList[myIDCounter]->setID ( fileModelsLine + 1 );
+            M_modelsFileID[myIDCounter] = fileID;
             M_modelsList[myIDCounter]->setCommunicator ( M_commManager.modelCommunicator ( fileID ) );
             M_modelsList[myIDCounter]->setGeometry ( geometryScale, geometryRotate, geometryTranslate );
             M_modelsList[myIDCounter]->setGlobalData ( M_globalData );
@@ -412,6 +417,12 @@ MultiscaleModelMultiscale::saveSolution()
         // Close the file
         output.close();
     }
+
+    // Show the distribution of the processes suggested by the measured cost of the models
+    if ( M_globalData->dataTime()->isLastTimeStep() )
+    {
+        M_commManager.showLoadBalance();
+    }
 }
 
 void
@@ -528,9 +539,16 @@ MultiscaleModelMultiscale::computeCouplingResiduals()
 #endif
 
     displayModelStatus ( "Solve" );
-    for ( multiscaleModelsContainerConstIterator_Type i = M_modelsList.begin(); i != M_modelsList.end(); ++i )
+    LifeChrono solveChrono;
+    for ( UInt i ( 0 ); i < M_modelsList.size(); ++i )
     {
-        ( *i )->solveModel();
+        solveChrono.reset();
+        solveChrono.start();
+        M_modelsList[i]->solveModel();
+        solveChrono.stop();
+
+        // Store the cost of the model for the load balance of the communicators
+        M_commManager.addModelCost ( M_modelsFileID[i], solveChrono.diff() );
     }
 
     //    for ( multiscaleModelsContainerConstIterator_Type i = M_modelsList.begin(); i != M_modelsList.end(); ++i )
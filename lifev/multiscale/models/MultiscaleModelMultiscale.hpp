@@ -199,6 +199,7 @@ private:
 
     // Models & Couplings
     multiscaleModelsContainer_Type     M_modelsList;
+    multiscaleIDContainer_Type         M_modelsFileID;
     multiscaleCouplingsContainer_Type  M_couplingsList;
 
     // Algorithm for subiterations
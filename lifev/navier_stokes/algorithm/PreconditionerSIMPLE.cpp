@@ -85,6 +85,8 @@ PreconditionerSIMPLE::createParametersList ( list_Type&         list,
     list.set ( "subprecs: Schur prec", schurPrec );
     std::string schurPrecDataSection = dataFile ( ( section + "/" + subsection + "/subprecs/schur_prec_data_section" ).data(), "" );
     list.set ( "subprecs: Schur prec data section", ( schurPrecDataSection ).data() );
+    Int schurThreads = dataFile ( ( section + "/" + subsection + "/subprecs/schur_threads" ).data(), 1 );
+    list.set ( "subprecs: Schur threads", schurThreads );
 
     list.set ( "SIMPLE Type", SIMPLEType );
 
@@ -237,8 +239,6 @@ PreconditionerSIMPLE::buildPreconditioner ( matrixPtr_Type& oper )
         std::cout << "       Block 1 (Schur)" << std::endl;
     }
     timer.start();
-    std::shared_ptr<matrixBlock_Type> P1c ( new matrixBlock_Type ( map ) );
-
     std::shared_ptr<matrixBlock_Type> BBlockMat ( new matrixBlock_Type ( map ) );
     BBlockMat->setBlockStructure ( blockNumRows, blockNumColumns );
     BBlockMat->blockView ( 1, 0, B21 );
@@ -257,28 +257,27 @@ PreconditionerSIMPLE::buildPreconditioner ( matrixPtr_Type& oper )
     }
     *invDBlockMat *= -1.0;
     invDBlockMat->globalAssemble();
-    std::shared_ptr<matrixBlock_Type> tmpResultMat ( new matrixBlock_Type ( map ) );
-    BBlockMat->multiply ( false,
-                          *invDBlockMat, false,
-                          *tmpResultMat, true );
-    BBlockMat.reset();
+    Epetra_Vector invD ( invDBlockMat->matrixPtr()->RowMap() );
+    invDBlockMat->matrixPtr()->ExtractDiagonalCopy ( invD );
     invDBlockMat.reset();
     std::shared_ptr<matrixBlock_Type> BtBlockMat ( new matrixBlock_Type ( map ) );
     BtBlockMat->setBlockStructure ( blockNumRows, blockNumColumns );
     BtBlockMat->blockView ( 0, 1, B12 );
     MatrixEpetraStructuredUtility::copyBlock ( Bt, B12 );
     BtBlockMat->globalAssemble();
-    tmpResultMat->multiply ( false,
-                             *BtBlockMat, false,
-                             *P1c, false );
-    BtBlockMat.reset();
-    tmpResultMat.reset();
-
-    P1c->setBlockStructure ( blockNumRows, blockNumColumns );
-    P1c->blockView ( 0, 0, B11 );
+    std::shared_ptr<matrixBlock_Type> identityBlockMat ( new matrixBlock_Type ( map ) );
+    identityBlockMat->setBlockStructure ( blockNumRows, blockNumColumns );
+    identityBlockMat->blockView ( 0, 0, B11 );
     MatrixEpetraStructuredUtility::createIdentityBlock ( B11 );
-    P1c->globalAssemble();
-    std::shared_ptr<matrix_Type> p1c = P1c;
+    identityBlockMat->globalAssemble();
+
+    // P1c = B * ( -D^-1 ) * Bt + I_u, the pattern is computed at the first build only.
+    // p1c is the matrix of M_schurComplementProduct, overwritten in place by the next build:
+    // the previous preconditioner has been reset above, so no block still refers to the old values.
+    std::shared_ptr<matrix_Type> p1c = M_schurComplementProduct.multiply ( *BBlockMat, &invD, *BtBlockMat, identityBlockMat.get() );
+    BBlockMat.reset();
+    BtBlockMat.reset();
+    identityBlockMat.reset();
     superPtr_Type precForBlock2 ( PRECFactory::instance().createObject ( M_schurPrec ) );
     precForBlock2->setDataFromGetPot ( M_dataFile, M_schurDataSection );
     this->pushBack ( p1c, precForBlock2, notInversed, notTransposed );
@@ -415,6 +414,10 @@ PreconditionerSIMPLE::setParameters ( Teuchos::ParameterList& list )
 
     M_schurPrec        = list.get ( "subprecs: Schur prec", "ML" );
     M_schurDataSection = list.get ( "subprecs: Schur prec data section", "" );
+
+    OpenMPParameters ompParams;
+    ompParams.numThreads = list.get ( "subprecs: Schur threads", 1 );
+    M_schurComplementProduct.setOpenMPParameters ( ompParams );
 }
 
 void
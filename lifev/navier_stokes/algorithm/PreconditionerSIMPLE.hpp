@@ -48,6 +48,7 @@
 #include <lifev/core/array/VectorEpetra.hpp>
 #include <lifev/core/algorithm/PreconditionerComposition.hpp>
 #include <lifev/core/array/MatrixEpetraStructured.hpp>
+#include <lifev/core/array/MatrixEpetraProduct.hpp>
 #include <lifev/core/solver/ADRAssembler.hpp>
 #include <lifev/core/fem/FESpace.hpp>
 #include <lifev/core/mesh/RegionMesh.hpp>
@@ -183,6 +184,9 @@ protected:
     std::string          M_schurPrec;
     std::string          M_schurDataSection;
 
+    //! Product B * D^-1 * Bt of the Schur block, its pattern is computed only once
+    MatrixEpetraProduct  M_schurComplementProduct;
+
 private:
     PreconditionerSIMPLE ( const PreconditionerSIMPLE& P ) :
         PreconditionerComposition ( P.M_comm ) {}
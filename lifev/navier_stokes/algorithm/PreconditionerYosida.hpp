@@ -46,6 +46,7 @@
 #include <lifev/core/array/VectorEpetra.hpp>
 #include <lifev/core/algorithm/PreconditionerComposition.hpp>
 #include <lifev/core/array/MatrixEpetraStructured.hpp>
+#include <lifev/core/array/MatrixEpetraProduct.hpp>
 #include <lifev/core/solver/ADRAssembler.hpp>
 #include <lifev/core/fem/FESpace.hpp>
 #include <lifev/core/mesh/RegionMesh.hpp>
@@ -177,6 +178,9 @@ protected:
     std::string          M_schurPrec;
     std::string          M_schurDataSection;
 
+    //! Product B * D^-1 * Bt of the Schur block, its pattern is computed only once
+    MatrixEpetraProduct  M_schurComplementProduct;
+
 private:
     PreconditionerYosida ( const PreconditionerYosida& P ) :
         PreconditionerComposition ( P.M_comm ) {}
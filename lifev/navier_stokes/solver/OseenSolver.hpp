@@ -1118,6 +1118,10 @@ OseenSolver<MeshType, SolverType>::setUp ( const GetPot& dataFile )
     M_ipStabilization.setGammaBeta ( M_gammaBeta );
     M_ipStabilization.setGammaDiv  ( M_gammaDiv );
     M_ipStabilization.setGammaPress ( M_gammaPress );
+
+    OpenMPParameters ipStabilizationOmpParams;
+    ipStabilizationOmpParams.numThreads = dataFile ( "fluid/ipstab/num_threads", 1 );
+    M_ipStabilization.setOpenMPParameters ( ipStabilizationOmpParams );
 }
 
 
@@ -42,7 +42,11 @@
 #ifndef _NSIPTERMS_HPP
 #define _NSIPTERMS_HPP
 
+#include <algorithm>
+#include <vector>
+
 #include <lifev/core/util/LifeChrono.hpp>
+#include <lifev/core/util/OpenMPParameters.hpp>
 #include <lifev/core/array/MatrixElemental.hpp>
 #include <lifev/core/array/VectorElemental.hpp>
 #include <lifev/core/fem/AssemblyElemental.hpp>
@@ -85,6 +89,11 @@ namespace details
  *  </ol>
  *  Both high Pechlet numbers and inf-sup incompatible FEM are stabilized.
  *
+ *  The list of the interior facets and of their adjacent elements is computed once
+ *  per mesh and reused by the following calls to apply(). The elemental matrices
+ *  of the facets are computed by the threads set in the OpenMP parameters, then
+ *  added to the global matrix in the order of the facets.
+ *
  */
 
 template<typename MeshType, typename DofType>
@@ -174,12 +183,18 @@ public:
     void setMesh (const meshPtr_Type mesh)
     {
         M_mesh = mesh;
+        M_interiorFacetsReady = false;
     }
     //! Set Discretization
     void setDiscretization (const dofPtr_Type& dof, const ReferenceFE& refFE, CurrentFEManifold& feBd, const QuadratureRule& quadRule);
     //! Set the fespace
     template<typename MapType>
     void setFeSpaceVelocity (FESpace<mesh_Type, MapType>& feSpaceVelocity);
+    //! Set the OpenMP parameters of the facet loop
+    void setOpenMPParameters (const OpenMPParameters& ompParams)
+    {
+        M_ompParams = ompParams;
+    }
     //@}
 private:
 
@@ -187,6 +202,56 @@ private:
     //@{
     //! facetToPoint(i,j) = localId of jth point on ith local facet
     typedef ID ( *FTOP ) ( ID const& localFacet, ID const& point );
+
+    //! Interior facet with its adjacent elements
+    struct InteriorFacet
+    {
+        //! Local id of the facet
+        UInt facet;
+        //! Local ids of the adjacent elements
+        UInt element1;
+        UInt element2;
+        //! Position of the facet in the first adjacent element
+        UInt position1;
+    };
+
+    //! Finite elements used to compute the contributions of a facet
+    struct FacetWorkspace
+    {
+        FacetWorkspace ( const ReferenceFE& refFE, const GeometricMap& geoMap,
+                         const QuadratureRule& quadRule, const CurrentFEManifold& feBdPrototype,
+                         const UInt geoDimensions ) :
+            feOnSide1 ( refFE, geoMap, quadRule ),
+            feOnSide2 ( refFE, geoMap, quadRule ),
+            feBd ( feBdPrototype ),
+            beta ( feBdPrototype.nbFEDof(), geoDimensions )
+        {}
+
+        //! current Fe on side 1 of the current facet
+        CurrentFE         feOnSide1;
+        //! current Fe on side 2 of the current facet
+        CurrentFE         feOnSide2;
+        //! current boundary FE
+        CurrentFEManifold feBd;
+        //! local trace of the velocity
+        VectorElemental   beta;
+    };
+
+    //! Elemental matrices of a facet, for the couples of sides (1,1), (2,2), (1,2), (2,1)
+    struct FacetMatrices
+    {
+        FacetMatrices ( const UInt nbFEDof, const UInt geoDimensions ) :
+            elMatP ( 4, MatrixElemental ( nbFEDof, geoDimensions + 1, geoDimensions + 1 ) ),
+            elMatU ( 4, MatrixElemental ( nbFEDof, geoDimensions, geoDimensions ) ),
+            hasPressure ( false ),
+            hasVelocity ( false )
+        {}
+
+        std::vector<MatrixElemental> elMatP;
+        std::vector<MatrixElemental> elMatU;
+        bool hasPressure;
+        bool hasVelocity;
+    };
     //@}
 
     //! @name Private Constructor
@@ -195,16 +260,34 @@ private:
     StabilizationIP (const StabilizationIP<mesh_Type, dof_Type>& original);
     //@}
 
+    //! @name Private Methods
+    //@{
+    //! Build the list of the interior facets of the mesh
+    void setupInteriorFacets();
+
+    //! Compute the elemental matrices of an interior facet
+    template<typename VectorType>
+    void computeFacet ( const InteriorFacet& facet, const VectorType& state, const Real normInf,
+                        FacetWorkspace& workspace, FacetMatrices& matrices ) const;
+
+    //! Add the elemental matrices of an interior facet into the global matrix
+    template<typename MatrixType>
+    void assembleFacet ( MatrixType& matrix, const InteriorFacet& facet, FacetMatrices& matrices ) const;
+    //@}
+
+    //! Number of facets computed by each thread between two additions to the global matrix
+    static const UInt S_facetsPerThread = 64;
+
     //! @name Private Attributes
     //@{
     //! Pointer to the mesh object
     meshPtr_Type  M_mesh;
     //! reference to the DofType data structure
     dofPtr_Type   M_dof;
-    //! current Fe on side 1 of the current facet
-    std::shared_ptr<CurrentFE>    M_feOnSide1;
-    //! current Fe on side 2 of the current facet
-    std::shared_ptr<CurrentFE>    M_feOnSide2;
+    //! reference FE of the velocity and pressure
+    const ReferenceFE*    M_refFE;
+    //! quadrature rule on the elements
+    const QuadratureRule* M_quadRule;
     //! current boundary FE
     CurrentFEManifold*  M_feBd;
     //! Stabilization parameter @f$\gamma_\beta@f$ for @f$\int_{facet} [\beta \cdot \nabla \mathbf{u}] [\beta \cdot \nabla \mathbf{v}]@f$
@@ -217,6 +300,12 @@ private:
     Real         M_viscosity;
     //! facetToPoint(i,j) = localId of jth point on ith local facet
     FTOP         M_facetToPoint;
+    //! Interior facets of the mesh, computed at the first call to apply
+    std::vector<InteriorFacet> M_interiorFacets;
+    //! True if M_interiorFacets is up to date with the mesh
+    bool         M_interiorFacetsReady;
+    //! OpenMP parameters of the facet loop
+    OpenMPParameters M_ompParams;
     //@}
 }; // class StabilizationIP
 
@@ -227,10 +316,14 @@ private:
 
 template<typename MeshType, typename DofType>
 StabilizationIP<MeshType, DofType>::StabilizationIP() :
+    M_refFE ( 0 ),
+    M_quadRule ( 0 ),
+    M_feBd ( 0 ),
     M_gammaBeta ( 0.0 ),
     M_gammaDiv  ( 0.0 ),
     M_gammaPress ( 0.0 ),
-    M_viscosity ( 0.0 )
+    M_viscosity ( 0.0 ),
+    M_interiorFacetsReady ( false )
 {}
 
 //=============================================================================
@@ -246,324 +339,62 @@ void StabilizationIP<MeshType, DofType>::apply ( MatrixType& matrix,  const Vect
         return;
     }
 
-    LifeChronoFake chronoUpdate;
-    LifeChronoFake chronoBeta;
-    LifeChronoFake chronoElemComp;
-    LifeChronoFake chronoAssembly1;
-    LifeChronoFake chronoAssembly2;
-    LifeChronoFake chronoAssembly3;
-    LifeChronoFake chronoAssembly4;
-    LifeChronoFake chronoAssembly5;
-    LifeChronoFake chronoAssembly6;
-    LifeChronoFake chronoAssembly7;
-    LifeChronoFake chronoAssembly8;
-    LifeChronoFake chronoAssembly9;
     LifeChrono chronoAssembly;
+    chronoAssembly.start();
 
-    ID geoDimensions = MeshType::S_geoDimensions;
-    MatrixElemental elMatU ( M_feOnSide1->nbFEDof(), geoDimensions    , geoDimensions   );
-    MatrixElemental elMatP ( M_feOnSide1->nbFEDof(), geoDimensions + 1, geoDimensions + 1 );
-
+    if ( !M_interiorFacetsReady )
+    {
+        setupInteriorFacets();
+    }
 
-    const UInt nDof = M_dof->numTotalDof();
+    const UInt geoDimensions ( MeshType::S_geoDimensions );
+    const UInt numFacets ( M_interiorFacets.size() );
 
     Real normInf;
     state.normInf (&normInf);
 
-    // local trace of the velocity
-    VectorElemental beta ( M_feBd->nbFEDof(), geoDimensions );
+    // The global matrix is not thread safe: the elemental matrices of a block of
+    // facets are computed in parallel, then added in the order of the facets
+    const UInt blockSize ( std::max<UInt> ( 1, std::min<UInt> ( numFacets, S_facetsPerThread * M_ompParams.numThreads ) ) );
+    std::vector<FacetMatrices> facetMatrices ( blockSize, FacetMatrices ( M_refFE->nbDof(), geoDimensions ) );
 
-    UInt myFacets (0);
+    M_ompParams.apply();
 
-    chronoAssembly.start();
-    // loop on interior facets
-    for ( UInt iFacet ( M_mesh->numBoundaryFacets() ); iFacet < M_mesh->numFacets();
-            ++iFacet )
+    #pragma omp parallel
     {
-        const UInt iElAd1 ( M_mesh->facet ( iFacet ).firstAdjacentElementIdentity()  );
-        const UInt iElAd2 ( M_mesh->facet ( iFacet ).secondAdjacentElementIdentity() );
-
-        if ( Flag::testOneSet ( M_mesh->facet ( iFacet ).flag(),
-                                EntityFlags::SUBDOMAIN_INTERFACE | EntityFlags::PHYSICAL_BOUNDARY ) )
-        {
-            //std::cout << "iElAd1 = " << iElAd1 << "; iElAd2 = " << iElAd2 << std::endl;
-            continue;
-        }
-        ++myFacets;
-
-        chronoUpdate.start();
-        // update current finite elements
-#if WITH_DIVERGENCE
-        M_feBd->update ( M_mesh->facet ( iFacet ), UPDATE_W_ROOT_DET_METRIC );
-#else
-        M_feBd->updateMeasNormal ( M_mesh->facet ( iFacet ) );
-        KNM<Real>& normal = M_feBd->normal;
-#endif
-        const Real hK2 = M_feBd->measure();
+        FacetWorkspace workspace ( *M_refFE, getGeometricMap ( *M_mesh ), *M_quadRule, *M_feBd, geoDimensions );
 
-
-        M_feOnSide1->updateFirstDeriv ( M_mesh->element ( iElAd1 ) );
-        M_feOnSide2->updateFirstDeriv ( M_mesh->element ( iElAd2 ) );
-        chronoUpdate.stop();
-
-        Real bmax (0);
-        if (normInf != 0.)
+        for ( UInt blockBegin ( 0 ); blockBegin < numFacets; blockBegin += blockSize )
         {
-            chronoBeta.start();
-            // determine bmax = ||\beta||_{0,\infty,K}
-            // first, get the local trace of the velocity into beta
+            const UInt blockEnd ( std::min ( blockBegin + blockSize, numFacets ) );
 
-            // local id of the facet in its adjacent element
-            UInt iFaEl ( M_mesh->facet ( iFacet ).firstAdjacentElementPosition() );
-            for ( UInt iNode ( 0 ); iNode < M_feBd->nbFEDof(); ++iNode )
+            #pragma omp for schedule(runtime)
+            for ( UInt iFacet = blockBegin; iFacet < blockEnd; ++iFacet )
             {
-                UInt iloc ( M_facetToPoint ( iFaEl, iNode ) );
-                for ( UInt iCoor ( 0 ); iCoor < M_feOnSide1->nbLocalCoor(); ++iCoor )
-                {
-                    UInt ig ( M_dof->localToGlobalMap ( iElAd1, iloc ) + iCoor * nDof );
-
-                    if (state.blockMap().LID ( static_cast<EpetraInt_Type> (ig) ) >= 0)
-                    {
-                        beta.vec() [ iCoor * M_feBd->nbFEDof() + iNode ] = state ( ig);
-                    }
-                }
+                computeFacet ( M_interiorFacets[ iFacet ], state, normInf, workspace,
+                               facetMatrices[ iFacet - blockBegin ] );
             }
 
-            // second, calculate its max norm
-            for ( UInt l ( 0 ); l < static_cast<UInt> ( M_feOnSide1->nbLocalCoor() *M_feBd->nbFEDof() ); ++l )
+            #pragma omp single
             {
-                if ( bmax < std::fabs ( beta.vec() [ l ] ) )
+                for ( UInt iFacet ( blockBegin ); iFacet < blockEnd; ++iFacet )
                 {
-                    bmax = std::fabs ( beta.vec() [ l ] );
+                    assembleFacet ( matrix, M_interiorFacets[ iFacet ], facetMatrices[ iFacet - blockBegin ] );
                 }
             }
-
-            chronoBeta.stop();
         }
+    }
 
+    M_ompParams.restorePreviousNumThreads();
 
-        // pressure stabilization
-        if ( M_gammaPress != 0.0 )
-        {
-#if USE_OLD_PARAMETERS
-            Real coeffPress ( M_gammaPress * hK2 ); // P1, P2 (code)
-            //Real coeffPress = M_gammaPress * sqrt( hK2 ); // P1 p nonsmooth (code)
-#else
-            Real coeffPress = M_gammaPress * hK2 / // Pk (paper)
-                std::max<Real> ( bmax, M_viscosity / std::sqrt ( hK2 ) );
-#endif
-
-            elMatP.zero();
-            chronoElemComp.start();
-            // coef*\int_{facet} grad u1 . grad v1
-            AssemblyElemental::ipstab_grad ( coeffPress, elMatP, *M_feOnSide1, *M_feOnSide1, *M_feBd,
-                                             geoDimensions, geoDimensions);
-            chronoElemComp.stop();
-            chronoAssembly1.start();
-
-            assembleMatrix (matrix, elMatP, *M_feOnSide1, *M_dof,
-                            geoDimensions, geoDimensions, geoDimensions * nDof, geoDimensions * nDof);
-            chronoAssembly1.stop();
-
-            elMatP.zero();
-            chronoElemComp.start();
-            // coef*\int_{face} grad u2 . grad v2
-            AssemblyElemental::ipstab_grad ( coeffPress, elMatP, *M_feOnSide2, *M_feOnSide2, *M_feBd,
-                                             geoDimensions, geoDimensions);
-            chronoElemComp.stop();
-            chronoAssembly2.start();
-
-            assembleMatrix (matrix, elMatP, *M_feOnSide2, *M_dof,
-                            geoDimensions, geoDimensions, geoDimensions * nDof, geoDimensions * nDof);
-            chronoAssembly2.stop();
-
-            elMatP.zero();
-            chronoElemComp.start();
-            // - coef*\int_{facet} grad u1 . grad v2
-            AssemblyElemental::ipstab_grad (- coeffPress, elMatP, *M_feOnSide1, *M_feOnSide2, *M_feBd,
-                                            geoDimensions, geoDimensions);
-            chronoElemComp.stop();
-            chronoAssembly3.start();
-
-            assembleMatrix (matrix, elMatP, *M_feOnSide1, *M_feOnSide2, *M_dof, *M_dof,
-                            geoDimensions, geoDimensions, geoDimensions * nDof, geoDimensions * nDof);
-            chronoAssembly3.stop();
-
-            elMatP.zero();
-            chronoElemComp.start();
-            // - coef*\int_{facet} grad u2 . grad v1
-            AssemblyElemental::ipstab_grad (- coeffPress, elMatP, *M_feOnSide2, *M_feOnSide1, *M_feBd,
-                                            geoDimensions, geoDimensions);
-            chronoElemComp.stop();
-            chronoAssembly4.start();
-
-            assembleMatrix (matrix, elMatP, *M_feOnSide2, *M_feOnSide1, *M_dof, *M_dof,
-                            geoDimensions, geoDimensions, geoDimensions * nDof, geoDimensions * nDof);
-            chronoAssembly4.stop();
-        }
-
-        // velocity stabilization
-        if ( ( M_gammaDiv != 0 || M_gammaBeta != 0 ) && bmax > 0 )
-        {
-#if WITH_DIVERGENCE
-#if USE_OLD_PARAMETERS
-            Real coeffBeta ( M_gammaBeta * hK2 / std::max<Real> (bmax, hK2) ); // code
-#else
-            Real coeffBeta ( M_gammaBeta * hK2 / bmax ); // paper
-#endif
-
-            Real coeffDiv ( M_gammaDiv * hK2 * bmax ); // (code and paper)
-            //Real coeffDiv ( M_gammaDiv * sqrt( hK2 ) * bmax ); // ? (code)
-#else
-            // determine bnmax = ||\beta \cdot n||_{0,\infty,K}
-            // and       bcmax = ||\beta \cross n||_{0,\infty,K}
-
-            chronoBeta.start();
-            Real bnmax ( 0. );
-            Real bcmax ( 0. );
-            for ( UInt iNode (0); iNode < M_feBd->nbNode; ++iNode )
-            {
-                Real bn ( 0 );
-                for ( UInt iCoor (0); iCoor < M_feOnSide1->nbLocalCoor(); ++iCoor )
-                {
-                    bn += normal (iNode, iCoor) *
-                          beta.vec() [ iCoor * M_feBd->nbNode + iNode ];
-                    bcmax = std::max<Real>
-                            (bcmax, normal (iNode, (iCoor) % 3) *
-                             beta.vec() [ (iCoor + 1) % 3 * M_feBd->nbNode + iNode ] -
-                             normal (iNode, (iCoor + 1) % 3) *
-                             beta.vec() [ (iCoor) % 3 * M_feBd->nbNode + iNode ]);
-                }
-                bnmax = std::max<Real> (bnmax, bn);
-            }
-            chronoBeta.stop();
-
-            Real coeffGrad = hK2 * (M_gammaBeta * bnmax + M_gammaDiv * bcmax);
-#endif
-            elMatU.zero();
-            chronoElemComp.start();
-#if WITH_DIVERGENCE
-            // coef*\int_{facet} (\beta1 . grad u1) (\beta2 . grad v2)
-            AssemblyElemental::ipstab_bgrad ( coeffBeta, elMatU, *M_feOnSide1, *M_feOnSide1, beta,
-                                              *M_feBd, 0, 0, geoDimensions );
-            // coef*\int_{facet} div u1 . div v1
-            AssemblyElemental::ipstab_div ( coeffDiv, elMatU, *M_feOnSide1, *M_feOnSide1, *M_feBd );
-#else
-            // coef*\int_{facet} grad u1 . grad v1
-            AssemblyElemental::ipstab_grad ( coeffGrad, elMatU, *M_feOnSide1, *M_feOnSide1, *M_feBd, 0, 0,
-                                             geoDimensions );
-#endif
-            chronoElemComp.stop();
-            chronoAssembly5.start();
-            for ( UInt iComp ( 0 ); iComp < geoDimensions; ++iComp )
-                for ( UInt jComp ( 0 ); jComp < geoDimensions; ++jComp )
-                {
-                    assembleMatrix ( matrix, elMatU, *M_feOnSide1, *M_dof,
-                                     iComp, jComp, iComp * nDof, jComp * nDof );
-                }
-            chronoAssembly5.stop();
-
-            elMatU.zero();
-            chronoElemComp.start();
-#if WITH_DIVERGENCE
-            // coef*\int_{facet} (\beta2 . grad u2) (\beta2 . grad v2)
-            AssemblyElemental::ipstab_bgrad ( coeffBeta, elMatU, *M_feOnSide2, *M_feOnSide2, beta,
-                                              *M_feBd, 0, 0, geoDimensions );
-            // coef*\int_{facet} div u2 . div v2
-            AssemblyElemental::ipstab_div ( coeffDiv, elMatU, *M_feOnSide2, *M_feOnSide2, *M_feBd );
-#else
-            // coef*\int_{facet} grad u2 . grad v2
-            AssemblyElemental::ipstab_grad ( coeffGrad, elMatU, *M_feOnSide2, *M_feOnSide2, *M_feBd, 0, 0,
-                                             geoDimensions );
-#endif
-            chronoElemComp.stop();
-            chronoAssembly6.start();
-            for ( UInt iComp ( 0 ); iComp < geoDimensions; ++iComp )
-                for ( UInt jComp ( 0 ); jComp < geoDimensions; ++jComp )
-                {
-                    assembleMatrix ( matrix, elMatU, *M_feOnSide2, *M_dof,
-                                     iComp, jComp, iComp * nDof, jComp * nDof );
-                }
-            chronoAssembly6.stop();
-
-            elMatU.zero();
-            chronoElemComp.start();
-#if WITH_DIVERGENCE
-            // - coef*\int_{facet} (\beta1 . grad u1) (\beta2 . grad v2)
-            AssemblyElemental::ipstab_bgrad ( -coeffBeta, elMatU, *M_feOnSide1, *M_feOnSide2, beta,
-                                              *M_feBd, 0, 0, geoDimensions );
-            // - coef*\int_{facet} div u1 . div v2
-            AssemblyElemental::ipstab_div ( -coeffDiv, elMatU, *M_feOnSide1, *M_feOnSide2, *M_feBd );
-#else
-            // - coef*\int_{facet} grad u1 . grad v2
-            AssemblyElemental::ipstab_grad ( -coeffGrad, elMatU, *M_feOnSide1, *M_feOnSide2, *M_feBd, 0, 0,
-                                             geoDimensions );
-#endif
-            chronoElemComp.stop();
-            chronoAssembly7.start();
-            for ( UInt iComp = 0; iComp < geoDimensions; ++iComp )
-                for ( UInt jComp = 0; jComp < geoDimensions; ++jComp )
-                {
-                    assembleMatrix ( matrix, elMatU, *M_feOnSide1, *M_feOnSide2, *M_dof, *M_dof,
-                                     iComp, jComp, iComp * nDof, jComp * nDof );
-                }
-            chronoAssembly7.stop();
-
-            elMatU.zero();
-            chronoElemComp.start();
-#if WITH_DIVERGENCE
-            // - coef*\int_{facet} (\beta2 . grad u2) (\beta1 . grad v1)
-            AssemblyElemental::ipstab_bgrad ( -coeffBeta, elMatU, *M_feOnSide2, *M_feOnSide1, beta,
-                                              *M_feBd, 0, 0, geoDimensions );
-            // - coef*\int_{facet} div u2 . div v1
-            AssemblyElemental::ipstab_div ( -coeffDiv, elMatU, *M_feOnSide2, *M_feOnSide1, *M_feBd );
-#else
-            // - coef*\int_{facet} grad u2 . grad v1
-            AssemblyElemental::ipstab_grad ( -coeffGrad, elMatU, *M_feOnSide2, *M_feOnSide1, *M_feBd, 0, 0,
-                                             geoDimensions );
-#endif
-            chronoElemComp.stop();
-            chronoAssembly8.start();
-            for ( UInt iComp ( 0 ); iComp < geoDimensions; ++iComp )
-                for ( UInt jComp ( 0 ); jComp < geoDimensions; ++jComp )
-                {
-                    assembleMatrix ( matrix, elMatU, *M_feOnSide2, *M_feOnSide1, *M_dof, *M_dof,
-                                     iComp, jComp, iComp * nDof, jComp * nDof );
-                }
-            chronoAssembly8.stop();
-        }
-
-    } // loop on interior facets
     chronoAssembly.stop();
     if (verbose)
     {
         debugStream (7101) << "\n";
         debugStream (7101) << static_cast<UInt> (state.blockMap().Comm().MyPID() )
-                           <<  "  .   Updating of element   done in "
-                           << chronoUpdate.diffCumul()   << " s." << "\n";
-        debugStream (7101) << "   .   Determination of beta done in "
-                           << chronoBeta.diffCumul()     << " s." << "\n";
-        debugStream (7101) << "   .   Element computations  done in "
-                           << chronoElemComp.diffCumul() << " s." << "\n";
-        debugStream (7101) << "   .   chrono 1              done in "
-                           << chronoAssembly1.diffCumul() << " s." << "\n";
-        debugStream (7101) << "   .   chrono 2              done in "
-                           << chronoAssembly2.diffCumul() << " s." << "\n";
-        debugStream (7101) << "   .   chrono 3              done in "
-                           << chronoAssembly3.diffCumul() << " s." << "\n";
-        debugStream (7101) << "   .   chrono 4              done in "
-                           << chronoAssembly4.diffCumul() << " s." << "\n";
-        debugStream (7101) << "   .   chrono 5              done in "
-                           << chronoAssembly5.diffCumul() << " s." << "\n";
-        debugStream (7101) << "   .   chrono 6              done in "
-                           << chronoAssembly6.diffCumul() << " s." << "\n";
-        debugStream (7101) << "   .   chrono 7              done in "
-                           << chronoAssembly7.diffCumul() << " s." << "\n";
-        debugStream (7101) << "   .   chrono 8              done in "
-                           << chronoAssembly8.diffCumul() << " s." << "\n";
-        debugStream (7101) << "   .   total                                   "
+                           << "   .   total                                   "
                            << chronoAssembly.diffCumul() << " s."
-                           << " myFacets = " << myFacets << "\n";
+                           << " myFacets = " << numFacets << "\n";
     }
 
 } // apply(...)
@@ -587,11 +418,12 @@ template<typename MeshType, typename DofType>
 void StabilizationIP<MeshType, DofType>::setDiscretization (const dofPtr_Type& dof, const ReferenceFE& refFE, CurrentFEManifold& feBd, const QuadratureRule& quadRule)
 {
     M_dof = dof;
-    M_feOnSide1.reset ( new CurrentFE (refFE, getGeometricMap (*M_mesh), quadRule) );
-    M_feOnSide2.reset ( new CurrentFE (refFE, getGeometricMap (*M_mesh), quadRule) );
+    M_refFE = &refFE;
+    M_quadRule = &quadRule;
     M_feBd = &feBd;
 
     M_facetToPoint = MeshType::elementShape_Type::facetToPoint;
+    M_interiorFacetsReady = false;
 }
 
 template<typename MeshType, typename DofType>
@@ -603,6 +435,217 @@ void StabilizationIP<MeshType, DofType>::setFeSpaceVelocity (FESpace<mesh_Type,
                        feSpaceVelocity.feBd(), feSpaceVelocity.qr() );
 }
 
+//=============================================================================
+// Private methods
+//=============================================================================
+
+template<typename MeshType, typename DofType>
+void StabilizationIP<MeshType, DofType>::setupInteriorFacets()
+{
+    M_interiorFacets.clear();
+
+    for ( UInt iFacet ( M_mesh->numBoundaryFacets() ); iFacet < M_mesh->numFacets(); ++iFacet )
+    {
+        if ( Flag::testOneSet ( M_mesh->facet ( iFacet ).flag(),
+                                EntityFlags::SUBDOMAIN_INTERFACE | EntityFlags::PHYSICAL_BOUNDARY ) )
+        {
+            continue;
+        }
+
+        InteriorFacet facet;
+        facet.facet     = iFacet;
+        facet.element1  = M_mesh->facet ( iFacet ).firstAdjacentElementIdentity();
+        facet.element2  = M_mesh->facet ( iFacet ).secondAdjacentElementIdentity();
+        facet.position1 = M_mesh->facet ( iFacet ).firstAdjacentElementPosition();
+        M_interiorFacets.push_back ( facet );
+    }
+
+    M_interiorFacetsReady = true;
+}
+
+template<typename MeshType, typename DofType>
+template<typename VectorType>
+void StabilizationIP<MeshType, DofType>::computeFacet ( const InteriorFacet& facet, const VectorType& state, const Real normInf,
+                                                        FacetWorkspace& workspace, FacetMatrices& matrices ) const
+{
+    const UInt geoDimensions ( MeshType::S_geoDimensions );
+    const UInt nDof ( M_dof->numTotalDof() );
+
+    CurrentFE& feOnSide1 ( workspace.feOnSide1 );
+    CurrentFE& feOnSide2 ( workspace.feOnSide2 );
+    CurrentFEManifold& feBd ( workspace.feBd );
+    VectorElemental& beta ( workspace.beta );
+
+    // couples of sides of the four blocks, the coupling blocks have a negative sign
+    const CurrentFE* const testSide[ 4 ]     = { &feOnSide1, &feOnSide2, &feOnSide1, &feOnSide2 };
+    const CurrentFE* const solutionSide[ 4 ] = { &feOnSide1, &feOnSide2, &feOnSide2, &feOnSide1 };
+    const Real sign[ 4 ] = { 1., 1., -1., -1. };
+
+    matrices.hasPressure = false;
+    matrices.hasVelocity = false;
+
+    // update current finite elements
+#if WITH_DIVERGENCE
+    feBd.update ( M_mesh->facet ( facet.facet ), UPDATE_W_ROOT_DET_METRIC );
+#else
+    feBd.updateMeasNormal ( M_mesh->facet ( facet.facet ) );
+    KNM<Real>& normal = feBd.normal;
+#endif
+    const Real hK2 = feBd.measure();
+
+    feOnSide1.updateFirstDeriv ( M_mesh->element ( facet.element1 ) );
+    feOnSide2.updateFirstDeriv ( M_mesh->element ( facet.element2 ) );
+
+    Real bmax (0);
+    if (normInf != 0.)
+    {
+        // determine bmax = ||\beta||_{0,\infty,K}
+        // first, get the local trace of the velocity into beta
+        beta.zero();
+        for ( UInt iNode ( 0 ); iNode < feBd.nbFEDof(); ++iNode )
+        {
+            UInt iloc ( M_facetToPoint ( facet.position1, iNode ) );
+            for ( UInt iCoor ( 0 ); iCoor < feOnSide1.nbLocalCoor(); ++iCoor )
+            {
+                UInt ig ( M_dof->localToGlobalMap ( facet.element1, iloc ) + iCoor * nDof );
+
+                if (state.blockMap().LID ( static_cast<EpetraInt_Type> (ig) ) >= 0)
+                {
+                    beta.vec() [ iCoor * feBd.nbFEDof() + iNode ] = state ( ig);
+                }
+            }
+        }
+
+        // second, calculate its max norm
+        for ( UInt l ( 0 ); l < static_cast<UInt> ( feOnSide1.nbLocalCoor() * feBd.nbFEDof() ); ++l )
+        {
+            if ( bmax < std::fabs ( beta.vec() [ l ] ) )
+            {
+                bmax = std::fabs ( beta.vec() [ l ] );
+            }
+        }
+    }
+
+    // pressure stabilization
+    if ( M_gammaPress != 0.0 )
+    {
+#if USE_OLD_PARAMETERS
+        Real coeffPress ( M_gammaPress * hK2 ); // P1, P2 (code)
+        //Real coeffPress = M_gammaPress * sqrt( hK2 ); // P1 p nonsmooth (code)
+#else
+        Real coeffPress = M_gammaPress * hK2 / // Pk (paper)
+            std::max<Real> ( bmax, M_viscosity / std::sqrt ( hK2 ) );
+#endif
+
+        for ( UInt iBlock ( 0 ); iBlock < 4; ++iBlock )
+        {
+            matrices.elMatP[ iBlock ].zero();
+            // +- coef*\int_{facet} grad u_j . grad v_i
+            AssemblyElemental::ipstab_grad ( sign[ iBlock ] * coeffPress, matrices.elMatP[ iBlock ],
+                                             *testSide[ iBlock ], *solutionSide[ iBlock ], feBd,
+                                             geoDimensions, geoDimensions );
+        }
+        matrices.hasPressure = true;
+    }
+
+    // velocity stabilization
+    if ( ( M_gammaDiv != 0 || M_gammaBeta != 0 ) && bmax > 0 )
+    {
+#if WITH_DIVERGENCE
+#if USE_OLD_PARAMETERS
+        Real coeffBeta ( M_gammaBeta * hK2 / std::max<Real> (bmax, hK2) ); // code
+#else
+        Real coeffBeta ( M_gammaBeta * hK2 / bmax ); // paper
+#endif
+
+        Real coeffDiv ( M_gammaDiv * hK2 * bmax ); // (code and paper)
+        //Real coeffDiv ( M_gammaDiv * sqrt( hK2 ) * bmax ); // ? (code)
+#else
+        // determine bnmax = ||\beta \cdot n||_{0,\infty,K}
+        // and       bcmax = ||\beta \cross n||_{0,\infty,K}
+
+        Real bnmax ( 0. );
+        Real bcmax ( 0. );
+        for ( UInt iNode (0); iNode < feBd.nbNode; ++iNode )
+        {
+            Real bn ( 0 );
+            for ( UInt iCoor (0); iCoor < feOnSide1.nbLocalCoor(); ++iCoor )
+            {
+                bn += normal (iNode, iCoor) *
+                      beta.vec() [ iCoor * feBd.nbNode + iNode ];
+                bcmax = std::max<Real>
+                        (bcmax, normal (iNode, (iCoor) % 3) *
+                         beta.vec() [ (iCoor + 1) % 3 * feBd.nbNode + iNode ] -
+                         normal (iNode, (iCoor + 1) % 3) *
+                         beta.vec() [ (iCoor) % 3 * feBd.nbNode + iNode ]);
+            }
+            bnmax = std::max<Real> (bnmax, bn);
+        }
+
+        Real coeffGrad = hK2 * (M_gammaBeta * bnmax + M_gammaDiv * bcmax);
+#endif
+        for ( UInt iBlock ( 0 ); iBlock < 4; ++iBlock )
+        {
+            matrices.elMatU[ iBlock ].zero();
+#if WITH_DIVERGENCE
+            // +- coef*\int_{facet} (\beta_i . grad u_j) (\beta_i . grad v_i)
+            AssemblyElemental::ipstab_bgrad ( sign[ iBlock ] * coeffBeta, matrices.elMatU[ iBlock ],
+                                              *testSide[ iBlock ], *solutionSide[ iBlock ], beta,
+                                              feBd, 0, 0, geoDimensions );
+            // +- coef*\int_{facet} div u_j . div v_i
+            AssemblyElemental::ipstab_div ( sign[ iBlock ] * coeffDiv, matrices.elMatU[ iBlock ],
+                                            *testSide[ iBlock ], *solutionSide[ iBlock ], feBd );
+#else
+            // +- coef*\int_{facet} grad u_j . grad v_i
+            AssemblyElemental::ipstab_grad ( sign[ iBlock ] * coeffGrad, matrices.elMatU[ iBlock ],
+                                             *testSide[ iBlock ], *solutionSide[ iBlock ], feBd, 0, 0,
+                                             geoDimensions );
+#endif
+        }
+        matrices.hasVelocity = true;
+    }
+}
+
+template<typename MeshType, typename DofType>
+template<typename MatrixType>
+void StabilizationIP<MeshType, DofType>::assembleFacet ( MatrixType& matrix, const InteriorFacet& facet,
+                                                         FacetMatrices& matrices ) const
+{
+    const UInt geoDimensions ( MeshType::S_geoDimensions );
+    const UInt nDof ( M_dof->numTotalDof() );
+    const UInt nbFEDof ( M_refFE->nbDof() );
+
+    // elements of the test and solution sides of the four blocks
+    const UInt element1 ( M_mesh->element ( facet.element1 ).localId() );
+    const UInt element2 ( M_mesh->element ( facet.element2 ).localId() );
+    const UInt testElement[ 4 ]     = { element1, element2, element1, element2 };
+    const UInt solutionElement[ 4 ] = { element1, element2, element2, element1 };
+
+    if ( matrices.hasPressure )
+    {
+        for ( UInt iBlock ( 0 ); iBlock < 4; ++iBlock )
+        {
+            MatrixElemental::matrix_view localView ( matrices.elMatP[ iBlock ].block ( geoDimensions, geoDimensions ) );
+            assembleMatrix ( matrix, testElement[ iBlock ], solutionElement[ iBlock ], localView,
+                             nbFEDof, nbFEDof, *M_dof, *M_dof,
+                             geoDimensions * nDof, geoDimensions * nDof );
+        }
+    }
+
+    if ( matrices.hasVelocity )
+    {
+        for ( UInt iBlock ( 0 ); iBlock < 4; ++iBlock )
+            for ( UInt iComp ( 0 ); iComp < geoDimensions; ++iComp )
+                for ( UInt jComp ( 0 ); jComp < geoDimensions; ++jComp )
+                {
+                    MatrixElemental::matrix_view localView ( matrices.elMatU[ iBlock ].block ( iComp, jComp ) );
+                    assembleMatrix ( matrix, testElement[ iBlock ], solutionElement[ iBlock ], localView,
+                                     nbFEDof, nbFEDof, *M_dof, *M_dof,
+                                     iComp * nDof, jComp * nDof );
+                }
+    }
+}
+
 } // namespace details
 
 } // namespace LifeV
@@ -0,0 +1,201 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file main.cpp
+    @brief Test of the threaded interior penalty stabilization
+
+    The interior penalty stabilization of a P1-P1 Oseen problem, linearized
+    around a non uniform velocity field, is assembled with one thread (as with
+    fluid/ipstab/num_threads = 1 in OseenSolver) and with several threads. The
+    elemental matrices of the facets are added to the global matrix in the
+    order of the facets whatever the number of threads, so the matrices must
+    be identical.
+
+    @date 10-2026
+ */
+
+// ===================================================
+//! Includes
+// ===================================================
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+#include <cmath>
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/array/MapEpetra.hpp>
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+#include <lifev/core/fem/DOF.hpp>
+#include <lifev/core/fem/FESpace.hpp>
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/util/OpenMPParameters.hpp>
+
+#include <lifev/navier_stokes/solver/StabilizationIP.hpp>
+
+// ===================================================
+//! Namespaces & define
+// ===================================================
+
+using namespace LifeV;
+
+namespace
+{
+
+typedef RegionMesh<LinearTetra>                        mesh_Type;
+typedef FESpace<mesh_Type, MapEpetra>                  feSpace_Type;
+typedef std::shared_ptr<feSpace_Type>                feSpacePtr_Type;
+typedef MatrixEpetra<Real>                             matrix_Type;
+typedef std::shared_ptr<matrix_Type>                 matrixPtr_Type;
+typedef details::StabilizationIP<mesh_Type, DOF>       stabilization_Type;
+
+// Thread counts compared with the serial assembly
+const int S_threadCounts[] = { 2, 3, 4 };
+const UInt S_numThreadCounts = sizeof ( S_threadCounts ) / sizeof ( S_threadCounts[ 0 ] );
+
+// Velocity field around which the stabilization is linearized
+Real beta ( const Real& /*t*/, const Real& x, const Real& y, const Real& z, const ID& i )
+{
+    switch ( i )
+    {
+        case 0:
+            return std::sin ( 2. * y ) + z;
+        case 1:
+            return x * z - 0.5;
+        default:
+            return std::cos ( x * y );
+    }
+}
+
+matrixPtr_Type assembleStabilization ( stabilization_Type& stabilization, const MapEpetra& map,
+                                       const VectorEpetra& state, const int numThreads )
+{
+    OpenMPParameters ompParams;
+    ompParams.numThreads = numThreads;
+    stabilization.setOpenMPParameters ( ompParams );
+
+    matrixPtr_Type matrix ( new matrix_Type ( map ) );
+    stabilization.apply ( *matrix, state, false );
+    matrix->globalAssemble();
+
+    return matrix;
+}
+
+}
+
+// ===================================================
+//! Main
+// ===================================================
+int main ( int argc, char** argv )
+{
+#ifdef HAVE_MPI
+    MPI_Init ( &argc, &argv );
+    std::shared_ptr<Epetra_Comm> comm ( new Epetra_MpiComm ( MPI_COMM_WORLD ) );
+#else
+    std::shared_ptr<Epetra_Comm> comm ( new Epetra_SerialComm );
+#endif
+
+    const bool verbose ( comm->MyPID() == 0 );
+    bool passed ( true );
+
+    {
+        // Unit cube with 6 x 6 x 6 cubes split in tetrahedra
+        std::shared_ptr<mesh_Type> fullMeshPtr ( new mesh_Type ( comm ) );
+        regularMesh3D ( *fullMeshPtr, 1, 6, 6, 6 );
+
+        std::shared_ptr<mesh_Type> localMeshPtr;
+        {
+            MeshPartitioner<mesh_Type> meshPartitioner;
+            meshPartitioner.doPartition ( fullMeshPtr, comm );
+            localMeshPtr = meshPartitioner.meshPartition();
+        }
+        fullMeshPtr.reset();
+
+        feSpacePtr_Type velocityFESpace ( new feSpace_Type ( localMeshPtr, feTetraP1, quadRuleTetra4pt, quadRuleTria4pt, 3, comm ) );
+        feSpacePtr_Type pressureFESpace ( new feSpace_Type ( localMeshPtr, feTetraP1, quadRuleTetra4pt, quadRuleTria4pt, 1, comm ) );
+
+        MapEpetra fluidMap ( velocityFESpace->map() );
+        fluidMap += pressureFESpace->map();
+
+        VectorEpetra velocity ( velocityFESpace->map(), Unique );
+        velocityFESpace->interpolate ( static_cast<feSpace_Type::function_Type> ( beta ), velocity, 0. );
+        const VectorEpetra repeatedVelocity ( velocity, Repeated );
+
+        stabilization_Type stabilization;
+        stabilization.setFeSpaceVelocity ( *velocityFESpace );
+        stabilization.setViscosity ( 0.01 );
+        stabilization.setGammaBeta ( 0.2 );
+        stabilization.setGammaDiv ( 0.1 );
+        stabilization.setGammaPress ( 0.05 );
+
+        const matrixPtr_Type serialMatrix ( assembleStabilization ( stabilization, fluidMap, repeatedVelocity, 1 ) );
+        const Real serialNorm ( serialMatrix->normFrobenius() );
+        passed &= serialNorm > 0.;
+
+        if ( verbose )
+        {
+            std::cout << "1 thread, Frobenius norm of the stabilization: " << serialNorm << std::endl;
+        }
+
+        for ( UInt iCount ( 0 ); iCount < S_numThreadCounts; ++iCount )
+        {
+            matrixPtr_Type threadedMatrix ( assembleStabilization ( stabilization, fluidMap, repeatedVelocity,
+                                                                    S_threadCounts[ iCount ] ) );
+            *threadedMatrix -= *serialMatrix;
+            const Real difference ( threadedMatrix->normFrobenius() );
+            passed &= difference == 0.;
+
+            if ( verbose )
+            {
+                std::cout << S_threadCounts[ iCount ] << " threads, difference with 1 thread: " << difference << std::endl;
+            }
+        }
+    }
+
+    if ( verbose )
+    {
+        std::cout << ( passed ? "Threaded IP stabilization test passed" : "Threaded IP stabilization test FAILED" ) << std::endl;
+    }
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !passed )
+    {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -1,4 +1,5 @@
 #include <lifev/navier_stokes_blocks/solver/FastAssemblerNS.hpp>
+#include <algorithm>
 #include <chrono>
 #include <omp.h>
 using namespace std::chrono;
@@ -119,7 +120,7 @@ FastAssemblerNS::~FastAssemblerNS()
 
 	//---------------------
 
-	for( int i = 0 ; i < M_numElements ; i++ )
+	for( int i = 0 ; i < M_chunkSize ; i++ )
 	{
 		delete [] M_rows_velocity[i];
 		delete [] M_cols_velocity[i];
@@ -133,7 +134,7 @@ FastAssemblerNS::~FastAssemblerNS()
 
 	//---------------------
 
-	for( int i = 0 ; i < M_numElements ; i++ )
+	for( int i = 0 ; i < M_chunkSize ; i++ )
 	{
 		for ( int j = 0; j < M_referenceFE_velocity->nbDof(); j++ )
 		{
@@ -145,7 +146,7 @@ FastAssemblerNS::~FastAssemblerNS()
 
 	//---------------------
 
-	for( int i = 0 ; i < M_numElements ; i++ )
+	for( int i = 0 ; i < M_chunkSize ; i++ )
 	{
 		for ( int j = 0; j < M_referenceFE_velocity->nbDof(); j++ )
 		{
@@ -157,7 +158,7 @@ FastAssemblerNS::~FastAssemblerNS()
 
 	//---------------------
 
-	for( int i = 0 ; i < M_numElements ; i++ )
+	for( int i = 0 ; i < M_chunkSize ; i++ )
 	{
 		for ( int j = 0; j < M_referenceFE_pressure->nbDof(); j++ )
 		{
@@ -169,7 +170,7 @@ FastAssemblerNS::~FastAssemblerNS()
 
 	//---------------------
 
-	for( int i = 0 ; i < M_numElements ; i++ )
+	for( int i = 0 ; i < M_chunkSize ; i++ )
 	{
 		for ( int j = 0; j < M_referenceFE_pressure->nbDof(); j++ )
 		{
@@ -181,7 +182,7 @@ FastAssemblerNS::~FastAssemblerNS()
 
 	if ( M_useSUPG )
 	{
-		for ( int i_elem = 0; i_elem <  M_numElements; i_elem++ )
+		for ( int i_elem = 0; i_elem <  M_chunkSize; i_elem++ )
 		{
 			for ( int k = 0; k <  3; k++ )
 			{
@@ -199,7 +200,7 @@ FastAssemblerNS::~FastAssemblerNS()
 		}
 		delete [] M_vals_supg;
 
-		for( int i = 0 ; i < M_numElements ; i++ )
+		for( int i = 0 ; i < M_chunkSize ; i++ )
 		{
 			for ( int k = 0; k < 3; k++ )
 			{
@@ -213,7 +214,7 @@ FastAssemblerNS::~FastAssemblerNS()
 		}
 		delete [] M_vals_supg_01;
 
-		for( int i = 0 ; i < M_numElements ; i++ )
+		for( int i = 0 ; i < M_chunkSize ; i++ )
 		{
 			for ( int k = 0; k < 3; k++ )
 			{
@@ -227,7 +228,7 @@ FastAssemblerNS::~FastAssemblerNS()
 		}
 		delete [] M_vals_supg_10;
 
-		for( int i = 0 ; i < M_numElements ; i++ )
+		for( int i = 0 ; i < M_chunkSize ; i++ )
 		{
 			delete [] M_rows_tmp[i];
 			delete [] M_cols_tmp[i];
@@ -317,12 +318,14 @@ FastAssemblerNS::updateGeoQuantities ( CurrentFE* current_fe )
 }
 //=========================================================================
 void
-FastAssemblerNS::allocateSpace ( CurrentFE* current_fe_velocity, const bool& use_supg )
+FastAssemblerNS::allocateSpace ( CurrentFE* current_fe_velocity, const bool& use_supg, const int& chunkSize )
 {
 	M_useSUPG = use_supg;
 
 	M_numElements = M_mesh->numVolumes();
 
+	M_chunkSize = ( chunkSize > 0 && chunkSize < M_numElements ) ? chunkSize : M_numElements;
+
 	M_numScalarDofs = M_fespace_velocity->dof().numTotalDof();
 
 	M_detJacobian = new double[ M_numElements ];
@@ -523,9 +526,9 @@ FastAssemblerNS::allocateSpace ( CurrentFE* current_fe_velocity, const bool& use
 	// ROWS VELOCITY
 	//-------------------------------------------------------------------------------------------------
 
-	M_rows_velocity = new int* [M_numElements];
+	M_rows_velocity = new int* [M_chunkSize];
 
-	for ( int i_elem = 0; i_elem <  M_numElements; i_elem++ )
+	for ( int i_elem = 0; i_elem <  M_chunkSize; i_elem++ )
 	{
 		M_rows_velocity[i_elem] = new int [ M_referenceFE_velocity->nbDof() ];
 	}
@@ -534,9 +537,9 @@ FastAssemblerNS::allocateSpace ( CurrentFE* current_fe_velocity, const bool& use
 	// ROWS PRESSURE
 	//-------------------------------------------------------------------------------------------------
 
-	M_rows_pressure = new int* [M_numElements];
+	M_rows_pressure = new int* [M_chunkSize];
 
-	for ( int i_elem = 0; i_elem <  M_numElements; i_elem++ )
+	for ( int i_elem = 0; i_elem <  M_chunkSize; i_elem++ )
 	{
 		M_rows_pressure[i_elem] = new int [ M_referenceFE_pressure->nbDof() ];
 	}
@@ -545,9 +548,9 @@ FastAssemblerNS::allocateSpace ( CurrentFE* current_fe_velocity, const bool& use
 	// COLS VELOCITY
 	//-------------------------------------------------------------------------------------------------
 
-	M_cols_velocity = new int* [M_numElements];
+	M_cols_velocity = new int* [M_chunkSize];
 
-	for ( int i_elem = 0; i_elem <  M_numElements; i_elem++ )
+	for ( int i_elem = 0; i_elem <  M_chunkSize; i_elem++ )
 	{
 		M_cols_velocity[i_elem] = new int [ M_referenceFE_velocity->nbDof() ];
 	}
@@ -556,9 +559,9 @@ FastAssemblerNS::allocateSpace ( CurrentFE* current_fe_velocity, const bool& use
 	// COLS PRESSURE
 	//-------------------------------------------------------------------------------------------------
 
-	M_cols_pressure = new int* [M_numElements];
+	M_cols_pressure = new int* [M_chunkSize];
 
-	for ( int i_elem = 0; i_elem <  M_numElements; i_elem++ )
+	for ( int i_elem = 0; i_elem <  M_chunkSize; i_elem++ )
 	{
 		M_cols_pressure[i_elem] = new int [ M_referenceFE_pressure->nbDof() ];
 	}
@@ -567,9 +570,9 @@ FastAssemblerNS::allocateSpace ( CurrentFE* current_fe_velocity, const bool& use
 	// VALUES BLOCK (0,0)
 	//-------------------------------------------------------------------------------------------------
 
-	M_vals_00 = new double** [M_numElements];
+	M_vals_00 = new double** [M_chunkSize];
 
-	for ( int i_elem = 0; i_elem <  M_numElements; i_elem++ )
+	for ( int i_elem = 0; i_elem <  M_chunkSize; i_elem++ )
 	{
 		M_vals_00[i_elem] = new double* [ M_referenceFE_velocity->nbDof() ];
 		for ( int i = 0; i <  M_referenceFE_velocity->nbDof(); i++ )
@@ -582,9 +585,9 @@ FastAssemblerNS::allocateSpace ( CurrentFE* current_fe_velocity, const bool& use
 	// VALUES BLOCK (0,1)
 	//-------------------------------------------------------------------------------------------------
 
-	M_vals_01 = new double** [M_numElements];
+	M_vals_01 = new double** [M_chunkSize];
 
-	for ( int i_elem = 0; i_elem <  M_numElements; i_elem++ )
+	for ( int i_elem = 0; i_elem <  M_chunkSize; i_elem++ )
 	{
 		M_vals_01[i_elem] = new double* [ M_referenceFE_velocity->nbDof() ];
 		for ( int i = 0; i <  M_referenceFE_velocity->nbDof(); i++ )
@@ -597,9 +600,9 @@ FastAssemblerNS::allocateSpace ( CurrentFE* current_fe_velocity, const bool& use
 	// VALUES BLOCK (1,0)
 	//-------------------------------------------------------------------------------------------------
 
-	M_vals_10 = new double** [M_numElements];
+	M_vals_10 = new double** [M_chunkSize];
 
-	for ( int i_elem = 0; i_elem <  M_numElements; i_elem++ )
+	for ( int i_elem = 0; i_elem <  M_chunkSize; i_elem++ )
 	{
 		M_vals_10[i_elem] = new double* [ M_referenceFE_pressure->nbDof() ];
 		for ( int i = 0; i <  M_referenceFE_pressure->nbDof(); i++ )
@@ -612,9 +615,9 @@ FastAssemblerNS::allocateSpace ( CurrentFE* current_fe_velocity, const bool& use
 	// VALUES BLOCK (1,1)
 	//-------------------------------------------------------------------------------------------------
 
-	M_vals_11 = new double** [M_numElements];
+	M_vals_11 = new double** [M_chunkSize];
 
-	for ( int i_elem = 0; i_elem <  M_numElements; i_elem++ )
+	for ( int i_elem = 0; i_elem <  M_chunkSize; i_elem++ )
 	{
 		M_vals_11[i_elem] = new double* [ M_referenceFE_pressure->nbDof() ];
 		for ( int i = 0; i <  M_referenceFE_pressure->nbDof(); i++ )
@@ -629,9 +632,9 @@ FastAssemblerNS::allocateSpace ( CurrentFE* current_fe_velocity, const bool& use
 		// SUPG MATRIX BLOCK (0,0) - because term with Tau_C leads to blocks on mixed components
 		//-------------------------------------------------------------------------------------------------
 
-		M_vals_supg = new double**** [M_numElements];
+		M_vals_supg = new double**** [M_chunkSize];
 
-		for ( int i_elem = 0; i_elem <  M_numElements; i_elem++ )
+		for ( int i_elem = 0; i_elem <  M_chunkSize; i_elem++ )
 		{
 			M_vals_supg[i_elem] = new double*** [ 3 ];
 			for ( int k = 0; k <  3; k++ )
@@ -652,8 +655,8 @@ FastAssemblerNS::allocateSpace ( CurrentFE* current_fe_velocity, const bool& use
 			}
 		}
 
-		M_vals_supg_01 = new double*** [M_numElements];
-		for ( int i_elem = 0; i_elem <  M_numElements; i_elem++ )
+		M_vals_supg_01 = new double*** [M_chunkSize];
+		for ( int i_elem = 0; i_elem <  M_chunkSize; i_elem++ )
 		{
 			M_vals_supg_01[i_elem] = new double** [ 3 ];
 			for ( int k = 0; k <  3; k++ )
@@ -666,8 +669,8 @@ FastAssemblerNS::allocateSpace ( CurrentFE* current_fe_velocity, const bool& use
 			}
 		}
 
-		M_vals_supg_10 = new double*** [M_numElements];
-		for ( int i_elem = 0; i_elem <  M_numElements; i_elem++ )
+		M_vals_supg_10 = new double*** [M_chunkSize];
+		for ( int i_elem = 0; i_elem <  M_chunkSize; i_elem++ )
 		{
 			M_vals_supg_10[i_elem] = new double** [ 3 ];
 			for ( int k = 0; k <  3; k++ )
@@ -680,16 +683,16 @@ FastAssemblerNS::allocateSpace ( CurrentFE* current_fe_velocity, const bool& use
 			}
 		}
 
-		M_rows_tmp = new int* [M_numElements];
+		M_rows_tmp = new int* [M_chunkSize];
 
-		for ( int i_elem = 0; i_elem <  M_numElements; i_elem++ )
+		for ( int i_elem = 0; i_elem <  M_chunkSize; i_elem++ )
 		{
 			M_rows_tmp[i_elem] = new int [ M_referenceFE_velocity->nbDof() ];
 		}
 
-		M_cols_tmp = new int* [M_numElements];
+		M_cols_tmp = new int* [M_chunkSize];
 
-		for ( int i_elem = 0; i_elem <  M_numElements; i_elem++ )
+		for ( int i_elem = 0; i_elem <  M_chunkSize; i_elem++ )
 		{
 			M_cols_tmp[i_elem] = new int [ M_referenceFE_velocity->nbDof() ];
 		}
@@ -748,6 +751,20 @@ FastAssemblerNS::allocateSpace ( CurrentFE* current_fe_velocity, const bool& use
 }
 //=========================================================================
 void
+FastAssemblerNS::addToMatrix ( matrixPtr_Type& matrix, const int& numRows, const int* rows,
+                               const int& numCols, const int* cols, const double* const* values )
+{
+	if ( matrix->matrixPtr()->Filled() )
+	{
+		matrix->matrixPtr()->SumIntoGlobalValues ( numRows, rows, numCols, cols, values, Epetra_FECrsMatrix::ROW_MAJOR );
+	}
+	else
+	{
+		matrix->matrixPtr()->InsertGlobalValues ( numRows, rows, numCols, cols, values, Epetra_FECrsMatrix::ROW_MAJOR );
+	}
+}
+//=========================================================================
+void
 FastAssemblerNS::assemble_supg_terms( matrixPtr_Type& block00, matrixPtr_Type& block01, matrixPtr_Type& block10, matrixPtr_Type& block11, const vector_Type& u_h )
 {
 	int ndof_velocity = M_referenceFE_velocity->nbDof();
@@ -762,297 +779,305 @@ FastAssemblerNS::assemble_supg_terms( matrixPtr_Type& block00, matrixPtr_Type& b
 		w_quad[q] = M_qr->weight(q);
 	}
 
-	#pragma omp parallel firstprivate( w_quad, ndof_velocity, ndof_pressure, NumQuadPoints)
+	// the elements are processed by chunks of M_chunkSize, the element stores are reused for each chunk
+	for ( int chunkBegin = 0; chunkBegin < M_numElements; chunkBegin += M_chunkSize )
 	{
-		int i_elem, i_dof, q, d1, d2, i_test, i_trial, e_idof, dim_mat, iCoor, jCoor, k1, k2;
-		double integral, integral_test, integral_trial, integral_partial, integral_lapl, partialSum;
-
-		double dphi_phys_velocity[ndof_velocity][NumQuadPoints][3];
-		double dphi_phys_pressure[ndof_pressure][NumQuadPoints][3];
-		double d2phi_phys_velocity[ndof_velocity][NumQuadPoints][3][3];
-		double uhq[3][NumQuadPoints];
+		const int chunkEnd ( std::min ( chunkBegin + M_chunkSize, M_numElements ) );
 
-		// ELEMENTI,
-		#pragma omp for
-		for ( i_elem = 0; i_elem <  M_numElements; i_elem++ )
+		#pragma omp parallel firstprivate( w_quad, ndof_velocity, ndof_pressure, NumQuadPoints)
 		{
-			// DOF
-			for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
+			int i_elem, i_dof, q, d1, d2, i_test, i_trial, e_idof, dim_mat, iCoor, jCoor, k1, k2;
+			double integral, integral_test, integral_trial, integral_partial, integral_lapl, partialSum;
+
+			double dphi_phys_velocity[ndof_velocity][NumQuadPoints][3];
+			double dphi_phys_pressure[ndof_pressure][NumQuadPoints][3];
+			double d2phi_phys_velocity[ndof_velocity][NumQuadPoints][3][3];
+			double uhq[3][NumQuadPoints];
+
+			// ELEMENTI,
+			#pragma omp for
+			for ( i_elem = chunkBegin; i_elem < chunkEnd; i_elem++ )
 			{
-				// QUAD
-				for (  q = 0; q < NumQuadPoints ; q++ )
+				const int i_chunk ( i_elem - chunkBegin );
+
+				// DOF
+				for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
 				{
-					// DIM 1
-					for ( d1 = 0; d1 < 3 ; d1++ )
+					// QUAD
+					for (  q = 0; q < NumQuadPoints ; q++ )
 					{
-						dphi_phys_velocity[i_dof][q][d1] = 0.0;
-
-						// DIM 2
-						for ( d2 = 0; d2 < 3 ; d2++ )
+						// DIM 1
+						for ( d1 = 0; d1 < 3 ; d1++ )
 						{
-							dphi_phys_velocity[i_dof][q][d1] += M_invJacobian[i_elem][d1][d2] * M_dphi_velocity[i_dof][q][d2];
+							dphi_phys_velocity[i_dof][q][d1] = 0.0;
+
+							// DIM 2
+							for ( d2 = 0; d2 < 3 ; d2++ )
+							{
+								dphi_phys_velocity[i_dof][q][d1] += M_invJacobian[i_elem][d1][d2] * M_dphi_velocity[i_dof][q][d2];
+							}
 						}
 					}
 				}
-			}
 
-			// DOF -- nota che può essere ottimizzato rishapando il gradiente fisico. Prima q poi d1 poi d2 e poi i_dof
-			for ( i_dof = 0; i_dof <  ndof_pressure; i_dof++ )
-			{
-				// QUAD
-				for (  q = 0; q < NumQuadPoints ; q++ )
+				// DOF -- nota che può essere ottimizzato rishapando il gradiente fisico. Prima q poi d1 poi d2 e poi i_dof
+				for ( i_dof = 0; i_dof <  ndof_pressure; i_dof++ )
 				{
-					// DIM 1
-					for ( d1 = 0; d1 < 3 ; d1++ )
+					// QUAD
+					for (  q = 0; q < NumQuadPoints ; q++ )
 					{
-						dphi_phys_pressure[i_dof][q][d1] = 0.0;
-
-						// DIM 2
-						for ( d2 = 0; d2 < 3 ; d2++ )
+						// DIM 1
+						for ( d1 = 0; d1 < 3 ; d1++ )
 						{
-							dphi_phys_pressure[i_dof][q][d1] += M_invJacobian[i_elem][d1][d2] * M_dphi_pressure[i_dof][q][d2];
+							dphi_phys_pressure[i_dof][q][d1] = 0.0;
+
+							// DIM 2
+							for ( d2 = 0; d2 < 3 ; d2++ )
+							{
+								dphi_phys_pressure[i_dof][q][d1] += M_invJacobian[i_elem][d1][d2] * M_dphi_pressure[i_dof][q][d2];
+							}
 						}
 					}
 				}
-			}
 
-			// QUAD
-			for (  q = 0; q < NumQuadPoints ; q++ )
-			{
-				// DOF
-				for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
+				// QUAD
+				for (  q = 0; q < NumQuadPoints ; q++ )
 				{
-					// DIM 1
-					for ( iCoor = 0; iCoor < 3 ; iCoor++ )
+					// DOF
+					for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
 					{
-						// DIM 2
-						for ( jCoor = 0; jCoor < 3 ; jCoor++ )
+						// DIM 1
+						for ( iCoor = 0; iCoor < 3 ; iCoor++ )
 						{
-							partialSum = 0.0;
-							// DIM 1
-							for ( k1 = 0; k1 < 3 ; k1++ )
+							// DIM 2
+							for ( jCoor = 0; jCoor < 3 ; jCoor++ )
 							{
-								// DIM 2
-								for ( k2 = 0; k2 < 3 ; k2++ )
+								partialSum = 0.0;
+								// DIM 1
+								for ( k1 = 0; k1 < 3 ; k1++ )
 								{
-									partialSum += M_invJacobian[i_elem][iCoor][k1]
-									              * M_d2phi_velocity[i_dof][q][k1][k2]
-									              * M_invJacobian[i_elem][jCoor][k2];
+									// DIM 2
+									for ( k2 = 0; k2 < 3 ; k2++ )
+									{
+										partialSum += M_invJacobian[i_elem][iCoor][k1]
+										              * M_d2phi_velocity[i_dof][q][k1][k2]
+										              * M_invJacobian[i_elem][jCoor][k2];
+									}
 								}
+								d2phi_phys_velocity[i_dof][q][iCoor][jCoor] = partialSum;
 							}
-							d2phi_phys_velocity[i_dof][q][iCoor][jCoor] = partialSum;
 						}
 					}
 				}
-			}
 
-			// QUAD
-			for (  q = 0; q < NumQuadPoints ; q++ )
-			{
-				for ( d1 = 0; d1 < 3 ; d1++ )
+				// QUAD
+				for (  q = 0; q < NumQuadPoints ; q++ )
 				{
-					uhq[d1][q] = 0.0;
-					for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
+					for ( d1 = 0; d1 < 3 ; d1++ )
 					{
-						e_idof =  M_elements_velocity[i_elem][i_dof] + d1*M_numScalarDofs  ;
-						uhq[d1][q] += u_h[e_idof] * M_phi_velocity[i_dof][q];
+						uhq[d1][q] = 0.0;
+						for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
+						{
+							e_idof =  M_elements_velocity[i_elem][i_dof] + d1*M_numScalarDofs  ;
+							uhq[d1][q] += u_h[e_idof] * M_phi_velocity[i_dof][q];
+						}
 					}
 				}
-			}
-
-			// STABILIZZAZIONE - coefficienti Tau_M e Tau_C
-			for (  q = 0; q < NumQuadPoints ; q++ )
-			{
-				M_Tau_M[i_elem][q] = 1.0/std::sqrt(
-						M_density*M_density*M_orderBDF*M_orderBDF/(M_timestep*M_timestep) // TAU_M_DEN_DT
-						+M_density*M_density*( uhq[0][q]*( M_G[i_elem][0][0]* uhq[0][q] +  M_G[i_elem][0][1] * uhq[1][q] + M_G[i_elem][0][2] * uhq[2][q] ) +
-											   uhq[1][q]*( M_G[i_elem][1][0]* uhq[0][q] +  M_G[i_elem][1][1] * uhq[1][q] + M_G[i_elem][1][2] * uhq[2][q] ) +
-											   uhq[2][q]*( M_G[i_elem][2][0]* uhq[0][q] +  M_G[i_elem][2][1] * uhq[1][q] + M_G[i_elem][2][2] * uhq[2][q]   )
-											 ) 	// TAU_M_DEN_VEL
-						+M_C_I*M_viscosity*M_viscosity*(
-								M_G[i_elem][0][0]*M_G[i_elem][0][0] + M_G[i_elem][0][1]*M_G[i_elem][0][1] + M_G[i_elem][0][2]*M_G[i_elem][0][2] +
-								M_G[i_elem][1][0]*M_G[i_elem][1][0] + M_G[i_elem][1][1]*M_G[i_elem][1][1] + M_G[i_elem][1][2]*M_G[i_elem][1][2] +
-								M_G[i_elem][2][0]*M_G[i_elem][2][0] + M_G[i_elem][2][1]*M_G[i_elem][2][1] + M_G[i_elem][2][2]*M_G[i_elem][2][2]
-											 )  // TAU_M_DEN_VISC*/
-				);
-
-				M_Tau_C[i_elem][q] = 1.0/( M_g[i_elem][0]*M_Tau_M[i_elem][q]*M_g[i_elem][0] +
-										   M_g[i_elem][1]*M_Tau_M[i_elem][q]*M_g[i_elem][1] +
-										   M_g[i_elem][2]*M_Tau_M[i_elem][q]*M_g[i_elem][2]
-										  );
 
-			}
+				// STABILIZZAZIONE - coefficienti Tau_M e Tau_C
+				for (  q = 0; q < NumQuadPoints ; q++ )
+				{
+					M_Tau_M[i_elem][q] = 1.0/std::sqrt(
+							M_density*M_density*M_orderBDF*M_orderBDF/(M_timestep*M_timestep) // TAU_M_DEN_DT
+							+M_density*M_density*( uhq[0][q]*( M_G[i_elem][0][0]* uhq[0][q] +  M_G[i_elem][0][1] * uhq[1][q] + M_G[i_elem][0][2] * uhq[2][q] ) +
+												   uhq[1][q]*( M_G[i_elem][1][0]* uhq[0][q] +  M_G[i_elem][1][1] * uhq[1][q] + M_G[i_elem][1][2] * uhq[2][q] ) +
+												   uhq[2][q]*( M_G[i_elem][2][0]* uhq[0][q] +  M_G[i_elem][2][1] * uhq[1][q] + M_G[i_elem][2][2] * uhq[2][q]   )
+												 ) 	// TAU_M_DEN_VEL
+							+M_C_I*M_viscosity*M_viscosity*(
+									M_G[i_elem][0][0]*M_G[i_elem][0][0] + M_G[i_elem][0][1]*M_G[i_elem][0][1] + M_G[i_elem][0][2]*M_G[i_elem][0][2] +
+									M_G[i_elem][1][0]*M_G[i_elem][1][0] + M_G[i_elem][1][1]*M_G[i_elem][1][1] + M_G[i_elem][1][2]*M_G[i_elem][1][2] +
+									M_G[i_elem][2][0]*M_G[i_elem][2][0] + M_G[i_elem][2][1]*M_G[i_elem][2][1] + M_G[i_elem][2][2]*M_G[i_elem][2][2]
+												 )  // TAU_M_DEN_VISC*/
+					);
+
+					M_Tau_C[i_elem][q] = 1.0/( M_g[i_elem][0]*M_Tau_M[i_elem][q]*M_g[i_elem][0] +
+											   M_g[i_elem][1]*M_Tau_M[i_elem][q]*M_g[i_elem][1] +
+											   M_g[i_elem][2]*M_Tau_M[i_elem][q]*M_g[i_elem][2]
+											  );
 
-			// DOF - test
-			for ( i_test = 0; i_test <  ndof_velocity; i_test++ )
-			{
-				M_rows_velocity[i_elem][i_test] = M_elements_velocity[i_elem][i_test];
+				}
 
-				// DOF - trial
-				for ( i_trial = 0; i_trial <  ndof_velocity; i_trial++ )
+				// DOF - test
+				for ( i_test = 0; i_test <  ndof_velocity; i_test++ )
 				{
-					M_cols_velocity[i_elem][i_trial] = M_elements_velocity[i_elem][i_trial];
+					M_rows_velocity[i_chunk][i_test] = M_elements_velocity[i_elem][i_test];
 
-					integral = 0.0;
-					// QUAD
-					for ( q = 0; q < NumQuadPoints ; q++ )
+					// DOF - trial
+					for ( i_trial = 0; i_trial <  ndof_velocity; i_trial++ )
 					{
-						integral_test = 0.0;
-						integral_trial = 0.0;
-						integral_lapl = 0.0;
+						M_cols_velocity[i_chunk][i_trial] = M_elements_velocity[i_elem][i_trial];
 
-						// DIM 1
-						for ( d1 = 0; d1 < 3 ; d1++ )
+						integral = 0.0;
+						// QUAD
+						for ( q = 0; q < NumQuadPoints ; q++ )
+						{
+							integral_test = 0.0;
+							integral_trial = 0.0;
+							integral_lapl = 0.0;
+
+							// DIM 1
+							for ( d1 = 0; d1 < 3 ; d1++ )
+							{
+								integral_lapl += d2phi_phys_velocity[i_trial][q][d1][d1];
+								integral_test += uhq[d1][q] * dphi_phys_velocity[i_test][q][d1];   // w grad(phi_i)
+								integral_trial += uhq[d1][q] * dphi_phys_velocity[i_trial][q][d1]; // w grad(phi_j) terzo indice dphi_phys e' derivata in x,y,z
+							}
+							integral += M_Tau_M[i_elem][q] * (integral_test * integral_trial + integral_test * M_phi_velocity[i_trial][q]
+							                                  - integral_test * integral_lapl ) * w_quad[q];
+							// above, the term "integral_test * M_phi[i_trial][q]" is the one which comes from (w grad(phi_i), phi_j)
+						}
+						M_vals_supg[i_chunk][0][0][i_test][i_trial] = integral *  M_detJacobian[i_elem]; // (w grad(phi_i), w grad(phi_j) )
+						M_vals_supg[i_chunk][1][1][i_test][i_trial] = integral *  M_detJacobian[i_elem];
+						M_vals_supg[i_chunk][2][2][i_test][i_trial] = integral *  M_detJacobian[i_elem];
+
+						for ( d1 = 0; d1 < 3; d1++ )
 						{
-							integral_lapl += d2phi_phys_velocity[i_trial][q][d1][d1];
-							integral_test += uhq[d1][q] * dphi_phys_velocity[i_test][q][d1];   // w grad(phi_i)
-							integral_trial += uhq[d1][q] * dphi_phys_velocity[i_trial][q][d1]; // w grad(phi_j) terzo indice dphi_phys e' derivata in x,y,z
+							for ( d2 = 0; d2 < 3; d2++ )
+							{
+								integral = 0.0;
+								// QUAD
+								for ( q = 0; q < NumQuadPoints ; q++ )
+								{
+									integral += M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][d1] * dphi_phys_velocity[i_trial][q][d2] * w_quad[q]; // div(phi_i) * div(phi_j)
+								}
+								M_vals_supg[i_chunk][d1][d2][i_test][i_trial] += integral *  M_detJacobian[i_elem];
+							}
 						}
-						integral += M_Tau_M[i_elem][q] * (integral_test * integral_trial + integral_test * M_phi_velocity[i_trial][q]
-						                                  - integral_test * integral_lapl ) * w_quad[q];
-						// above, the term "integral_test * M_phi[i_trial][q]" is the one which comes from (w grad(phi_i), phi_j)
+
 					}
-					M_vals_supg[i_elem][0][0][i_test][i_trial] = integral *  M_detJacobian[i_elem]; // (w grad(phi_i), w grad(phi_j) )
-					M_vals_supg[i_elem][1][1][i_test][i_trial] = integral *  M_detJacobian[i_elem];
-					M_vals_supg[i_elem][2][2][i_test][i_trial] = integral *  M_detJacobian[i_elem];
 
-					for ( d1 = 0; d1 < 3; d1++ )
+					for ( i_trial = 0; i_trial <  ndof_pressure; i_trial++ )
 					{
-						for ( d2 = 0; d2 < 3; d2++ )
+						for ( dim_mat = 0; dim_mat < 3 ; dim_mat++ )
 						{
+							M_cols_pressure[i_chunk][i_trial] = M_elements_pressure[i_elem][i_trial];
+
 							integral = 0.0;
+
 							// QUAD
 							for ( q = 0; q < NumQuadPoints ; q++ )
 							{
-								integral += M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][d1] * dphi_phys_velocity[i_trial][q][d2] * w_quad[q]; // div(phi_i) * div(phi_j)
+								integral_partial = 0.0;
+								for ( d1 = 0; d1 < 3 ; d1++ )
+								{
+									integral_partial += ( dphi_phys_velocity[i_test][q][d1] * uhq[d1][q] );
+								}
+								integral += M_Tau_M[i_elem][q] * dphi_phys_pressure[i_trial][q][dim_mat] * integral_partial * w_quad[q];
 							}
-							M_vals_supg[i_elem][d1][d2][i_test][i_trial] += integral *  M_detJacobian[i_elem];
+							M_vals_supg_01[i_chunk][dim_mat][i_test][i_trial] = integral * M_detJacobian[i_elem];
 						}
 					}
 
 				}
 
-				for ( i_trial = 0; i_trial <  ndof_pressure; i_trial++ )
+				// DOF - test - assemblo blocchi (1,0) e (1,1)
+				for ( i_test = 0; i_test <  ndof_pressure; i_test++ )
 				{
-					for ( dim_mat = 0; dim_mat < 3 ; dim_mat++ )
-					{
-						M_cols_pressure[i_elem][i_trial] = M_elements_pressure[i_elem][i_trial];
+					M_rows_pressure[i_chunk][i_test] = M_elements_pressure[i_elem][i_test];
 
+					// DOF - trial
+					for ( i_trial = 0; i_trial <  ndof_pressure; i_trial++ )
+					{
 						integral = 0.0;
-
 						// QUAD
 						for ( q = 0; q < NumQuadPoints ; q++ )
 						{
-							integral_partial = 0.0;
+							// DIM 1
 							for ( d1 = 0; d1 < 3 ; d1++ )
 							{
-								integral_partial += ( dphi_phys_velocity[i_test][q][d1] * uhq[d1][q] );
+								integral += M_Tau_M[i_elem][q] * dphi_phys_pressure[i_test][q][d1] * dphi_phys_pressure[i_trial][q][d1]*w_quad[q];
 							}
-							integral += M_Tau_M[i_elem][q] * dphi_phys_pressure[i_trial][q][dim_mat] * integral_partial * w_quad[q];
 						}
-						M_vals_supg_01[i_elem][dim_mat][i_test][i_trial] = integral * M_detJacobian[i_elem];
+						M_vals_11[i_chunk][i_test][i_trial] = 0.0;
+						M_vals_11[i_chunk][i_test][i_trial] = integral * M_detJacobian[i_elem];
 					}
 				}
 
-			}
-
-			// DOF - test - assemblo blocchi (1,0) e (1,1)
-			for ( i_test = 0; i_test <  ndof_pressure; i_test++ )
-			{
-				M_rows_pressure[i_elem][i_test] = M_elements_pressure[i_elem][i_test];
-
-				// DOF - trial
-				for ( i_trial = 0; i_trial <  ndof_pressure; i_trial++ )
+				for ( dim_mat = 0; dim_mat < 3 ; dim_mat++ )
 				{
-					integral = 0.0;
-					// QUAD
-					for ( q = 0; q < NumQuadPoints ; q++ )
+					// DOF - test
+					for ( i_test = 0; i_test <  ndof_pressure; i_test++ )
 					{
-						// DIM 1
-						for ( d1 = 0; d1 < 3 ; d1++ )
+						// DOF - trial
+						for ( i_trial = 0; i_trial < ndof_velocity; i_trial++ )
 						{
-							integral += M_Tau_M[i_elem][q] * dphi_phys_pressure[i_test][q][d1] * dphi_phys_pressure[i_trial][q][d1]*w_quad[q];
-						}
-					}
-					M_vals_11[i_elem][i_test][i_trial] = 0.0;
-					M_vals_11[i_elem][i_test][i_trial] = integral * M_detJacobian[i_elem];
-				}
-			}
-
-			for ( dim_mat = 0; dim_mat < 3 ; dim_mat++ )
-			{
-				// DOF - test
-				for ( i_test = 0; i_test <  ndof_pressure; i_test++ )
-				{
-					// DOF - trial
-					for ( i_trial = 0; i_trial < ndof_velocity; i_trial++ )
-					{
-						integral = 0.0;
+							integral = 0.0;
 
-						// QUAD
-						for ( q = 0; q < NumQuadPoints ; q++ )
-						{
-							integral_partial = 0.0;
-							for ( d1 = 0; d1 < 3 ; d1++ )
+							// QUAD
+							for ( q = 0; q < NumQuadPoints ; q++ )
 							{
-								integral_partial += ( dphi_phys_velocity[i_trial][q][d1] * uhq[d1][q] - d2phi_phys_velocity[i_trial][q][d1][d1] );
+								integral_partial = 0.0;
+								for ( d1 = 0; d1 < 3 ; d1++ )
+								{
+									integral_partial += ( dphi_phys_velocity[i_trial][q][d1] * uhq[d1][q] - d2phi_phys_velocity[i_trial][q][d1][d1] );
+								}
+								integral += M_Tau_M[i_elem][q] * ( dphi_phys_pressure[i_test][q][dim_mat] * M_phi_velocity[i_trial][q] +
+											                       dphi_phys_pressure[i_test][q][dim_mat] * integral_partial ) * w_quad[q];
 							}
-							integral += M_Tau_M[i_elem][q] * ( dphi_phys_pressure[i_test][q][dim_mat] * M_phi_velocity[i_trial][q] +
-										                       dphi_phys_pressure[i_test][q][dim_mat] * integral_partial ) * w_quad[q];
-						}
 
-						M_vals_supg_10[i_elem][dim_mat][i_test][i_trial] = integral * M_detJacobian[i_elem];
+							M_vals_supg_10[i_chunk][dim_mat][i_test][i_trial] = integral * M_detJacobian[i_elem];
+						}
 					}
 				}
 			}
 		}
-	}
 
-	for ( UInt d1 = 0; d1 < 3 ; d1++ ) // row index
-	{
-		for ( int k = 0; k < M_numElements; ++k )
+		for ( UInt d1 = 0; d1 < 3 ; d1++ ) // row index
 		{
-			for ( UInt i = 0; i <  ndof_velocity; i++ )
+			for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
 			{
-				M_rows_tmp[k][i] = M_rows_velocity[k][i] + d1 * M_numScalarDofs;
+				for ( UInt i = 0; i <  ndof_velocity; i++ )
+				{
+					M_rows_tmp[k][i] = M_rows_velocity[k][i] + d1 * M_numScalarDofs;
+				}
+				addToMatrix ( block00, ndof_velocity, M_rows_tmp[k], ndof_velocity, M_cols_velocity[k], M_vals_supg[k][d1][0] );
+				addToMatrix ( block01, ndof_velocity, M_rows_tmp[k], ndof_pressure, M_cols_pressure[k], M_vals_supg_01[k][d1] );
 			}
-			block00->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k], ndof_velocity, M_cols_velocity[k], M_vals_supg[k][d1][0], Epetra_FECrsMatrix::ROW_MAJOR);
-			block01->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k], ndof_pressure, M_cols_pressure[k], M_vals_supg_01[k][d1], Epetra_FECrsMatrix::ROW_MAJOR);
-		}
 
-		for ( int k = 0; k < M_numElements; ++k )
-		{
-			for ( UInt i = 0; i <  ndof_velocity; i++ )
+			for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
 			{
-				M_cols_tmp[k][i] = M_cols_velocity[k][i] + M_numScalarDofs;
+				for ( UInt i = 0; i <  ndof_velocity; i++ )
+				{
+					M_cols_tmp[k][i] = M_cols_velocity[k][i] + M_numScalarDofs;
+				}
+				addToMatrix ( block00, ndof_velocity, M_rows_tmp[k], ndof_velocity, M_cols_tmp[k], M_vals_supg[k][d1][1] );
 			}
-			block00->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k], ndof_velocity, M_cols_tmp[k], M_vals_supg[k][d1][1], Epetra_FECrsMatrix::ROW_MAJOR);
-		}
 
-		for ( int k = 0; k < M_numElements; ++k )
-		{
-			for ( UInt i = 0; i <  ndof_velocity; i++ )
+			for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
 			{
-				M_cols_tmp[k][i] = M_cols_velocity[k][i] + 2 * M_numScalarDofs;
+				for ( UInt i = 0; i <  ndof_velocity; i++ )
+				{
+					M_cols_tmp[k][i] = M_cols_velocity[k][i] + 2 * M_numScalarDofs;
+				}
+				addToMatrix ( block00, ndof_velocity, M_rows_tmp[k], ndof_velocity, M_cols_tmp[k], M_vals_supg[k][d1][2] );
 			}
-			block00->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k], ndof_velocity, M_cols_tmp[k], M_vals_supg[k][d1][2], Epetra_FECrsMatrix::ROW_MAJOR);
 		}
-	}
 
-	for ( int k = 0; k < M_numElements; ++k )
-	{
-		block11->matrixPtr()->InsertGlobalValues ( ndof_pressure, M_rows_pressure[k], ndof_pressure, M_cols_pressure[k], M_vals_11[k], Epetra_FECrsMatrix::ROW_MAJOR);
-	}
+		for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
+		{
+			addToMatrix ( block11, ndof_pressure, M_rows_pressure[k], ndof_pressure, M_cols_pressure[k], M_vals_11[k] );
+		}
 
-	for ( UInt d1 = 0; d1 < 3 ; d1++ )
-	{
-		for ( int k = 0; k < M_numElements; ++k )
+		for ( UInt d1 = 0; d1 < 3 ; d1++ )
 		{
-			for ( UInt i = 0; i <  ndof_velocity; i++ )
+			for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
 			{
-				M_cols_tmp[k][i] = M_cols_velocity[k][i] + d1 * M_numScalarDofs;
+				for ( UInt i = 0; i <  ndof_velocity; i++ )
+				{
+					M_cols_tmp[k][i] = M_cols_velocity[k][i] + d1 * M_numScalarDofs;
+				}
+				addToMatrix ( block10, ndof_pressure, M_rows_pressure[k], ndof_velocity, M_cols_tmp[k], M_vals_supg_10[k][d1] );
 			}
-			block10->matrixPtr()->InsertGlobalValues ( ndof_pressure, M_rows_pressure[k], ndof_velocity, M_cols_tmp[k], M_vals_supg_10[k][d1], Epetra_FECrsMatrix::ROW_MAJOR);
 		}
 	}
 }
@@ -1072,253 +1097,252 @@ FastAssemblerNS::assemble_constant_terms( matrixPtr_Type& mass, matrixPtr_Type&
         w_quad[q] = M_qr->weight(q);
     }
     
-    #pragma omp parallel firstprivate( w_quad, ndof_velocity, ndof_pressure, NumQuadPoints)
+    // the elements are processed by chunks of M_chunkSize, the element stores are reused for each chunk
+    for ( int chunkBegin = 0; chunkBegin < M_numElements; chunkBegin += M_chunkSize )
     {
-        int i_elem, i_dof, q, d1, d2, i_test, i_trial, dim_mat, dim_mat1, dim_mat2;
-        double integral, integral_00, integral_01, integral_02, integral_10, integral_11, integral_12;
-        double integral_20, integral_21, integral_22;
+        const int chunkEnd ( std::min ( chunkBegin + M_chunkSize, M_numElements ) );
+
+        #pragma omp parallel firstprivate( w_quad, ndof_velocity, ndof_pressure, NumQuadPoints)
+        {
+            int i_elem, i_dof, q, d1, d2, i_test, i_trial, dim_mat, dim_mat1, dim_mat2;
+            double integral, integral_00, integral_01, integral_02, integral_10, integral_11, integral_12;
+            double integral_20, integral_21, integral_22;
         
-        double dphi_phys_velocity[ndof_velocity][NumQuadPoints][3]; // Gradient in the physical domain
+            double dphi_phys_velocity[ndof_velocity][NumQuadPoints][3]; // Gradient in the physical domain
         
-        // ELEMENTI
-        #pragma omp for
-        for ( i_elem = 0; i_elem <  M_numElements ; i_elem++ )
-        {
-            // DOF
-            for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
+            // ELEMENTI
+            #pragma omp for
+            for ( i_elem = chunkBegin; i_elem < chunkEnd; i_elem++ )
             {
-                // QUAD
-                for (  q = 0; q < NumQuadPoints ; q++ )
+                const int i_chunk ( i_elem - chunkBegin );
+
+                // DOF
+                for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
                 {
-                    // DIM 1
-                    for ( d1 = 0; d1 < 3 ; d1++ )
+                    // QUAD
+                    for (  q = 0; q < NumQuadPoints ; q++ )
                     {
-                        dphi_phys_velocity[i_dof][q][d1] = 0.0;
-                        
-                        // DIM 2
-                        for ( d2 = 0; d2 < 3 ; d2++ )
+                        // DIM 1
+                        for ( d1 = 0; d1 < 3 ; d1++ )
                         {
-                            dphi_phys_velocity[i_dof][q][d1] += M_invJacobian[i_elem][d1][d2] * M_dphi_velocity[i_dof][q][d2];
+                            dphi_phys_velocity[i_dof][q][d1] = 0.0;
+                        
+                            // DIM 2
+                            for ( d2 = 0; d2 < 3 ; d2++ )
+                            {
+                                dphi_phys_velocity[i_dof][q][d1] += M_invJacobian[i_elem][d1][d2] * M_dphi_velocity[i_dof][q][d2];
+                            }
                         }
                     }
                 }
-            }
             
-            // DOF - test
-            for ( i_test = 0; i_test <  ndof_velocity; i_test++ )
-            {
-                M_rows_velocity[i_elem][i_test] = M_elements_velocity[i_elem][i_test];
-                
-                // DOF - trial
-                for ( i_trial = 0; i_trial <  ndof_velocity; i_trial++ )
+                // DOF - test
+                for ( i_test = 0; i_test <  ndof_velocity; i_test++ )
                 {
-                    M_cols_velocity[i_elem][i_trial] = M_elements_velocity[i_elem][i_trial];
-                    M_vals_00[i_elem][i_test][i_trial] = 0.0;
-                    integral = 0.0;
-                    // QUAD
-                    for ( q = 0; q < NumQuadPoints ; q++ )
+                    M_rows_velocity[i_chunk][i_test] = M_elements_velocity[i_elem][i_test];
+                
+                    // DOF - trial
+                    for ( i_trial = 0; i_trial <  ndof_velocity; i_trial++ )
                     {
-                        integral += M_phi_velocity[i_test][q] * M_phi_velocity[i_trial][q]*w_quad[q];
+                        M_cols_velocity[i_chunk][i_trial] = M_elements_velocity[i_elem][i_trial];
+                        M_vals_00[i_chunk][i_test][i_trial] = 0.0;
+                        integral = 0.0;
+                        // QUAD
+                        for ( q = 0; q < NumQuadPoints ; q++ )
+                        {
+                            integral += M_phi_velocity[i_test][q] * M_phi_velocity[i_trial][q]*w_quad[q];
+                        }
+                        M_vals_00[i_chunk][i_test][i_trial] = M_density * integral * M_detJacobian[i_elem];
                     }
-                    M_vals_00[i_elem][i_test][i_trial] = M_density * integral * M_detJacobian[i_elem];
                 }
-            }
 
-            // DOF - test
-            for ( i_test = 0; i_test <  ndof_velocity; i_test++ )
-            {
-                // DOF - trial
-                for ( i_trial = 0; i_trial <  ndof_velocity; i_trial++ )
+                // DOF - test
+                for ( i_test = 0; i_test <  ndof_velocity; i_test++ )
                 {
-                    M_vals_supg[i_elem][0][0][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][0][1][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][0][2][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][1][0][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][1][1][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][1][2][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][2][0][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][2][1][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][2][2][i_test][i_trial] = 0.0;
-                    integral_00 = 0.0;
-                    integral_01 = 0.0;
-                    integral_02 = 0.0;
-                    integral_10 = 0.0;
-                    integral_11 = 0.0;
-                    integral_12 = 0.0;
-                    integral_20 = 0.0;
-                    integral_21 = 0.0;
-                    integral_22 = 0.0;
-                    // QUAD
-                    for ( q = 0; q < NumQuadPoints ; q++ )
+                    // DOF - trial
+                    for ( i_trial = 0; i_trial <  ndof_velocity; i_trial++ )
                     {
-                        integral_00 += ( 2*dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][0] +
-                                         dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][1]   +
-                                         dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][2] ) * w_quad[q];
+                        M_vals_supg[i_chunk][0][0][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][0][1][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][0][2][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][1][0][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][1][1][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][1][2][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][2][0][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][2][1][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][2][2][i_test][i_trial] = 0.0;
+                        integral_00 = 0.0;
+                        integral_01 = 0.0;
+                        integral_02 = 0.0;
+                        integral_10 = 0.0;
+                        integral_11 = 0.0;
+                        integral_12 = 0.0;
+                        integral_20 = 0.0;
+                        integral_21 = 0.0;
+                        integral_22 = 0.0;
+                        // QUAD
+                        for ( q = 0; q < NumQuadPoints ; q++ )
+                        {
+                            integral_00 += ( 2*dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][0] +
+                                             dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][1]   +
+                                             dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][2] ) * w_quad[q];
                         
-                        integral_01 += dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][0] * w_quad[q];
+                            integral_01 += dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][0] * w_quad[q];
                         
-                        integral_02 += dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][0] * w_quad[q];
+                            integral_02 += dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][0] * w_quad[q];
                         
-                        integral_10 += dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][1] * w_quad[q];
+                            integral_10 += dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][1] * w_quad[q];
                         
-                        integral_11 += ( 2*dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][1] +
-                                        dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][0]   +
-                                        dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][2] ) * w_quad[q];
+                            integral_11 += ( 2*dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][1] +
+                                            dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][0]   +
+                                            dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][2] ) * w_quad[q];
                         
-                        integral_12 += dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][1] * w_quad[q];
+                            integral_12 += dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][1] * w_quad[q];
                         
-                        integral_20 += dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][2] * w_quad[q];
+                            integral_20 += dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][2] * w_quad[q];
                         
-                        integral_21 += dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][2] * w_quad[q];
+                            integral_21 += dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][2] * w_quad[q];
                         
-                        integral_22 += ( 2*dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][2] +
-                                        dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][0]   +
-                                        dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][1] ) * w_quad[q];
+                            integral_22 += ( 2*dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][2] +
+                                            dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][0]   +
+                                            dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][1] ) * w_quad[q];
                         
+                        }
+                        M_vals_supg[i_chunk][0][0][i_test][i_trial] = M_viscosity * integral_00 * M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][0][1][i_test][i_trial] = M_viscosity * integral_01 * M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][0][2][i_test][i_trial] = M_viscosity * integral_02 * M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][1][0][i_test][i_trial] = M_viscosity * integral_10 * M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][1][1][i_test][i_trial] = M_viscosity * integral_11 * M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][1][2][i_test][i_trial] = M_viscosity * integral_12 * M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][2][0][i_test][i_trial] = M_viscosity * integral_20 * M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][2][1][i_test][i_trial] = M_viscosity * integral_21 * M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][2][2][i_test][i_trial] = M_viscosity * integral_22 * M_detJacobian[i_elem];
                     }
-                    M_vals_supg[i_elem][0][0][i_test][i_trial] = M_viscosity * integral_00 * M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][0][1][i_test][i_trial] = M_viscosity * integral_01 * M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][0][2][i_test][i_trial] = M_viscosity * integral_02 * M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][1][0][i_test][i_trial] = M_viscosity * integral_10 * M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][1][1][i_test][i_trial] = M_viscosity * integral_11 * M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][1][2][i_test][i_trial] = M_viscosity * integral_12 * M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][2][0][i_test][i_trial] = M_viscosity * integral_20 * M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][2][1][i_test][i_trial] = M_viscosity * integral_21 * M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][2][2][i_test][i_trial] = M_viscosity * integral_22 * M_detJacobian[i_elem];
                 }
-            }
             
-            for ( dim_mat = 0; dim_mat < 3 ; dim_mat++ )
-            {
-                // DOF - test
-                for ( i_test = 0; i_test <  ndof_velocity; i_test++ )
+                for ( dim_mat = 0; dim_mat < 3 ; dim_mat++ )
                 {
-                    // DOF - trial
-                    for ( i_trial = 0; i_trial < ndof_pressure; i_trial++ )
+                    // DOF - test
+                    for ( i_test = 0; i_test <  ndof_velocity; i_test++ )
                     {
-                        M_vals_supg_01[i_elem][dim_mat][i_test][i_trial] = 0.0;
-                        M_cols_pressure[i_elem][i_trial] = M_elements_pressure[i_elem][i_trial];
-                        integral = 0.0;
-                        // QUAD
-                        for ( q = 0; q < NumQuadPoints ; q++ )
+                        // DOF - trial
+                        for ( i_trial = 0; i_trial < ndof_pressure; i_trial++ )
                         {
-                            integral += dphi_phys_velocity[i_test][q][dim_mat]*M_phi_pressure[i_trial][q]*w_quad[q];
+                            M_vals_supg_01[i_chunk][dim_mat][i_test][i_trial] = 0.0;
+                            M_cols_pressure[i_chunk][i_trial] = M_elements_pressure[i_elem][i_trial];
+                            integral = 0.0;
+                            // QUAD
+                            for ( q = 0; q < NumQuadPoints ; q++ )
+                            {
+                                integral += dphi_phys_velocity[i_test][q][dim_mat]*M_phi_pressure[i_trial][q]*w_quad[q];
+                            }
+                            M_vals_supg_01[i_chunk][dim_mat][i_test][i_trial] = -1.0 * integral * M_detJacobian[i_elem];
                         }
-                        M_vals_supg_01[i_elem][dim_mat][i_test][i_trial] = -1.0 * integral * M_detJacobian[i_elem];
                     }
                 }
-            }
             
-            for ( dim_mat = 0; dim_mat < 3 ; dim_mat++ )
-            {
-                // DOF - test
-                for ( i_test = 0; i_test <  ndof_pressure; i_test++ )
+                for ( dim_mat = 0; dim_mat < 3 ; dim_mat++ )
                 {
-                    M_rows_pressure[i_elem][i_test] = M_elements_pressure[i_elem][i_test];
-                    
-                    // DOF - trial
-                    for ( i_trial = 0; i_trial < ndof_velocity; i_trial++ )
+                    // DOF - test
+                    for ( i_test = 0; i_test <  ndof_pressure; i_test++ )
                     {
-                        M_vals_supg_10[i_elem][dim_mat][i_test][i_trial] = 0.0;
-                        integral = 0.0;
-                        // QUAD
-                        for ( q = 0; q < NumQuadPoints ; q++ )
+                        M_rows_pressure[i_chunk][i_test] = M_elements_pressure[i_elem][i_test];
+                    
+                        // DOF - trial
+                        for ( i_trial = 0; i_trial < ndof_velocity; i_trial++ )
                         {
-                            integral += dphi_phys_velocity[i_trial][q][dim_mat]*M_phi_pressure[i_test][q]*w_quad[q];
-                        }
+                            M_vals_supg_10[i_chunk][dim_mat][i_test][i_trial] = 0.0;
+                            integral = 0.0;
+                            // QUAD
+                            for ( q = 0; q < NumQuadPoints ; q++ )
+                            {
+                                integral += dphi_phys_velocity[i_trial][q][dim_mat]*M_phi_pressure[i_test][q]*w_quad[q];
+                            }
                         
-                        M_vals_supg_10[i_elem][dim_mat][i_test][i_trial] = integral * M_detJacobian[i_elem];
+                            M_vals_supg_10[i_chunk][dim_mat][i_test][i_trial] = integral * M_detJacobian[i_elem];
+                        }
                     }
                 }
             }
         }
-    }
     
-    for ( int k = 0; k < M_numElements; ++k )
-    {
-        mass->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_velocity[k],
-                                                ndof_velocity, M_cols_velocity[k],
-                                                M_vals_00[k],
-                                                Epetra_FECrsMatrix::ROW_MAJOR);
+        for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
+        {
+            addToMatrix ( mass, ndof_velocity, M_rows_velocity[k],
+                          ndof_velocity, M_cols_velocity[k],
+                          M_vals_00[k] );
         
-        b01->matrixPtr()->InsertGlobalValues ( ndof_velocity,
-                                               M_rows_velocity[k],
-                                               ndof_pressure,
-                                               M_cols_pressure[k],
-                                               M_vals_supg_01[k][0],
-                                               Epetra_FECrsMatrix::ROW_MAJOR);
+            addToMatrix ( b01, ndof_velocity,
+                          M_rows_velocity[k],
+                          ndof_pressure,
+                          M_cols_pressure[k],
+                          M_vals_supg_01[k][0] );
         
-        b10->matrixPtr()->InsertGlobalValues ( ndof_pressure, M_rows_pressure[k],
-                                               ndof_velocity, M_cols_velocity[k],
-                                               M_vals_supg_10[k][0],
-                                               Epetra_FECrsMatrix::ROW_MAJOR);
+            addToMatrix ( b10, ndof_pressure, M_rows_pressure[k],
+                          ndof_velocity, M_cols_velocity[k],
+                          M_vals_supg_10[k][0] );
         
-    }
+        }
     
-    for ( UInt d1 = 0; d1 < 3 ; d1++ ) // row index
-    {
-        for ( int k = 0; k < M_numElements; ++k )
+        for ( UInt d1 = 0; d1 < 3 ; d1++ ) // row index
         {
-            for ( UInt i = 0; i <  ndof_velocity; i++ )
+            for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
             {
-                M_rows_tmp[k][i] = M_rows_velocity[k][i] + d1 * M_numScalarDofs;
-            }
-            stiffness->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k],
-                                                         ndof_velocity, M_cols_velocity[k],
-                                                         M_vals_supg[k][d1][0],
-                                                         Epetra_FECrsMatrix::ROW_MAJOR);
+                for ( UInt i = 0; i <  ndof_velocity; i++ )
+                {
+                    M_rows_tmp[k][i] = M_rows_velocity[k][i] + d1 * M_numScalarDofs;
+                }
+                addToMatrix ( stiffness, ndof_velocity, M_rows_tmp[k],
+                              ndof_velocity, M_cols_velocity[k],
+                              M_vals_supg[k][d1][0] );
 
-        }
+            }
         
-        for ( int k = 0; k < M_numElements; ++k )
-        {
-            for ( UInt i = 0; i <  ndof_velocity; i++ )
+            for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
             {
-                M_cols_tmp[k][i] = M_cols_velocity[k][i] + M_numScalarDofs;
+                for ( UInt i = 0; i <  ndof_velocity; i++ )
+                {
+                    M_cols_tmp[k][i] = M_cols_velocity[k][i] + M_numScalarDofs;
+                }
+                addToMatrix ( stiffness, ndof_velocity, M_rows_tmp[k],
+                              ndof_velocity, M_cols_tmp[k],
+                              M_vals_supg[k][d1][1] );
             }
-            stiffness->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k],
-                                                         ndof_velocity, M_cols_tmp[k],
-                                                         M_vals_supg[k][d1][1],
-                                                         Epetra_FECrsMatrix::ROW_MAJOR);
-        }
         
-        for ( int k = 0; k < M_numElements; ++k )
-        {
-            for ( UInt i = 0; i <  ndof_velocity; i++ )
+            for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
             {
-                M_cols_tmp[k][i] = M_cols_velocity[k][i] + 2 * M_numScalarDofs;
+                for ( UInt i = 0; i <  ndof_velocity; i++ )
+                {
+                    M_cols_tmp[k][i] = M_cols_velocity[k][i] + 2 * M_numScalarDofs;
+                }
+                addToMatrix ( stiffness, ndof_velocity, M_rows_tmp[k],
+                              ndof_velocity, M_cols_tmp[k],
+                              M_vals_supg[k][d1][2] );
             }
-            stiffness->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k],
-                                                         ndof_velocity, M_cols_tmp[k],
-                                                         M_vals_supg[k][d1][2],
-                                                         Epetra_FECrsMatrix::ROW_MAJOR);
         }
-    }
     
-    for ( UInt d1 = 1; d1 < 3 ; d1++ )
-    {
-        for ( int k = 0; k < M_numElements; ++k )
+        for ( UInt d1 = 1; d1 < 3 ; d1++ )
         {
-            for ( UInt i = 0; i <  ndof_velocity; i++ )
+            for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
             {
-                M_rows_velocity[k][i] += M_numScalarDofs;
-                M_cols_velocity[k][i] += M_numScalarDofs;
-            }
-            mass->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_velocity[k],
-                                                    ndof_velocity, M_cols_velocity[k],
-                                                    M_vals_00[k],
-                                                    Epetra_FECrsMatrix::ROW_MAJOR);
+                for ( UInt i = 0; i <  ndof_velocity; i++ )
+                {
+                    M_rows_velocity[k][i] += M_numScalarDofs;
+                    M_cols_velocity[k][i] += M_numScalarDofs;
+                }
+                addToMatrix ( mass, ndof_velocity, M_rows_velocity[k],
+                              ndof_velocity, M_cols_velocity[k],
+                              M_vals_00[k] );
             
-            b01->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_velocity[k],
-                                                   ndof_pressure, M_cols_pressure[k],
-                                                   M_vals_supg_01[k][d1],
-                                                   Epetra_FECrsMatrix::ROW_MAJOR);
+                addToMatrix ( b01, ndof_velocity, M_rows_velocity[k],
+                              ndof_pressure, M_cols_pressure[k],
+                              M_vals_supg_01[k][d1] );
             
-            b10->matrixPtr()->InsertGlobalValues ( ndof_pressure, M_rows_pressure[k],
-                                                   ndof_velocity, M_cols_velocity[k],
-                                                   M_vals_supg_10[k][d1],
-                                                   Epetra_FECrsMatrix::ROW_MAJOR);
+                addToMatrix ( b10, ndof_pressure, M_rows_pressure[k],
+                              ndof_velocity, M_cols_velocity[k],
+                              M_vals_supg_10[k][d1] );
             
+            }
         }
     }
 }
@@ -1337,102 +1361,108 @@ FastAssemblerNS::assembleConvective( matrixPtr_Type& matrix, const vector_Type&
         w_quad[q] = M_qr->weight(q);
     }
     
-    #pragma omp parallel firstprivate( w_quad, ndof_velocity, NumQuadPoints)
+    // the elements are processed by chunks of M_chunkSize, the element stores are reused for each chunk
+    for ( int chunkBegin = 0; chunkBegin < M_numElements; chunkBegin += M_chunkSize )
     {
-        int i_elem, i_dof, q, d1, d2, i_test, i_trial, e_idof;
-        double integral;
+        const int chunkEnd ( std::min ( chunkBegin + M_chunkSize, M_numElements ) );
+
+        #pragma omp parallel firstprivate( w_quad, ndof_velocity, NumQuadPoints)
+        {
+            int i_elem, i_dof, q, d1, d2, i_test, i_trial, e_idof;
+            double integral;
         
-        double dphi_phys_velocity[ndof_velocity][NumQuadPoints][3];
+            double dphi_phys_velocity[ndof_velocity][NumQuadPoints][3];
         
-        double uhq[3][NumQuadPoints];
+            double uhq[3][NumQuadPoints];
         
-        // ELEMENTI,
-        #pragma omp for
-        for ( i_elem = 0; i_elem <  M_numElements; i_elem++ )
-        {
-            // DOF
-            for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
+            // ELEMENTI,
+            #pragma omp for
+            for ( i_elem = chunkBegin; i_elem < chunkEnd; i_elem++ )
             {
-                // QUAD
-                for (  q = 0; q < NumQuadPoints ; q++ )
+                const int i_chunk ( i_elem - chunkBegin );
+
+                // DOF
+                for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
                 {
-                    // DIM 1
-                    for ( d1 = 0; d1 < 3 ; d1++ )
+                    // QUAD
+                    for (  q = 0; q < NumQuadPoints ; q++ )
                     {
-                        dphi_phys_velocity[i_dof][q][d1] = 0.0;
-                        
-                        // DIM 2
-                        for ( d2 = 0; d2 < 3 ; d2++ )
+                        // DIM 1
+                        for ( d1 = 0; d1 < 3 ; d1++ )
                         {
-                            dphi_phys_velocity[i_dof][q][d1] += M_invJacobian[i_elem][d1][d2] * M_dphi_velocity[i_dof][q][d2];
-                        }
+                            dphi_phys_velocity[i_dof][q][d1] = 0.0;
+                        
+                            // DIM 2
+                            for ( d2 = 0; d2 < 3 ; d2++ )
+                            {
+                                dphi_phys_velocity[i_dof][q][d1] += M_invJacobian[i_elem][d1][d2] * M_dphi_velocity[i_dof][q][d2];
+                            }
+                        }
                     }
                 }
-            }
             
-            // QUAD
-            for (  q = 0; q < NumQuadPoints ; q++ )
-            {
-                for ( d1 = 0; d1 < 3 ; d1++ )
+                // QUAD
+                for (  q = 0; q < NumQuadPoints ; q++ )
                 {
-                    uhq[d1][q] = 0.0;
-                    for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
+                    for ( d1 = 0; d1 < 3 ; d1++ )
                     {
-                        e_idof =  M_elements_velocity[i_elem][i_dof] + d1*M_numScalarDofs  ;
-                        uhq[d1][q] += u_h[e_idof] * M_phi_velocity[i_dof][q];
+                        uhq[d1][q] = 0.0;
+                        for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
+                        {
+                            e_idof =  M_elements_velocity[i_elem][i_dof] + d1*M_numScalarDofs  ;
+                            uhq[d1][q] += u_h[e_idof] * M_phi_velocity[i_dof][q];
+                        }
                     }
                 }
-            }
             
-            // DOF - test
-            for ( i_test = 0; i_test <  ndof_velocity; i_test++ )
-            {
-                M_rows_velocity[i_elem][i_test] = M_elements_velocity[i_elem][i_test];
-                
-                // DOF - trial
-                for ( i_trial = 0; i_trial <  ndof_velocity; i_trial++ )
+                // DOF - test
+                for ( i_test = 0; i_test <  ndof_velocity; i_test++ )
                 {
-                    M_cols_velocity[i_elem][i_trial] = M_elements_velocity[i_elem][i_trial];
+                    M_rows_velocity[i_chunk][i_test] = M_elements_velocity[i_elem][i_test];
+                
+                    // DOF - trial
+                    for ( i_trial = 0; i_trial <  ndof_velocity; i_trial++ )
+                    {
+                        M_cols_velocity[i_chunk][i_trial] = M_elements_velocity[i_elem][i_trial];
                     
-                    M_vals_00[i_elem][i_test][i_trial] = 0.0;
+                        M_vals_00[i_chunk][i_test][i_trial] = 0.0;
                     
-                    integral = 0.0;
-                    // QUAD
-                    for ( q = 0; q < NumQuadPoints ; q++ )
-                    {
-                        // DIM 1
-                        for ( d1 = 0; d1 < 3 ; d1++ )
+                        integral = 0.0;
+                        // QUAD
+                        for ( q = 0; q < NumQuadPoints ; q++ )
                         {
-                            integral += uhq[d1][q] * dphi_phys_velocity[i_trial][q][d1] * M_phi_velocity[i_test][q] * w_quad[q];
+                            // DIM 1
+                            for ( d1 = 0; d1 < 3 ; d1++ )
+                            {
+                                integral += uhq[d1][q] * dphi_phys_velocity[i_trial][q][d1] * M_phi_velocity[i_test][q] * w_quad[q];
+                            }
                         }
+                        M_vals_00[i_chunk][i_test][i_trial] = M_density * integral *  M_detJacobian[i_elem];
                     }
-                    M_vals_00[i_elem][i_test][i_trial] = M_density * integral *  M_detJacobian[i_elem];
                 }
             }
         }
-    }
     
-    for ( int k = 0; k < M_numElements; ++k )
-    {
-        matrix->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_velocity[k],
-                                                  ndof_velocity, M_cols_velocity[k],
-                                                  M_vals_00[k],
-                                                  Epetra_FECrsMatrix::ROW_MAJOR);
-    }
+        for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
+        {
+            addToMatrix ( matrix, ndof_velocity, M_rows_velocity[k],
+                          ndof_velocity, M_cols_velocity[k],
+                          M_vals_00[k] );
+        }
     
-    for ( UInt d1 = 1; d1 < 3 ; d1++ )
-    {
-        for ( int k = 0; k < M_numElements; ++k )
+        for ( UInt d1 = 1; d1 < 3 ; d1++ )
         {
-            for ( UInt i = 0; i <  ndof_velocity; i++ )
+            for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
             {
-                M_rows_tmp[k][i] = M_rows_velocity[k][i] + d1 * M_numScalarDofs;
-                M_cols_tmp[k][i] = M_cols_velocity[k][i] + d1 * M_numScalarDofs;
+                for ( UInt i = 0; i <  ndof_velocity; i++ )
+                {
+                    M_rows_tmp[k][i] = M_rows_velocity[k][i] + d1 * M_numScalarDofs;
+                    M_cols_tmp[k][i] = M_cols_velocity[k][i] + d1 * M_numScalarDofs;
+                }
+                addToMatrix ( matrix, ndof_velocity, M_rows_tmp[k],
+                              ndof_velocity, M_cols_tmp[k],
+                              M_vals_00[k] );
             }
-            matrix->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k],
-                                                      ndof_velocity, M_cols_tmp[k],
-                                                      M_vals_00[k],
-                                                      Epetra_FECrsMatrix::ROW_MAJOR);
         }
     }
 }
@@ -1451,158 +1481,163 @@ FastAssemblerNS::jacobianNS( matrixPtr_Type& matrix, const vector_Type& u_h )
         w_quad[q] = M_qr->weight(q);
     }
     
-    #pragma omp parallel firstprivate( w_quad, ndof_velocity, NumQuadPoints)
+    // the elements are processed by chunks of M_chunkSize, the element stores are reused for each chunk
+    for ( int chunkBegin = 0; chunkBegin < M_numElements; chunkBegin += M_chunkSize )
     {
-        int i_elem, i_dof, q, d1, d2, i_test, i_trial, e_idof;
-        double integral, integral_00, integral_01, integral_02, integral_10, integral_11, integral_12;
-        double integral_20, integral_21, integral_22;
+        const int chunkEnd ( std::min ( chunkBegin + M_chunkSize, M_numElements ) );
+
+        #pragma omp parallel firstprivate( w_quad, ndof_velocity, NumQuadPoints)
+        {
+            int i_elem, i_dof, q, d1, d2, i_test, i_trial, e_idof;
+            double integral, integral_00, integral_01, integral_02, integral_10, integral_11, integral_12;
+            double integral_20, integral_21, integral_22;
         
-        double dphi_phys_velocity[ndof_velocity][NumQuadPoints][3];
+            double dphi_phys_velocity[ndof_velocity][NumQuadPoints][3];
         
-        double duhq[3][3][NumQuadPoints];
+            double duhq[3][3][NumQuadPoints];
         
-        // ELEMENTI,
-        #pragma omp for
-        for ( i_elem = 0; i_elem <  M_numElements; i_elem++ )
-        {
-            
-            // DOF
-            for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
+            // ELEMENTI,
+            #pragma omp for
+            for ( i_elem = chunkBegin; i_elem < chunkEnd; i_elem++ )
             {
-                // QUAD
-                for (  q = 0; q < NumQuadPoints ; q++ )
+                const int i_chunk ( i_elem - chunkBegin );
+
+            
+                // DOF
+                for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
                 {
-                    // DIM 1
-                    for ( d1 = 0; d1 < 3 ; d1++ )
+                    // QUAD
+                    for (  q = 0; q < NumQuadPoints ; q++ )
                     {
-                        dphi_phys_velocity[i_dof][q][d1] = 0.0;
-                        
-                        // DIM 2
-                        for ( d2 = 0; d2 < 3 ; d2++ )
+                        // DIM 1
+                        for ( d1 = 0; d1 < 3 ; d1++ )
                         {
-                            dphi_phys_velocity[i_dof][q][d1] += M_invJacobian[i_elem][d1][d2] * M_dphi_velocity[i_dof][q][d2];
+                            dphi_phys_velocity[i_dof][q][d1] = 0.0;
+                        
+                            // DIM 2
+                            for ( d2 = 0; d2 < 3 ; d2++ )
+                            {
+                                dphi_phys_velocity[i_dof][q][d1] += M_invJacobian[i_elem][d1][d2] * M_dphi_velocity[i_dof][q][d2];
+                            }
                         }
                     }
                 }
-            }
             
-            // QUAD
-            for (  q = 0; q < NumQuadPoints ; q++ )
-            {
-                for ( d1 = 0; d1 < 3 ; d1++ )
+                // QUAD
+                for (  q = 0; q < NumQuadPoints ; q++ )
                 {
-                    for ( d2 = 0; d2 < 3 ; d2++ )
+                    for ( d1 = 0; d1 < 3 ; d1++ )
                     {
-                        duhq[d1][d2][q] = 0.0;
-                        for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
+                        for ( d2 = 0; d2 < 3 ; d2++ )
                         {
-                            e_idof =  M_elements_velocity[i_elem][i_dof] + d1*M_numScalarDofs  ;
-                            duhq[d1][d2][q] += u_h[e_idof] * dphi_phys_velocity[i_dof][q][d2];
+                            duhq[d1][d2][q] = 0.0;
+                            for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
+                            {
+                                e_idof =  M_elements_velocity[i_elem][i_dof] + d1*M_numScalarDofs  ;
+                                duhq[d1][d2][q] += u_h[e_idof] * dphi_phys_velocity[i_dof][q][d2];
+                            }
                         }
                     }
                 }
-            }
             
-            // DOF - test
-            for ( i_test = 0; i_test <  ndof_velocity; i_test++ )
-            {
-                M_rows_velocity[i_elem][i_test] = M_elements_velocity[i_elem][i_test];
-                // DOF - trial
-                for ( i_trial = 0; i_trial <  ndof_velocity; i_trial++ )
+                // DOF - test
+                for ( i_test = 0; i_test <  ndof_velocity; i_test++ )
                 {
-                    M_cols_velocity[i_elem][i_trial] = M_elements_velocity[i_elem][i_trial];
-                    
-                    M_vals_supg[i_elem][0][0][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][0][1][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][0][2][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][1][0][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][1][1][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][1][2][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][2][0][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][2][1][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][2][2][i_test][i_trial] = 0.0;
-                    integral_00 = 0.0;
-                    integral_01 = 0.0;
-                    integral_02 = 0.0;
-                    integral_10 = 0.0;
-                    integral_11 = 0.0;
-                    integral_12 = 0.0;
-                    integral_20 = 0.0;
-                    integral_21 = 0.0;
-                    integral_22 = 0.0;
-                    // QUAD
-                    for ( q = 0; q < NumQuadPoints ; q++ )
+                    M_rows_velocity[i_chunk][i_test] = M_elements_velocity[i_elem][i_test];
+                    // DOF - trial
+                    for ( i_trial = 0; i_trial <  ndof_velocity; i_trial++ )
                     {
-                        integral_00 += M_phi_velocity[i_test][q] * duhq[0][0][q] * M_phi_velocity[i_trial][q] * w_quad[q];
+                        M_cols_velocity[i_chunk][i_trial] = M_elements_velocity[i_elem][i_trial];
+                    
+                        M_vals_supg[i_chunk][0][0][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][0][1][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][0][2][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][1][0][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][1][1][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][1][2][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][2][0][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][2][1][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][2][2][i_test][i_trial] = 0.0;
+                        integral_00 = 0.0;
+                        integral_01 = 0.0;
+                        integral_02 = 0.0;
+                        integral_10 = 0.0;
+                        integral_11 = 0.0;
+                        integral_12 = 0.0;
+                        integral_20 = 0.0;
+                        integral_21 = 0.0;
+                        integral_22 = 0.0;
+                        // QUAD
+                        for ( q = 0; q < NumQuadPoints ; q++ )
+                        {
+                            integral_00 += M_phi_velocity[i_test][q] * duhq[0][0][q] * M_phi_velocity[i_trial][q] * w_quad[q];
                         
-                        integral_01 += M_phi_velocity[i_test][q] * duhq[0][1][q] * M_phi_velocity[i_trial][q] * w_quad[q];
+                            integral_01 += M_phi_velocity[i_test][q] * duhq[0][1][q] * M_phi_velocity[i_trial][q] * w_quad[q];
                         
-                        integral_02 += M_phi_velocity[i_test][q] * duhq[0][2][q] * M_phi_velocity[i_trial][q] * w_quad[q];
+                            integral_02 += M_phi_velocity[i_test][q] * duhq[0][2][q] * M_phi_velocity[i_trial][q] * w_quad[q];
                         
-                        integral_10 += M_phi_velocity[i_test][q] * duhq[1][0][q] * M_phi_velocity[i_trial][q] * w_quad[q];
+                            integral_10 += M_phi_velocity[i_test][q] * duhq[1][0][q] * M_phi_velocity[i_trial][q] * w_quad[q];
                         
-                        integral_11 += M_phi_velocity[i_test][q] * duhq[1][1][q] * M_phi_velocity[i_trial][q] * w_quad[q];
+                            integral_11 += M_phi_velocity[i_test][q] * duhq[1][1][q] * M_phi_velocity[i_trial][q] * w_quad[q];
                         
-                        integral_12 += M_phi_velocity[i_test][q] * duhq[1][2][q] * M_phi_velocity[i_trial][q] * w_quad[q];
+                            integral_12 += M_phi_velocity[i_test][q] * duhq[1][2][q] * M_phi_velocity[i_trial][q] * w_quad[q];
                         
-                        integral_20 += M_phi_velocity[i_test][q] * duhq[2][0][q] * M_phi_velocity[i_trial][q] * w_quad[q];
+                            integral_20 += M_phi_velocity[i_test][q] * duhq[2][0][q] * M_phi_velocity[i_trial][q] * w_quad[q];
                         
-                        integral_21 += M_phi_velocity[i_test][q] * duhq[2][1][q] * M_phi_velocity[i_trial][q] * w_quad[q];
+                            integral_21 += M_phi_velocity[i_test][q] * duhq[2][1][q] * M_phi_velocity[i_trial][q] * w_quad[q];
                         
-                        integral_22 += M_phi_velocity[i_test][q] * duhq[2][2][q] * M_phi_velocity[i_trial][q] * w_quad[q];
+                            integral_22 += M_phi_velocity[i_test][q] * duhq[2][2][q] * M_phi_velocity[i_trial][q] * w_quad[q];
                         
+                        }
+                        M_vals_supg[i_chunk][0][0][i_test][i_trial] = M_density * integral_00 * M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][0][1][i_test][i_trial] = M_density * integral_01 * M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][0][2][i_test][i_trial] = M_density * integral_02 * M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][1][0][i_test][i_trial] = M_density * integral_10 * M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][1][1][i_test][i_trial] = M_density * integral_11 * M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][1][2][i_test][i_trial] = M_density * integral_12 * M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][2][0][i_test][i_trial] = M_density * integral_20 * M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][2][1][i_test][i_trial] = M_density * integral_21 * M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][2][2][i_test][i_trial] = M_density * integral_22 * M_detJacobian[i_elem];
                     }
-                    M_vals_supg[i_elem][0][0][i_test][i_trial] = M_density * integral_00 * M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][0][1][i_test][i_trial] = M_density * integral_01 * M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][0][2][i_test][i_trial] = M_density * integral_02 * M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][1][0][i_test][i_trial] = M_density * integral_10 * M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][1][1][i_test][i_trial] = M_density * integral_11 * M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][1][2][i_test][i_trial] = M_density * integral_12 * M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][2][0][i_test][i_trial] = M_density * integral_20 * M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][2][1][i_test][i_trial] = M_density * integral_21 * M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][2][2][i_test][i_trial] = M_density * integral_22 * M_detJacobian[i_elem];
                 }
             }
         }
-    }
     
-    for ( UInt d1 = 0; d1 < 3 ; d1++ ) // row index
-    {
-        for ( int k = 0; k < M_numElements; ++k )
+        for ( UInt d1 = 0; d1 < 3 ; d1++ ) // row index
         {
-            for ( UInt i = 0; i <  ndof_velocity; i++ )
+            for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
             {
-                M_rows_tmp[k][i] = M_rows_velocity[k][i] + d1 * M_numScalarDofs;
-            }
-            matrix->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k],
-                                                      ndof_velocity, M_cols_velocity[k],
-                                                      M_vals_supg[k][d1][0],
-                                                      Epetra_FECrsMatrix::ROW_MAJOR);
+                for ( UInt i = 0; i <  ndof_velocity; i++ )
+                {
+                    M_rows_tmp[k][i] = M_rows_velocity[k][i] + d1 * M_numScalarDofs;
+                }
+                addToMatrix ( matrix, ndof_velocity, M_rows_tmp[k],
+                              ndof_velocity, M_cols_velocity[k],
+                              M_vals_supg[k][d1][0] );
             
-        }
+            }
         
-        for ( int k = 0; k < M_numElements; ++k )
-        {
-            for ( UInt i = 0; i <  ndof_velocity; i++ )
+            for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
             {
-                M_cols_tmp[k][i] = M_cols_velocity[k][i] + M_numScalarDofs;
+                for ( UInt i = 0; i <  ndof_velocity; i++ )
+                {
+                    M_cols_tmp[k][i] = M_cols_velocity[k][i] + M_numScalarDofs;
+                }
+                addToMatrix ( matrix, ndof_velocity, M_rows_tmp[k],
+                              ndof_velocity, M_cols_tmp[k],
+                              M_vals_supg[k][d1][1] );
             }
-            matrix->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k],
-                                                      ndof_velocity, M_cols_tmp[k],
-                                                      M_vals_supg[k][d1][1],
-                                                      Epetra_FECrsMatrix::ROW_MAJOR);
-        }
         
-        for ( int k = 0; k < M_numElements; ++k )
-        {
-            for ( UInt i = 0; i <  ndof_velocity; i++ )
+            for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
             {
-                M_cols_tmp[k][i] = M_cols_velocity[k][i] + 2 * M_numScalarDofs;
+                for ( UInt i = 0; i <  ndof_velocity; i++ )
+                {
+                    M_cols_tmp[k][i] = M_cols_velocity[k][i] + 2 * M_numScalarDofs;
+                }
+                addToMatrix ( matrix, ndof_velocity, M_rows_tmp[k],
+                              ndof_velocity, M_cols_tmp[k],
+                              M_vals_supg[k][d1][2] );
             }
-            matrix->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k],
-                                                      ndof_velocity, M_cols_tmp[k],
-                                                      M_vals_supg[k][d1][2],
-                                                      Epetra_FECrsMatrix::ROW_MAJOR);
         }
     }
 }
@@ -1629,532 +1664,534 @@ FastAssemblerNS::supg_FI_FSI_terms ( matrixPtr_Type& block00,
         w_quad[q] = M_qr->weight(q);
     }
     
-#pragma omp parallel firstprivate( w_quad, ndof_velocity, ndof_pressure, NumQuadPoints)
+    // the elements are processed by chunks of M_chunkSize, the element stores are reused for each chunk
+    for ( int chunkBegin = 0; chunkBegin < M_numElements; chunkBegin += M_chunkSize )
     {
-        int i_elem, i_dof, q, d1, d2, i_test, i_trial, e_idof, dim_mat, iCoor, jCoor, k1, k2;
-        double integral, integral_test, integral_trial, integral_partial, integral_lapl, partialSum;
+        const int chunkEnd ( std::min ( chunkBegin + M_chunkSize, M_numElements ) );
+
+    #pragma omp parallel firstprivate( w_quad, ndof_velocity, ndof_pressure, NumQuadPoints)
+        {
+            int i_elem, i_dof, q, d1, d2, i_test, i_trial, e_idof, dim_mat, iCoor, jCoor, k1, k2;
+            double integral, integral_test, integral_trial, integral_partial, integral_lapl, partialSum;
         
-        double dphi_phys_velocity[ndof_velocity][NumQuadPoints][3];
-        double dphi_phys_pressure[ndof_pressure][NumQuadPoints][3];
-        double d2phi_phys_velocity[ndof_velocity][NumQuadPoints][3][3];
-        double u_km1_q[3][NumQuadPoints];
-        double beta_km1_q[3][NumQuadPoints];
-        double u_bdf_q[3][NumQuadPoints];
-        double p_km1_q[NumQuadPoints];
-        double i_00, i_01, i_02, i_10, i_11, i_12, i_20, i_21, i_22;
-        double d_ukm1_q[3][3][NumQuadPoints];
-        double d_pkm1_q[3][NumQuadPoints];
+            double dphi_phys_velocity[ndof_velocity][NumQuadPoints][3];
+            double dphi_phys_pressure[ndof_pressure][NumQuadPoints][3];
+            double d2phi_phys_velocity[ndof_velocity][NumQuadPoints][3][3];
+            double u_km1_q[3][NumQuadPoints];
+            double beta_km1_q[3][NumQuadPoints];
+            double u_bdf_q[3][NumQuadPoints];
+            double p_km1_q[NumQuadPoints];
+            double i_00, i_01, i_02, i_10, i_11, i_12, i_20, i_21, i_22;
+            double d_ukm1_q[3][3][NumQuadPoints];
+            double d_pkm1_q[3][NumQuadPoints];
         
-        // ELEMENTI,
-#pragma omp for
-        for ( i_elem = 0; i_elem <  M_numElements; i_elem++ )
-        {
-            // DOF
-            for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
+            // ELEMENTI,
+    #pragma omp for
+            for ( i_elem = chunkBegin; i_elem < chunkEnd; i_elem++ )
             {
-                // QUAD
-                for (  q = 0; q < NumQuadPoints ; q++ )
+                const int i_chunk ( i_elem - chunkBegin );
+
+                // DOF
+                for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
                 {
-                    // DIM 1
-                    for ( d1 = 0; d1 < 3 ; d1++ )
+                    // QUAD
+                    for (  q = 0; q < NumQuadPoints ; q++ )
                     {
-                        dphi_phys_velocity[i_dof][q][d1] = 0.0;
+                        // DIM 1
+                        for ( d1 = 0; d1 < 3 ; d1++ )
+                        {
+                            dphi_phys_velocity[i_dof][q][d1] = 0.0;
                         
-                        // DIM 2
-                        for ( d2 = 0; d2 < 3 ; d2++ )
+                            // DIM 2
+                            for ( d2 = 0; d2 < 3 ; d2++ )
+                            {
+                                dphi_phys_velocity[i_dof][q][d1] += M_invJacobian[i_elem][d1][d2] * M_dphi_velocity[i_dof][q][d2];
+                            }
+                        }
+                    }
+                }
+            
+                // DOF -- nota che può essere ottimizzato rishapando il gradiente fisico. Prima q poi d1 poi d2 e poi i_dof
+                for ( i_dof = 0; i_dof <  ndof_pressure; i_dof++ )
+                {
+                    // QUAD
+                    for (  q = 0; q < NumQuadPoints ; q++ )
+                    {
+                        // DIM 1
+                        for ( d1 = 0; d1 < 3 ; d1++ )
                         {
-                            dphi_phys_velocity[i_dof][q][d1] += M_invJacobian[i_elem][d1][d2] * M_dphi_velocity[i_dof][q][d2];
+                            dphi_phys_pressure[i_dof][q][d1] = 0.0;
+                        
+                            // DIM 2
+                            for ( d2 = 0; d2 < 3 ; d2++ )
+                            {
+                                dphi_phys_pressure[i_dof][q][d1] += M_invJacobian[i_elem][d1][d2] * M_dphi_pressure[i_dof][q][d2];
+                            }
                         }
                     }
                 }
-            }
             
-            // DOF -- nota che può essere ottimizzato rishapando il gradiente fisico. Prima q poi d1 poi d2 e poi i_dof
-            for ( i_dof = 0; i_dof <  ndof_pressure; i_dof++ )
-            {
                 // QUAD
                 for (  q = 0; q < NumQuadPoints ; q++ )
                 {
-                    // DIM 1
                     for ( d1 = 0; d1 < 3 ; d1++ )
                     {
-                        dphi_phys_pressure[i_dof][q][d1] = 0.0;
-                        
-                        // DIM 2
-                        for ( d2 = 0; d2 < 3 ; d2++ )
+                        beta_km1_q[d1][q] = 0.0;
+                        u_km1_q[d1][q] = 0.0;
+                        u_bdf_q[d1][q] = 0.0;
+                        for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
                         {
-                            dphi_phys_pressure[i_dof][q][d1] += M_invJacobian[i_elem][d1][d2] * M_dphi_pressure[i_dof][q][d2];
+                            e_idof =  M_elements_velocity[i_elem][i_dof] + d1*M_numScalarDofs;
+                            beta_km1_q[d1][q] += beta_km1[e_idof] * M_phi_velocity[i_dof][q];
+                            u_km1_q[d1][q] += u_km1[e_idof] * M_phi_velocity[i_dof][q];
+                            u_bdf_q[d1][q] += u_bdf[e_idof] * M_phi_velocity[i_dof][q];
                         }
                     }
-                }
-            }
-            
-            // QUAD
-            for (  q = 0; q < NumQuadPoints ; q++ )
-            {
-                for ( d1 = 0; d1 < 3 ; d1++ )
-                {
-                    beta_km1_q[d1][q] = 0.0;
-                    u_km1_q[d1][q] = 0.0;
-                    u_bdf_q[d1][q] = 0.0;
-                    for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
+                
+                    p_km1_q[q] = 0.0;
+                    for ( i_dof = 0; i_dof < ndof_pressure; i_dof++ )
                     {
-                        e_idof =  M_elements_velocity[i_elem][i_dof] + d1*M_numScalarDofs;
-                        beta_km1_q[d1][q] += beta_km1[e_idof] * M_phi_velocity[i_dof][q];
-                        u_km1_q[d1][q] += u_km1[e_idof] * M_phi_velocity[i_dof][q];
-                        u_bdf_q[d1][q] += u_bdf[e_idof] * M_phi_velocity[i_dof][q];
+                        e_idof =  M_elements_pressure[i_elem][i_dof];
+                        p_km1_q[q] += p_km1[e_idof] * M_phi_pressure[i_dof][q];
                     }
-                }
                 
-                p_km1_q[q] = 0.0;
-                for ( i_dof = 0; i_dof < ndof_pressure; i_dof++ )
-                {
-                    e_idof =  M_elements_pressure[i_elem][i_dof];
-                    p_km1_q[q] += p_km1[e_idof] * M_phi_pressure[i_dof][q];
                 }
-                
-            }
             
-            // QUAD
-            for (  q = 0; q < NumQuadPoints ; q++ )
-            {
-                for ( d1 = 0; d1 < 3 ; d1++ )
+                // QUAD
+                for (  q = 0; q < NumQuadPoints ; q++ )
                 {
-                    for ( d2 = 0; d2 < 3 ; d2++ )
+                    for ( d1 = 0; d1 < 3 ; d1++ )
                     {
-                        d_ukm1_q[d1][d2][q] = 0.0;
-                        for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
+                        for ( d2 = 0; d2 < 3 ; d2++ )
                         {
-                            e_idof =  M_elements_velocity[i_elem][i_dof] + d1*M_numScalarDofs  ;
-                            d_ukm1_q[d1][d2][q] += u_km1[e_idof] * dphi_phys_velocity[i_dof][q][d2];
+                            d_ukm1_q[d1][d2][q] = 0.0;
+                            for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
+                            {
+                                e_idof =  M_elements_velocity[i_elem][i_dof] + d1*M_numScalarDofs  ;
+                                d_ukm1_q[d1][d2][q] += u_km1[e_idof] * dphi_phys_velocity[i_dof][q][d2];
+                            }
                         }
                     }
                 }
-            }
             
-            // QUAD
-            for (  q = 0; q < NumQuadPoints ; q++ )
-            {
-                for ( d1 = 0; d1 < 3 ; d1++ )
+                // QUAD
+                for (  q = 0; q < NumQuadPoints ; q++ )
                 {
-                    d_pkm1_q[d1][q] = 0.0;
-                    for ( i_dof = 0; i_dof <  ndof_pressure; i_dof++ )
+                    for ( d1 = 0; d1 < 3 ; d1++ )
                     {
-                        e_idof =  M_elements_pressure[i_elem][i_dof];
-                        d_pkm1_q[d1][q] += p_km1[e_idof] * dphi_phys_pressure[i_dof][q][d1];
+                        d_pkm1_q[d1][q] = 0.0;
+                        for ( i_dof = 0; i_dof <  ndof_pressure; i_dof++ )
+                        {
+                            e_idof =  M_elements_pressure[i_elem][i_dof];
+                            d_pkm1_q[d1][q] += p_km1[e_idof] * dphi_phys_pressure[i_dof][q][d1];
+                        }
                     }
                 }
-            }
             
-            // STABILIZZAZIONE - coefficienti Tau_M e Tau_C
-            for (  q = 0; q < NumQuadPoints ; q++ )
-            {
-                M_Tau_M[i_elem][q] = 1.0/std::sqrt(
-                                                   M_density*M_density*M_orderBDF*M_orderBDF/(M_timestep*M_timestep) // TAU_M_DEN_DT
-                                                   +M_density*M_density*( beta_km1_q[0][q]*( M_G[i_elem][0][0]* beta_km1_q[0][q] +  M_G[i_elem][0][1] * beta_km1_q[1][q] + M_G[i_elem][0][2] * beta_km1_q[2][q] ) +
-                                                                         beta_km1_q[1][q]*( M_G[i_elem][1][0]* beta_km1_q[0][q] +  M_G[i_elem][1][1] * beta_km1_q[1][q] + M_G[i_elem][1][2] * beta_km1_q[2][q] ) +
-                                                                         beta_km1_q[2][q]*( M_G[i_elem][2][0]* beta_km1_q[0][q] +  M_G[i_elem][2][1] * beta_km1_q[1][q] + M_G[i_elem][2][2] * beta_km1_q[2][q]   )
-                                                                         ) 	// TAU_M_DEN_VEL
-                                                   +M_C_I*M_viscosity*M_viscosity*(
-                                                                                   M_G[i_elem][0][0]*M_G[i_elem][0][0] + M_G[i_elem][0][1]*M_G[i_elem][0][1] + M_G[i_elem][0][2]*M_G[i_elem][0][2] +
-                                                                                   M_G[i_elem][1][0]*M_G[i_elem][1][0] + M_G[i_elem][1][1]*M_G[i_elem][1][1] + M_G[i_elem][1][2]*M_G[i_elem][1][2] +
-                                                                                   M_G[i_elem][2][0]*M_G[i_elem][2][0] + M_G[i_elem][2][1]*M_G[i_elem][2][1] + M_G[i_elem][2][2]*M_G[i_elem][2][2]
-                                                                                   )  // TAU_M_DEN_VISC
-                                                   );
+                // STABILIZZAZIONE - coefficienti Tau_M e Tau_C
+                for (  q = 0; q < NumQuadPoints ; q++ )
+                {
+                    M_Tau_M[i_elem][q] = 1.0/std::sqrt(
+                                                       M_density*M_density*M_orderBDF*M_orderBDF/(M_timestep*M_timestep) // TAU_M_DEN_DT
+                                                       +M_density*M_density*( beta_km1_q[0][q]*( M_G[i_elem][0][0]* beta_km1_q[0][q] +  M_G[i_elem][0][1] * beta_km1_q[1][q] + M_G[i_elem][0][2] * beta_km1_q[2][q] ) +
+                                                                             beta_km1_q[1][q]*( M_G[i_elem][1][0]* beta_km1_q[0][q] +  M_G[i_elem][1][1] * beta_km1_q[1][q] + M_G[i_elem][1][2] * beta_km1_q[2][q] ) +
+                                                                             beta_km1_q[2][q]*( M_G[i_elem][2][0]* beta_km1_q[0][q] +  M_G[i_elem][2][1] * beta_km1_q[1][q] + M_G[i_elem][2][2] * beta_km1_q[2][q]   )
+                                                                             ) 	// TAU_M_DEN_VEL
+                                                       +M_C_I*M_viscosity*M_viscosity*(
+                                                                                       M_G[i_elem][0][0]*M_G[i_elem][0][0] + M_G[i_elem][0][1]*M_G[i_elem][0][1] + M_G[i_elem][0][2]*M_G[i_elem][0][2] +
+                                                                                       M_G[i_elem][1][0]*M_G[i_elem][1][0] + M_G[i_elem][1][1]*M_G[i_elem][1][1] + M_G[i_elem][1][2]*M_G[i_elem][1][2] +
+                                                                                       M_G[i_elem][2][0]*M_G[i_elem][2][0] + M_G[i_elem][2][1]*M_G[i_elem][2][1] + M_G[i_elem][2][2]*M_G[i_elem][2][2]
+                                                                                       )  // TAU_M_DEN_VISC
+                                                       );
                 
-                M_Tau_C[i_elem][q] = 1.0/( M_g[i_elem][0]*M_Tau_M[i_elem][q]*M_g[i_elem][0] +
-                                          M_g[i_elem][1]*M_Tau_M[i_elem][q]*M_g[i_elem][1] +
-                                          M_g[i_elem][2]*M_Tau_M[i_elem][q]*M_g[i_elem][2]
-                                          );
+                    M_Tau_C[i_elem][q] = 1.0/( M_g[i_elem][0]*M_Tau_M[i_elem][q]*M_g[i_elem][0] +
+                                              M_g[i_elem][1]*M_Tau_M[i_elem][q]*M_g[i_elem][1] +
+                                              M_g[i_elem][2]*M_Tau_M[i_elem][q]*M_g[i_elem][2]
+                                              );
                 
-            }
+                }
             
-            // DOF - test
-            for ( i_test = 0; i_test <  ndof_velocity; i_test++ )
-            {
-                M_rows_velocity[i_elem][i_test] = M_elements_velocity[i_elem][i_test];
-                
-                // DOF - trial
-                for ( i_trial = 0; i_trial <  ndof_velocity; i_trial++ )
+                // DOF - test
+                for ( i_test = 0; i_test <  ndof_velocity; i_test++ )
                 {
-                    M_cols_velocity[i_elem][i_trial] = M_elements_velocity[i_elem][i_trial];
+                    M_rows_velocity[i_chunk][i_test] = M_elements_velocity[i_elem][i_test];
+                
+                    // DOF - trial
+                    for ( i_trial = 0; i_trial <  ndof_velocity; i_trial++ )
+                    {
+                        M_cols_velocity[i_chunk][i_trial] = M_elements_velocity[i_elem][i_trial];
                     
-                    integral = 0.0;
-                    i_00 = 0.0; i_01 = 0.0; i_02 = 0.0; i_10 = 0.0; i_11 = 0.0; i_12 = 0.0; i_20 = 0.0; i_21 = 0.0; i_22 = 0.0;
+                        integral = 0.0;
+                        i_00 = 0.0; i_01 = 0.0; i_02 = 0.0; i_10 = 0.0; i_11 = 0.0; i_12 = 0.0; i_20 = 0.0; i_21 = 0.0; i_22 = 0.0;
                     
-                    M_vals_supg[i_elem][0][0][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][0][1][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][0][2][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][1][0][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][1][1][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][1][2][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][2][0][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][2][1][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][2][2][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][0][0][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][0][1][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][0][2][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][1][0][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][1][1][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][1][2][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][2][0][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][2][1][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][2][2][i_test][i_trial] = 0.0;
                     
-                    // QUAD
-                    for ( q = 0; q < NumQuadPoints ; q++ )
-                    {
-                        integral_test = 0.0;
-                        integral_trial = 0.0;
-                        integral_partial = 0.0;
-                        
-                        // DIM 1
-                        for ( d1 = 0; d1 < 3 ; d1++ )
+                        // QUAD
+                        for ( q = 0; q < NumQuadPoints ; q++ )
                         {
-                            integral_test += beta_km1_q[d1][q] * dphi_phys_velocity[i_test][q][d1];
-                        }
+                            integral_test = 0.0;
+                            integral_trial = 0.0;
+                            integral_partial = 0.0;
+                        
+                            // DIM 1
+                            for ( d1 = 0; d1 < 3 ; d1++ )
+                            {
+                                integral_test += beta_km1_q[d1][q] * dphi_phys_velocity[i_test][q][d1];
+                            }
                         
-    integral_partial = ( dphi_phys_velocity[i_test][q][0] * beta_km1_q[0][q] +
-                          dphi_phys_velocity[i_test][q][1] * beta_km1_q[1][q] +
-                          dphi_phys_velocity[i_test][q][2] * beta_km1_q[2][q]
-                        ) *
-                        ( dphi_phys_velocity[i_trial][q][0] * beta_km1_q[0][q] +
-                          dphi_phys_velocity[i_trial][q][1] * beta_km1_q[1][q] +
-                          dphi_phys_velocity[i_trial][q][2] * beta_km1_q[2][q]
-                         );
+        integral_partial = ( dphi_phys_velocity[i_test][q][0] * beta_km1_q[0][q] +
+                              dphi_phys_velocity[i_test][q][1] * beta_km1_q[1][q] +
+                              dphi_phys_velocity[i_test][q][2] * beta_km1_q[2][q]
+                            ) *
+                            ( dphi_phys_velocity[i_trial][q][0] * beta_km1_q[0][q] +
+                              dphi_phys_velocity[i_trial][q][1] * beta_km1_q[1][q] +
+                              dphi_phys_velocity[i_trial][q][2] * beta_km1_q[2][q]
+                             );
                         
-    i_00 += ( M_Tau_M[i_elem][q] * ( M_density * dphi_phys_velocity[i_test][q][0] * M_phi_velocity[i_trial][q] *
-                                   ( M_density * M_alpha / M_timestep * u_km1_q[0][q] +
-                                     d_pkm1_q[0][q]
-                                   )
-                                  -dphi_phys_velocity[i_test][q][0] * M_phi_velocity[i_trial][q] * u_bdf_q[0][q]
-                                  +M_density * M_density *
-                                  ( dphi_phys_velocity[i_test][q][0] * beta_km1_q[0][q] * d_ukm1_q[0][0][q] * M_phi_velocity[i_trial][q]
-                                   +dphi_phys_velocity[i_test][q][1] * beta_km1_q[1][q] * d_ukm1_q[0][0][q] * M_phi_velocity[i_trial][q]
-                                   +dphi_phys_velocity[i_test][q][2] * beta_km1_q[2][q] * d_ukm1_q[0][0][q] * M_phi_velocity[i_trial][q]
-                                  )
-                                  + M_density * M_density * dphi_phys_velocity[i_test][q][0] * M_phi_velocity[i_trial][q] *
-                                    ( d_ukm1_q[0][0][q] * beta_km1_q[0][q] + d_ukm1_q[0][1][q] * beta_km1_q[1][q] + d_ukm1_q[0][2][q] * beta_km1_q[2][q] )
-                                 )
-              +M_Tau_C[i_elem][q] * ( dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][0] )
-             ) * w_quad[q];
+        i_00 += ( M_Tau_M[i_elem][q] * ( M_density * dphi_phys_velocity[i_test][q][0] * M_phi_velocity[i_trial][q] *
+                                       ( M_density * M_alpha / M_timestep * u_km1_q[0][q] +
+                                         d_pkm1_q[0][q]
+                                       )
+                                      -dphi_phys_velocity[i_test][q][0] * M_phi_velocity[i_trial][q] * u_bdf_q[0][q]
+                                      +M_density * M_density *
+                                      ( dphi_phys_velocity[i_test][q][0] * beta_km1_q[0][q] * d_ukm1_q[0][0][q] * M_phi_velocity[i_trial][q]
+                                       +dphi_phys_velocity[i_test][q][1] * beta_km1_q[1][q] * d_ukm1_q[0][0][q] * M_phi_velocity[i_trial][q]
+                                       +dphi_phys_velocity[i_test][q][2] * beta_km1_q[2][q] * d_ukm1_q[0][0][q] * M_phi_velocity[i_trial][q]
+                                      )
+                                      + M_density * M_density * dphi_phys_velocity[i_test][q][0] * M_phi_velocity[i_trial][q] *
+                                        ( d_ukm1_q[0][0][q] * beta_km1_q[0][q] + d_ukm1_q[0][1][q] * beta_km1_q[1][q] + d_ukm1_q[0][2][q] * beta_km1_q[2][q] )
+                                     )
+                  +M_Tau_C[i_elem][q] * ( dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][0] )
+                 ) * w_quad[q];
     
-    i_01 += ( M_Tau_M[i_elem][q] * ( M_density * dphi_phys_velocity[i_test][q][1] * M_phi_velocity[i_trial][q] *
-                                   ( M_density * M_alpha / M_timestep * u_km1_q[0][q] +
-                                     d_pkm1_q[0][q]
-                                   )
-                                  -dphi_phys_velocity[i_test][q][1] * M_phi_velocity[i_trial][q] * u_bdf_q[0][q]
-                                  +M_density * M_density *
-                                  ( dphi_phys_velocity[i_test][q][0] * beta_km1_q[0][q] * d_ukm1_q[0][1][q] * M_phi_velocity[i_trial][q]
-                                   +dphi_phys_velocity[i_test][q][1] * beta_km1_q[1][q] * d_ukm1_q[0][1][q] * M_phi_velocity[i_trial][q]
-                                   +dphi_phys_velocity[i_test][q][2] * beta_km1_q[2][q] * d_ukm1_q[0][1][q] * M_phi_velocity[i_trial][q]
-                                  )
-                                  + M_density * M_density * dphi_phys_velocity[i_test][q][1] * M_phi_velocity[i_trial][q] *
-                                    ( d_ukm1_q[0][0][q] * beta_km1_q[0][q] + d_ukm1_q[0][1][q] * beta_km1_q[1][q] + d_ukm1_q[0][2][q] * beta_km1_q[2][q] )
-                                 )
-             +M_Tau_C[i_elem][q] * ( dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][1] )
-                        ) * w_quad[q];
+        i_01 += ( M_Tau_M[i_elem][q] * ( M_density * dphi_phys_velocity[i_test][q][1] * M_phi_velocity[i_trial][q] *
+                                       ( M_density * M_alpha / M_timestep * u_km1_q[0][q] +
+                                         d_pkm1_q[0][q]
+                                       )
+                                      -dphi_phys_velocity[i_test][q][1] * M_phi_velocity[i_trial][q] * u_bdf_q[0][q]
+                                      +M_density * M_density *
+                                      ( dphi_phys_velocity[i_test][q][0] * beta_km1_q[0][q] * d_ukm1_q[0][1][q] * M_phi_velocity[i_trial][q]
+                                       +dphi_phys_velocity[i_test][q][1] * beta_km1_q[1][q] * d_ukm1_q[0][1][q] * M_phi_velocity[i_trial][q]
+                                       +dphi_phys_velocity[i_test][q][2] * beta_km1_q[2][q] * d_ukm1_q[0][1][q] * M_phi_velocity[i_trial][q]
+                                      )
+                                      + M_density * M_density * dphi_phys_velocity[i_test][q][1] * M_phi_velocity[i_trial][q] *
+                                        ( d_ukm1_q[0][0][q] * beta_km1_q[0][q] + d_ukm1_q[0][1][q] * beta_km1_q[1][q] + d_ukm1_q[0][2][q] * beta_km1_q[2][q] )
+                                     )
+                 +M_Tau_C[i_elem][q] * ( dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][1] )
+                            ) * w_quad[q];
     
-    i_02 += ( M_Tau_M[i_elem][q] * ( M_density * dphi_phys_velocity[i_test][q][2] * M_phi_velocity[i_trial][q] *
-                                   ( M_density * M_alpha / M_timestep * u_km1_q[0][q] +
-                                     d_pkm1_q[0][q]
-                                   )
-                                  -dphi_phys_velocity[i_test][q][2] * M_phi_velocity[i_trial][q] * u_bdf_q[0][q]
-                                  +M_density * M_density *
-                                  ( dphi_phys_velocity[i_test][q][0] * beta_km1_q[0][q] * d_ukm1_q[0][2][q] * M_phi_velocity[i_trial][q]
-                                   +dphi_phys_velocity[i_test][q][1] * beta_km1_q[1][q] * d_ukm1_q[0][2][q] * M_phi_velocity[i_trial][q]
-                                   +dphi_phys_velocity[i_test][q][2] * beta_km1_q[2][q] * d_ukm1_q[0][2][q] * M_phi_velocity[i_trial][q]
-                                  )
-                                  + M_density * M_density * dphi_phys_velocity[i_test][q][2] * M_phi_velocity[i_trial][q] *
-                                    ( d_ukm1_q[0][0][q] * beta_km1_q[0][q] + d_ukm1_q[0][1][q] * beta_km1_q[1][q] + d_ukm1_q[0][2][q] * beta_km1_q[2][q] )
-                                 )
-            +M_Tau_C[i_elem][q] * ( dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][2] )
-                        ) * w_quad[q];
+        i_02 += ( M_Tau_M[i_elem][q] * ( M_density * dphi_phys_velocity[i_test][q][2] * M_phi_velocity[i_trial][q] *
+                                       ( M_density * M_alpha / M_timestep * u_km1_q[0][q] +
+                                         d_pkm1_q[0][q]
+                                       )
+                                      -dphi_phys_velocity[i_test][q][2] * M_phi_velocity[i_trial][q] * u_bdf_q[0][q]
+                                      +M_density * M_density *
+                                      ( dphi_phys_velocity[i_test][q][0] * beta_km1_q[0][q] * d_ukm1_q[0][2][q] * M_phi_velocity[i_trial][q]
+                                       +dphi_phys_velocity[i_test][q][1] * beta_km1_q[1][q] * d_ukm1_q[0][2][q] * M_phi_velocity[i_trial][q]
+                                       +dphi_phys_velocity[i_test][q][2] * beta_km1_q[2][q] * d_ukm1_q[0][2][q] * M_phi_velocity[i_trial][q]
+                                      )
+                                      + M_density * M_density * dphi_phys_velocity[i_test][q][2] * M_phi_velocity[i_trial][q] *
+                                        ( d_ukm1_q[0][0][q] * beta_km1_q[0][q] + d_ukm1_q[0][1][q] * beta_km1_q[1][q] + d_ukm1_q[0][2][q] * beta_km1_q[2][q] )
+                                     )
+                +M_Tau_C[i_elem][q] * ( dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][2] )
+                            ) * w_quad[q];
     
-    i_10 += ( M_Tau_M[i_elem][q] * ( M_density * dphi_phys_velocity[i_test][q][0] * M_phi_velocity[i_trial][q] *
-                                   ( M_density * M_alpha / M_timestep * u_km1_q[1][q] +
-                                     d_pkm1_q[1][q]
-                                   )
-                                  -dphi_phys_velocity[i_test][q][0] * M_phi_velocity[i_trial][q] * u_bdf_q[1][q]
-                                  +M_density * M_density *
-                                  ( dphi_phys_velocity[i_test][q][0] * beta_km1_q[0][q] * d_ukm1_q[1][0][q] * M_phi_velocity[i_trial][q]
-                                   +dphi_phys_velocity[i_test][q][1] * beta_km1_q[1][q] * d_ukm1_q[1][0][q] * M_phi_velocity[i_trial][q]
-                                   +dphi_phys_velocity[i_test][q][2] * beta_km1_q[2][q] * d_ukm1_q[1][0][q] * M_phi_velocity[i_trial][q]
-                                  )
-                                  + M_density * M_density * dphi_phys_velocity[i_test][q][0] * M_phi_velocity[i_trial][q] *
-                                    ( d_ukm1_q[1][0][q] * beta_km1_q[0][q] + d_ukm1_q[1][1][q] * beta_km1_q[1][q] + d_ukm1_q[1][2][q] * beta_km1_q[2][q] )
-                                 )
-            +M_Tau_C[i_elem][q] * ( dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][0] )
-                        ) * w_quad[q];
+        i_10 += ( M_Tau_M[i_elem][q] * ( M_density * dphi_phys_velocity[i_test][q][0] * M_phi_velocity[i_trial][q] *
+                                       ( M_density * M_alpha / M_timestep * u_km1_q[1][q] +
+                                         d_pkm1_q[1][q]
+                                       )
+                                      -dphi_phys_velocity[i_test][q][0] * M_phi_velocity[i_trial][q] * u_bdf_q[1][q]
+                                      +M_density * M_density *
+                                      ( dphi_phys_velocity[i_test][q][0] * beta_km1_q[0][q] * d_ukm1_q[1][0][q] * M_phi_velocity[i_trial][q]
+                                       +dphi_phys_velocity[i_test][q][1] * beta_km1_q[1][q] * d_ukm1_q[1][0][q] * M_phi_velocity[i_trial][q]
+                                       +dphi_phys_velocity[i_test][q][2] * beta_km1_q[2][q] * d_ukm1_q[1][0][q] * M_phi_velocity[i_trial][q]
+                                      )
+                                      + M_density * M_density * dphi_phys_velocity[i_test][q][0] * M_phi_velocity[i_trial][q] *
+                                        ( d_ukm1_q[1][0][q] * beta_km1_q[0][q] + d_ukm1_q[1][1][q] * beta_km1_q[1][q] + d_ukm1_q[1][2][q] * beta_km1_q[2][q] )
+                                     )
+                +M_Tau_C[i_elem][q] * ( dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][0] )
+                            ) * w_quad[q];
     
-    i_11 += ( M_Tau_M[i_elem][q] * ( M_density * dphi_phys_velocity[i_test][q][1] * M_phi_velocity[i_trial][q] *
-                                   ( M_density * M_alpha / M_timestep * u_km1_q[1][q] +
-                                     d_pkm1_q[1][q]
-                                   )
-                                  -dphi_phys_velocity[i_test][q][1] * M_phi_velocity[i_trial][q] * u_bdf_q[1][q]
-                                  +M_density * M_density *
-                                  ( dphi_phys_velocity[i_test][q][0] * beta_km1_q[0][q] * d_ukm1_q[1][1][q] * M_phi_velocity[i_trial][q]
-                                   +dphi_phys_velocity[i_test][q][1] * beta_km1_q[1][q] * d_ukm1_q[1][1][q] * M_phi_velocity[i_trial][q]
-                                   +dphi_phys_velocity[i_test][q][2] * beta_km1_q[2][q] * d_ukm1_q[1][1][q] * M_phi_velocity[i_trial][q]
-                                  )
-                                  + M_density * M_density * dphi_phys_velocity[i_test][q][1] * M_phi_velocity[i_trial][q] *
-                                   ( d_ukm1_q[1][0][q] * beta_km1_q[0][q] + d_ukm1_q[1][1][q] * beta_km1_q[1][q] + d_ukm1_q[1][2][q] * beta_km1_q[2][q] )
-                                 )
-            +M_Tau_C[i_elem][q] * ( dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][1] )
-                        ) * w_quad[q];
+        i_11 += ( M_Tau_M[i_elem][q] * ( M_density * dphi_phys_velocity[i_test][q][1] * M_phi_velocity[i_trial][q] *
+                                       ( M_density * M_alpha / M_timestep * u_km1_q[1][q] +
+                                         d_pkm1_q[1][q]
+                                       )
+                                      -dphi_phys_velocity[i_test][q][1] * M_phi_velocity[i_trial][q] * u_bdf_q[1][q]
+                                      +M_density * M_density *
+                                      ( dphi_phys_velocity[i_test][q][0] * beta_km1_q[0][q] * d_ukm1_q[1][1][q] * M_phi_velocity[i_trial][q]
+                                       +dphi_phys_velocity[i_test][q][1] * beta_km1_q[1][q] * d_ukm1_q[1][1][q] * M_phi_velocity[i_trial][q]
+                                       +dphi_phys_velocity[i_test][q][2] * beta_km1_q[2][q] * d_ukm1_q[1][1][q] * M_phi_velocity[i_trial][q]
+                                      )
+                                      + M_density * M_density * dphi_phys_velocity[i_test][q][1] * M_phi_velocity[i_trial][q] *
+                                       ( d_ukm1_q[1][0][q] * beta_km1_q[0][q] + d_ukm1_q[1][1][q] * beta_km1_q[1][q] + d_ukm1_q[1][2][q] * beta_km1_q[2][q] )
+                                     )
+                +M_Tau_C[i_elem][q] * ( dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][1] )
+                            ) * w_quad[q];
     
-    i_12 += ( M_Tau_M[i_elem][q] * ( M_density * dphi_phys_velocity[i_test][q][2] * M_phi_velocity[i_trial][q] *
-                                   ( M_density * M_alpha / M_timestep * u_km1_q[1][q] +
-                                     d_pkm1_q[1][q]
-                                   )
-                                  -dphi_phys_velocity[i_test][q][2] * M_phi_velocity[i_trial][q] * u_bdf_q[1][q]
-                                  +M_density * M_density *
-                                  ( dphi_phys_velocity[i_test][q][0] * beta_km1_q[0][q] * d_ukm1_q[1][2][q] * M_phi_velocity[i_trial][q]
-                                   +dphi_phys_velocity[i_test][q][1] * beta_km1_q[1][q] * d_ukm1_q[1][2][q] * M_phi_velocity[i_trial][q]
-                                   +dphi_phys_velocity[i_test][q][2] * beta_km1_q[2][q] * d_ukm1_q[1][2][q] * M_phi_velocity[i_trial][q]
-                                  )
-                                  + M_density * M_density * dphi_phys_velocity[i_test][q][2] * M_phi_velocity[i_trial][q] *
-                                   ( d_ukm1_q[1][0][q] * beta_km1_q[0][q] + d_ukm1_q[1][1][q] * beta_km1_q[1][q] + d_ukm1_q[1][2][q] * beta_km1_q[2][q] )
-                                 )
-             + M_Tau_C[i_elem][q] * ( dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][2] )
-             ) * w_quad[q];
+        i_12 += ( M_Tau_M[i_elem][q] * ( M_density * dphi_phys_velocity[i_test][q][2] * M_phi_velocity[i_trial][q] *
+                                       ( M_density * M_alpha / M_timestep * u_km1_q[1][q] +
+                                         d_pkm1_q[1][q]
+                                       )
+                                      -dphi_phys_velocity[i_test][q][2] * M_phi_velocity[i_trial][q] * u_bdf_q[1][q]
+                                      +M_density * M_density *
+                                      ( dphi_phys_velocity[i_test][q][0] * beta_km1_q[0][q] * d_ukm1_q[1][2][q] * M_phi_velocity[i_trial][q]
+                                       +dphi_phys_velocity[i_test][q][1] * beta_km1_q[1][q] * d_ukm1_q[1][2][q] * M_phi_velocity[i_trial][q]
+                                       +dphi_phys_velocity[i_test][q][2] * beta_km1_q[2][q] * d_ukm1_q[1][2][q] * M_phi_velocity[i_trial][q]
+                                      )
+                                      + M_density * M_density * dphi_phys_velocity[i_test][q][2] * M_phi_velocity[i_trial][q] *
+                                       ( d_ukm1_q[1][0][q] * beta_km1_q[0][q] + d_ukm1_q[1][1][q] * beta_km1_q[1][q] + d_ukm1_q[1][2][q] * beta_km1_q[2][q] )
+                                     )
+                 + M_Tau_C[i_elem][q] * ( dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][2] )
+                 ) * w_quad[q];
     
-    i_20 += ( M_Tau_M[i_elem][q] * ( M_density * dphi_phys_velocity[i_test][q][0] * M_phi_velocity[i_trial][q] *
-                                   ( M_density * M_alpha / M_timestep * u_km1_q[2][q] +
-                                     d_pkm1_q[2][q]
-                                   )
-                                  -dphi_phys_velocity[i_test][q][0] * M_phi_velocity[i_trial][q] * u_bdf_q[2][q]
-                                  +M_density * M_density *
-                                  ( dphi_phys_velocity[i_test][q][0] * beta_km1_q[0][q] * d_ukm1_q[2][0][q] * M_phi_velocity[i_trial][q]
-                                   +dphi_phys_velocity[i_test][q][1] * beta_km1_q[1][q] * d_ukm1_q[2][0][q] * M_phi_velocity[i_trial][q]
-                                   +dphi_phys_velocity[i_test][q][2] * beta_km1_q[2][q] * d_ukm1_q[2][0][q] * M_phi_velocity[i_trial][q]
-                                  )
-                                  + M_density * M_density * dphi_phys_velocity[i_test][q][0] * M_phi_velocity[i_trial][q] *
-                                   ( d_ukm1_q[2][0][q] * beta_km1_q[0][q] + d_ukm1_q[2][1][q] * beta_km1_q[1][q] + d_ukm1_q[2][2][q] * beta_km1_q[2][q] )
-                                 )
-             +M_Tau_C[i_elem][q] * ( dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][0] )
-             ) * w_quad[q];
+        i_20 += ( M_Tau_M[i_elem][q] * ( M_density * dphi_phys_velocity[i_test][q][0] * M_phi_velocity[i_trial][q] *
+                                       ( M_density * M_alpha / M_timestep * u_km1_q[2][q] +
+                                         d_pkm1_q[2][q]
+                                       )
+                                      -dphi_phys_velocity[i_test][q][0] * M_phi_velocity[i_trial][q] * u_bdf_q[2][q]
+                                      +M_density * M_density *
+                                      ( dphi_phys_velocity[i_test][q][0] * beta_km1_q[0][q] * d_ukm1_q[2][0][q] * M_phi_velocity[i_trial][q]
+                                       +dphi_phys_velocity[i_test][q][1] * beta_km1_q[1][q] * d_ukm1_q[2][0][q] * M_phi_velocity[i_trial][q]
+                                       +dphi_phys_velocity[i_test][q][2] * beta_km1_q[2][q] * d_ukm1_q[2][0][q] * M_phi_velocity[i_trial][q]
+                                      )
+                                      + M_density * M_density * dphi_phys_velocity[i_test][q][0] * M_phi_velocity[i_trial][q] *
+                                       ( d_ukm1_q[2][0][q] * beta_km1_q[0][q] + d_ukm1_q[2][1][q] * beta_km1_q[1][q] + d_ukm1_q[2][2][q] * beta_km1_q[2][q] )
+                                     )
+                 +M_Tau_C[i_elem][q] * ( dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][0] )
+                 ) * w_quad[q];
     
-    i_21 += ( M_Tau_M[i_elem][q] * ( M_density * dphi_phys_velocity[i_test][q][1] * M_phi_velocity[i_trial][q] *
-                                   ( M_density * M_alpha / M_timestep * u_km1_q[2][q] +
-                                     d_pkm1_q[2][q]
-                                   )
-                                  -dphi_phys_velocity[i_test][q][1] * M_phi_velocity[i_trial][q] * u_bdf_q[2][q]
-                                  +M_density * M_density *
-                                  ( dphi_phys_velocity[i_test][q][0] * beta_km1_q[0][q] * d_ukm1_q[2][1][q] * M_phi_velocity[i_trial][q]
-                                   +dphi_phys_velocity[i_test][q][1] * beta_km1_q[1][q] * d_ukm1_q[2][1][q] * M_phi_velocity[i_trial][q]
-                                   +dphi_phys_velocity[i_test][q][2] * beta_km1_q[2][q] * d_ukm1_q[2][1][q] * M_phi_velocity[i_trial][q]
-                                  )
-                                  + M_density * M_density * dphi_phys_velocity[i_test][q][1] * M_phi_velocity[i_trial][q] *
-                                   ( d_ukm1_q[2][0][q] * beta_km1_q[0][q] + d_ukm1_q[2][1][q] * beta_km1_q[1][q] + d_ukm1_q[2][2][q] * beta_km1_q[2][q] )
-                                 )
-             +M_Tau_C[i_elem][q] * ( dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][1] )
-             ) * w_quad[q];
+        i_21 += ( M_Tau_M[i_elem][q] * ( M_density * dphi_phys_velocity[i_test][q][1] * M_phi_velocity[i_trial][q] *
+                                       ( M_density * M_alpha / M_timestep * u_km1_q[2][q] +
+                                         d_pkm1_q[2][q]
+                                       )
+                                      -dphi_phys_velocity[i_test][q][1] * M_phi_velocity[i_trial][q] * u_bdf_q[2][q]
+                                      +M_density * M_density *
+                                      ( dphi_phys_velocity[i_test][q][0] * beta_km1_q[0][q] * d_ukm1_q[2][1][q] * M_phi_velocity[i_trial][q]
+                                       +dphi_phys_velocity[i_test][q][1] * beta_km1_q[1][q] * d_ukm1_q[2][1][q] * M_phi_velocity[i_trial][q]
+                                       +dphi_phys_velocity[i_test][q][2] * beta_km1_q[2][q] * d_ukm1_q[2][1][q] * M_phi_velocity[i_trial][q]
+                                      )
+                                      + M_density * M_density * dphi_phys_velocity[i_test][q][1] * M_phi_velocity[i_trial][q] *
+                                       ( d_ukm1_q[2][0][q] * beta_km1_q[0][q] + d_ukm1_q[2][1][q] * beta_km1_q[1][q] + d_ukm1_q[2][2][q] * beta_km1_q[2][q] )
+                                     )
+                 +M_Tau_C[i_elem][q] * ( dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][1] )
+                 ) * w_quad[q];
     
-    i_22 += ( M_Tau_M[i_elem][q] * ( M_density * dphi_phys_velocity[i_test][q][2] * M_phi_velocity[i_trial][q] *
-                                   ( M_density * M_alpha / M_timestep * u_km1_q[2][q] +
-                                     d_pkm1_q[2][q]
-                                   )
-                                  -dphi_phys_velocity[i_test][q][2] * M_phi_velocity[i_trial][q] * u_bdf_q[2][q]
-                                  +M_density * M_density *
-                                  ( dphi_phys_velocity[i_test][q][0] * beta_km1_q[0][q] * d_ukm1_q[2][2][q] * M_phi_velocity[i_trial][q]
-                                   +dphi_phys_velocity[i_test][q][1] * beta_km1_q[1][q] * d_ukm1_q[2][2][q] * M_phi_velocity[i_trial][q]
-                                   +dphi_phys_velocity[i_test][q][2] * beta_km1_q[2][q] * d_ukm1_q[2][2][q] * M_phi_velocity[i_trial][q]
-                                  )
-                                  + M_density * M_density * dphi_phys_velocity[i_test][q][2] * M_phi_velocity[i_trial][q] *
-                                   ( d_ukm1_q[2][0][q] * beta_km1_q[0][q] + d_ukm1_q[2][1][q] * beta_km1_q[1][q] + d_ukm1_q[2][2][q] * beta_km1_q[2][q] )
-                                 )
-             +M_Tau_C[i_elem][q] * ( dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][2] )
-             ) * w_quad[q];
+        i_22 += ( M_Tau_M[i_elem][q] * ( M_density * dphi_phys_velocity[i_test][q][2] * M_phi_velocity[i_trial][q] *
+                                       ( M_density * M_alpha / M_timestep * u_km1_q[2][q] +
+                                         d_pkm1_q[2][q]
+                                       )
+                                      -dphi_phys_velocity[i_test][q][2] * M_phi_velocity[i_trial][q] * u_bdf_q[2][q]
+                                      +M_density * M_density *
+                                      ( dphi_phys_velocity[i_test][q][0] * beta_km1_q[0][q] * d_ukm1_q[2][2][q] * M_phi_velocity[i_trial][q]
+                                       +dphi_phys_velocity[i_test][q][1] * beta_km1_q[1][q] * d_ukm1_q[2][2][q] * M_phi_velocity[i_trial][q]
+                                       +dphi_phys_velocity[i_test][q][2] * beta_km1_q[2][q] * d_ukm1_q[2][2][q] * M_phi_velocity[i_trial][q]
+                                      )
+                                      + M_density * M_density * dphi_phys_velocity[i_test][q][2] * M_phi_velocity[i_trial][q] *
+                                       ( d_ukm1_q[2][0][q] * beta_km1_q[0][q] + d_ukm1_q[2][1][q] * beta_km1_q[1][q] + d_ukm1_q[2][2][q] * beta_km1_q[2][q] )
+                                     )
+                 +M_Tau_C[i_elem][q] * ( dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][2] )
+                 ) * w_quad[q];
                         
-    integral +=  M_Tau_M[i_elem][q] * (  M_density * M_density * M_alpha / M_timestep * integral_test * M_phi_velocity[i_trial][q]
-                                       + M_density * M_density * integral_partial
-                                      ) * w_quad[q];
+        integral +=  M_Tau_M[i_elem][q] * (  M_density * M_density * M_alpha / M_timestep * integral_test * M_phi_velocity[i_trial][q]
+                                           + M_density * M_density * integral_partial
+                                          ) * w_quad[q];
                         
-                    }
+                        }
                     
-                    M_vals_supg[i_elem][0][0][i_test][i_trial] = (i_00 + integral) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][0][1][i_test][i_trial] = (i_01 ) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][0][2][i_test][i_trial] = (i_02 ) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][1][0][i_test][i_trial] = (i_10 ) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][1][1][i_test][i_trial] = (i_11 + integral) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][1][2][i_test][i_trial] = (i_12 ) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][2][0][i_test][i_trial] = (i_20 ) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][2][1][i_test][i_trial] = (i_21 ) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][2][2][i_test][i_trial] = (i_22 + integral) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][0][0][i_test][i_trial] = (i_00 + integral) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][0][1][i_test][i_trial] = (i_01 ) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][0][2][i_test][i_trial] = (i_02 ) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][1][0][i_test][i_trial] = (i_10 ) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][1][1][i_test][i_trial] = (i_11 + integral) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][1][2][i_test][i_trial] = (i_12 ) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][2][0][i_test][i_trial] = (i_20 ) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][2][1][i_test][i_trial] = (i_21 ) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][2][2][i_test][i_trial] = (i_22 + integral) *  M_detJacobian[i_elem];
                     
-                }
+                    }
                 
-                for ( i_trial = 0; i_trial <  ndof_pressure; i_trial++ )
-                {
-                    for ( dim_mat = 0; dim_mat < 3 ; dim_mat++ )
+                    for ( i_trial = 0; i_trial <  ndof_pressure; i_trial++ )
                     {
-                        M_cols_pressure[i_elem][i_trial] = M_elements_pressure[i_elem][i_trial];
-                        M_vals_supg_01[i_elem][dim_mat][i_test][i_trial] = 0.0;
+                        for ( dim_mat = 0; dim_mat < 3 ; dim_mat++ )
+                        {
+                            M_cols_pressure[i_chunk][i_trial] = M_elements_pressure[i_elem][i_trial];
+                            M_vals_supg_01[i_chunk][dim_mat][i_test][i_trial] = 0.0;
                         
-                        integral = 0.0;
+                            integral = 0.0;
                         
-                        // QUAD
-                        for ( q = 0; q < NumQuadPoints ; q++ )
-                        {
-                            integral_partial = 0.0;
-                            for ( d1 = 0; d1 < 3 ; d1++ )
+                            // QUAD
+                            for ( q = 0; q < NumQuadPoints ; q++ )
                             {
-                                integral_partial += ( dphi_phys_velocity[i_test][q][d1] * beta_km1_q[d1][q] );
+                                integral_partial = 0.0;
+                                for ( d1 = 0; d1 < 3 ; d1++ )
+                                {
+                                    integral_partial += ( dphi_phys_velocity[i_test][q][d1] * beta_km1_q[d1][q] );
+                                }
+                                integral += M_Tau_M[i_elem][q] * dphi_phys_pressure[i_trial][q][dim_mat] * integral_partial * w_quad[q];
                             }
-                            integral += M_Tau_M[i_elem][q] * dphi_phys_pressure[i_trial][q][dim_mat] * integral_partial * w_quad[q];
+                            M_vals_supg_01[i_chunk][dim_mat][i_test][i_trial] = integral * M_detJacobian[i_elem];
                         }
-                        M_vals_supg_01[i_elem][dim_mat][i_test][i_trial] = integral * M_detJacobian[i_elem];
                     }
-                }
                 
-            }// end test
+                }// end test
             
-            for ( i_test = 0; i_test <  ndof_pressure; i_test++ )
-            {
-                M_rows_pressure[i_elem][i_test] = M_elements_pressure[i_elem][i_test];
-                
-                // DOF - trial
-                for ( i_trial = 0; i_trial <  ndof_pressure; i_trial++ )
+                for ( i_test = 0; i_test <  ndof_pressure; i_test++ )
                 {
-                    M_vals_11[i_elem][i_test][i_trial] = 0.0;
-                    integral = 0.0;
-                    // QUAD
-                    for ( q = 0; q < NumQuadPoints ; q++ )
+                    M_rows_pressure[i_chunk][i_test] = M_elements_pressure[i_elem][i_test];
+                
+                    // DOF - trial
+                    for ( i_trial = 0; i_trial <  ndof_pressure; i_trial++ )
                     {
-                        // DIM 1
-                        for ( d1 = 0; d1 < 3 ; d1++ )
+                        M_vals_11[i_chunk][i_test][i_trial] = 0.0;
+                        integral = 0.0;
+                        // QUAD
+                        for ( q = 0; q < NumQuadPoints ; q++ )
                         {
-                            integral += M_Tau_M[i_elem][q] * dphi_phys_pressure[i_test][q][d1] * dphi_phys_pressure[i_trial][q][d1]*w_quad[q];
+                            // DIM 1
+                            for ( d1 = 0; d1 < 3 ; d1++ )
+                            {
+                                integral += M_Tau_M[i_elem][q] * dphi_phys_pressure[i_test][q][d1] * dphi_phys_pressure[i_trial][q][d1]*w_quad[q];
+                            }
                         }
+                        M_vals_11[i_chunk][i_test][i_trial] = integral * M_detJacobian[i_elem];
                     }
-                    M_vals_11[i_elem][i_test][i_trial] = integral * M_detJacobian[i_elem];
                 }
-            }
             
-            // DOF - test
-            for ( i_test = 0; i_test <  ndof_pressure; i_test++ )
-            {
-                // DOF - trial
-                for ( i_trial = 0; i_trial < ndof_velocity; i_trial++ )
+                // DOF - test
+                for ( i_test = 0; i_test <  ndof_pressure; i_test++ )
                 {
-                    i_00 = 0.0;
-                    i_10 = 0.0;
-                    i_20 = 0.0;
+                    // DOF - trial
+                    for ( i_trial = 0; i_trial < ndof_velocity; i_trial++ )
+                    {
+                        i_00 = 0.0;
+                        i_10 = 0.0;
+                        i_20 = 0.0;
                     
-                    M_vals_supg_10[i_elem][0][i_test][i_trial] = 0.0;
-                    M_vals_supg_10[i_elem][1][i_test][i_trial] = 0.0;
-                    M_vals_supg_10[i_elem][2][i_test][i_trial] = 0.0;
+                        M_vals_supg_10[i_chunk][0][i_test][i_trial] = 0.0;
+                        M_vals_supg_10[i_chunk][1][i_test][i_trial] = 0.0;
+                        M_vals_supg_10[i_chunk][2][i_test][i_trial] = 0.0;
                     
-                    // QUAD
-                    for ( q = 0; q < NumQuadPoints ; q++ )
-                    {
-                        i_00 += M_Tau_M[i_elem][q] * (
-                                                    M_alpha * M_density / M_timestep * dphi_phys_pressure[i_test][q][0] * M_phi_velocity[i_trial][q]
+                        // QUAD
+                        for ( q = 0; q < NumQuadPoints ; q++ )
+                        {
+                            i_00 += M_Tau_M[i_elem][q] * (
+                                                        M_alpha * M_density / M_timestep * dphi_phys_pressure[i_test][q][0] * M_phi_velocity[i_trial][q]
                                                    
-                                                   +M_density * ( dphi_phys_pressure[i_test][q][0] * M_phi_velocity[i_trial][q] * d_ukm1_q[0][0][q]
-                                                                 +dphi_phys_pressure[i_test][q][1] * M_phi_velocity[i_trial][q] * d_ukm1_q[1][0][q]
-                                                                 +dphi_phys_pressure[i_test][q][2] * M_phi_velocity[i_trial][q] * d_ukm1_q[2][0][q]
-                                                                )
-                                                   +M_density * dphi_phys_pressure[i_test][q][0] * (
-                                                                                                     dphi_phys_velocity[i_trial][q][0]*beta_km1_q[0][q]
-                                                                                                    +dphi_phys_velocity[i_trial][q][1]*beta_km1_q[1][q]
-                                                                                                    +dphi_phys_velocity[i_trial][q][2]*beta_km1_q[2][q]
-                                                                                                   )
-                                                     ) * w_quad[q];
-                        
-                        i_10 += M_Tau_M[i_elem][q] * (
-                                                      M_alpha * M_density / M_timestep * dphi_phys_pressure[i_test][q][1] * M_phi_velocity[i_trial][q]
-                                                      +M_density * ( dphi_phys_pressure[i_test][q][0] * M_phi_velocity[i_trial][q] * d_ukm1_q[0][1][q]
-                                                                    +dphi_phys_pressure[i_test][q][1] * M_phi_velocity[i_trial][q] * d_ukm1_q[1][1][q]
-                                                                    +dphi_phys_pressure[i_test][q][2] * M_phi_velocity[i_trial][q] * d_ukm1_q[2][1][q]
+                                                       +M_density * ( dphi_phys_pressure[i_test][q][0] * M_phi_velocity[i_trial][q] * d_ukm1_q[0][0][q]
+                                                                     +dphi_phys_pressure[i_test][q][1] * M_phi_velocity[i_trial][q] * d_ukm1_q[1][0][q]
+                                                                     +dphi_phys_pressure[i_test][q][2] * M_phi_velocity[i_trial][q] * d_ukm1_q[2][0][q]
                                                                     )
-                                                      +M_density * dphi_phys_pressure[i_test][q][1] * (
-                                                                                                       dphi_phys_velocity[i_trial][q][0]*beta_km1_q[0][q]
-                                                                                                       +dphi_phys_velocity[i_trial][q][1]*beta_km1_q[1][q]
-                                                                                                       +dphi_phys_velocity[i_trial][q][2]*beta_km1_q[2][q]
+                                                       +M_density * dphi_phys_pressure[i_test][q][0] * (
+                                                                                                         dphi_phys_velocity[i_trial][q][0]*beta_km1_q[0][q]
+                                                                                                        +dphi_phys_velocity[i_trial][q][1]*beta_km1_q[1][q]
+                                                                                                        +dphi_phys_velocity[i_trial][q][2]*beta_km1_q[2][q]
                                                                                                        )
+                                                         ) * w_quad[q];
+                        
+                            i_10 += M_Tau_M[i_elem][q] * (
+                                                          M_alpha * M_density / M_timestep * dphi_phys_pressure[i_test][q][1] * M_phi_velocity[i_trial][q]
+                                                          +M_density * ( dphi_phys_pressure[i_test][q][0] * M_phi_velocity[i_trial][q] * d_ukm1_q[0][1][q]
+                                                                        +dphi_phys_pressure[i_test][q][1] * M_phi_velocity[i_trial][q] * d_ukm1_q[1][1][q]
+                                                                        +dphi_phys_pressure[i_test][q][2] * M_phi_velocity[i_trial][q] * d_ukm1_q[2][1][q]
+                                                                        )
+                                                          +M_density * dphi_phys_pressure[i_test][q][1] * (
+                                                                                                           dphi_phys_velocity[i_trial][q][0]*beta_km1_q[0][q]
+                                                                                                           +dphi_phys_velocity[i_trial][q][1]*beta_km1_q[1][q]
+                                                                                                           +dphi_phys_velocity[i_trial][q][2]*beta_km1_q[2][q]
+                                                                                                           )
                                                       
-                                                      ) * w_quad[q];
+                                                          ) * w_quad[q];
                         
-                        i_20 += M_Tau_M[i_elem][q] * (
-                                                      M_alpha * M_density / M_timestep * dphi_phys_pressure[i_test][q][2] * M_phi_velocity[i_trial][q]
-                                                      +M_density * ( dphi_phys_pressure[i_test][q][0] * M_phi_velocity[i_trial][q] * d_ukm1_q[0][2][q]
-                                                                    +dphi_phys_pressure[i_test][q][1] * M_phi_velocity[i_trial][q] * d_ukm1_q[1][2][q]
-                                                                    +dphi_phys_pressure[i_test][q][2] * M_phi_velocity[i_trial][q] * d_ukm1_q[2][2][q]
-                                                                    )
-                                                      +M_density * dphi_phys_pressure[i_test][q][2] * (
-                                                                                                       dphi_phys_velocity[i_trial][q][0]*beta_km1_q[0][q]
-                                                                                                       +dphi_phys_velocity[i_trial][q][1]*beta_km1_q[1][q]
-                                                                                                       +dphi_phys_velocity[i_trial][q][2]*beta_km1_q[2][q]
-                                                                                                       )
+                            i_20 += M_Tau_M[i_elem][q] * (
+                                                          M_alpha * M_density / M_timestep * dphi_phys_pressure[i_test][q][2] * M_phi_velocity[i_trial][q]
+                                                          +M_density * ( dphi_phys_pressure[i_test][q][0] * M_phi_velocity[i_trial][q] * d_ukm1_q[0][2][q]
+                                                                        +dphi_phys_pressure[i_test][q][1] * M_phi_velocity[i_trial][q] * d_ukm1_q[1][2][q]
+                                                                        +dphi_phys_pressure[i_test][q][2] * M_phi_velocity[i_trial][q] * d_ukm1_q[2][2][q]
+                                                                        )
+                                                          +M_density * dphi_phys_pressure[i_test][q][2] * (
+                                                                                                           dphi_phys_velocity[i_trial][q][0]*beta_km1_q[0][q]
+                                                                                                           +dphi_phys_velocity[i_trial][q][1]*beta_km1_q[1][q]
+                                                                                                           +dphi_phys_velocity[i_trial][q][2]*beta_km1_q[2][q]
+                                                                                                           )
                                                       
-                                                      ) * w_quad[q];
-                    }
+                                                          ) * w_quad[q];
+                        }
                     
-                    M_vals_supg_10[i_elem][0][i_test][i_trial] = i_00 * M_detJacobian[i_elem];
-                    M_vals_supg_10[i_elem][1][i_test][i_trial] = i_10 * M_detJacobian[i_elem];
-                    M_vals_supg_10[i_elem][2][i_test][i_trial] = i_20 * M_detJacobian[i_elem];
+                        M_vals_supg_10[i_chunk][0][i_test][i_trial] = i_00 * M_detJacobian[i_elem];
+                        M_vals_supg_10[i_chunk][1][i_test][i_trial] = i_10 * M_detJacobian[i_elem];
+                        M_vals_supg_10[i_chunk][2][i_test][i_trial] = i_20 * M_detJacobian[i_elem];
+                    }
                 }
-            }
             
-        }// end elements
-    }// end parallel region
+            }// end elements
+        }// end parallel region
     
-    for ( UInt d1 = 0; d1 < 3 ; d1++ ) // row index
-    {
-        for ( int k = 0; k < M_numElements; ++k )
+        for ( UInt d1 = 0; d1 < 3 ; d1++ ) // row index
         {
-            for ( UInt i = 0; i <  ndof_velocity; i++ )
+            for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
             {
-                M_rows_tmp[k][i] = M_rows_velocity[k][i] + d1 * M_numScalarDofs;
+                for ( UInt i = 0; i <  ndof_velocity; i++ )
+                {
+                    M_rows_tmp[k][i] = M_rows_velocity[k][i] + d1 * M_numScalarDofs;
+                }
+                addToMatrix ( block00, ndof_velocity, M_rows_tmp[k],
+                              ndof_velocity, M_cols_velocity[k],
+                              M_vals_supg[k][d1][0] );
+                addToMatrix ( block01, ndof_velocity, M_rows_tmp[k],
+                              ndof_pressure, M_cols_pressure[k],
+                              M_vals_supg_01[k][d1] );
             }
-            block00->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k],
-                                                       ndof_velocity, M_cols_velocity[k],
-                                                       M_vals_supg[k][d1][0],
-                                                       Epetra_FECrsMatrix::ROW_MAJOR);
-            block01->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k],
-                                                       ndof_pressure, M_cols_pressure[k],
-                                                       M_vals_supg_01[k][d1],
-                                                       Epetra_FECrsMatrix::ROW_MAJOR);
-        }
         
-        for ( int k = 0; k < M_numElements; ++k )
-        {
-            for ( UInt i = 0; i <  ndof_velocity; i++ )
+            for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
             {
-                M_cols_tmp[k][i] = M_cols_velocity[k][i] + M_numScalarDofs;
+                for ( UInt i = 0; i <  ndof_velocity; i++ )
+                {
+                    M_cols_tmp[k][i] = M_cols_velocity[k][i] + M_numScalarDofs;
+                }
+                addToMatrix ( block00, ndof_velocity, M_rows_tmp[k],
+                              ndof_velocity, M_cols_tmp[k],
+                              M_vals_supg[k][d1][1] );
             }
-            block00->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k],
-                                                       ndof_velocity, M_cols_tmp[k],
-                                                       M_vals_supg[k][d1][1],
-                                                       Epetra_FECrsMatrix::ROW_MAJOR);
-        }
         
-        for ( int k = 0; k < M_numElements; ++k )
-        {
-            for ( UInt i = 0; i <  ndof_velocity; i++ )
+            for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
             {
-                M_cols_tmp[k][i] = M_cols_velocity[k][i] + 2 * M_numScalarDofs;
+                for ( UInt i = 0; i <  ndof_velocity; i++ )
+                {
+                    M_cols_tmp[k][i] = M_cols_velocity[k][i] + 2 * M_numScalarDofs;
+                }
+                addToMatrix ( block00, ndof_velocity, M_rows_tmp[k],
+                              ndof_velocity, M_cols_tmp[k],
+                              M_vals_supg[k][d1][2] );
             }
-            block00->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k],
-                                                       ndof_velocity, M_cols_tmp[k],
-                                                       M_vals_supg[k][d1][2],
-                                                       Epetra_FECrsMatrix::ROW_MAJOR);
         }
-    }
-    
-    for ( int k = 0; k < M_numElements; ++k )
-    {
-        block11->matrixPtr()->InsertGlobalValues ( ndof_pressure, M_rows_pressure[k],
-                                                   ndof_pressure, M_cols_pressure[k],
-                                                   M_vals_11[k],
-                                                   Epetra_FECrsMatrix::ROW_MAJOR);
-    }
     
-    for ( UInt d1 = 0; d1 < 3 ; d1++ )
-    {
-        for ( int k = 0; k < M_numElements; ++k )
+        for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
+        {
+            addToMatrix ( block11, ndof_pressure, M_rows_pressure[k],
+                          ndof_pressure, M_cols_pressure[k],
+                          M_vals_11[k] );
+        }
+    
+        for ( UInt d1 = 0; d1 < 3 ; d1++ )
         {
-            for ( UInt i = 0; i <  ndof_velocity; i++ )
+            for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
             {
-                M_cols_tmp[k][i] = M_cols_velocity[k][i] + d1 * M_numScalarDofs;
+                for ( UInt i = 0; i <  ndof_velocity; i++ )
+                {
+                    M_cols_tmp[k][i] = M_cols_velocity[k][i] + d1 * M_numScalarDofs;
+                }
+                addToMatrix ( block10, ndof_pressure, M_rows_pressure[k],
+                              ndof_velocity, M_cols_tmp[k],
+                              M_vals_supg_10[k][d1] );
             }
-            block10->matrixPtr()->InsertGlobalValues ( ndof_pressure, M_rows_pressure[k],
-                                                       ndof_velocity, M_cols_tmp[k],
-                                                       M_vals_supg_10[k][d1],
-                                                       Epetra_FECrsMatrix::ROW_MAJOR);
         }
     }
 }
@@ -2179,569 +2216,573 @@ FastAssemblerNS::vmsles_semi_implicit_terms ( matrixPtr_Type& block00,
         w_quad[q] = M_qr->weight(q);
     }
     
-    #pragma omp parallel firstprivate( w_quad, ndof_velocity, ndof_pressure, NumQuadPoints)
+    // the elements are processed by chunks of M_chunkSize, the element stores are reused for each chunk
+    for ( int chunkBegin = 0; chunkBegin < M_numElements; chunkBegin += M_chunkSize )
     {
-        int i_elem, i_dof, q, d1, d2, i_test, i_trial, e_idof, dim_mat, iCoor, jCoor, k1, k2;
-        double integral, integral_test, integral_trial, integral_partial, integral_lapl, partialSum;
+        const int chunkEnd ( std::min ( chunkBegin + M_chunkSize, M_numElements ) );
+
+        #pragma omp parallel firstprivate( w_quad, ndof_velocity, ndof_pressure, NumQuadPoints)
+        {
+            int i_elem, i_dof, q, d1, d2, i_test, i_trial, e_idof, dim_mat, iCoor, jCoor, k1, k2;
+            double integral, integral_test, integral_trial, integral_partial, integral_lapl, partialSum;
         
-        double dphi_phys_velocity[ndof_velocity][NumQuadPoints][3];
-        double dphi_phys_pressure[ndof_pressure][NumQuadPoints][3];
-        double d2phi_phys_velocity[ndof_velocity][NumQuadPoints][3][3];
-        double uhq[3][NumQuadPoints];
-        double i_00, i_01, i_02, i_10, i_11, i_12, i_20, i_21, i_22;
+            double dphi_phys_velocity[ndof_velocity][NumQuadPoints][3];
+            double dphi_phys_pressure[ndof_pressure][NumQuadPoints][3];
+            double d2phi_phys_velocity[ndof_velocity][NumQuadPoints][3][3];
+            double uhq[3][NumQuadPoints];
+            double i_00, i_01, i_02, i_10, i_11, i_12, i_20, i_21, i_22;
 
         
-        // ELEMENTI,
-        #pragma omp for
-        for ( i_elem = 0; i_elem <  M_numElements; i_elem++ )
-        {
-            // DOF
-            for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
+            // ELEMENTI,
+            #pragma omp for
+            for ( i_elem = chunkBegin; i_elem < chunkEnd; i_elem++ )
             {
-                // QUAD
-                for (  q = 0; q < NumQuadPoints ; q++ )
+                const int i_chunk ( i_elem - chunkBegin );
+
+                // DOF
+                for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
                 {
-                    // DIM 1
-                    for ( d1 = 0; d1 < 3 ; d1++ )
+                    // QUAD
+                    for (  q = 0; q < NumQuadPoints ; q++ )
                     {
-                        dphi_phys_velocity[i_dof][q][d1] = 0.0;
-                        
-                        // DIM 2
-                        for ( d2 = 0; d2 < 3 ; d2++ )
+                        // DIM 1
+                        for ( d1 = 0; d1 < 3 ; d1++ )
                         {
-                            dphi_phys_velocity[i_dof][q][d1] += M_invJacobian[i_elem][d1][d2] * M_dphi_velocity[i_dof][q][d2];
+                            dphi_phys_velocity[i_dof][q][d1] = 0.0;
+                        
+                            // DIM 2
+                            for ( d2 = 0; d2 < 3 ; d2++ )
+                            {
+                                dphi_phys_velocity[i_dof][q][d1] += M_invJacobian[i_elem][d1][d2] * M_dphi_velocity[i_dof][q][d2];
+                            }
                         }
                     }
                 }
-            }
             
-            for ( i_dof = 0; i_dof <  ndof_pressure; i_dof++ )
-            {
-                // QUAD
-                for (  q = 0; q < NumQuadPoints ; q++ )
+                for ( i_dof = 0; i_dof <  ndof_pressure; i_dof++ )
                 {
-                    // DIM 1
-                    for ( d1 = 0; d1 < 3 ; d1++ )
+                    // QUAD
+                    for (  q = 0; q < NumQuadPoints ; q++ )
                     {
-                        dphi_phys_pressure[i_dof][q][d1] = 0.0;
-                        
-                        // DIM 2
-                        for ( d2 = 0; d2 < 3 ; d2++ )
+                        // DIM 1
+                        for ( d1 = 0; d1 < 3 ; d1++ )
                         {
-                            dphi_phys_pressure[i_dof][q][d1] += M_invJacobian[i_elem][d1][d2] * M_dphi_pressure[i_dof][q][d2];
+                            dphi_phys_pressure[i_dof][q][d1] = 0.0;
+                        
+                            // DIM 2
+                            for ( d2 = 0; d2 < 3 ; d2++ )
+                            {
+                                dphi_phys_pressure[i_dof][q][d1] += M_invJacobian[i_elem][d1][d2] * M_dphi_pressure[i_dof][q][d2];
+                            }
                         }
                     }
                 }
-            }
             
-            // QUAD
-            for (  q = 0; q < NumQuadPoints ; q++ )
-            {
-                // DOF
-                for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
+                // QUAD
+                for (  q = 0; q < NumQuadPoints ; q++ )
                 {
-                    // DIM 1
-                    for ( iCoor = 0; iCoor < 3 ; iCoor++ )
+                    // DOF
+                    for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
                     {
-                        // DIM 2
-                        for ( jCoor = 0; jCoor < 3 ; jCoor++ )
+                        // DIM 1
+                        for ( iCoor = 0; iCoor < 3 ; iCoor++ )
                         {
-                            partialSum = 0.0;
-                            // DIM 1
-                            for ( k1 = 0; k1 < 3 ; k1++ )
+                            // DIM 2
+                            for ( jCoor = 0; jCoor < 3 ; jCoor++ )
                             {
-                                // DIM 2
-                                for ( k2 = 0; k2 < 3 ; k2++ )
+                                partialSum = 0.0;
+                                // DIM 1
+                                for ( k1 = 0; k1 < 3 ; k1++ )
                                 {
-                                    partialSum += M_invJacobian[i_elem][iCoor][k1]
-                                    * M_d2phi_velocity[i_dof][q][k1][k2]
-                                    * M_invJacobian[i_elem][jCoor][k2];
+                                    // DIM 2
+                                    for ( k2 = 0; k2 < 3 ; k2++ )
+                                    {
+                                        partialSum += M_invJacobian[i_elem][iCoor][k1]
+                                        * M_d2phi_velocity[i_dof][q][k1][k2]
+                                        * M_invJacobian[i_elem][jCoor][k2];
+                                    }
                                 }
+                                d2phi_phys_velocity[i_dof][q][iCoor][jCoor] = partialSum;
                             }
-                            d2phi_phys_velocity[i_dof][q][iCoor][jCoor] = partialSum;
                         }
                     }
                 }
-            }
 
-            // QUAD
-            for (  q = 0; q < NumQuadPoints ; q++ )
-            {
-                for ( d1 = 0; d1 < 3 ; d1++ )
+                // QUAD
+                for (  q = 0; q < NumQuadPoints ; q++ )
                 {
-                    uhq[d1][q] = 0.0;
-                    for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
+                    for ( d1 = 0; d1 < 3 ; d1++ )
                     {
-                        e_idof =  M_elements_velocity[i_elem][i_dof] + d1*M_numScalarDofs  ;
-                        uhq[d1][q] += u_extr[e_idof] * M_phi_velocity[i_dof][q];
+                        uhq[d1][q] = 0.0;
+                        for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
+                        {
+                            e_idof =  M_elements_velocity[i_elem][i_dof] + d1*M_numScalarDofs  ;
+                            uhq[d1][q] += u_extr[e_idof] * M_phi_velocity[i_dof][q];
+                        }
                     }
                 }
-            }
             
-            // STABILIZZAZIONE - coefficienti Tau_M e Tau_C
-            for (  q = 0; q < NumQuadPoints ; q++ )
-            {
-                M_Tau_M[i_elem][q] = 1.0/std::sqrt(
-                                                   M_density*M_density*( uhq[0][q]*( M_G[i_elem][0][0]* uhq[0][q] +  M_G[i_elem][0][1] * uhq[1][q] + M_G[i_elem][0][2] * uhq[2][q] ) +
-                                                                         uhq[1][q]*( M_G[i_elem][1][0]* uhq[0][q] +  M_G[i_elem][1][1] * uhq[1][q] + M_G[i_elem][1][2] * uhq[2][q] ) +
-                                                                         uhq[2][q]*( M_G[i_elem][2][0]* uhq[0][q] +  M_G[i_elem][2][1] * uhq[1][q] + M_G[i_elem][2][2] * uhq[2][q]   )
-                                                                         ) 	// TAU_M_DEN_VEL
-                                                   +M_C_I*M_viscosity*M_viscosity*(
-                                                                                   M_G[i_elem][0][0]*M_G[i_elem][0][0] + M_G[i_elem][0][1]*M_G[i_elem][0][1] + M_G[i_elem][0][2]*M_G[i_elem][0][2] +
-                                                                                   M_G[i_elem][1][0]*M_G[i_elem][1][0] + M_G[i_elem][1][1]*M_G[i_elem][1][1] + M_G[i_elem][1][2]*M_G[i_elem][1][2] +
-                                                                                   M_G[i_elem][2][0]*M_G[i_elem][2][0] + M_G[i_elem][2][1]*M_G[i_elem][2][1] + M_G[i_elem][2][2]*M_G[i_elem][2][2]
-                                                                                   )  // TAU_M_DEN_VISC*/
-                                                   );
+                // STABILIZZAZIONE - coefficienti Tau_M e Tau_C
+                for (  q = 0; q < NumQuadPoints ; q++ )
+                {
+                    M_Tau_M[i_elem][q] = 1.0/std::sqrt(
+                                                       M_density*M_density*( uhq[0][q]*( M_G[i_elem][0][0]* uhq[0][q] +  M_G[i_elem][0][1] * uhq[1][q] + M_G[i_elem][0][2] * uhq[2][q] ) +
+                                                                             uhq[1][q]*( M_G[i_elem][1][0]* uhq[0][q] +  M_G[i_elem][1][1] * uhq[1][q] + M_G[i_elem][1][2] * uhq[2][q] ) +
+                                                                             uhq[2][q]*( M_G[i_elem][2][0]* uhq[0][q] +  M_G[i_elem][2][1] * uhq[1][q] + M_G[i_elem][2][2] * uhq[2][q]   )
+                                                                             ) 	// TAU_M_DEN_VEL
+                                                       +M_C_I*M_viscosity*M_viscosity*(
+                                                                                       M_G[i_elem][0][0]*M_G[i_elem][0][0] + M_G[i_elem][0][1]*M_G[i_elem][0][1] + M_G[i_elem][0][2]*M_G[i_elem][0][2] +
+                                                                                       M_G[i_elem][1][0]*M_G[i_elem][1][0] + M_G[i_elem][1][1]*M_G[i_elem][1][1] + M_G[i_elem][1][2]*M_G[i_elem][1][2] +
+                                                                                       M_G[i_elem][2][0]*M_G[i_elem][2][0] + M_G[i_elem][2][1]*M_G[i_elem][2][1] + M_G[i_elem][2][2]*M_G[i_elem][2][2]
+                                                                                       )  // TAU_M_DEN_VISC*/
+                                                       );
                 
-                M_Tau_C[i_elem][q] = 1.0/( M_g[i_elem][0]*M_Tau_M[i_elem][q]*M_g[i_elem][0] +
-                                          M_g[i_elem][1]*M_Tau_M[i_elem][q]*M_g[i_elem][1] +
-                                          M_g[i_elem][2]*M_Tau_M[i_elem][q]*M_g[i_elem][2]
-                                          );
+                    M_Tau_C[i_elem][q] = 1.0/( M_g[i_elem][0]*M_Tau_M[i_elem][q]*M_g[i_elem][0] +
+                                              M_g[i_elem][1]*M_Tau_M[i_elem][q]*M_g[i_elem][1] +
+                                              M_g[i_elem][2]*M_Tau_M[i_elem][q]*M_g[i_elem][2]
+                                              );
                 
-                M_Tau_M_hat[i_elem][q] = 1.0/( M_alpha * M_density / M_timestep + 1.0/M_Tau_M[i_elem][q]);
-            }
+                    M_Tau_M_hat[i_elem][q] = 1.0/( M_alpha * M_density / M_timestep + 1.0/M_Tau_M[i_elem][q]);
+                }
             
-            // DOF - test
-            for ( i_test = 0; i_test <  ndof_velocity; i_test++ )
-            {
-                M_rows_velocity[i_elem][i_test] = M_elements_velocity[i_elem][i_test];
-                
-                // DOF - trial
-                for ( i_trial = 0; i_trial <  ndof_velocity; i_trial++ )
+                // DOF - test
+                for ( i_test = 0; i_test <  ndof_velocity; i_test++ )
                 {
-                    M_cols_velocity[i_elem][i_trial] = M_elements_velocity[i_elem][i_trial];
+                    M_rows_velocity[i_chunk][i_test] = M_elements_velocity[i_elem][i_test];
+                
+                    // DOF - trial
+                    for ( i_trial = 0; i_trial <  ndof_velocity; i_trial++ )
+                    {
+                        M_cols_velocity[i_chunk][i_trial] = M_elements_velocity[i_elem][i_trial];
                     
-                    i_00 = 0.0; i_01 = 0.0; i_02 = 0.0; i_10 = 0.0; i_11 = 0.0; i_12 = 0.0; i_20 = 0.0; i_21 = 0.0; i_22 = 0.0;
+                        i_00 = 0.0; i_01 = 0.0; i_02 = 0.0; i_10 = 0.0; i_11 = 0.0; i_12 = 0.0; i_20 = 0.0; i_21 = 0.0; i_22 = 0.0;
                     
-                    M_vals_supg[i_elem][0][0][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][0][1][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][0][2][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][1][0][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][1][1][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][1][2][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][2][0][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][2][1][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][2][2][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][0][0][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][0][1][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][0][2][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][1][0][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][1][1][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][1][2][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][2][0][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][2][1][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][2][2][i_test][i_trial] = 0.0;
                 
-                    double tmp_supg = 0.0;
-                    double tmp_supg_test = 0.0;
-                    double tmp_supg_trial = 0.0;
+                        double tmp_supg = 0.0;
+                        double tmp_supg_test = 0.0;
+                        double tmp_supg_trial = 0.0;
                     
-                    // QUAD
-                    for ( q = 0; q < NumQuadPoints ; q++ )
-                    {
-    tmp_supg = M_alpha * M_density * M_density / M_timestep * (
-    dphi_phys_velocity[i_test][q][0] * uhq[0][q] + dphi_phys_velocity[i_test][q][1] * uhq[1][q] + dphi_phys_velocity[i_test][q][2] * uhq[2][q]
-                                                               ) * M_phi_velocity[i_trial][q];
+                        // QUAD
+                        for ( q = 0; q < NumQuadPoints ; q++ )
+                        {
+        tmp_supg = M_alpha * M_density * M_density / M_timestep * (
+        dphi_phys_velocity[i_test][q][0] * uhq[0][q] + dphi_phys_velocity[i_test][q][1] * uhq[1][q] + dphi_phys_velocity[i_test][q][2] * uhq[2][q]
+                                                                   ) * M_phi_velocity[i_trial][q];
                         
-    tmp_supg_test =
-    dphi_phys_velocity[i_test][q][0] * uhq[0][q] + dphi_phys_velocity[i_test][q][1] * uhq[1][q] + dphi_phys_velocity[i_test][q][2] * uhq[2][q];
+        tmp_supg_test =
+        dphi_phys_velocity[i_test][q][0] * uhq[0][q] + dphi_phys_velocity[i_test][q][1] * uhq[1][q] + dphi_phys_velocity[i_test][q][2] * uhq[2][q];
                         
-    tmp_supg_trial =
-    dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q];
+        tmp_supg_trial =
+        dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q];
                         
-                        i_00 += ( M_Tau_M_hat[i_elem][q] * (
-    M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][0] * M_phi_velocity[i_trial][q] +
-    M_density * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][0] * (
-        dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                              )
-    -M_viscosity * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][0] *
-               ( d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2] )
-    // VMS
-    +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][0] * uhq[0][q] * M_phi_velocity[i_trial][q] )
-    +M_density * M_density * dphi_phys_velocity[i_test][q][0] * uhq[0][q] * (
-       dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                            )
-    -M_density * M_viscosity * dphi_phys_velocity[i_test][q][0] * uhq[0][q] * (
-       d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]                                                     
-                                                                              )
-    // SUPG
-    +tmp_supg
-    +M_density * M_density * tmp_supg_test*tmp_supg_trial
-    -M_density * M_viscosity * tmp_supg_test * (
-            d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
-                                               )
-                                                            )
-                                 + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][0]
+                            i_00 += ( M_Tau_M_hat[i_elem][q] * (
+        M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][0] * M_phi_velocity[i_trial][q] +
+        M_density * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][0] * (
+            dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                                  )
+        -M_viscosity * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][0] *
+                   ( d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2] )
+        // VMS
+        +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][0] * uhq[0][q] * M_phi_velocity[i_trial][q] )
+        +M_density * M_density * dphi_phys_velocity[i_test][q][0] * uhq[0][q] * (
+           dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                                )
+        -M_density * M_viscosity * dphi_phys_velocity[i_test][q][0] * uhq[0][q] * (
+           d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]                                                     
+                                                                                  )
+        // SUPG
+        +tmp_supg
+        +M_density * M_density * tmp_supg_test*tmp_supg_trial
+        -M_density * M_viscosity * tmp_supg_test * (
+                d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
+                                                   )
+                                                                )
+                                     + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][0]
                                  
-                                ) * w_quad[q];
+                                    ) * w_quad[q];
                         
-                        i_01 += ( M_Tau_M_hat[i_elem][q] * (
-    M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][0] * M_phi_velocity[i_trial][q] +
-    M_density * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][0] * (
-        dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                              )
-    -M_viscosity * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][0] *
-               ( d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2] )
-    // VMS
-    +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][1] * uhq[0][q] * M_phi_velocity[i_trial][q] )
-    +M_density * M_density * dphi_phys_velocity[i_test][q][1] * uhq[0][q] * (
-       dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                            )
-    -M_density * M_viscosity * dphi_phys_velocity[i_test][q][1] * uhq[0][q] * (
-       d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
-                                                                              )
-                                                            )
-                                 + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][1]
-                                 ) * w_quad[q];
+                            i_01 += ( M_Tau_M_hat[i_elem][q] * (
+        M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][0] * M_phi_velocity[i_trial][q] +
+        M_density * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][0] * (
+            dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                                  )
+        -M_viscosity * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][0] *
+                   ( d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2] )
+        // VMS
+        +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][1] * uhq[0][q] * M_phi_velocity[i_trial][q] )
+        +M_density * M_density * dphi_phys_velocity[i_test][q][1] * uhq[0][q] * (
+           dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                                )
+        -M_density * M_viscosity * dphi_phys_velocity[i_test][q][1] * uhq[0][q] * (
+           d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
+                                                                                  )
+                                                                )
+                                     + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][1]
+                                     ) * w_quad[q];
                         
-                        i_02 += ( M_Tau_M_hat[i_elem][q] * (
-    M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][0] * M_phi_velocity[i_trial][q] +
-    M_density * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][0] * (
-        dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                              )
-   -M_viscosity * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][0] *
-              ( d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2] )
-   // VMS
-   +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][2] * uhq[0][q] * M_phi_velocity[i_trial][q] )
-   +M_density * M_density * dphi_phys_velocity[i_test][q][2] * uhq[0][q] * (
-      dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                           )
-   -M_density * M_viscosity * dphi_phys_velocity[i_test][q][2] * uhq[0][q] * (
-      d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
-                                                                             )
-                                                         )
-                                 + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][2]
-                                 ) * w_quad[q];
+                            i_02 += ( M_Tau_M_hat[i_elem][q] * (
+        M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][0] * M_phi_velocity[i_trial][q] +
+        M_density * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][0] * (
+            dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                                  )
+       -M_viscosity * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][0] *
+                  ( d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2] )
+       // VMS
+       +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][2] * uhq[0][q] * M_phi_velocity[i_trial][q] )
+       +M_density * M_density * dphi_phys_velocity[i_test][q][2] * uhq[0][q] * (
+          dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                               )
+       -M_density * M_viscosity * dphi_phys_velocity[i_test][q][2] * uhq[0][q] * (
+          d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
+                                                                                 )
+                                                             )
+                                     + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][2]
+                                     ) * w_quad[q];
                         
-                        i_10 += ( M_Tau_M_hat[i_elem][q] * (
-    M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][1] * M_phi_velocity[i_trial][q] +
-    M_density * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][1] * (
-        dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                              )
-   -M_viscosity * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][1] *
-              ( d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2] )
-   // VMS
-   +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][0] * uhq[1][q] * M_phi_velocity[i_trial][q] )
-   +M_density * M_density * dphi_phys_velocity[i_test][q][0] * uhq[1][q] * (
-      dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                           )
-   -M_density * M_viscosity * dphi_phys_velocity[i_test][q][0] * uhq[1][q] * (
-      d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
-                                                                             )
-                                                            )
-                                 + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][0]
-                                                         ) * w_quad[q];
+                            i_10 += ( M_Tau_M_hat[i_elem][q] * (
+        M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][1] * M_phi_velocity[i_trial][q] +
+        M_density * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][1] * (
+            dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                                  )
+       -M_viscosity * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][1] *
+                  ( d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2] )
+       // VMS
+       +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][0] * uhq[1][q] * M_phi_velocity[i_trial][q] )
+       +M_density * M_density * dphi_phys_velocity[i_test][q][0] * uhq[1][q] * (
+          dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                               )
+       -M_density * M_viscosity * dphi_phys_velocity[i_test][q][0] * uhq[1][q] * (
+          d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
+                                                                                 )
+                                                                )
+                                     + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][0]
+                                                             ) * w_quad[q];
                         
-                        i_11 += ( M_Tau_M_hat[i_elem][q] * (
-    M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][1] * M_phi_velocity[i_trial][q] +
-    M_density * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][1] * (
-        dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                              )
-   -M_viscosity * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][1] *
-              ( d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2] )
-   // VMS
-   +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][1] * uhq[1][q] * M_phi_velocity[i_trial][q] )
-   +M_density * M_density * dphi_phys_velocity[i_test][q][1] * uhq[1][q] * (
-      dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                           )
-   -M_density * M_viscosity * dphi_phys_velocity[i_test][q][1] * uhq[1][q] * (
-      d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
-                                                                             )
-   // SUPG
-   +tmp_supg
-   +M_density * M_density * tmp_supg_test*tmp_supg_trial
-   -M_density * M_viscosity * tmp_supg_test * (
-      d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
-                                              )
-                                                          )
-                                 + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][1]
-                                                         ) * w_quad[q];
+                            i_11 += ( M_Tau_M_hat[i_elem][q] * (
+        M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][1] * M_phi_velocity[i_trial][q] +
+        M_density * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][1] * (
+            dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                                  )
+       -M_viscosity * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][1] *
+                  ( d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2] )
+       // VMS
+       +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][1] * uhq[1][q] * M_phi_velocity[i_trial][q] )
+       +M_density * M_density * dphi_phys_velocity[i_test][q][1] * uhq[1][q] * (
+          dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                               )
+       -M_density * M_viscosity * dphi_phys_velocity[i_test][q][1] * uhq[1][q] * (
+          d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
+                                                                                 )
+       // SUPG
+       +tmp_supg
+       +M_density * M_density * tmp_supg_test*tmp_supg_trial
+       -M_density * M_viscosity * tmp_supg_test * (
+          d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
+                                                  )
+                                                              )
+                                     + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][1]
+                                                             ) * w_quad[q];
                         
-                        i_12 += ( M_Tau_M_hat[i_elem][q] * (
-    M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][1] * M_phi_velocity[i_trial][q] +
-    M_density * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][1] * (
-        dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                              )
-   -M_viscosity * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][1] *
-              ( d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2] )
-   // VMS
-   +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][2] * uhq[1][q] * M_phi_velocity[i_trial][q] )
-   +M_density * M_density * dphi_phys_velocity[i_test][q][2] * uhq[1][q] * (
-      dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                           )
-   -M_density * M_viscosity * dphi_phys_velocity[i_test][q][2] * uhq[1][q] * (
-      d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
-                                                                             )
-                                                            )
-                                 + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][2]
-                                                         ) * w_quad[q];
+                            i_12 += ( M_Tau_M_hat[i_elem][q] * (
+        M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][1] * M_phi_velocity[i_trial][q] +
+        M_density * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][1] * (
+            dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                                  )
+       -M_viscosity * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][1] *
+                  ( d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2] )
+       // VMS
+       +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][2] * uhq[1][q] * M_phi_velocity[i_trial][q] )
+       +M_density * M_density * dphi_phys_velocity[i_test][q][2] * uhq[1][q] * (
+          dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                               )
+       -M_density * M_viscosity * dphi_phys_velocity[i_test][q][2] * uhq[1][q] * (
+          d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
+                                                                                 )
+                                                                )
+                                     + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][2]
+                                                             ) * w_quad[q];
                         
-                        i_20 += ( M_Tau_M_hat[i_elem][q] * (
-    M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][2] * M_phi_velocity[i_trial][q] +
-    M_density * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][2] * (
-        dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                              )
-   -M_viscosity * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][2] *
-              ( d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2] )
-   // VMS
-   +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][0] * uhq[2][q] * M_phi_velocity[i_trial][q] )
-   +M_density * M_density * dphi_phys_velocity[i_test][q][0] * uhq[2][q] * (
-      dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                           )
-   -M_density * M_viscosity * dphi_phys_velocity[i_test][q][0] * uhq[2][q] * (
-      d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
-                                                                             )
-                                                            )
-                                 + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][0]
-                                                         ) * w_quad[q];
+                            i_20 += ( M_Tau_M_hat[i_elem][q] * (
+        M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][2] * M_phi_velocity[i_trial][q] +
+        M_density * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][2] * (
+            dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                                  )
+       -M_viscosity * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][2] *
+                  ( d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2] )
+       // VMS
+       +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][0] * uhq[2][q] * M_phi_velocity[i_trial][q] )
+       +M_density * M_density * dphi_phys_velocity[i_test][q][0] * uhq[2][q] * (
+          dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                               )
+       -M_density * M_viscosity * dphi_phys_velocity[i_test][q][0] * uhq[2][q] * (
+          d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
+                                                                                 )
+                                                                )
+                                     + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][0]
+                                                             ) * w_quad[q];
                         
-                        i_21 += ( M_Tau_M_hat[i_elem][q] * (
-    M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][2] * M_phi_velocity[i_trial][q] +
-    M_density * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][2] * (
-        dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                            i_21 += ( M_Tau_M_hat[i_elem][q] * (
+        M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][2] * M_phi_velocity[i_trial][q] +
+        M_density * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][2] * (
+            dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                                  )
+       -M_viscosity * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][2] *
+                  ( d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2] )
+      // VMS
+      +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][1] * uhq[2][q] * M_phi_velocity[i_trial][q] )
+      +M_density * M_density * dphi_phys_velocity[i_test][q][1] * uhq[2][q] * (
+         dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
                                                                               )
-   -M_viscosity * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][2] *
-              ( d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2] )
-  // VMS
-  +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][1] * uhq[2][q] * M_phi_velocity[i_trial][q] )
-  +M_density * M_density * dphi_phys_velocity[i_test][q][1] * uhq[2][q] * (
-     dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                          )
-  -M_density * M_viscosity * dphi_phys_velocity[i_test][q][1] * uhq[2][q] * (
-     d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
-                                                                            )
-                                                            )
-                                 + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][1]
-                                                         ) * w_quad[q];
+      -M_density * M_viscosity * dphi_phys_velocity[i_test][q][1] * uhq[2][q] * (
+         d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
+                                                                                )
+                                                                )
+                                     + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][1]
+                                                             ) * w_quad[q];
                         
-                        i_22 += ( M_Tau_M_hat[i_elem][q] * (
-    M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][2] * M_phi_velocity[i_trial][q] +
-    M_density * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][2] * (
-        dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                              )
-   -M_viscosity * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][2] *
-              ( d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2] )
-   // VMS
-   +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][2] * uhq[2][q] * M_phi_velocity[i_trial][q] )
-   +M_density * M_density * dphi_phys_velocity[i_test][q][2] * uhq[2][q] * (
-      dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                           )
-   -M_density * M_viscosity * dphi_phys_velocity[i_test][q][2] * uhq[2][q] * (
-      d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
-                                                                             )
-   // SUPG
-   +tmp_supg
-   +M_density * M_density * tmp_supg_test*tmp_supg_trial
-   -M_density * M_viscosity * tmp_supg_test * (
-      d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
-                                              )
-                                                            )
-                                 + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][2]
-                                                         ) * w_quad[q];
+                            i_22 += ( M_Tau_M_hat[i_elem][q] * (
+        M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][2] * M_phi_velocity[i_trial][q] +
+        M_density * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][2] * (
+            dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                                  )
+       -M_viscosity * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][2] *
+                  ( d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2] )
+       // VMS
+       +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][2] * uhq[2][q] * M_phi_velocity[i_trial][q] )
+       +M_density * M_density * dphi_phys_velocity[i_test][q][2] * uhq[2][q] * (
+          dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                               )
+       -M_density * M_viscosity * dphi_phys_velocity[i_test][q][2] * uhq[2][q] * (
+          d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
+                                                                                 )
+       // SUPG
+       +tmp_supg
+       +M_density * M_density * tmp_supg_test*tmp_supg_trial
+       -M_density * M_viscosity * tmp_supg_test * (
+          d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
+                                                  )
+                                                                )
+                                     + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][2]
+                                                             ) * w_quad[q];
                         
                         
-                    } // end quadrature
+                        } // end quadrature
                     
-                    M_vals_supg[i_elem][0][0][i_test][i_trial] = (i_00 ) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][0][1][i_test][i_trial] = (i_01 ) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][0][2][i_test][i_trial] = (i_02 ) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][1][0][i_test][i_trial] = (i_10 ) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][1][1][i_test][i_trial] = (i_11 ) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][1][2][i_test][i_trial] = (i_12 ) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][2][0][i_test][i_trial] = (i_20 ) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][2][1][i_test][i_trial] = (i_21 ) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][2][2][i_test][i_trial] = (i_22 ) *  M_detJacobian[i_elem];
-
-                } // end trial
+                        M_vals_supg[i_chunk][0][0][i_test][i_trial] = (i_00 ) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][0][1][i_test][i_trial] = (i_01 ) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][0][2][i_test][i_trial] = (i_02 ) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][1][0][i_test][i_trial] = (i_10 ) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][1][1][i_test][i_trial] = (i_11 ) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][1][2][i_test][i_trial] = (i_12 ) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][2][0][i_test][i_trial] = (i_20 ) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][2][1][i_test][i_trial] = (i_21 ) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][2][2][i_test][i_trial] = (i_22 ) *  M_detJacobian[i_elem];
+
+                    } // end trial
                 
-                for ( i_trial = 0; i_trial <  ndof_pressure; i_trial++ )
-                {
-                    M_cols_pressure[i_elem][i_trial] = M_elements_pressure[i_elem][i_trial];
-                    M_vals_supg_01[i_elem][0][i_test][i_trial] = 0.0;
-                    M_vals_supg_01[i_elem][1][i_test][i_trial] = 0.0;
-                    M_vals_supg_01[i_elem][2][i_test][i_trial] = 0.0;
+                    for ( i_trial = 0; i_trial <  ndof_pressure; i_trial++ )
+                    {
+                        M_cols_pressure[i_chunk][i_trial] = M_elements_pressure[i_elem][i_trial];
+                        M_vals_supg_01[i_chunk][0][i_test][i_trial] = 0.0;
+                        M_vals_supg_01[i_chunk][1][i_test][i_trial] = 0.0;
+                        M_vals_supg_01[i_chunk][2][i_test][i_trial] = 0.0;
                     
-                    i_00 = 0.0;
-                    i_10 = 0.0;
-                    i_20 = 0.0;
+                        i_00 = 0.0;
+                        i_10 = 0.0;
+                        i_20 = 0.0;
                     
-                    // QUAD
-                    for ( q = 0; q < NumQuadPoints ; q++ )
-                    {
-                        i_00 += M_Tau_M_hat[i_elem][q] * (
-                                dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][0] * dphi_phys_pressure[i_trial][q][0]
-                               +dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][0] * dphi_phys_pressure[i_trial][q][1]
-                               +dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][0] * dphi_phys_pressure[i_trial][q][2]
-                               +M_density * (
-    (dphi_phys_velocity[i_test][q][0] * uhq[0][q] + dphi_phys_velocity[i_test][q][1] * uhq[1][q] + dphi_phys_velocity[i_test][q][2] * uhq[2][q])
-    * dphi_phys_pressure[i_trial][q][0]
-    + dphi_phys_velocity[i_test][q][0] * uhq[0][q] * dphi_phys_pressure[i_trial][q][0]
-    + dphi_phys_velocity[i_test][q][1] * uhq[0][q] * dphi_phys_pressure[i_trial][q][1]
-    + dphi_phys_velocity[i_test][q][2] * uhq[0][q] * dphi_phys_pressure[i_trial][q][2]
-                                             )
-                                                          ) * w_quad[q];
+                        // QUAD
+                        for ( q = 0; q < NumQuadPoints ; q++ )
+                        {
+                            i_00 += M_Tau_M_hat[i_elem][q] * (
+                                    dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][0] * dphi_phys_pressure[i_trial][q][0]
+                                   +dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][0] * dphi_phys_pressure[i_trial][q][1]
+                                   +dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][0] * dphi_phys_pressure[i_trial][q][2]
+                                   +M_density * (
+        (dphi_phys_velocity[i_test][q][0] * uhq[0][q] + dphi_phys_velocity[i_test][q][1] * uhq[1][q] + dphi_phys_velocity[i_test][q][2] * uhq[2][q])
+        * dphi_phys_pressure[i_trial][q][0]
+        + dphi_phys_velocity[i_test][q][0] * uhq[0][q] * dphi_phys_pressure[i_trial][q][0]
+        + dphi_phys_velocity[i_test][q][1] * uhq[0][q] * dphi_phys_pressure[i_trial][q][1]
+        + dphi_phys_velocity[i_test][q][2] * uhq[0][q] * dphi_phys_pressure[i_trial][q][2]
+                                                 )
+                                                              ) * w_quad[q];
                         
-                        i_10 += M_Tau_M_hat[i_elem][q] * (
-                                dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][1] * dphi_phys_pressure[i_trial][q][0]
-                               +dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][1] * dphi_phys_pressure[i_trial][q][1]
-                               +dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][1] * dphi_phys_pressure[i_trial][q][2]
-                               +M_density * (
-    (dphi_phys_velocity[i_test][q][0] * uhq[0][q] + dphi_phys_velocity[i_test][q][1] * uhq[1][q] + dphi_phys_velocity[i_test][q][2] * uhq[2][q])
-    * dphi_phys_pressure[i_trial][q][1]
-    + dphi_phys_velocity[i_test][q][0] * uhq[1][q] * dphi_phys_pressure[i_trial][q][0]
-    + dphi_phys_velocity[i_test][q][1] * uhq[1][q] * dphi_phys_pressure[i_trial][q][1]
-    + dphi_phys_velocity[i_test][q][2] * uhq[1][q] * dphi_phys_pressure[i_trial][q][2]
-                                             )
-                                                          ) * w_quad[q];
+                            i_10 += M_Tau_M_hat[i_elem][q] * (
+                                    dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][1] * dphi_phys_pressure[i_trial][q][0]
+                                   +dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][1] * dphi_phys_pressure[i_trial][q][1]
+                                   +dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][1] * dphi_phys_pressure[i_trial][q][2]
+                                   +M_density * (
+        (dphi_phys_velocity[i_test][q][0] * uhq[0][q] + dphi_phys_velocity[i_test][q][1] * uhq[1][q] + dphi_phys_velocity[i_test][q][2] * uhq[2][q])
+        * dphi_phys_pressure[i_trial][q][1]
+        + dphi_phys_velocity[i_test][q][0] * uhq[1][q] * dphi_phys_pressure[i_trial][q][0]
+        + dphi_phys_velocity[i_test][q][1] * uhq[1][q] * dphi_phys_pressure[i_trial][q][1]
+        + dphi_phys_velocity[i_test][q][2] * uhq[1][q] * dphi_phys_pressure[i_trial][q][2]
+                                                 )
+                                                              ) * w_quad[q];
                         
-                        i_20 += M_Tau_M_hat[i_elem][q] * (
-                                dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][2] * dphi_phys_pressure[i_trial][q][0]
-                               +dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][2] * dphi_phys_pressure[i_trial][q][1]
-                               +dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][2] * dphi_phys_pressure[i_trial][q][2]
-                               +M_density * (
-    (dphi_phys_velocity[i_test][q][0] * uhq[0][q] + dphi_phys_velocity[i_test][q][1] * uhq[1][q] + dphi_phys_velocity[i_test][q][2] * uhq[2][q])
-    * dphi_phys_pressure[i_trial][q][2]
-    + dphi_phys_velocity[i_test][q][0] * uhq[2][q] * dphi_phys_pressure[i_trial][q][0]
-    + dphi_phys_velocity[i_test][q][1] * uhq[2][q] * dphi_phys_pressure[i_trial][q][1]
-    + dphi_phys_velocity[i_test][q][2] * uhq[2][q] * dphi_phys_pressure[i_trial][q][2]
-                                             )
-                                                          ) * w_quad[q];
-                    }
+                            i_20 += M_Tau_M_hat[i_elem][q] * (
+                                    dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][2] * dphi_phys_pressure[i_trial][q][0]
+                                   +dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][2] * dphi_phys_pressure[i_trial][q][1]
+                                   +dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][2] * dphi_phys_pressure[i_trial][q][2]
+                                   +M_density * (
+        (dphi_phys_velocity[i_test][q][0] * uhq[0][q] + dphi_phys_velocity[i_test][q][1] * uhq[1][q] + dphi_phys_velocity[i_test][q][2] * uhq[2][q])
+        * dphi_phys_pressure[i_trial][q][2]
+        + dphi_phys_velocity[i_test][q][0] * uhq[2][q] * dphi_phys_pressure[i_trial][q][0]
+        + dphi_phys_velocity[i_test][q][1] * uhq[2][q] * dphi_phys_pressure[i_trial][q][1]
+        + dphi_phys_velocity[i_test][q][2] * uhq[2][q] * dphi_phys_pressure[i_trial][q][2]
+                                                 )
+                                                              ) * w_quad[q];
+                        }
                     
-                    M_vals_supg_01[i_elem][0][i_test][i_trial] = i_00 * M_detJacobian[i_elem];
-                    M_vals_supg_01[i_elem][1][i_test][i_trial] = i_10 * M_detJacobian[i_elem];
-                    M_vals_supg_01[i_elem][2][i_test][i_trial] = i_20 * M_detJacobian[i_elem];
+                        M_vals_supg_01[i_chunk][0][i_test][i_trial] = i_00 * M_detJacobian[i_elem];
+                        M_vals_supg_01[i_chunk][1][i_test][i_trial] = i_10 * M_detJacobian[i_elem];
+                        M_vals_supg_01[i_chunk][2][i_test][i_trial] = i_20 * M_detJacobian[i_elem];
                     
-                }
+                    }
                 
-            } // end dof test
+                } // end dof test
             
-            // DOF - test - assemblo blocchi (1,0) e (1,1)
-            for ( i_test = 0; i_test <  ndof_pressure; i_test++ )
-            {
-                M_rows_pressure[i_elem][i_test] = M_elements_pressure[i_elem][i_test];
-                
-                // DOF - trial
-                for ( i_trial = 0; i_trial <  ndof_pressure; i_trial++ )
+                // DOF - test - assemblo blocchi (1,0) e (1,1)
+                for ( i_test = 0; i_test <  ndof_pressure; i_test++ )
                 {
-                    M_vals_11[i_elem][i_test][i_trial] = 0.0;
-                    
-                    integral = 0.0;
-                    // QUAD
-                    for ( q = 0; q < NumQuadPoints ; q++ )
+                    M_rows_pressure[i_chunk][i_test] = M_elements_pressure[i_elem][i_test];
+                
+                    // DOF - trial
+                    for ( i_trial = 0; i_trial <  ndof_pressure; i_trial++ )
                     {
-                        // DIM 1
-                        for ( d1 = 0; d1 < 3 ; d1++ )
+                        M_vals_11[i_chunk][i_test][i_trial] = 0.0;
+                    
+                        integral = 0.0;
+                        // QUAD
+                        for ( q = 0; q < NumQuadPoints ; q++ )
                         {
-                            integral += M_Tau_M_hat[i_elem][q] * dphi_phys_pressure[i_test][q][d1] * dphi_phys_pressure[i_trial][q][d1]*w_quad[q];
+                            // DIM 1
+                            for ( d1 = 0; d1 < 3 ; d1++ )
+                            {
+                                integral += M_Tau_M_hat[i_elem][q] * dphi_phys_pressure[i_test][q][d1] * dphi_phys_pressure[i_trial][q][d1]*w_quad[q];
+                            }
                         }
+                        M_vals_11[i_chunk][i_test][i_trial] = integral * M_detJacobian[i_elem];
                     }
-                    M_vals_11[i_elem][i_test][i_trial] = integral * M_detJacobian[i_elem];
                 }
-            }
             
-            // DOF - test
-            for ( i_test = 0; i_test <  ndof_pressure; i_test++ )
-            {
-                // DOF - trial
-                for ( i_trial = 0; i_trial < ndof_velocity; i_trial++ )
+                // DOF - test
+                for ( i_test = 0; i_test <  ndof_pressure; i_test++ )
                 {
-                    i_00 = 0.0;
-                    i_01 = 0.0;
-                    i_02 = 0.0;
-                    
-                    // QUAD
-                    for ( q = 0; q < NumQuadPoints ; q++ )
+                    // DOF - trial
+                    for ( i_trial = 0; i_trial < ndof_velocity; i_trial++ )
                     {
-                        i_00 += M_Tau_M_hat[i_elem][q] * (
-         M_density * M_alpha / M_timestep * dphi_phys_pressure[i_test][q][0] * M_phi_velocity[i_trial][q]
-        +M_density * dphi_phys_pressure[i_test][q][0] * (
-          dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                        )
-        -M_viscosity * dphi_phys_pressure[i_test][q][0] * (
-          d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
-                                                          )
-                                                         ) * w_quad[q];
+                        i_00 = 0.0;
+                        i_01 = 0.0;
+                        i_02 = 0.0;
+                    
+                        // QUAD
+                        for ( q = 0; q < NumQuadPoints ; q++ )
+                        {
+                            i_00 += M_Tau_M_hat[i_elem][q] * (
+             M_density * M_alpha / M_timestep * dphi_phys_pressure[i_test][q][0] * M_phi_velocity[i_trial][q]
+            +M_density * dphi_phys_pressure[i_test][q][0] * (
+              dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                            )
+            -M_viscosity * dphi_phys_pressure[i_test][q][0] * (
+              d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
+                                                              )
+                                                             ) * w_quad[q];
                         
-                        i_01 += M_Tau_M_hat[i_elem][q] * (
-         M_density * M_alpha / M_timestep * dphi_phys_pressure[i_test][q][1] * M_phi_velocity[i_trial][q]
-        +M_density * dphi_phys_pressure[i_test][q][1] * (
-          dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                        )
-        -M_viscosity * dphi_phys_pressure[i_test][q][1] * (
-          d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
-                                                          )
-                                                         ) * w_quad[q];
+                            i_01 += M_Tau_M_hat[i_elem][q] * (
+             M_density * M_alpha / M_timestep * dphi_phys_pressure[i_test][q][1] * M_phi_velocity[i_trial][q]
+            +M_density * dphi_phys_pressure[i_test][q][1] * (
+              dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                            )
+            -M_viscosity * dphi_phys_pressure[i_test][q][1] * (
+              d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
+                                                              )
+                                                             ) * w_quad[q];
                         
-                        i_02 += M_Tau_M_hat[i_elem][q] * (
-         M_density * M_alpha / M_timestep * dphi_phys_pressure[i_test][q][2] * M_phi_velocity[i_trial][q]
-        +M_density * dphi_phys_pressure[i_test][q][2] * (
-          dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                        )
-        -M_viscosity * dphi_phys_pressure[i_test][q][2] * (
-          d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
-                                                          )
-                                                         ) * w_quad[q];
-                    }
+                            i_02 += M_Tau_M_hat[i_elem][q] * (
+             M_density * M_alpha / M_timestep * dphi_phys_pressure[i_test][q][2] * M_phi_velocity[i_trial][q]
+            +M_density * dphi_phys_pressure[i_test][q][2] * (
+              dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                            )
+            -M_viscosity * dphi_phys_pressure[i_test][q][2] * (
+              d2phi_phys_velocity[i_trial][q][0][0] + d2phi_phys_velocity[i_trial][q][1][1] + d2phi_phys_velocity[i_trial][q][2][2]
+                                                              )
+                                                             ) * w_quad[q];
+                        }
                     
-                    M_vals_supg_10[i_elem][0][i_test][i_trial] = i_00 * M_detJacobian[i_elem];
-                    M_vals_supg_10[i_elem][1][i_test][i_trial] = i_01 * M_detJacobian[i_elem];
-                    M_vals_supg_10[i_elem][2][i_test][i_trial] = i_02 * M_detJacobian[i_elem];
+                        M_vals_supg_10[i_chunk][0][i_test][i_trial] = i_00 * M_detJacobian[i_elem];
+                        M_vals_supg_10[i_chunk][1][i_test][i_trial] = i_01 * M_detJacobian[i_elem];
+                        M_vals_supg_10[i_chunk][2][i_test][i_trial] = i_02 * M_detJacobian[i_elem];
+                    }
                 }
-            }
 
+            }
         }
-    }
     
-    for ( UInt d1 = 0; d1 < 3 ; d1++ ) // row index
-    {
-        for ( int k = 0; k < M_numElements; ++k )
+        for ( UInt d1 = 0; d1 < 3 ; d1++ ) // row index
         {
-            for ( UInt i = 0; i <  ndof_velocity; i++ )
+            for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
             {
-                M_rows_tmp[k][i] = M_rows_velocity[k][i] + d1 * M_numScalarDofs;
-            }
-            block00->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k],
-                                                       ndof_velocity, M_cols_velocity[k],
-                                                       M_vals_supg[k][d1][0],
-                                                       Epetra_FECrsMatrix::ROW_MAJOR);
+                for ( UInt i = 0; i <  ndof_velocity; i++ )
+                {
+                    M_rows_tmp[k][i] = M_rows_velocity[k][i] + d1 * M_numScalarDofs;
+                }
+                addToMatrix ( block00, ndof_velocity, M_rows_tmp[k],
+                              ndof_velocity, M_cols_velocity[k],
+                              M_vals_supg[k][d1][0] );
             
-            block01->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k],
-                                                       ndof_pressure, M_cols_pressure[k],
-                                                       M_vals_supg_01[k][d1],
-                                                       Epetra_FECrsMatrix::ROW_MAJOR);
-        }
+                addToMatrix ( block01, ndof_velocity, M_rows_tmp[k],
+                              ndof_pressure, M_cols_pressure[k],
+                              M_vals_supg_01[k][d1] );
+            }
         
-        for ( int k = 0; k < M_numElements; ++k )
-        {
-            for ( UInt i = 0; i <  ndof_velocity; i++ )
+            for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
             {
-                M_cols_tmp[k][i] = M_cols_velocity[k][i] + M_numScalarDofs;
+                for ( UInt i = 0; i <  ndof_velocity; i++ )
+                {
+                    M_cols_tmp[k][i] = M_cols_velocity[k][i] + M_numScalarDofs;
+                }
+                addToMatrix ( block00, ndof_velocity, M_rows_tmp[k],
+                              ndof_velocity, M_cols_tmp[k],
+                              M_vals_supg[k][d1][1] );
             }
-            block00->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k],
-                                                       ndof_velocity, M_cols_tmp[k],
-                                                       M_vals_supg[k][d1][1],
-                                                       Epetra_FECrsMatrix::ROW_MAJOR);
-        }
         
-        for ( int k = 0; k < M_numElements; ++k )
-        {
-            for ( UInt i = 0; i <  ndof_velocity; i++ )
+            for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
             {
-                M_cols_tmp[k][i] = M_cols_velocity[k][i] + 2 * M_numScalarDofs;
+                for ( UInt i = 0; i <  ndof_velocity; i++ )
+                {
+                    M_cols_tmp[k][i] = M_cols_velocity[k][i] + 2 * M_numScalarDofs;
+                }
+                addToMatrix ( block00, ndof_velocity, M_rows_tmp[k],
+                              ndof_velocity, M_cols_tmp[k],
+                              M_vals_supg[k][d1][2] );
             }
-            block00->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k],
-                                                       ndof_velocity, M_cols_tmp[k],
-                                                       M_vals_supg[k][d1][2],
-                                                       Epetra_FECrsMatrix::ROW_MAJOR);
         }
-    }
 
-    for ( int k = 0; k < M_numElements; ++k )
-    {
-        block11->matrixPtr()->InsertGlobalValues ( ndof_pressure, M_rows_pressure[k], ndof_pressure, M_cols_pressure[k], M_vals_11[k], Epetra_FECrsMatrix::ROW_MAJOR);
-    }
+        for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
+        {
+            addToMatrix ( block11, ndof_pressure, M_rows_pressure[k], ndof_pressure, M_cols_pressure[k], M_vals_11[k] );
+        }
     
-    for ( UInt d1 = 0; d1 < 3 ; d1++ )
-    {
-        for ( int k = 0; k < M_numElements; ++k )
+        for ( UInt d1 = 0; d1 < 3 ; d1++ )
         {
-            for ( UInt i = 0; i <  ndof_velocity; i++ )
+            for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
             {
-                M_cols_tmp[k][i] = M_cols_velocity[k][i] + d1 * M_numScalarDofs;
+                for ( UInt i = 0; i <  ndof_velocity; i++ )
+                {
+                    M_cols_tmp[k][i] = M_cols_velocity[k][i] + d1 * M_numScalarDofs;
+                }
+                addToMatrix ( block10, ndof_pressure, M_rows_pressure[k], ndof_velocity, M_cols_tmp[k], M_vals_supg_10[k][d1] );
             }
-            block10->matrixPtr()->InsertGlobalValues ( ndof_pressure, M_rows_pressure[k], ndof_velocity, M_cols_tmp[k], M_vals_supg_10[k][d1], Epetra_FECrsMatrix::ROW_MAJOR);
         }
     }
 }
@@ -2766,481 +2807,485 @@ FastAssemblerNS::vmsles_semi_implicit_termsP1P1 ( matrixPtr_Type& block00,
         w_quad[q] = M_qr->weight(q);
     }
 
-    #pragma omp parallel firstprivate( w_quad, ndof_velocity, ndof_pressure, NumQuadPoints)
+    // the elements are processed by chunks of M_chunkSize, the element stores are reused for each chunk
+    for ( int chunkBegin = 0; chunkBegin < M_numElements; chunkBegin += M_chunkSize )
     {
-        int i_elem, i_dof, q, d1, d2, i_test, i_trial, e_idof, dim_mat, iCoor, jCoor, k1, k2;
-        double integral, integral_test, integral_trial, integral_partial, integral_lapl, partialSum;
+        const int chunkEnd ( std::min ( chunkBegin + M_chunkSize, M_numElements ) );
+
+        #pragma omp parallel firstprivate( w_quad, ndof_velocity, ndof_pressure, NumQuadPoints)
+        {
+            int i_elem, i_dof, q, d1, d2, i_test, i_trial, e_idof, dim_mat, iCoor, jCoor, k1, k2;
+            double integral, integral_test, integral_trial, integral_partial, integral_lapl, partialSum;
 
-        double dphi_phys_velocity[ndof_velocity][NumQuadPoints][3];
-        double dphi_phys_pressure[ndof_pressure][NumQuadPoints][3];
-        double uhq[3][NumQuadPoints];
-        double i_00, i_01, i_02, i_10, i_11, i_12, i_20, i_21, i_22;
+            double dphi_phys_velocity[ndof_velocity][NumQuadPoints][3];
+            double dphi_phys_pressure[ndof_pressure][NumQuadPoints][3];
+            double uhq[3][NumQuadPoints];
+            double i_00, i_01, i_02, i_10, i_11, i_12, i_20, i_21, i_22;
 
 
-        // ELEMENTI,
-        #pragma omp for
-        for ( i_elem = 0; i_elem <  M_numElements; i_elem++ )
-        {
-            // DOF
-            for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
+            // ELEMENTI,
+            #pragma omp for
+            for ( i_elem = chunkBegin; i_elem < chunkEnd; i_elem++ )
             {
-                // QUAD
-                for (  q = 0; q < NumQuadPoints ; q++ )
+                const int i_chunk ( i_elem - chunkBegin );
+
+                // DOF
+                for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
                 {
-                    // DIM 1
-                    for ( d1 = 0; d1 < 3 ; d1++ )
+                    // QUAD
+                    for (  q = 0; q < NumQuadPoints ; q++ )
                     {
-                        dphi_phys_velocity[i_dof][q][d1] = 0.0;
+                        // DIM 1
+                        for ( d1 = 0; d1 < 3 ; d1++ )
+                        {
+                            dphi_phys_velocity[i_dof][q][d1] = 0.0;
 
-                        // DIM 2
-                        for ( d2 = 0; d2 < 3 ; d2++ )
+                            // DIM 2
+                            for ( d2 = 0; d2 < 3 ; d2++ )
+                            {
+                                dphi_phys_velocity[i_dof][q][d1] += M_invJacobian[i_elem][d1][d2] * M_dphi_velocity[i_dof][q][d2];
+                            }
+                        }
+                    }
+                }
+
+                for ( i_dof = 0; i_dof <  ndof_pressure; i_dof++ )
+                {
+                    // QUAD
+                    for (  q = 0; q < NumQuadPoints ; q++ )
+                    {
+                        // DIM 1
+                        for ( d1 = 0; d1 < 3 ; d1++ )
                         {
-                            dphi_phys_velocity[i_dof][q][d1] += M_invJacobian[i_elem][d1][d2] * M_dphi_velocity[i_dof][q][d2];
+                            dphi_phys_pressure[i_dof][q][d1] = 0.0;
+
+                            // DIM 2
+                            for ( d2 = 0; d2 < 3 ; d2++ )
+                            {
+                                dphi_phys_pressure[i_dof][q][d1] += M_invJacobian[i_elem][d1][d2] * M_dphi_pressure[i_dof][q][d2];
+                            }
                         }
                     }
                 }
-            }
 
-            for ( i_dof = 0; i_dof <  ndof_pressure; i_dof++ )
-            {
                 // QUAD
                 for (  q = 0; q < NumQuadPoints ; q++ )
                 {
-                    // DIM 1
                     for ( d1 = 0; d1 < 3 ; d1++ )
                     {
-                        dphi_phys_pressure[i_dof][q][d1] = 0.0;
-
-                        // DIM 2
-                        for ( d2 = 0; d2 < 3 ; d2++ )
+                        uhq[d1][q] = 0.0;
+                        for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
                         {
-                            dphi_phys_pressure[i_dof][q][d1] += M_invJacobian[i_elem][d1][d2] * M_dphi_pressure[i_dof][q][d2];
+                            e_idof =  M_elements_velocity[i_elem][i_dof] + d1*M_numScalarDofs  ;
+                            uhq[d1][q] += u_extr[e_idof] * M_phi_velocity[i_dof][q];
                         }
                     }
                 }
-            }
 
-            // QUAD
-            for (  q = 0; q < NumQuadPoints ; q++ )
-            {
-                for ( d1 = 0; d1 < 3 ; d1++ )
+                // STABILIZZAZIONE - coefficienti Tau_M e Tau_C
+                for (  q = 0; q < NumQuadPoints ; q++ )
                 {
-                    uhq[d1][q] = 0.0;
-                    for ( i_dof = 0; i_dof <  ndof_velocity; i_dof++ )
-                    {
-                        e_idof =  M_elements_velocity[i_elem][i_dof] + d1*M_numScalarDofs  ;
-                        uhq[d1][q] += u_extr[e_idof] * M_phi_velocity[i_dof][q];
-                    }
+                    M_Tau_M[i_elem][q] = 1.0/std::sqrt(
+                                                       M_density*M_density*( uhq[0][q]*( M_G[i_elem][0][0]* uhq[0][q] +  M_G[i_elem][0][1] * uhq[1][q] + M_G[i_elem][0][2] * uhq[2][q] ) +
+                                                                             uhq[1][q]*( M_G[i_elem][1][0]* uhq[0][q] +  M_G[i_elem][1][1] * uhq[1][q] + M_G[i_elem][1][2] * uhq[2][q] ) +
+                                                                             uhq[2][q]*( M_G[i_elem][2][0]* uhq[0][q] +  M_G[i_elem][2][1] * uhq[1][q] + M_G[i_elem][2][2] * uhq[2][q]   )
+                                                                             ) 	// TAU_M_DEN_VEL
+                                                       +M_C_I*M_viscosity*M_viscosity*(
+                                                                                       M_G[i_elem][0][0]*M_G[i_elem][0][0] + M_G[i_elem][0][1]*M_G[i_elem][0][1] + M_G[i_elem][0][2]*M_G[i_elem][0][2] +
+                                                                                       M_G[i_elem][1][0]*M_G[i_elem][1][0] + M_G[i_elem][1][1]*M_G[i_elem][1][1] + M_G[i_elem][1][2]*M_G[i_elem][1][2] +
+                                                                                       M_G[i_elem][2][0]*M_G[i_elem][2][0] + M_G[i_elem][2][1]*M_G[i_elem][2][1] + M_G[i_elem][2][2]*M_G[i_elem][2][2]
+                                                                                       )  // TAU_M_DEN_VISC*/
+                                                       );
+
+                    M_Tau_C[i_elem][q] = 1.0/( M_g[i_elem][0]*M_Tau_M[i_elem][q]*M_g[i_elem][0] +
+                                              M_g[i_elem][1]*M_Tau_M[i_elem][q]*M_g[i_elem][1] +
+                                              M_g[i_elem][2]*M_Tau_M[i_elem][q]*M_g[i_elem][2]
+                                              );
+
+                    M_Tau_M_hat[i_elem][q] = 1.0/( M_alpha * M_density / M_timestep + 1.0/M_Tau_M[i_elem][q]);
                 }
-            }
-
-            // STABILIZZAZIONE - coefficienti Tau_M e Tau_C
-            for (  q = 0; q < NumQuadPoints ; q++ )
-            {
-                M_Tau_M[i_elem][q] = 1.0/std::sqrt(
-                                                   M_density*M_density*( uhq[0][q]*( M_G[i_elem][0][0]* uhq[0][q] +  M_G[i_elem][0][1] * uhq[1][q] + M_G[i_elem][0][2] * uhq[2][q] ) +
-                                                                         uhq[1][q]*( M_G[i_elem][1][0]* uhq[0][q] +  M_G[i_elem][1][1] * uhq[1][q] + M_G[i_elem][1][2] * uhq[2][q] ) +
-                                                                         uhq[2][q]*( M_G[i_elem][2][0]* uhq[0][q] +  M_G[i_elem][2][1] * uhq[1][q] + M_G[i_elem][2][2] * uhq[2][q]   )
-                                                                         ) 	// TAU_M_DEN_VEL
-                                                   +M_C_I*M_viscosity*M_viscosity*(
-                                                                                   M_G[i_elem][0][0]*M_G[i_elem][0][0] + M_G[i_elem][0][1]*M_G[i_elem][0][1] + M_G[i_elem][0][2]*M_G[i_elem][0][2] +
-                                                                                   M_G[i_elem][1][0]*M_G[i_elem][1][0] + M_G[i_elem][1][1]*M_G[i_elem][1][1] + M_G[i_elem][1][2]*M_G[i_elem][1][2] +
-                                                                                   M_G[i_elem][2][0]*M_G[i_elem][2][0] + M_G[i_elem][2][1]*M_G[i_elem][2][1] + M_G[i_elem][2][2]*M_G[i_elem][2][2]
-                                                                                   )  // TAU_M_DEN_VISC*/
-                                                   );
-
-                M_Tau_C[i_elem][q] = 1.0/( M_g[i_elem][0]*M_Tau_M[i_elem][q]*M_g[i_elem][0] +
-                                          M_g[i_elem][1]*M_Tau_M[i_elem][q]*M_g[i_elem][1] +
-                                          M_g[i_elem][2]*M_Tau_M[i_elem][q]*M_g[i_elem][2]
-                                          );
-
-                M_Tau_M_hat[i_elem][q] = 1.0/( M_alpha * M_density / M_timestep + 1.0/M_Tau_M[i_elem][q]);
-            }
 
-            // DOF - test
-            for ( i_test = 0; i_test <  ndof_velocity; i_test++ )
-            {
-                M_rows_velocity[i_elem][i_test] = M_elements_velocity[i_elem][i_test];
-
-                // DOF - trial
-                for ( i_trial = 0; i_trial <  ndof_velocity; i_trial++ )
+                // DOF - test
+                for ( i_test = 0; i_test <  ndof_velocity; i_test++ )
                 {
-                    M_cols_velocity[i_elem][i_trial] = M_elements_velocity[i_elem][i_trial];
-
-                    i_00 = 0.0; i_01 = 0.0; i_02 = 0.0; i_10 = 0.0; i_11 = 0.0; i_12 = 0.0; i_20 = 0.0; i_21 = 0.0; i_22 = 0.0;
-
-                    M_vals_supg[i_elem][0][0][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][0][1][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][0][2][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][1][0][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][1][1][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][1][2][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][2][0][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][2][1][i_test][i_trial] = 0.0;
-                    M_vals_supg[i_elem][2][2][i_test][i_trial] = 0.0;
-
-                    double tmp_supg = 0.0;
-                    double tmp_supg_test = 0.0;
-                    double tmp_supg_trial = 0.0;
+                    M_rows_velocity[i_chunk][i_test] = M_elements_velocity[i_elem][i_test];
 
-                    // QUAD
-                    for ( q = 0; q < NumQuadPoints ; q++ )
+                    // DOF - trial
+                    for ( i_trial = 0; i_trial <  ndof_velocity; i_trial++ )
                     {
-    tmp_supg = M_alpha * M_density * M_density / M_timestep * (
-    dphi_phys_velocity[i_test][q][0] * uhq[0][q] + dphi_phys_velocity[i_test][q][1] * uhq[1][q] + dphi_phys_velocity[i_test][q][2] * uhq[2][q]
-                                                               ) * M_phi_velocity[i_trial][q];
-
-    tmp_supg_test =
-    dphi_phys_velocity[i_test][q][0] * uhq[0][q] + dphi_phys_velocity[i_test][q][1] * uhq[1][q] + dphi_phys_velocity[i_test][q][2] * uhq[2][q];
-
-    tmp_supg_trial =
-    dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q];
-
-                        i_00 += ( M_Tau_M_hat[i_elem][q] * (
-    M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][0] * M_phi_velocity[i_trial][q] +
-    M_density * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][0] * (
-        dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                              )
-    // VMS
-    +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][0] * uhq[0][q] * M_phi_velocity[i_trial][q] )
-    +M_density * M_density * dphi_phys_velocity[i_test][q][0] * uhq[0][q] * (
-       dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                            )
-    // SUPG
-    +tmp_supg
-    +M_density * M_density * tmp_supg_test*tmp_supg_trial
-                        									)
-                                 + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][0]
-
-                                ) * w_quad[q];
-
-                        i_01 += ( M_Tau_M_hat[i_elem][q] * (
-    M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][0] * M_phi_velocity[i_trial][q] +
-    M_density * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][0] * (
-        dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                              )
-    // VMS
-    +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][1] * uhq[0][q] * M_phi_velocity[i_trial][q] )
-    +M_density * M_density * dphi_phys_velocity[i_test][q][1] * uhq[0][q] * (
-       dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                            )
-
-                                                            )
-                                 + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][1]
-                                 ) * w_quad[q];
-
-                        i_02 += ( M_Tau_M_hat[i_elem][q] * (
-    M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][0] * M_phi_velocity[i_trial][q] +
-    M_density * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][0] * (
-        dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                              )
+                        M_cols_velocity[i_chunk][i_trial] = M_elements_velocity[i_elem][i_trial];
 
-   // VMS
-   +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][2] * uhq[0][q] * M_phi_velocity[i_trial][q] )
-   +M_density * M_density * dphi_phys_velocity[i_test][q][2] * uhq[0][q] * (
-      dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                           )
-                                                         )
-                                 + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][2]
-                                 ) * w_quad[q];
-
-                        i_10 += ( M_Tau_M_hat[i_elem][q] * (
-    M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][1] * M_phi_velocity[i_trial][q] +
-    M_density * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][1] * (
-        dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                              )
-
-   // VMS
-   +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][0] * uhq[1][q] * M_phi_velocity[i_trial][q] )
-   +M_density * M_density * dphi_phys_velocity[i_test][q][0] * uhq[1][q] * (
-      dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                           )
-                                                            )
-                                 + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][0]
-                                                         ) * w_quad[q];
+                        i_00 = 0.0; i_01 = 0.0; i_02 = 0.0; i_10 = 0.0; i_11 = 0.0; i_12 = 0.0; i_20 = 0.0; i_21 = 0.0; i_22 = 0.0;
 
-                        i_11 += ( M_Tau_M_hat[i_elem][q] * (
-    M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][1] * M_phi_velocity[i_trial][q] +
-    M_density * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][1] * (
-        dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                              )
+                        M_vals_supg[i_chunk][0][0][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][0][1][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][0][2][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][1][0][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][1][1][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][1][2][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][2][0][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][2][1][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][2][2][i_test][i_trial] = 0.0;
 
-   // VMS
-   +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][1] * uhq[1][q] * M_phi_velocity[i_trial][q] )
-   +M_density * M_density * dphi_phys_velocity[i_test][q][1] * uhq[1][q] * (
-      dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                           )
-   // SUPG
-   +tmp_supg
-   +M_density * M_density * tmp_supg_test*tmp_supg_trial
-                                                          )
-                                 + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][1]
-                                                         ) * w_quad[q];
+                        double tmp_supg = 0.0;
+                        double tmp_supg_test = 0.0;
+                        double tmp_supg_trial = 0.0;
 
-                        i_12 += ( M_Tau_M_hat[i_elem][q] * (
-    M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][1] * M_phi_velocity[i_trial][q] +
-    M_density * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][1] * (
-        dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                              )
-   // VMS
-   +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][2] * uhq[1][q] * M_phi_velocity[i_trial][q] )
-   +M_density * M_density * dphi_phys_velocity[i_test][q][2] * uhq[1][q] * (
-      dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                           )
-                                                            )
-                                 + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][2]
-                                                         ) * w_quad[q];
-
-                        i_20 += ( M_Tau_M_hat[i_elem][q] * (
-    M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][2] * M_phi_velocity[i_trial][q] +
-    M_density * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][2] * (
-        dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                              )
-   // VMS
-   +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][0] * uhq[2][q] * M_phi_velocity[i_trial][q] )
-   +M_density * M_density * dphi_phys_velocity[i_test][q][0] * uhq[2][q] * (
-      dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                           )
-                                                            )
-                                 + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][0]
-                                                         ) * w_quad[q];
-
-                        i_21 += ( M_Tau_M_hat[i_elem][q] * (
-    M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][2] * M_phi_velocity[i_trial][q] +
-    M_density * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][2] * (
-        dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                              )
-  // VMS
-  +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][1] * uhq[2][q] * M_phi_velocity[i_trial][q] )
-  +M_density * M_density * dphi_phys_velocity[i_test][q][1] * uhq[2][q] * (
-     dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                          )
-                                                            )
-                                 + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][1]
-                                                         ) * w_quad[q];
+                        // QUAD
+                        for ( q = 0; q < NumQuadPoints ; q++ )
+                        {
+        tmp_supg = M_alpha * M_density * M_density / M_timestep * (
+        dphi_phys_velocity[i_test][q][0] * uhq[0][q] + dphi_phys_velocity[i_test][q][1] * uhq[1][q] + dphi_phys_velocity[i_test][q][2] * uhq[2][q]
+                                                                   ) * M_phi_velocity[i_trial][q];
+
+        tmp_supg_test =
+        dphi_phys_velocity[i_test][q][0] * uhq[0][q] + dphi_phys_velocity[i_test][q][1] * uhq[1][q] + dphi_phys_velocity[i_test][q][2] * uhq[2][q];
+
+        tmp_supg_trial =
+        dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q];
+
+                            i_00 += ( M_Tau_M_hat[i_elem][q] * (
+        M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][0] * M_phi_velocity[i_trial][q] +
+        M_density * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][0] * (
+            dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                                  )
+        // VMS
+        +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][0] * uhq[0][q] * M_phi_velocity[i_trial][q] )
+        +M_density * M_density * dphi_phys_velocity[i_test][q][0] * uhq[0][q] * (
+           dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                                )
+        // SUPG
+        +tmp_supg
+        +M_density * M_density * tmp_supg_test*tmp_supg_trial
+                            									)
+                                     + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][0]
+
+                                    ) * w_quad[q];
+
+                            i_01 += ( M_Tau_M_hat[i_elem][q] * (
+        M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][0] * M_phi_velocity[i_trial][q] +
+        M_density * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][0] * (
+            dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                                  )
+        // VMS
+        +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][1] * uhq[0][q] * M_phi_velocity[i_trial][q] )
+        +M_density * M_density * dphi_phys_velocity[i_test][q][1] * uhq[0][q] * (
+           dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                                )
 
-                        i_22 += ( M_Tau_M_hat[i_elem][q] * (
-    M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][2] * M_phi_velocity[i_trial][q] +
-    M_density * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][2] * (
-        dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                )
+                                     + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][1]
+                                     ) * w_quad[q];
+
+                            i_02 += ( M_Tau_M_hat[i_elem][q] * (
+        M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][0] * M_phi_velocity[i_trial][q] +
+        M_density * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][0] * (
+            dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                                  )
+
+       // VMS
+       +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][2] * uhq[0][q] * M_phi_velocity[i_trial][q] )
+       +M_density * M_density * dphi_phys_velocity[i_test][q][2] * uhq[0][q] * (
+          dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                               )
+                                                             )
+                                     + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][0] * dphi_phys_velocity[i_trial][q][2]
+                                     ) * w_quad[q];
+
+                            i_10 += ( M_Tau_M_hat[i_elem][q] * (
+        M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][1] * M_phi_velocity[i_trial][q] +
+        M_density * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][1] * (
+            dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                                  )
+
+       // VMS
+       +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][0] * uhq[1][q] * M_phi_velocity[i_trial][q] )
+       +M_density * M_density * dphi_phys_velocity[i_test][q][0] * uhq[1][q] * (
+          dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                               )
+                                                                )
+                                     + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][0]
+                                                             ) * w_quad[q];
+
+                            i_11 += ( M_Tau_M_hat[i_elem][q] * (
+        M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][1] * M_phi_velocity[i_trial][q] +
+        M_density * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][1] * (
+            dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                                  )
+
+       // VMS
+       +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][1] * uhq[1][q] * M_phi_velocity[i_trial][q] )
+       +M_density * M_density * dphi_phys_velocity[i_test][q][1] * uhq[1][q] * (
+          dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                               )
+       // SUPG
+       +tmp_supg
+       +M_density * M_density * tmp_supg_test*tmp_supg_trial
+                                                              )
+                                     + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][1]
+                                                             ) * w_quad[q];
+
+                            i_12 += ( M_Tau_M_hat[i_elem][q] * (
+        M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][1] * M_phi_velocity[i_trial][q] +
+        M_density * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][1] * (
+            dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                                  )
+       // VMS
+       +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][2] * uhq[1][q] * M_phi_velocity[i_trial][q] )
+       +M_density * M_density * dphi_phys_velocity[i_test][q][2] * uhq[1][q] * (
+          dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                               )
+                                                                )
+                                     + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][1] * dphi_phys_velocity[i_trial][q][2]
+                                                             ) * w_quad[q];
+
+                            i_20 += ( M_Tau_M_hat[i_elem][q] * (
+        M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][2] * M_phi_velocity[i_trial][q] +
+        M_density * dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][2] * (
+            dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                                  )
+       // VMS
+       +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][0] * uhq[2][q] * M_phi_velocity[i_trial][q] )
+       +M_density * M_density * dphi_phys_velocity[i_test][q][0] * uhq[2][q] * (
+          dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                               )
+                                                                )
+                                     + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][0]
+                                                             ) * w_quad[q];
+
+                            i_21 += ( M_Tau_M_hat[i_elem][q] * (
+        M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][2] * M_phi_velocity[i_trial][q] +
+        M_density * dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][2] * (
+            dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                                  )
+      // VMS
+      +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][1] * uhq[2][q] * M_phi_velocity[i_trial][q] )
+      +M_density * M_density * dphi_phys_velocity[i_test][q][1] * uhq[2][q] * (
+         dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
                                                                               )
-   // VMS
-   +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][2] * uhq[2][q] * M_phi_velocity[i_trial][q] )
-   +M_density * M_density * dphi_phys_velocity[i_test][q][2] * uhq[2][q] * (
-      dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                                           )
-   // SUPG
-   +tmp_supg
-   +M_density * M_density * tmp_supg_test*tmp_supg_trial
-                                                            )
-                                 + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][2]
-                                                         ) * w_quad[q];
-
-
-                    } // end quadrature
+                                                                )
+                                     + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][1]
+                                                             ) * w_quad[q];
+
+                            i_22 += ( M_Tau_M_hat[i_elem][q] * (
+        M_alpha * M_density * M_density / M_timestep * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][2] * M_phi_velocity[i_trial][q] +
+        M_density * dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][2] * (
+            dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                                  )
+       // VMS
+       +M_alpha * M_density * M_density / M_timestep * ( dphi_phys_velocity[i_test][q][2] * uhq[2][q] * M_phi_velocity[i_trial][q] )
+       +M_density * M_density * dphi_phys_velocity[i_test][q][2] * uhq[2][q] * (
+          dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                                               )
+       // SUPG
+       +tmp_supg
+       +M_density * M_density * tmp_supg_test*tmp_supg_trial
+                                                                )
+                                     + M_Tau_C[i_elem][q] * dphi_phys_velocity[i_test][q][2] * dphi_phys_velocity[i_trial][q][2]
+                                                             ) * w_quad[q];
 
-                    M_vals_supg[i_elem][0][0][i_test][i_trial] = (i_00 ) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][0][1][i_test][i_trial] = (i_01 ) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][0][2][i_test][i_trial] = (i_02 ) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][1][0][i_test][i_trial] = (i_10 ) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][1][1][i_test][i_trial] = (i_11 ) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][1][2][i_test][i_trial] = (i_12 ) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][2][0][i_test][i_trial] = (i_20 ) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][2][1][i_test][i_trial] = (i_21 ) *  M_detJacobian[i_elem];
-                    M_vals_supg[i_elem][2][2][i_test][i_trial] = (i_22 ) *  M_detJacobian[i_elem];
 
-                } // end trial
+                        } // end quadrature
 
-                for ( i_trial = 0; i_trial <  ndof_pressure; i_trial++ )
-                {
-                    M_cols_pressure[i_elem][i_trial] = M_elements_pressure[i_elem][i_trial];
-                    M_vals_supg_01[i_elem][0][i_test][i_trial] = 0.0;
-                    M_vals_supg_01[i_elem][1][i_test][i_trial] = 0.0;
-                    M_vals_supg_01[i_elem][2][i_test][i_trial] = 0.0;
+                        M_vals_supg[i_chunk][0][0][i_test][i_trial] = (i_00 ) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][0][1][i_test][i_trial] = (i_01 ) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][0][2][i_test][i_trial] = (i_02 ) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][1][0][i_test][i_trial] = (i_10 ) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][1][1][i_test][i_trial] = (i_11 ) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][1][2][i_test][i_trial] = (i_12 ) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][2][0][i_test][i_trial] = (i_20 ) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][2][1][i_test][i_trial] = (i_21 ) *  M_detJacobian[i_elem];
+                        M_vals_supg[i_chunk][2][2][i_test][i_trial] = (i_22 ) *  M_detJacobian[i_elem];
 
-                    i_00 = 0.0;
-                    i_10 = 0.0;
-                    i_20 = 0.0;
+                    } // end trial
 
-                    // QUAD
-                    for ( q = 0; q < NumQuadPoints ; q++ )
+                    for ( i_trial = 0; i_trial <  ndof_pressure; i_trial++ )
                     {
-                        i_00 += M_Tau_M_hat[i_elem][q] * (
-                                dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][0] * dphi_phys_pressure[i_trial][q][0]
-                               +dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][0] * dphi_phys_pressure[i_trial][q][1]
-                               +dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][0] * dphi_phys_pressure[i_trial][q][2]
-                               +M_density * (
-    (dphi_phys_velocity[i_test][q][0] * uhq[0][q] + dphi_phys_velocity[i_test][q][1] * uhq[1][q] + dphi_phys_velocity[i_test][q][2] * uhq[2][q])
-    * dphi_phys_pressure[i_trial][q][0]
-    + dphi_phys_velocity[i_test][q][0] * uhq[0][q] * dphi_phys_pressure[i_trial][q][0]
-    + dphi_phys_velocity[i_test][q][1] * uhq[0][q] * dphi_phys_pressure[i_trial][q][1]
-    + dphi_phys_velocity[i_test][q][2] * uhq[0][q] * dphi_phys_pressure[i_trial][q][2]
-                                             )
-                                                          ) * w_quad[q];
+                        M_cols_pressure[i_chunk][i_trial] = M_elements_pressure[i_elem][i_trial];
+                        M_vals_supg_01[i_chunk][0][i_test][i_trial] = 0.0;
+                        M_vals_supg_01[i_chunk][1][i_test][i_trial] = 0.0;
+                        M_vals_supg_01[i_chunk][2][i_test][i_trial] = 0.0;
 
-                        i_10 += M_Tau_M_hat[i_elem][q] * (
-                                dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][1] * dphi_phys_pressure[i_trial][q][0]
-                               +dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][1] * dphi_phys_pressure[i_trial][q][1]
-                               +dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][1] * dphi_phys_pressure[i_trial][q][2]
-                               +M_density * (
-    (dphi_phys_velocity[i_test][q][0] * uhq[0][q] + dphi_phys_velocity[i_test][q][1] * uhq[1][q] + dphi_phys_velocity[i_test][q][2] * uhq[2][q])
-    * dphi_phys_pressure[i_trial][q][1]
-    + dphi_phys_velocity[i_test][q][0] * uhq[1][q] * dphi_phys_pressure[i_trial][q][0]
-    + dphi_phys_velocity[i_test][q][1] * uhq[1][q] * dphi_phys_pressure[i_trial][q][1]
-    + dphi_phys_velocity[i_test][q][2] * uhq[1][q] * dphi_phys_pressure[i_trial][q][2]
-                                             )
-                                                          ) * w_quad[q];
+                        i_00 = 0.0;
+                        i_10 = 0.0;
+                        i_20 = 0.0;
 
-                        i_20 += M_Tau_M_hat[i_elem][q] * (
-                                dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][2] * dphi_phys_pressure[i_trial][q][0]
-                               +dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][2] * dphi_phys_pressure[i_trial][q][1]
-                               +dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][2] * dphi_phys_pressure[i_trial][q][2]
-                               +M_density * (
-    (dphi_phys_velocity[i_test][q][0] * uhq[0][q] + dphi_phys_velocity[i_test][q][1] * uhq[1][q] + dphi_phys_velocity[i_test][q][2] * uhq[2][q])
-    * dphi_phys_pressure[i_trial][q][2]
-    + dphi_phys_velocity[i_test][q][0] * uhq[2][q] * dphi_phys_pressure[i_trial][q][0]
-    + dphi_phys_velocity[i_test][q][1] * uhq[2][q] * dphi_phys_pressure[i_trial][q][1]
-    + dphi_phys_velocity[i_test][q][2] * uhq[2][q] * dphi_phys_pressure[i_trial][q][2]
-                                             )
-                                                          ) * w_quad[q];
-                    }
-
-                    M_vals_supg_01[i_elem][0][i_test][i_trial] = i_00 * M_detJacobian[i_elem];
-                    M_vals_supg_01[i_elem][1][i_test][i_trial] = i_10 * M_detJacobian[i_elem];
-                    M_vals_supg_01[i_elem][2][i_test][i_trial] = i_20 * M_detJacobian[i_elem];
+                        // QUAD
+                        for ( q = 0; q < NumQuadPoints ; q++ )
+                        {
+                            i_00 += M_Tau_M_hat[i_elem][q] * (
+                                    dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][0] * dphi_phys_pressure[i_trial][q][0]
+                                   +dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][0] * dphi_phys_pressure[i_trial][q][1]
+                                   +dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][0] * dphi_phys_pressure[i_trial][q][2]
+                                   +M_density * (
+        (dphi_phys_velocity[i_test][q][0] * uhq[0][q] + dphi_phys_velocity[i_test][q][1] * uhq[1][q] + dphi_phys_velocity[i_test][q][2] * uhq[2][q])
+        * dphi_phys_pressure[i_trial][q][0]
+        + dphi_phys_velocity[i_test][q][0] * uhq[0][q] * dphi_phys_pressure[i_trial][q][0]
+        + dphi_phys_velocity[i_test][q][1] * uhq[0][q] * dphi_phys_pressure[i_trial][q][1]
+        + dphi_phys_velocity[i_test][q][2] * uhq[0][q] * dphi_phys_pressure[i_trial][q][2]
+                                                 )
+                                                              ) * w_quad[q];
+
+                            i_10 += M_Tau_M_hat[i_elem][q] * (
+                                    dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][1] * dphi_phys_pressure[i_trial][q][0]
+                                   +dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][1] * dphi_phys_pressure[i_trial][q][1]
+                                   +dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][1] * dphi_phys_pressure[i_trial][q][2]
+                                   +M_density * (
+        (dphi_phys_velocity[i_test][q][0] * uhq[0][q] + dphi_phys_velocity[i_test][q][1] * uhq[1][q] + dphi_phys_velocity[i_test][q][2] * uhq[2][q])
+        * dphi_phys_pressure[i_trial][q][1]
+        + dphi_phys_velocity[i_test][q][0] * uhq[1][q] * dphi_phys_pressure[i_trial][q][0]
+        + dphi_phys_velocity[i_test][q][1] * uhq[1][q] * dphi_phys_pressure[i_trial][q][1]
+        + dphi_phys_velocity[i_test][q][2] * uhq[1][q] * dphi_phys_pressure[i_trial][q][2]
+                                                 )
+                                                              ) * w_quad[q];
+
+                            i_20 += M_Tau_M_hat[i_elem][q] * (
+                                    dphi_phys_velocity[i_test][q][0] * fine_scale[i_elem][q][2] * dphi_phys_pressure[i_trial][q][0]
+                                   +dphi_phys_velocity[i_test][q][1] * fine_scale[i_elem][q][2] * dphi_phys_pressure[i_trial][q][1]
+                                   +dphi_phys_velocity[i_test][q][2] * fine_scale[i_elem][q][2] * dphi_phys_pressure[i_trial][q][2]
+                                   +M_density * (
+        (dphi_phys_velocity[i_test][q][0] * uhq[0][q] + dphi_phys_velocity[i_test][q][1] * uhq[1][q] + dphi_phys_velocity[i_test][q][2] * uhq[2][q])
+        * dphi_phys_pressure[i_trial][q][2]
+        + dphi_phys_velocity[i_test][q][0] * uhq[2][q] * dphi_phys_pressure[i_trial][q][0]
+        + dphi_phys_velocity[i_test][q][1] * uhq[2][q] * dphi_phys_pressure[i_trial][q][1]
+        + dphi_phys_velocity[i_test][q][2] * uhq[2][q] * dphi_phys_pressure[i_trial][q][2]
+                                                 )
+                                                              ) * w_quad[q];
+                        }
 
-                }
+                        M_vals_supg_01[i_chunk][0][i_test][i_trial] = i_00 * M_detJacobian[i_elem];
+                        M_vals_supg_01[i_chunk][1][i_test][i_trial] = i_10 * M_detJacobian[i_elem];
+                        M_vals_supg_01[i_chunk][2][i_test][i_trial] = i_20 * M_detJacobian[i_elem];
 
-            } // end dof test
+                    }
 
-            // DOF - test - assemblo blocchi (1,0) e (1,1)
-            for ( i_test = 0; i_test <  ndof_pressure; i_test++ )
-            {
-                M_rows_pressure[i_elem][i_test] = M_elements_pressure[i_elem][i_test];
+                } // end dof test
 
-                // DOF - trial
-                for ( i_trial = 0; i_trial <  ndof_pressure; i_trial++ )
+                // DOF - test - assemblo blocchi (1,0) e (1,1)
+                for ( i_test = 0; i_test <  ndof_pressure; i_test++ )
                 {
-                    M_vals_11[i_elem][i_test][i_trial] = 0.0;
+                    M_rows_pressure[i_chunk][i_test] = M_elements_pressure[i_elem][i_test];
 
-                    integral = 0.0;
-                    // QUAD
-                    for ( q = 0; q < NumQuadPoints ; q++ )
+                    // DOF - trial
+                    for ( i_trial = 0; i_trial <  ndof_pressure; i_trial++ )
                     {
-                        // DIM 1
-                        for ( d1 = 0; d1 < 3 ; d1++ )
+                        M_vals_11[i_chunk][i_test][i_trial] = 0.0;
+
+                        integral = 0.0;
+                        // QUAD
+                        for ( q = 0; q < NumQuadPoints ; q++ )
                         {
-                            integral += M_Tau_M_hat[i_elem][q] * dphi_phys_pressure[i_test][q][d1] * dphi_phys_pressure[i_trial][q][d1]*w_quad[q];
+                            // DIM 1
+                            for ( d1 = 0; d1 < 3 ; d1++ )
+                            {
+                                integral += M_Tau_M_hat[i_elem][q] * dphi_phys_pressure[i_test][q][d1] * dphi_phys_pressure[i_trial][q][d1]*w_quad[q];
+                            }
                         }
+                        M_vals_11[i_chunk][i_test][i_trial] = integral * M_detJacobian[i_elem];
                     }
-                    M_vals_11[i_elem][i_test][i_trial] = integral * M_detJacobian[i_elem];
                 }
-            }
 
-            // DOF - test
-            for ( i_test = 0; i_test <  ndof_pressure; i_test++ )
-            {
-                // DOF - trial
-                for ( i_trial = 0; i_trial < ndof_velocity; i_trial++ )
+                // DOF - test
+                for ( i_test = 0; i_test <  ndof_pressure; i_test++ )
                 {
-                    i_00 = 0.0;
-                    i_01 = 0.0;
-                    i_02 = 0.0;
-
-                    // QUAD
-                    for ( q = 0; q < NumQuadPoints ; q++ )
+                    // DOF - trial
+                    for ( i_trial = 0; i_trial < ndof_velocity; i_trial++ )
                     {
-                        i_00 += M_Tau_M_hat[i_elem][q] * (
-         M_density * M_alpha / M_timestep * dphi_phys_pressure[i_test][q][0] * M_phi_velocity[i_trial][q]
-        +M_density * dphi_phys_pressure[i_test][q][0] * (
-          dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                        )
+                        i_00 = 0.0;
+                        i_01 = 0.0;
+                        i_02 = 0.0;
 
-                                                         ) * w_quad[q];
+                        // QUAD
+                        for ( q = 0; q < NumQuadPoints ; q++ )
+                        {
+                            i_00 += M_Tau_M_hat[i_elem][q] * (
+             M_density * M_alpha / M_timestep * dphi_phys_pressure[i_test][q][0] * M_phi_velocity[i_trial][q]
+            +M_density * dphi_phys_pressure[i_test][q][0] * (
+              dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                            )
 
-                        i_01 += M_Tau_M_hat[i_elem][q] * (
-         M_density * M_alpha / M_timestep * dphi_phys_pressure[i_test][q][1] * M_phi_velocity[i_trial][q]
-        +M_density * dphi_phys_pressure[i_test][q][1] * (
-          dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                        )
+                                                             ) * w_quad[q];
 
-                                                         ) * w_quad[q];
+                            i_01 += M_Tau_M_hat[i_elem][q] * (
+             M_density * M_alpha / M_timestep * dphi_phys_pressure[i_test][q][1] * M_phi_velocity[i_trial][q]
+            +M_density * dphi_phys_pressure[i_test][q][1] * (
+              dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                            )
 
-                        i_02 += M_Tau_M_hat[i_elem][q] * (
-         M_density * M_alpha / M_timestep * dphi_phys_pressure[i_test][q][2] * M_phi_velocity[i_trial][q]
-        +M_density * dphi_phys_pressure[i_test][q][2] * (
-          dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
-                                                        )
-                                                         ) * w_quad[q];
-                    }
+                                                             ) * w_quad[q];
 
-                    M_vals_supg_10[i_elem][0][i_test][i_trial] = i_00 * M_detJacobian[i_elem];
-                    M_vals_supg_10[i_elem][1][i_test][i_trial] = i_01 * M_detJacobian[i_elem];
-                    M_vals_supg_10[i_elem][2][i_test][i_trial] = i_02 * M_detJacobian[i_elem];
+                            i_02 += M_Tau_M_hat[i_elem][q] * (
+             M_density * M_alpha / M_timestep * dphi_phys_pressure[i_test][q][2] * M_phi_velocity[i_trial][q]
+            +M_density * dphi_phys_pressure[i_test][q][2] * (
+              dphi_phys_velocity[i_trial][q][0] * uhq[0][q] + dphi_phys_velocity[i_trial][q][1] * uhq[1][q] + dphi_phys_velocity[i_trial][q][2] * uhq[2][q]
+                                                            )
+                                                             ) * w_quad[q];
+                        }
+
+                        M_vals_supg_10[i_chunk][0][i_test][i_trial] = i_00 * M_detJacobian[i_elem];
+                        M_vals_supg_10[i_chunk][1][i_test][i_trial] = i_01 * M_detJacobian[i_elem];
+                        M_vals_supg_10[i_chunk][2][i_test][i_trial] = i_02 * M_detJacobian[i_elem];
+                    }
                 }
-            }
 
+            }
         }
-    }
 
-    for ( UInt d1 = 0; d1 < 3 ; d1++ ) // row index
-    {
-        for ( int k = 0; k < M_numElements; ++k )
+        for ( UInt d1 = 0; d1 < 3 ; d1++ ) // row index
         {
-            for ( UInt i = 0; i <  ndof_velocity; i++ )
+            for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
             {
-                M_rows_tmp[k][i] = M_rows_velocity[k][i] + d1 * M_numScalarDofs;
+                for ( UInt i = 0; i <  ndof_velocity; i++ )
+                {
+                    M_rows_tmp[k][i] = M_rows_velocity[k][i] + d1 * M_numScalarDofs;
+                }
+                addToMatrix ( block00, ndof_velocity, M_rows_tmp[k],
+                              ndof_velocity, M_cols_velocity[k],
+                              M_vals_supg[k][d1][0] );
+
+                addToMatrix ( block01, ndof_velocity, M_rows_tmp[k],
+                              ndof_pressure, M_cols_pressure[k],
+                              M_vals_supg_01[k][d1] );
             }
-            block00->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k],
-                                                       ndof_velocity, M_cols_velocity[k],
-                                                       M_vals_supg[k][d1][0],
-                                                       Epetra_FECrsMatrix::ROW_MAJOR);
-
-            block01->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k],
-                                                       ndof_pressure, M_cols_pressure[k],
-                                                       M_vals_supg_01[k][d1],
-                                                       Epetra_FECrsMatrix::ROW_MAJOR);
-        }
 
-        for ( int k = 0; k < M_numElements; ++k )
-        {
-            for ( UInt i = 0; i <  ndof_velocity; i++ )
+            for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
             {
-                M_cols_tmp[k][i] = M_cols_velocity[k][i] + M_numScalarDofs;
+                for ( UInt i = 0; i <  ndof_velocity; i++ )
+                {
+                    M_cols_tmp[k][i] = M_cols_velocity[k][i] + M_numScalarDofs;
+                }
+                addToMatrix ( block00, ndof_velocity, M_rows_tmp[k],
+                              ndof_velocity, M_cols_tmp[k],
+                              M_vals_supg[k][d1][1] );
             }
-            block00->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k],
-                                                       ndof_velocity, M_cols_tmp[k],
-                                                       M_vals_supg[k][d1][1],
-                                                       Epetra_FECrsMatrix::ROW_MAJOR);
-        }
 
-        for ( int k = 0; k < M_numElements; ++k )
-        {
-            for ( UInt i = 0; i <  ndof_velocity; i++ )
+            for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
             {
-                M_cols_tmp[k][i] = M_cols_velocity[k][i] + 2 * M_numScalarDofs;
+                for ( UInt i = 0; i <  ndof_velocity; i++ )
+                {
+                    M_cols_tmp[k][i] = M_cols_velocity[k][i] + 2 * M_numScalarDofs;
+                }
+                addToMatrix ( block00, ndof_velocity, M_rows_tmp[k],
+                              ndof_velocity, M_cols_tmp[k],
+                              M_vals_supg[k][d1][2] );
             }
-            block00->matrixPtr()->InsertGlobalValues ( ndof_velocity, M_rows_tmp[k],
-                                                       ndof_velocity, M_cols_tmp[k],
-                                                       M_vals_supg[k][d1][2],
-                                                       Epetra_FECrsMatrix::ROW_MAJOR);
         }
-    }
 
-    for ( int k = 0; k < M_numElements; ++k )
-    {
-        block11->matrixPtr()->InsertGlobalValues ( ndof_pressure, M_rows_pressure[k], ndof_pressure, M_cols_pressure[k], M_vals_11[k], Epetra_FECrsMatrix::ROW_MAJOR);
-    }
+        for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
+        {
+            addToMatrix ( block11, ndof_pressure, M_rows_pressure[k], ndof_pressure, M_cols_pressure[k], M_vals_11[k] );
+        }
 
-    for ( UInt d1 = 0; d1 < 3 ; d1++ )
-    {
-        for ( int k = 0; k < M_numElements; ++k )
+        for ( UInt d1 = 0; d1 < 3 ; d1++ )
         {
-            for ( UInt i = 0; i <  ndof_velocity; i++ )
+            for ( int k = 0; k < chunkEnd - chunkBegin; ++k )
             {
-                M_cols_tmp[k][i] = M_cols_velocity[k][i] + d1 * M_numScalarDofs;
+                for ( UInt i = 0; i <  ndof_velocity; i++ )
+                {
+                    M_cols_tmp[k][i] = M_cols_velocity[k][i] + d1 * M_numScalarDofs;
+                }
+                addToMatrix ( block10, ndof_pressure, M_rows_pressure[k], ndof_velocity, M_cols_tmp[k], M_vals_supg_10[k][d1] );
             }
-            block10->matrixPtr()->InsertGlobalValues ( ndof_pressure, M_rows_pressure[k], ndof_velocity, M_cols_tmp[k], M_vals_supg_10[k][d1], Epetra_FECrsMatrix::ROW_MAJOR);
         }
     }
 }
@@ -131,9 +131,14 @@ public:
 
 	//! Allocate space for members before the assembly
 	/*!
+	 * The element matrices are computed and added to the global matrices by chunks
+	 * of elements, so that the memory used for the element matrices is bounded by the
+	 * size of a chunk instead of the number of elements of the mesh.
 	 * @param current_fe_velocity - current FE space velocity
+	 * @param use_supg - allocate the space for the stabilization terms
+	 * @param chunkSize - number of elements per chunk, all the elements in a single chunk if 0
 	 */
-	void allocateSpace( CurrentFE* current_fe_velocity, const bool& use_supg );
+	void allocateSpace( CurrentFE* current_fe_velocity, const bool& use_supg, const int& chunkSize = 0 );
 
     //! Assemble constant terms NS
     /*!
@@ -244,10 +249,15 @@ public:
 
 private:
 
+	//! Add element contributions to a matrix: SumInto if the matrix is already filled, Insert otherwise
+	static void addToMatrix ( matrixPtr_Type& matrix, const int& numRows, const int* rows,
+	                          const int& numCols, const int* cols, const double* const* values );
+
 	meshPtr_Type M_mesh;
 	commPtr_Type M_comm;
 
 	int M_numElements;
+	int M_chunkSize; // number of elements in the element stores (M_vals_*, M_rows_*, M_cols_*)
 	int M_numScalarDofs;
 
 	double * M_detJacobian;
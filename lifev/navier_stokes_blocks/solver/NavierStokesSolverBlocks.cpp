@@ -147,7 +147,7 @@ void NavierStokesSolverBlocks::setup(const meshPtr_Type& mesh, const int& id_dom
     												 &(M_velocityFESpace->refFE()), &(M_pressureFESpace->refFE()),
     												 M_velocityFESpace, M_pressureFESpace,
     												 &(M_velocityFESpace->qr()) ) );
-    	M_fastAssembler->allocateSpace ( &(M_velocityFESpace->fe()), true );
+    	M_fastAssembler->allocateSpace ( &(M_velocityFESpace->fe()), true, M_dataFile ( "fluid/fast_assembly_chunk_size", 0 ) );
     }
 
 
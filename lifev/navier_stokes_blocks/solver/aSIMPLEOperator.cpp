@@ -91,6 +91,13 @@ void aSIMPLEOperator::setOptions(const Teuchos::ParameterList& solversOptions)
     std::shared_ptr<Teuchos::ParameterList> momentumOptions;
     momentumOptions.reset(new Teuchos::ParameterList(solversOptions.sublist("MomentumOperator")) );
     setMomentumOptions(momentumOptions);
+
+    if ( solversOptions.isParameter("Schur complement threads") )
+    {
+        OpenMPParameters ompParams;
+        ompParams.numThreads = solversOptions.get<int>("Schur complement threads");
+        M_schurComplementProduct.setOpenMPParameters(ompParams);
+    }
 }
 
 void aSIMPLEOperator::setMomentumOptions(const parameterListPtr_Type & _oList)
@@ -133,21 +140,17 @@ void aSIMPLEOperator::buildShurComplement( )
     // computing diag(F)^{-1}
     M_invD->Reciprocal(diag);
 
-    // computing diag(F)^{-1}*M_Btranspose
-    matrixEpetra_Type FBT (*M_Btranspose);
-    FBT.matrixPtr()->LeftScale(*M_invD);
-
-    M_schurComplement.reset ( new matrixEpetra_Type ( M_B->map() ) );
-
-    // computing M_B*(diag(F)^{-1}*M_Btranspose)
-    M_B->multiply (false, FBT, false, *M_schurComplement, false);
+    // computing M_B*diag(F)^{-1}*M_Btranspose (- M_D), only the values are computed after the first call.
+    // M_schurComplement is the matrix of M_schurComplementProduct, overwritten in place by each call:
+    // the Schur complement operator is recomputed right after, in updateApproximatedSchurComplementOperator.
     if ( M_useStabilization )
     {
-    	*M_D *= -1.0;
-    	*M_schurComplement += *M_D;
+        M_schurComplement = M_schurComplementProduct.multiply ( *M_B, M_invD.get(), *M_Btranspose, M_D.get(), -1.0 );
+    }
+    else
+    {
+        M_schurComplement = M_schurComplementProduct.multiply ( *M_B, M_invD.get(), *M_Btranspose );
     }
-
-    M_schurComplement->globalAssemble();
 
     M_DBT.reset ( new matrixEpetra_Type( *M_Btranspose ) );
     M_DBT->matrixPtr()->LeftScale(*M_invD);
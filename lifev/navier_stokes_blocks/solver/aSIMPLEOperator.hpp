@@ -42,6 +42,7 @@
 #include <lifev/navier_stokes_blocks/solver/NavierStokesPreconditionerOperator.hpp>
 
 #include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/MatrixEpetraProduct.hpp>
 #include <lifev/core/linear_algebra/ApproximatedInvertibleRowMatrix.hpp>
 #include <Teuchos_ParameterList.hpp>
 #include <Teuchos_XMLParameterListHelpers.hpp>
@@ -192,6 +193,10 @@ public:
     void showMe();
 
     //! Return the list of options being used
+    /*!
+     *  The optional parameter "Schur complement threads" sets the number of OpenMP threads
+     *  used to compute the values of the approximated Schur complement.
+     */
     void setOptions(const Teuchos::ParameterList& solversOptions);
 
     //! Return the block(0,0)
@@ -225,8 +230,12 @@ private:
 
     matrixEpetraPtr_Type M_D;
 
+    //! Matrix of M_schurComplementProduct, overwritten in place by each buildShurComplement
     matrixEpetraPtr_Type M_schurComplement;
 
+    //! Product B*diag(F)^-1*Btranspose - D, its pattern is computed only once
+    MatrixEpetraProduct M_schurComplementProduct;
+
     //! Communicator
     commPtr_Type M_comm;
 
@@ -77,10 +77,11 @@ OneDFSISolver::OneDFSISolver() :
     M_dSdUVector                   (),
     M_homogeneousMassMatrixPtr     (),
     M_homogeneousGradientMatrixPtr (),
-    M_dSdUMassMatrixPtr            (),
-    M_dFdUStiffnessMatrixPtr       (),
-    M_dFdUGradientMatrixPtr        (),
-    M_dSdUDivergenceMatrixPtr      (),
+    M_elementalDOF                 (),
+    M_unitaryMassMatrices          (),
+    M_unitaryStiffnessMatrices     (),
+    M_unitaryGradientMatrices      (),
+    M_unitaryDivergenceMatrices    (),
     M_linearSolverPtr              (),
     M_linearViscoelasticSolverPtr  ()
 {
@@ -95,13 +96,8 @@ OneDFSISolver::buildConstantMatrices()
     std::fill ( M_dFdUVector.begin(), M_dFdUVector.end(), ublas::zero_vector<Real> ( M_physicsPtr->data()->numberOfNodes() ) );
     std::fill ( M_dSdUVector.begin(), M_dSdUVector.end(), ublas::zero_vector<Real> ( M_physicsPtr->data()->numberOfNodes() ) );
 
-    for ( UInt i (0); i < 4; ++i )
-    {
-        M_dSdUMassMatrixPtr[i].reset ( new matrix_Type ( M_feSpacePtr->map() ) );
-        M_dFdUStiffnessMatrixPtr[i].reset ( new matrix_Type ( M_feSpacePtr->map() ) );
-        M_dFdUGradientMatrixPtr[i].reset ( new matrix_Type ( M_feSpacePtr->map() ) );
-        M_dSdUDivergenceMatrixPtr[i].reset ( new matrix_Type ( M_feSpacePtr->map() ) );
-    }
+    // Elemental matrices with unitary coefficients (used to assemble the non-linear terms)
+    buildElementalMatrices();
 
     // Elementary computation and matrix assembling
     for ( UInt iElement (0); iElement < M_physicsPtr->data()->numberOfElements(); ++iElement )
@@ -245,7 +241,6 @@ OneDFSISolver::updateRHS ( const solution_Type& solution, const Real& timeStep )
 {
     updatedFdU ( solution ); // Update the vector containing the values of the flux at the nodes and its jacobian
     updatedSdU ( solution ); // Update the vector containing the values of the source term at the nodes and its jacobian
-    updateMatrices();       // Update the matrices for the non-linear terms
 
     // Taylor-Galerkin scheme: (explicit, U = [U1,U2]^T, with U1=A, U2=Q )
     // (Un+1, phi) =          (               Un,     phi     )-> massFactor^{-1} * Un+1 = mass * U
@@ -258,9 +253,10 @@ OneDFSISolver::updateRHS ( const solution_Type& solution, const Real& timeStep )
 
     Real dt2over2 = timeStep * timeStep * 0.5;
 
-    // Initialize residual to 0
-    *M_residual[0] *= 0;
-    *M_residual[1] *= 0;
+    // Initialize residual with the second order (non-linear) terms:
+    // rhs = rhs - dt^2/2 * gradDiffFlux * S(Un) + dt^2/2 * divDiffSrc * F(Un)
+    //           - dt^2/2 * stiffDiffFlux * F(Un) + dt^2/2 * massDiffSrc * S(Un)
+    updateNonLinearResidual ( dt2over2 );
 
     for ( UInt i (0); i < 2; ++i )
     {
@@ -269,25 +265,6 @@ OneDFSISolver::updateRHS ( const solution_Type& solution, const Real& timeStep )
 
         // rhs = rhs - dt * mass * S(Un)
         *M_residual[i] += ( *M_homogeneousMassMatrixPtr ) * ( - timeStep * *M_sourceVector[i] );
-
-        for ( UInt j (0); j < 2; ++j )
-        {
-            // rhs = rhs - dt^2/2 * gradDiffFlux * S(Un)
-            M_dFdUGradientMatrixPtr[2 * i + j]->globalAssemble();
-            *M_residual[i] += *M_dFdUGradientMatrixPtr[2 * i + j] * ( -dt2over2 * *M_sourceVector[j] );
-
-            // rhs = rhs + dt^2/2 * divDiffSrc * F(Un)
-            M_dSdUDivergenceMatrixPtr[2 * i + j]->globalAssemble();
-            *M_residual[i] += *M_dSdUDivergenceMatrixPtr[2 * i + j] * ( dt2over2 * *M_fluxVector[j] );
-
-            // rhs = rhs - dt^2/2 * stiffDiffFlux * F(Un)
-            M_dFdUStiffnessMatrixPtr[2 * i + j]->globalAssemble();
-            *M_residual[i] += *M_dFdUStiffnessMatrixPtr[2 * i + j] * ( -dt2over2 * *M_fluxVector[j] );
-
-            // rhs = rhs + dt^2/2 * massDiffSrc * S(Un)
-            M_dSdUMassMatrixPtr[2 * i + j]->globalAssemble();
-            *M_residual[i] += *M_dSdUMassMatrixPtr[2 * i + j] * ( dt2over2 * *M_sourceVector[j] );
-        }
     }
 
     // rhs = mass * Un + residual
@@ -733,102 +710,121 @@ OneDFSISolver::updatedSdU ( const solution_Type& solution )
 }
 
 void
-OneDFSISolver::updateMatrices()
+OneDFSISolver::buildElementalMatrices()
 {
-    // Matrices initialization
-    for ( UInt i (0); i < 4; ++i )
-    {
-        M_dSdUMassMatrixPtr[i].reset ( new matrix_Type ( M_feSpacePtr->map() ) );
-        M_dFdUStiffnessMatrixPtr[i].reset ( new matrix_Type ( M_feSpacePtr->map() ) );
-        M_dFdUGradientMatrixPtr[i].reset ( new matrix_Type ( M_feSpacePtr->map() ) );
-        M_dSdUDivergenceMatrixPtr[i].reset ( new matrix_Type ( M_feSpacePtr->map() ) );
-    }
+    const UInt numberOfElements ( M_physicsPtr->data()->numberOfElements() );
+    const UInt nbFEDof ( M_feSpacePtr->fe().nbFEDof() );
+    const UInt elementalMatrixSize ( nbFEDof * nbFEDof );
 
-    // Elementary computation and matrix assembling
-    for ( UInt iElement (0); iElement < M_physicsPtr->data()->numberOfElements(); ++iElement )
+    M_elementalDOF.resize ( numberOfElements * nbFEDof );
+    M_unitaryMassMatrices.resize ( numberOfElements * elementalMatrixSize );
+    M_unitaryStiffnessMatrices.resize ( numberOfElements * elementalMatrixSize );
+    M_unitaryGradientMatrices.resize ( numberOfElements * elementalMatrixSize );
+    M_unitaryDivergenceMatrices.resize ( numberOfElements * elementalMatrixSize );
+
+    for ( UInt iElement (0); iElement < numberOfElements; ++iElement )
     {
         // Update the current element
-        M_feSpacePtr->fe().update ( M_feSpacePtr->mesh()->edgeList ( iElement), UPDATE_DPHI | UPDATE_WDET );
+        M_feSpacePtr->fe().update ( M_feSpacePtr->mesh()->edgeList ( iElement ), UPDATE_DPHI | UPDATE_WDET );
+
+        // Set the elementary matrices to 0.
+        M_elementalMassMatrixPtr->zero();
+        M_elementalStiffnessMatrixPtr->zero();
+        M_elementalGradientMatrixPtr->zero();
+        M_elementalDivergenceMatrixPtr->zero();
 
-        for ( UInt ii (0); ii < 2; ++ii )
+        // The operators are linear with respect to the coefficient: the P0 coefficients are applied later
+        AssemblyElemental::mass ( 1, *M_elementalMassMatrixPtr, M_feSpacePtr->fe(), 0, 0 );
+        AssemblyElemental::stiff ( 1, *M_elementalStiffnessMatrixPtr, M_feSpacePtr->fe(), 0 , 0 );
+        AssemblyElemental::grad ( 0, 1, *M_elementalGradientMatrixPtr, M_feSpacePtr->fe(), M_feSpacePtr->fe(), 0, 0 );
+        AssemblyElemental::div ( 0, 1, *M_elementalDivergenceMatrixPtr, M_feSpacePtr->fe(), M_feSpacePtr->fe(), 0, 0 );
+
+        // Store the elemental matrices and the global DOF of the element in contiguous arrays
+        for ( UInt iDof (0); iDof < nbFEDof; ++iDof )
         {
-            for ( UInt jj (0); jj < 2; ++jj )
+            M_elementalDOF[iElement * nbFEDof + iDof] = M_feSpacePtr->dof().localToGlobalMap ( M_feSpacePtr->fe().currentLocalId(), iDof );
+
+            for ( UInt jDof (0); jDof < nbFEDof; ++jDof )
             {
-                // Update the elemental matrices
-                updateElementalMatrices ( M_dFdUVector[ 2 * ii + jj ] ( iElement ), M_dSdUVector[ 2 * ii + jj ] ( iElement ) );
+                const UInt index ( iElement * elementalMatrixSize + iDof * nbFEDof + jDof );
 
-                // Assemble the global matrices
-                matrixAssemble ( ii, jj );
+                M_unitaryMassMatrices[index]       = M_elementalMassMatrixPtr->block ( 0, 0 ) ( iDof, jDof );
+                M_unitaryStiffnessMatrices[index]  = M_elementalStiffnessMatrixPtr->block ( 0, 0 ) ( iDof, jDof );
+                M_unitaryGradientMatrices[index]   = M_elementalGradientMatrixPtr->block ( 0, 0 ) ( iDof, jDof );
+                M_unitaryDivergenceMatrices[index] = M_elementalDivergenceMatrixPtr->block ( 0, 0 ) ( iDof, jDof );
             }
         }
     }
 }
 
 void
-OneDFSISolver::updateElementalMatrices ( const Real& dFdU, const Real& dSdU )
-{
-    // Set the elementary matrices to 0.
-    M_elementalMassMatrixPtr->zero();
-    M_elementalStiffnessMatrixPtr->zero();
-    M_elementalGradientMatrixPtr->zero();
-    M_elementalDivergenceMatrixPtr->zero();
-
-    // Update the mass matrix
-    AssemblyElemental::mass ( dSdU, *M_elementalMassMatrixPtr, M_feSpacePtr->fe(), 0, 0 );
-    //    std::cout << "Elem Stiff matrix :" << std::endl;
-    //    M_elementalMassMatrixPtr->showMe( std::cout );
-
-    // Update the stiffness matrix
-    AssemblyElemental::stiff ( dFdU, *M_elementalStiffnessMatrixPtr, M_feSpacePtr->fe(), 0 , 0 );
-    //AssemblyElemental::stiffness( *M_elementalStiffnessMatrixPtr, M_feSpacePtr->fe(), M_coeffStiff, 0 );
-    //    std::cout << "Elem Stiff matrix :" << std::endl;
-    //    M_elementalStiffnessMatrixPtr->showMe( std::cout );
-
-    /*! Update the gradient matrix
-      gradient operator:
-      grad_{ij} = \int_{fe} coeff \phi_j \frac{d \phi_i}{d x}
-
-      BEWARE :
-      \param 0: the first argument "0" corresponds to the first
-      and only coordinate (1D!), and HERE it starts from 0... (Damm'!)
-
-      \param - M_coeffGrad: the sign "-" in the second argument
-      is added to correspond to the described operator.
-      (There is a minus in the elemOper implementation).
-    */
-    AssemblyElemental::grad ( 0, -dFdU, *M_elementalGradientMatrixPtr, M_feSpacePtr->fe(), M_feSpacePtr->fe(), 0, 0 );
-    //    std::cout << "Elem Grad matrix :" << std::endl;
-    //    M_elementalGradientMatrixPtr->showMe( std::cout );
-
-    /*! update the divergence matrix
-      divergence operator: (transpose of the gradient)
-      div_{ij} = \int_{fe} coeff \frac{d \phi_j}{d x} \phi_i
-
-      \note formally this M_elementalDivergenceMatrixPtr is not necessary
-      as it is the transpose of the M_elementalGradientMatrixPtr.
-      But for the sake of clarity, I prefer to keep it. (low cost!)
-
-      BEWARE : same remarks as grad (see above).
-    */
-    AssemblyElemental::div ( 0, -dSdU, *M_elementalDivergenceMatrixPtr, M_feSpacePtr->fe(), M_feSpacePtr->fe(), 0, 0 );
-    //    std::cout << "Elem Div matrix :" << std::endl;
-    //    M_elementalDivergenceMatrixPtr->showMe( std::cout );
-}
-
-void
-OneDFSISolver::matrixAssemble ( const UInt& ii, const UInt& jj )
+OneDFSISolver::updateNonLinearResidual ( const Real& dt2over2 )
 {
-    // Assemble the mass matrix
-    assembleMatrix ( *M_dSdUMassMatrixPtr[ 2 * ii + jj ], *M_elementalMassMatrixPtr, M_feSpacePtr->fe(), M_feSpacePtr->dof(), 0, 0, 0, 0 );
+    const UInt numberOfNodes ( M_physicsPtr->data()->numberOfNodes() );
+    const UInt numberOfElements ( M_physicsPtr->data()->numberOfElements() );
+    const UInt nbFEDof ( M_feSpacePtr->fe().nbFEDof() );
+    const UInt elementalMatrixSize ( nbFEDof * nbFEDof );
+
+    // Nodal values of the flux and of the source term
+    std::vector< Real > flux ( 2 * numberOfNodes );
+    std::vector< Real > source ( 2 * numberOfNodes );
+    for ( UInt iNode (0); iNode < numberOfNodes; ++iNode )
+    {
+        for ( UInt j (0); j < 2; ++j )
+        {
+            flux[j * numberOfNodes + iNode]   = ( *M_fluxVector[j] ) ( iNode );
+            source[j * numberOfNodes + iNode] = ( *M_sourceVector[j] ) ( iNode );
+        }
+    }
 
-    // Assemble the stiffness matrix
-    assembleMatrix ( *M_dFdUStiffnessMatrixPtr[ 2 * ii + jj ], *M_elementalStiffnessMatrixPtr, M_feSpacePtr->fe(), M_feSpacePtr->dof(), 0, 0, 0, 0 );
+    // Matrix-free application of the P0-weighted elemental operators
+    std::vector< Real > residual ( 2 * numberOfNodes, 0. );
+    for ( UInt iElement (0); iElement < numberOfElements; ++iElement )
+    {
+        const UInt* dof ( &M_elementalDOF[iElement * nbFEDof] );
+        const Real* mass ( &M_unitaryMassMatrices[iElement * elementalMatrixSize] );
+        const Real* stiffness ( &M_unitaryStiffnessMatrices[iElement * elementalMatrixSize] );
+        const Real* gradient ( &M_unitaryGradientMatrices[iElement * elementalMatrixSize] );
+        const Real* divergence ( &M_unitaryDivergenceMatrices[iElement * elementalMatrixSize] );
 
-    // Assemble the gradient matrix
-    assembleMatrix ( *M_dFdUGradientMatrixPtr[ 2 * ii + jj ], *M_elementalGradientMatrixPtr, M_feSpacePtr->fe(), M_feSpacePtr->dof(), 0, 0, 0, 0 );
+        for ( UInt i (0); i < 2; ++i )
+        {
+            for ( UInt j (0); j < 2; ++j )
+            {
+                const Real dFdU ( M_dFdUVector[ 2 * i + j ] ( iElement ) );
+                const Real dSdU ( M_dSdUVector[ 2 * i + j ] ( iElement ) );
+
+                // Coefficients of the operators (the gradient and the divergence are defined with a minus sign)
+                const Real gradientCoefficient   ( dt2over2 * dFdU );  // - dt^2/2 * ( -dFdU ) * grad
+                const Real divergenceCoefficient ( -dt2over2 * dSdU ); //   dt^2/2 * ( -dSdU ) * div
+                const Real stiffnessCoefficient  ( -dt2over2 * dFdU ); // - dt^2/2 * dFdU * stiff
+                const Real massCoefficient       ( dt2over2 * dSdU );  //   dt^2/2 * dSdU * mass
+
+                const Real* fluxJ ( &flux[j * numberOfNodes] );
+                const Real* sourceJ ( &source[j * numberOfNodes] );
+                Real* residualI ( &residual[i * numberOfNodes] );
+
+                for ( UInt iDof (0); iDof < nbFEDof; ++iDof )
+                {
+                    Real value (0);
+                    for ( UInt jDof (0); jDof < nbFEDof; ++jDof )
+                    {
+                        const UInt index ( iDof * nbFEDof + jDof );
+
+                        value += ( gradientCoefficient * gradient[index] + massCoefficient * mass[index] ) * sourceJ[dof[jDof]]
+                                 + ( divergenceCoefficient * divergence[index] + stiffnessCoefficient * stiffness[index] ) * fluxJ[dof[jDof]];
+                    }
+                    residualI[dof[iDof]] += value;
+                }
+            }
+        }
+    }
 
-    // Assemble the divergence matrix
-    assembleMatrix ( *M_dSdUDivergenceMatrixPtr[ 2 * ii + jj ], *M_elementalDivergenceMatrixPtr, M_feSpacePtr->fe(), M_feSpacePtr->dof(), 0, 0, 0, 0 );
+    for ( UInt iNode (0); iNode < numberOfNodes; ++iNode )
+    {
+        ( *M_residual[0] ) ( iNode ) = residual[iNode];
+        ( *M_residual[1] ) ( iNode ) = residual[numberOfNodes + iNode];
+    }
 }
 
 void
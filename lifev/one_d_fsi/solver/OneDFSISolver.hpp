@@ -136,15 +136,12 @@ namespace LifeV
  *  </ol>
  *
  *  <b>DEVELOPMENT NOTES:</b> <BR>
- *  The option taken here is to define the different tridiagonal matrix
- *  operators (div, grad, mass, stiff) and reconstruct them at each time
- *  step (as they depend on diffFlux and diffSrc). They are thus rebuilt
- *  at the element level and reassembled.
- *  Afterwards, there remains to do only some tridiagonal matrix vector
- *  products to obtain the right hand side. This procedure might appear a bit memory consuming (there are 18
- *  tridiagonal matrices stored), but it has the advantage of being
- *  very clear. If it is too costly, it should be quite easy to improve
- *  it.
+ *  The different operators (div, grad, mass, stiff) depend on diffFlux and diffSrc,
+ *  which are constant on each element. The elemental matrices with unitary coefficients
+ *  are therefore computed only once and stored in contiguous arrays; at each time step
+ *  the non-linear terms of the right hand side are obtained by applying them element by element,
+ *  without assembling any global matrix.
+ *  Only the constant mass and gradient matrices are assembled in global (tridiagonal) matrices.
  */
 class OneDFSISolver
 {
@@ -503,32 +500,29 @@ private:
      */
     void updatedSdU ( const solution_Type& solution );
 
-    //! Update the matrices
+    //! Build the elemental matrices with unitary coefficients
+    /*!
+     *  The mass, stiffness, gradient, and divergence elemental matrices are
+     *  stored, together with the global DOF of each element, in contiguous arrays.
+     *  Since the non-linear operators are obtained by multiplying them by the P0
+     *  coefficients diffFlux(Un) and diffSrc(Un), they need to be computed only once.
+     */
+    void buildElementalMatrices();
+
+    //! Update the residual with the second order terms of the Taylor-Galerkin scheme
     /*!
      *  \cond \TODO improve doxygen description with latex equation, input/output parameter, etc... \endcond
      *
-     *  M_massMatrixDiffSrcij, M_stiffMatrixDiffFluxij
-     *  M_gradMatrixDiffFluxij, and M_divMatrixDiffSrcij (i,j=1,2)
+     *  M_residuali = - dt^2/2 * gradDiffFlux * S(Un) + dt^2/2 * divDiffSrc * F(Un)
+     *                - dt^2/2 * stiffDiffFlux * F(Un) + dt^2/2 * massDiffSrc * S(Un)
      *
-     *  from the values of diffFlux(Un) and diffSrc(Un)
-     *  that are computed with _updateMatrixCoefficients.
+     *  The operators are applied element by element (matrix-free) using the elemental
+     *  matrices computed by buildElementalMatrices() and the values of diffFlux(Un)
+     *  and diffSrc(Un) computed by updatedFdU() and updatedSdU().
      *
-     *  call of  _updateMatrixCoefficients,
-     *  _updateMatrixElementalrices and _assemble_matrices.
-     */
-    void updateMatrices();
-
-    //! Update the element matrices with the current element
-    /*!
-     * \cond \TODO improve doxygen description with latex equation, input/output parameter, etc... \endcond
+     *  @param dt2over2 half of the square of the time step
      */
-    void updateElementalMatrices ( const Real& dFdU, const Real& dSdU );
-
-    //! Assemble the matrices
-    /*!
-     * \cond \TODO improve doxygen description with latex equation, input/output parameter, etc... \endcond
-     */
-    void matrixAssemble ( const UInt& ii, const UInt& jj );
+    void updateNonLinearResidual ( const Real& dt2over2 );
 
     //! Update the matrices to take into account Dirichlet BC.
     /*!
@@ -605,17 +599,20 @@ private:
     //! tridiagonal gradient matrix
     matrixPtr_Type                     M_homogeneousGradientMatrixPtr;
 
-    //! tridiagonal mass matrices multiplied by diffSrcij
-    matrixPtrContainer_Type            M_dSdUMassMatrixPtr;
+    //! global DOF of the elements (nbFEDof entries per element)
+    std::vector< UInt >                M_elementalDOF;
+
+    //! elemental mass matrices with unitary coefficient (row-major, nbFEDof^2 entries per element)
+    std::vector< Real >                M_unitaryMassMatrices;
 
-    //! tridiagonal stiffness matrices multiplied by diffFluxij
-    matrixPtrContainer_Type            M_dFdUStiffnessMatrixPtr;
+    //! elemental stiffness matrices with unitary coefficient
+    std::vector< Real >                M_unitaryStiffnessMatrices;
 
-    //! tridiagonal gradient matrices multiplied by diffFluxij
-    matrixPtrContainer_Type            M_dFdUGradientMatrixPtr;
+    //! elemental gradient matrices with unitary coefficient
+    std::vector< Real >                M_unitaryGradientMatrices;
 
-    //! tridiagonal divergence matrices multiplied by diffSrcij
-    matrixPtrContainer_Type            M_dSdUDivergenceMatrixPtr;
+    //! elemental divergence matrices with unitary coefficient
+    std::vector< Real >                M_unitaryDivergenceMatrices;
 
     //! The linear solver
     linearSolverPtr_Type               M_linearSolverPtr;
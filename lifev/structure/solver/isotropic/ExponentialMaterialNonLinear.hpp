@@ -469,86 +469,36 @@ void ExponentialMaterialNonLinear<MeshType>::updateNonLinearJacobianTerms ( matr
     // Definition I_C
     traceTensor_Type I_C = ExpressionDefinitions::traceTensor( C );
 
-    //Assembling Volumetric Part
+    // All the terms are assembled in a single sweep over the mesh (see
+    // NeoHookeanMaterialNonLinear). Ic_iso = J^(-2/3) Ic.
+    //
+    //! VOLUMETRIC PART (bulk)
+    //! 1. int { 1/2 * bulk * ( 2 J^2 - J + 1 ) ( F^-T : \nabla \delta ) ( F^-T : \nabla \v ) }
+    //! 2. int { -1/2 * bulk * ( J^2 - J + ln(J) ) ( F^-T [\nabla \delta]^t F^-T ) : \nabla \v }
+    //!
+    //! ISOCHORIC PART (alpha * J^(-2/3) * exp( gamma*( Ic_iso - 3) ))
+    //! 1. int { -2/3 * ( 1. + gamma * Ic_iso ) *
+    //!          [ ( F^-T : \nabla \delta ) ( F : \nabla \v ) + ( F : \nabla \delta ) ( F^-T : \nabla \v ) ] }
+    //! 2. int { 2 * gamma * J^(-2/3) ( F : \nabla \delta ) ( F : \nabla \v ) }
+    //! 3. int { 2/9 * Ic ( 1. + gamma * Ic_iso ) ( F^-T : \nabla \delta ) ( F^-T : \nabla \v ) }
+    //! 4. int { \nabla \delta : \nabla \v }
+    //! 5. int { 1/3 * Ic ( F^-T [\nabla \delta]^t F^-T ) : \nabla \v }
     integrate ( elements ( this->M_dispETFESpace->mesh() ),
                 this->M_dispFESpace->qr(),
                 this->M_dispETFESpace,
                 this->M_dispETFESpace,
-                value ( 1.0 / 2.0 ) * parameter ( (* (this->M_vectorsParameters) ) [2] ) * ( value (2.0) *pow (J, 2.0) - J + value (1.0) ) * dot ( F_T, grad (phi_j) ) * dot ( F_T, grad (phi_i) )
-              ) >> jacobian;
-
-    integrate ( elements ( this->M_dispETFESpace->mesh() ),
-                this->M_dispFESpace->qr(),
-                this->M_dispETFESpace,
-                this->M_dispETFESpace,
-                value ( -1.0 / 2.0 ) * parameter ( (* (this->M_vectorsParameters) ) [2] ) * ( pow (J, 2.0) - J + log (J) ) * dot ( F_T * transpose (grad (phi_j) ) * F_T,  grad (phi_i) )
-              ) >> jacobian;
-
-    // //Assembling the Isochoric Part
-    // //! 1. Stiffness matrix : int { - 2/3 * alpha * J^(-2/3) * exp( gamma*( Ic_iso - 3) )* ( 1. + coefExp * Ic_iso )
-    // //!                      *( F^-T : \nabla \delta ) ( F : \nabla \v ) }
-    integrate ( elements ( this->M_dispETFESpace->mesh() ),
-                this->M_dispFESpace->qr(),
-                this->M_dispETFESpace,
-                this->M_dispETFESpace,
-                value (-2.0 / 3.0) * parameter ( (* (this->M_vectorsParameters) ) [0]) *
-                pow (J, -2.0 / 3.0) * exp ( parameter ( (* (this->M_vectorsParameters) ) [1] ) * ( pow( J, -(2.0/3.0) ) * I_C - value (3.0) ) ) *
-                ( value (1.0) + parameter ( (* (this->M_vectorsParameters) ) [1]) * pow( J, -(2.0/3.0) ) * I_C ) *
-                dot ( F_T, grad (phi_j) ) * dot ( F, grad (phi_i) )
-              ) >> jacobian;
-
-    //! 2. Stiffness matrix : int { 2 * alpha * gamma * J^(-4/3) * exp( gamma*( Ic_iso - 3) ) *
-    //!             ( F : \nabla \delta ) ( F : \nabla \v ) }
-    integrate ( elements ( this->M_dispETFESpace->mesh() ),
-                this->M_dispFESpace->qr(),
-                this->M_dispETFESpace,
-                this->M_dispETFESpace,
-                value (2.0) * parameter ( (* (this->M_vectorsParameters) ) [0] ) * parameter ( (* (this->M_vectorsParameters) ) [1]) * pow (J, -4.0 / 3.0) * exp ( parameter ( (* (this->M_vectorsParameters) ) [1] ) * ( pow( J, -(2.0/3.0) ) * I_C - value (3.0) ) ) *
-                dot ( F, grad (phi_j) ) * dot ( F, grad (phi_i) )
-              ) >> jacobian;
-
-    // //! 3. Stiffness matrix : int { 2.0/9.0 *  alpha *  Ic_iso * exp( gamma*( Ic_iso - 3) )*
-    // //!                       ( 1. + gamma * Ic_iso )( F^-T : \nabla \delta ) ( F^-T : \nabla \v )}
-    integrate ( elements ( this->M_dispETFESpace->mesh() ) ,
-                this->M_dispFESpace->qr(),
-                this->M_dispETFESpace,
-                this->M_dispETFESpace,
-                value (2.0 / 9.0) * parameter ( (* (this->M_vectorsParameters) ) [0]) * ( pow( J, -(2.0/3.0) ) * I_C )  * exp ( parameter ( (* (this->M_vectorsParameters) ) [1]) * ( pow( J, (-2.0/3.0) ) * I_C  - value (3.0) ) ) * ( value (1.0) + parameter ( (* (this->M_vectorsParameters) ) [1]) * pow( J, (-2.0/3.0) ) * I_C ) *
-                dot ( F_T, grad (phi_j) ) * dot ( F_T, grad (phi_i) )
-              ) >> jacobian;
-
-    // //! 4. Stiffness matrix : int { -2.0/3.0 *  alpha * J^(-2/3) * exp( gamma*( Ic_iso - 3) )
-    // //!                    * ( 1. + gamma * Ic_iso )( deformationGradientTensor : \nabla \delta ) ( F^-T : \nabla \v ) }
-    integrate ( elements ( this->M_dispETFESpace->mesh() ),
-                this->M_dispFESpace->qr(),
-                this->M_dispETFESpace,
-                this->M_dispETFESpace,
-                value (-2.0 / 3.0) * parameter ( (* (this->M_vectorsParameters) ) [0]) * pow (J, -2.0 / 3.0) * exp ( parameter ( (* (this->M_vectorsParameters) ) [1] ) * ( pow( J, (-2.0/3.0) ) * I_C - value (3.0) ) ) *
-                ( value (1.0) + parameter ( (* (this->M_vectorsParameters) ) [1]) * pow( J, (-2.0/3.0) ) * I_C ) *
-                dot ( F, grad (phi_j) ) * dot ( F_T, grad (phi_i) )
-              ) >> jacobian;
-
-
-    // //! 5. Stiffness matrix : int {  alpha * J^(-2/3) * exp( gamma*( Ic_iso - 3)) (\nabla \delta: \nabla \v)}
-    integrate ( elements ( this->M_dispETFESpace->mesh() ),
-                this->M_dispFESpace->qr(),
-                this->M_dispETFESpace,
-                this->M_dispETFESpace,
-                parameter ( (* (this->M_vectorsParameters) ) [0]) * pow (J, -2.0 / 3.0) *
-                exp ( parameter ( (* (this->M_vectorsParameters) ) [1] ) * ( pow( J, (-2.0/3.0) ) * I_C - value (3.0) ) ) *
-                dot ( grad (phi_j), grad (phi_i) )
-              ) >> jacobian;
-
-
-    // //! 6. Stiffness matrix : int { 1.0/3.0 * alpha * Ic_iso *  exp(gamma*( Ic_iso - 3)) *
-    // //!                       (F^-T [\nabla \delta]^t F^-T ) : \nabla \v  }
-    integrate ( elements ( this->M_dispETFESpace->mesh() ),
-                this->M_dispFESpace->qr(),
-                this->M_dispETFESpace,
-                this->M_dispETFESpace,
-                value (1.0 / 3.0) * parameter ( (* (this->M_vectorsParameters) ) [0]) * pow(J, (-2.0/3.0) ) * I_C *
-                exp ( parameter ( (* (this->M_vectorsParameters) ) [1] ) * ( pow(J, (-2.0/3.0) ) * I_C  - value (3.0) ) ) *
-                dot ( F_T * transpose (grad (phi_j) ) * F_T , grad (phi_i) )
+                parameter ( (* (this->M_vectorsParameters) ) [2] ) *
+                ( value ( 1.0 / 2.0 ) * ( value (2.0) * pow (J, 2.0) - J + value (1.0) ) * dot ( F_T, grad (phi_j) ) * dot ( F_T, grad (phi_i) )
+                  + value ( -1.0 / 2.0 ) * ( pow (J, 2.0) - J + log (J) ) * dot ( F_T * transpose (grad (phi_j) ) * F_T,  grad (phi_i) ) )
+                + parameter ( (* (this->M_vectorsParameters) ) [0] ) * pow (J, -2.0 / 3.0) *
+                exp ( parameter ( (* (this->M_vectorsParameters) ) [1] ) * ( pow ( J, -(2.0 / 3.0) ) * I_C - value (3.0) ) ) *
+                ( value (-2.0 / 3.0) * ( value (1.0) + parameter ( (* (this->M_vectorsParameters) ) [1]) * pow ( J, -(2.0 / 3.0) ) * I_C ) *
+                  ( dot ( F_T, grad (phi_j) ) * dot ( F, grad (phi_i) ) + dot ( F, grad (phi_j) ) * dot ( F_T, grad (phi_i) ) )
+                  + value (2.0) * parameter ( (* (this->M_vectorsParameters) ) [1]) * pow (J, -2.0 / 3.0) * dot ( F, grad (phi_j) ) * dot ( F, grad (phi_i) )
+                  + value (2.0 / 9.0) * I_C * ( value (1.0) + parameter ( (* (this->M_vectorsParameters) ) [1]) * pow ( J, -(2.0 / 3.0) ) * I_C ) *
+                  dot ( F_T, grad (phi_j) ) * dot ( F_T, grad (phi_i) )
+                  + dot ( grad (phi_j), grad (phi_i) )
+                  + value (1.0 / 3.0) * I_C * dot ( F_T * transpose (grad (phi_j) ) * F_T , grad (phi_i) ) )
               ) >> jacobian;
 
 
@@ -624,18 +574,12 @@ void ExponentialMaterialNonLinear<MeshType>::computeStiffness ( const vector_Typ
     // Definition I_C
     traceTensor_Type I_C = ExpressionDefinitions::traceTensor( C );
 
-    //Computation of the volumetric part
+    //Computation of the volumetric and of the isochoric part in a single sweep
     integrate ( elements ( this->M_dispETFESpace->mesh() ) ,
                 this->M_dispFESpace->qr(),
                 this->M_dispETFESpace,
                 value (1.0 / 2.0) * parameter ( (* (this->M_vectorsParameters) ) [2] ) * ( pow ( J , 2.0) - J + log (J) ) * dot (  F_T, grad (phi_i) )
-              ) >> M_stiff;
-
-    //Computation of the isochoric part
-    integrate ( elements ( this->M_dispETFESpace->mesh() ) ,
-                this->M_dispFESpace->qr(),
-                this->M_dispETFESpace,
-                parameter ( (* (this->M_vectorsParameters) ) [0] ) * pow (J, -2.0 / 3.0) *
+                + parameter ( (* (this->M_vectorsParameters) ) [0] ) * pow (J, -2.0 / 3.0) *
                 exp ( parameter ( (* (this->M_vectorsParameters) ) [1] ) * ( pow (J, -2.0 / 3.0) * I_C  - value (3.0) ) )  *
                 (dot ( F - value (1.0 / 3.0) * I_C * F_T, grad (phi_i) ) )
               ) >> M_stiff;
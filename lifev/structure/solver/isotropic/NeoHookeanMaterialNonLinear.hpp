@@ -438,67 +438,31 @@ void NeoHookeanMaterialNonLinear<MeshType>::updateNonLinearJacobianTerms ( matri
     // Definition of tr( C )
     traceTensor_Type I_C = ExpressionDefinitions::traceTensor( C );
 
-    //Assembling Volumetric Part
-    integrate ( elements ( this->M_dispETFESpace->mesh() ) ,
-                this->M_dispFESpace->qr(),
-                this->M_dispETFESpace,
-                this->M_dispETFESpace,
-                value ( 1.0 / 2.0 ) * parameter ( (* (this->M_vectorsParameters) ) [1] ) * ( value (2.0) *pow (J, 2.0) - J + value (1.0) ) * dot ( F_T, grad (phi_j) ) * dot ( F_T, grad (phi_i) )
-              ) >> jacobian;
-
-    integrate ( elements ( this->M_dispETFESpace->mesh() ) ,
-                this->M_dispFESpace->qr(),
-                this->M_dispETFESpace,
-                this->M_dispETFESpace,
-                value ( - 1.0 / 2.0 ) * parameter ( (* (this->M_vectorsParameters) ) [1] ) * ( pow (J, 2.0) - J + log (J) ) * dot ( F_T * transpose (grad (phi_j) ) * F_T,  grad (phi_i) )
-              ) >> jacobian;
-
-
-    //! ISOCHORIC PART
-    //! 1. Stiffness matrix : int { -2/3 * mu * J^(-2/3) *( F^-T : \nabla \delta ) ( F : \nabla \v ) }
-    integrate ( elements ( this->M_dispETFESpace->mesh() ) ,
-                this->M_dispFESpace->qr(),
-                this->M_dispETFESpace,
-                this->M_dispETFESpace,
-                value (-2.0 / 3.0) * parameter ( (* (this->M_vectorsParameters) ) [0] ) * pow (J, - (2.0 / 3.0) )  * dot ( F_T , grad (phi_j) ) * dot ( F , grad (phi_i) )
-              ) >> jacobian;
-
-
-    //! 2. Stiffness matrix : int { 2/9 * mu * ( Ic_iso )( F^-T : \nabla \delta ) ( F^-T : \nabla \v ) }
-    integrate ( elements ( this->M_dispETFESpace->mesh() ) ,
-                this->M_dispFESpace->qr(),
-                this->M_dispETFESpace,
-                this->M_dispETFESpace,
-                value (2.0 / 9.0) * parameter ( (* (this->M_vectorsParameters) ) [0] ) *
-                pow( J, (-2.0/3.0) ) * I_C  * dot ( F_T , grad (phi_j) ) * dot ( F_T , grad (phi_i) )
-              ) >> jacobian;
-
-    //! 3. Stiffness matrix : int { mu * J^(-2/3) (\nabla \delta : \nabla \v)}
+    // All the terms are assembled in a single sweep over the mesh: the terms sharing
+    // the same test/trial structure are grouped, so that the elemental matrix is
+    // computed and inserted in the global jacobian only once per element.
+    //
+    //! VOLUMETRIC PART (bulk)
+    //! 1. int { 1/2 * bulk * ( 2 J^2 - J + 1 ) ( F^-T : \nabla \delta ) ( F^-T : \nabla \v ) }
+    //! 2. int { -1/2 * bulk * ( J^2 - J + ln(J) ) ( F^-T [\nabla \delta]^t F^-T ) : \nabla \v }
+    //!
+    //! ISOCHORIC PART (mu * J^(-2/3))
+    //! 1. int { 2/9 * Ic ( F^-T : \nabla \delta ) ( F^-T : \nabla \v ) }
+    //! 2. int { 1/3 * Ic ( F^-T [\nabla \delta]^t F^-T ) : \nabla \v }
+    //! 3. int { -2/3 * [ ( F^-T : \nabla \delta ) ( F : \nabla \v ) + ( F : \nabla \delta ) ( F^-T : \nabla \v ) ] }
+    //! 4. int { \nabla \delta : \nabla \v }
     integrate ( elements ( this->M_dispETFESpace->mesh() ) ,
                 this->M_dispFESpace->qr(),
                 this->M_dispETFESpace,
                 this->M_dispETFESpace,
-                parameter ( (* (this->M_vectorsParameters) ) [0] ) * pow (J, - (2.0 / 3.0) )  * dot ( grad (phi_j), grad (phi_i) )
-              ) >> jacobian;
-
-    //! 4. Stiffness matrix : int { -2/3 * mu * J^(-2/3) ( F : \nabla \delta ) ( F^-T : \nabla \v ) }
-    integrate ( elements ( this->M_dispETFESpace->mesh() ),
-                this->M_dispFESpace->qr(),
-                this->M_dispETFESpace,
-                this->M_dispETFESpace,
-                value (-2.0 / 3.0) * parameter ( (* (this->M_vectorsParameters) ) [0] ) *
-                pow (J, - (2.0 / 3.0) )  * dot ( F , grad (phi_j) ) * dot ( F_T , grad (phi_i) )
-              ) >> jacobian;
-
-
-
-    //! 5. Stiffness matrix : int { 1/3 * mu * Ic_iso * (F^-T [\nabla \delta]^t F^-T ) : \nabla \v }
-    integrate ( elements ( this->M_dispETFESpace->mesh() ),
-                this->M_dispFESpace->qr(),
-                this->M_dispETFESpace,
-                this->M_dispETFESpace,
-                value (1.0 / 3.0) * parameter ( (* (this->M_vectorsParameters) ) [0] ) *
-                pow( J, -2.0/3.0) * I_C  * dot ( ( F_T * transpose (grad (phi_j) ) * F_T ), grad (phi_i) )
+                parameter ( (* (this->M_vectorsParameters) ) [1] ) *
+                ( value ( 1.0 / 2.0 ) * ( value (2.0) * pow (J, 2.0) - J + value (1.0) ) * dot ( F_T, grad (phi_j) ) * dot ( F_T, grad (phi_i) )
+                  + value ( - 1.0 / 2.0 ) * ( pow (J, 2.0) - J + log (J) ) * dot ( F_T * transpose (grad (phi_j) ) * F_T,  grad (phi_i) ) )
+                + parameter ( (* (this->M_vectorsParameters) ) [0] ) * pow (J, - (2.0 / 3.0) ) *
+                ( value (2.0 / 9.0) * I_C * dot ( F_T , grad (phi_j) ) * dot ( F_T , grad (phi_i) )
+                  + value (1.0 / 3.0) * I_C * dot ( F_T * transpose (grad (phi_j) ) * F_T, grad (phi_i) )
+                  + value (-2.0 / 3.0) * ( dot ( F_T , grad (phi_j) ) * dot ( F , grad (phi_i) ) + dot ( F , grad (phi_j) ) * dot ( F_T , grad (phi_i) ) )
+                  + dot ( grad (phi_j), grad (phi_i) ) )
               ) >> jacobian;
 
     //    }
@@ -574,19 +538,12 @@ void NeoHookeanMaterialNonLinear<MeshType>::computeStiffness ( const vector_Type
     // Definition of tr( C )
     traceTensor_Type I_C = ExpressionDefinitions::traceTensor( C );
 
-    //Computation of the volumetric part
-    //
+    //Computation of the volumetric and of the isochoric part in a single sweep
     integrate ( elements ( this->M_dispETFESpace->mesh() ),
                 this->M_dispFESpace->qr(),
                 this->M_dispETFESpace,
                 value (1.0 / 2.0) * parameter ( (* (this->M_vectorsParameters) ) [1] ) * ( pow ( J , 2.0) - J + log (J) ) * dot (  F_T, grad (phi_i) )
-              ) >> M_stiff;
-
-    //Computation of the isochoric part
-    integrate ( elements ( this->M_dispETFESpace->mesh() ),
-                this->M_dispFESpace->qr(),
-                this->M_dispETFESpace,
-                parameter ( (* (this->M_vectorsParameters) ) [0] ) * pow (J, -2.0 / 3.0) * (dot ( F - value (1.0 / 3.0) * I_C * F_T, grad (phi_i) ) )
+                + parameter ( (* (this->M_vectorsParameters) ) [0] ) * pow (J, -2.0 / 3.0) * (dot ( F - value (1.0 / 3.0) * I_C * F_T, grad (phi_i) ) )
               ) >> M_stiff;
 
     //    }
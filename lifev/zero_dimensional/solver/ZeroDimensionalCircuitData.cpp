@@ -994,8 +994,8 @@ void ZeroDimensionalCircuitData::updateABC ( matrix_Type& A,
                                              matrix_Type& B,
                                              vector_Type& C )
 {
-    A.openCrsMatrix();
-    B.openCrsMatrix();
+    // If A and B have been built with buildABCPattern() their structure is already closed
+    // and the contributions of the elements are summed into it.
     A.matrixPtr()->PutScalar ( 0.0 );
     B.matrixPtr()->PutScalar ( 0.0 );
     C.epetraVector().PutScalar ( 0.0 );
@@ -1012,6 +1012,22 @@ void ZeroDimensionalCircuitData::updateABC ( matrix_Type& A,
     B.globalAssemble();
 }
 
+void ZeroDimensionalCircuitData::buildABCPattern ( matrix_Type& pattern,
+                                                   vector_Type& C )
+{
+    const ptrVecZeroDimensionalElementPtr_Type& elementList = M_Elements->elementList();
+
+    //iterate over all elements and insert both A and B contributions in the same matrix
+    for ( iterZeroDimensionalElement_Type theElement = elementList ->begin(); theElement != elementList->end(); theElement++ )
+    {
+        ( *theElement )->buildABC ( pattern, pattern, C, M_Nodes );
+    }
+
+    // The global assemble adds also the diagonal
+    pattern.globalAssemble();
+    C.epetraVector().PutScalar ( 0.0 );
+}
+
 
 OutPutFormat::OutPutFormat ( std::string width,
                              std::string precision,
@@ -1380,6 +1380,14 @@ public:
      */
     void updateABC (matrix_Type& A, matrix_Type& B, vector_Type& C);
 
+    //! create the sparsity pattern of the circuit.
+    /*!
+     * The pattern is the union of the patterns of A and B, which depend only on the topology of the circuit.
+     * The values inserted in the matrix are meaningless: the matrix is meant to be used as a template
+     * for A, B, and the jacobian, so that updateABC() can sum into a fixed structure.
+     */
+    void buildABCPattern (matrix_Type& pattern, vector_Type& C);
+
 
     //! (deep) update the circuit data from solution.
     /*!
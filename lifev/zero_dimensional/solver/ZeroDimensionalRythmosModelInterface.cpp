@@ -58,25 +58,15 @@ RythmosModelInterface::RythmosModelInterface ( Int numCircuitElements,
                                            M_commSharedPtr ) );
     M_standardMap = ( M_mapEpetraPtr->map ( Unique ) ).get();
     M_numMyElements = M_standardMap->NumMyElements();
-    M_A.reset ( new matrix_Type ( *M_mapEpetraPtr,
-                                  M_numCircuitElements ) );
-    M_B.reset ( new matrix_Type ( *M_mapEpetraPtr,
-                                  M_numCircuitElements ) );
+    M_C.reset ( new vector_Type ( *M_mapEpetraPtr ) );
 
-    for ( Int i = 0; i < M_numCircuitElements; i++ )
-    {
-        for ( Int j = 0; j < M_numCircuitElements; j++ )
-        {
-            M_A->addToCoefficient ( i, j, 1.0 );
-            M_B->addToCoefficient ( i, j, 1.0 );
-        }
-    }
-    M_A->globalAssemble();
-    M_B->globalAssemble();
+    // A, B, and the jacobian share the sparsity pattern of the circuit, which is built once
+    M_A.reset ( new matrix_Type ( *M_mapEpetraPtr ) );
+    M_circuitData->buildABCPattern ( *M_A, *M_C );
+    M_B.reset ( new matrix_Type ( *M_A ) );
 
     M_graph = new Epetra_CrsGraph ( M_A->matrixPtr()->Graph() );
     M_graphSharedPtr.reset ( M_graph );
-    M_C.reset ( new vector_Type ( *M_mapEpetraPtr ) );
 
     M_fA.reset ( new vectorEpetra_Type ( *M_standardMap ) );
     M_fB.reset ( new vectorEpetra_Type ( *M_standardMap ) );